@@ -0,0 +1,17 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_dist_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("libsupport")
+subdirs("libgalois")
+subdirs("libpygalois")
+subdirs("libdist")
+subdirs("libcusp")
+subdirs("libgluon")
+subdirs("libpangolin")
+subdirs("lonestar")
+subdirs("scripts")
+subdirs("inputs")
+subdirs("tools")
@@ -0,0 +1 @@
+file(DOWNLOAD http://iss.oden.utexas.edu/projects/galois/downloads/small_inputs_for_lonestar_test.tar.gz /root/repo/_dist_build/inputs/lonestar-cpu-inputs.tar.gz SHOW_PROGRESS)
\ No newline at end of file
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libdist/src/Barrier.cpp" "libdist/CMakeFiles/galois_dist_async.dir/src/Barrier.cpp.o" "gcc" "libdist/CMakeFiles/galois_dist_async.dir/src/Barrier.cpp.o.d"
+  "/root/repo/libdist/src/DistGalois.cpp" "libdist/CMakeFiles/galois_dist_async.dir/src/DistGalois.cpp.o" "gcc" "libdist/CMakeFiles/galois_dist_async.dir/src/DistGalois.cpp.o.d"
+  "/root/repo/libdist/src/DistStats.cpp" "libdist/CMakeFiles/galois_dist_async.dir/src/DistStats.cpp.o" "gcc" "libdist/CMakeFiles/galois_dist_async.dir/src/DistStats.cpp.o.d"
+  "/root/repo/libdist/src/Network.cpp" "libdist/CMakeFiles/galois_dist_async.dir/src/Network.cpp.o" "gcc" "libdist/CMakeFiles/galois_dist_async.dir/src/Network.cpp.o.d"
+  "/root/repo/libdist/src/NetworkBuffered.cpp" "libdist/CMakeFiles/galois_dist_async.dir/src/NetworkBuffered.cpp.o" "gcc" "libdist/CMakeFiles/galois_dist_async.dir/src/NetworkBuffered.cpp.o.d"
+  "/root/repo/libdist/src/NetworkIOMPI.cpp" "libdist/CMakeFiles/galois_dist_async.dir/src/NetworkIOMPI.cpp.o" "gcc" "libdist/CMakeFiles/galois_dist_async.dir/src/NetworkIOMPI.cpp.o.d"
+  "/root/repo/libdist/src/NetworkLCI.cpp" "libdist/CMakeFiles/galois_dist_async.dir/src/NetworkLCI.cpp.o" "gcc" "libdist/CMakeFiles/galois_dist_async.dir/src/NetworkLCI.cpp.o.d"
+  "/root/repo/libdist/src/NetworkSim.cpp" "libdist/CMakeFiles/galois_dist_async.dir/src/NetworkSim.cpp.o" "gcc" "libdist/CMakeFiles/galois_dist_async.dir/src/NetworkSim.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dist_build/libgalois/CMakeFiles/galois_shmem.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
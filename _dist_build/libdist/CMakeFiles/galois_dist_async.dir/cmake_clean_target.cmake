@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libgalois_dist_async.a"
+)
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-dist-network-sim.dir/network-sim.cpp.o"
+  "CMakeFiles/unit-dist-network-sim.dir/network-sim.cpp.o.d"
+  "unit-dist-network-sim"
+  "unit-dist-network-sim.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-dist-network-sim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
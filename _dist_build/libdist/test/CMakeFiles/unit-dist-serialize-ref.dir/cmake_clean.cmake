@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-dist-serialize-ref.dir/serialize-ref.cpp.o"
+  "CMakeFiles/unit-dist-serialize-ref.dir/serialize-ref.cpp.o.d"
+  "unit-dist-serialize-ref"
+  "unit-dist-serialize-ref.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-dist-serialize-ref.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
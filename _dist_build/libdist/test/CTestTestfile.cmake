@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libdist/test
+# Build directory: /root/repo/_dist_build/libdist/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(unit-dist-network-sim "/root/repo/_dist_build/libdist/test/unit-dist-network-sim")
+set_tests_properties(unit-dist-network-sim PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/libdist/test/CMakeLists.txt;7;add_test;/root/repo/libdist/test/CMakeLists.txt;16;add_dist_test_unit;/root/repo/libdist/test/CMakeLists.txt;0;")
+add_test(unit-dist-network-sim-drop "sh" "-c" "/root/repo/_dist_build/libdist/test/unit-dist-network-sim drop")
+set_tests_properties(unit-dist-network-sim-drop PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "deadlocked" _BACKTRACE_TRIPLES "/root/repo/libdist/test/CMakeLists.txt;19;add_test;/root/repo/libdist/test/CMakeLists.txt;0;")
+add_test(unit-dist-serialize-ref "/root/repo/_dist_build/libdist/test/unit-dist-serialize-ref")
+set_tests_properties(unit-dist-serialize-ref PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/libdist/test/CMakeLists.txt;7;add_test;/root/repo/libdist/test/CMakeLists.txt;28;add_dist_test_unit;/root/repo/libdist/test/CMakeLists.txt;0;")
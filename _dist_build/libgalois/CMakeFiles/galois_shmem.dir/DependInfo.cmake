@@ -0,0 +1,60 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_dist_build/libgalois/Version.cpp" "libgalois/CMakeFiles/galois_shmem.dir/Version.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/Version.cpp.o.d"
+  "/root/repo/libgalois/src/Barrier.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/Barrier.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/Barrier.cpp.o.d"
+  "/root/repo/libgalois/src/Barrier_Counting.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/Barrier_Counting.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/Barrier_Counting.cpp.o.d"
+  "/root/repo/libgalois/src/Barrier_Dissemination.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/Barrier_Dissemination.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/Barrier_Dissemination.cpp.o.d"
+  "/root/repo/libgalois/src/Barrier_MCS.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/Barrier_MCS.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/Barrier_MCS.cpp.o.d"
+  "/root/repo/libgalois/src/Barrier_Pthread.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/Barrier_Pthread.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/Barrier_Pthread.cpp.o.d"
+  "/root/repo/libgalois/src/Barrier_Simple.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/Barrier_Simple.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/Barrier_Simple.cpp.o.d"
+  "/root/repo/libgalois/src/Barrier_Topo.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/Barrier_Topo.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/Barrier_Topo.cpp.o.d"
+  "/root/repo/libgalois/src/Context.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/Context.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/Context.cpp.o.d"
+  "/root/repo/libgalois/src/Deterministic.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/Deterministic.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/Deterministic.cpp.o.d"
+  "/root/repo/libgalois/src/DynamicBitset.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/DynamicBitset.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/DynamicBitset.cpp.o.d"
+  "/root/repo/libgalois/src/EnvCheck.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/EnvCheck.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/EnvCheck.cpp.o.d"
+  "/root/repo/libgalois/src/FileGraph.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/FileGraph.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/FileGraph.cpp.o.d"
+  "/root/repo/libgalois/src/FileGraphParallel.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/FileGraphParallel.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/FileGraphParallel.cpp.o.d"
+  "/root/repo/libgalois/src/GraphHelpers.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/GraphHelpers.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/GraphHelpers.cpp.o.d"
+  "/root/repo/libgalois/src/GraphMetadata.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/GraphMetadata.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/GraphMetadata.cpp.o.d"
+  "/root/repo/libgalois/src/HWTopo.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/HWTopo.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/HWTopo.cpp.o.d"
+  "/root/repo/libgalois/src/HWTopoLinux.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/HWTopoLinux.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/HWTopoLinux.cpp.o.d"
+  "/root/repo/libgalois/src/HypergraphIO.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/HypergraphIO.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/HypergraphIO.cpp.o.d"
+  "/root/repo/libgalois/src/Mem.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/Mem.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/Mem.cpp.o.d"
+  "/root/repo/libgalois/src/NumaMem.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/NumaMem.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/NumaMem.cpp.o.d"
+  "/root/repo/libgalois/src/OCFileGraph.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/OCFileGraph.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/OCFileGraph.cpp.o.d"
+  "/root/repo/libgalois/src/PageAlloc.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/PageAlloc.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/PageAlloc.cpp.o.d"
+  "/root/repo/libgalois/src/PagePool.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/PagePool.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/PagePool.cpp.o.d"
+  "/root/repo/libgalois/src/ParaMeter.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/ParaMeter.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/ParaMeter.cpp.o.d"
+  "/root/repo/libgalois/src/PerThreadStorage.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/PerThreadStorage.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/PerThreadStorage.cpp.o.d"
+  "/root/repo/libgalois/src/PreAlloc.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/PreAlloc.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/PreAlloc.cpp.o.d"
+  "/root/repo/libgalois/src/Profile.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/Profile.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/Profile.cpp.o.d"
+  "/root/repo/libgalois/src/PtrLock.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/PtrLock.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/PtrLock.cpp.o.d"
+  "/root/repo/libgalois/src/SharedMem.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/SharedMem.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/SharedMem.cpp.o.d"
+  "/root/repo/libgalois/src/SharedMemSys.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/SharedMemSys.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/SharedMemSys.cpp.o.d"
+  "/root/repo/libgalois/src/SimpleLock.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/SimpleLock.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/SimpleLock.cpp.o.d"
+  "/root/repo/libgalois/src/Statistics.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/Statistics.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/Statistics.cpp.o.d"
+  "/root/repo/libgalois/src/Substrate.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/Substrate.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/Substrate.cpp.o.d"
+  "/root/repo/libgalois/src/Support.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/Support.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/Support.cpp.o.d"
+  "/root/repo/libgalois/src/Termination.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/Termination.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/Termination.cpp.o.d"
+  "/root/repo/libgalois/src/ThreadPool.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/ThreadPool.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/ThreadPool.cpp.o.d"
+  "/root/repo/libgalois/src/ThreadTimer.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/ThreadTimer.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/ThreadTimer.cpp.o.d"
+  "/root/repo/libgalois/src/Threads.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/Threads.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/Threads.cpp.o.d"
+  "/root/repo/libgalois/src/Timer.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/Timer.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/Timer.cpp.o.d"
+  "/root/repo/libgalois/src/Tracer.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/Tracer.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/Tracer.cpp.o.d"
+  "/root/repo/libgalois/src/gIO.cpp" "libgalois/CMakeFiles/galois_shmem.dir/src/gIO.cpp.o" "gcc" "libgalois/CMakeFiles/galois_shmem.dir/src/gIO.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-acquire.dir/acquire.cpp.o"
+  "CMakeFiles/unit-acquire.dir/acquire.cpp.o.d"
+  "unit-acquire"
+  "unit-acquire.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-acquire.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-bandwidth.dir/bandwidth.cpp.o"
+  "CMakeFiles/unit-bandwidth.dir/bandwidth.cpp.o.d"
+  "unit-bandwidth"
+  "unit-bandwidth.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-bandwidth.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
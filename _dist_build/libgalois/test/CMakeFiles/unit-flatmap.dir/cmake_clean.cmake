@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-flatmap.dir/flatmap.cpp.o"
+  "CMakeFiles/unit-flatmap.dir/flatmap.cpp.o.d"
+  "unit-flatmap"
+  "unit-flatmap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-flatmap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-floatingPointErrors.dir/floatingPointErrors.cpp.o"
+  "CMakeFiles/unit-floatingPointErrors.dir/floatingPointErrors.cpp.o.d"
+  "unit-floatingPointErrors"
+  "unit-floatingPointErrors.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-floatingPointErrors.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
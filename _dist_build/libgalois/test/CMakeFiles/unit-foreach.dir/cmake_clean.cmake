@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-foreach.dir/foreach.cpp.o"
+  "CMakeFiles/unit-foreach.dir/foreach.cpp.o.d"
+  "unit-foreach"
+  "unit-foreach.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-foreach.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-gcollections.dir/gcollections.cpp.o"
+  "CMakeFiles/unit-gcollections.dir/gcollections.cpp.o.d"
+  "unit-gcollections"
+  "unit-gcollections.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-gcollections.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-graph-compile.dir/graph-compile.cpp.o"
+  "CMakeFiles/unit-graph-compile.dir/graph-compile.cpp.o.d"
+  "unit-graph-compile"
+  "unit-graph-compile.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-graph-compile.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
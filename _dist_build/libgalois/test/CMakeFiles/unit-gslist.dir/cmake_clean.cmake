@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-gslist.dir/gslist.cpp.o"
+  "CMakeFiles/unit-gslist.dir/gslist.cpp.o.d"
+  "unit-gslist"
+  "unit-gslist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-gslist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
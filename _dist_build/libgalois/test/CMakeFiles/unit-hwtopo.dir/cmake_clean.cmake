@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-hwtopo.dir/hwtopo.cpp.o"
+  "CMakeFiles/unit-hwtopo.dir/hwtopo.cpp.o.d"
+  "unit-hwtopo"
+  "unit-hwtopo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-hwtopo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-hypergraph-io.dir/hypergraph-io.cpp.o"
+  "CMakeFiles/unit-hypergraph-io.dir/hypergraph-io.cpp.o.d"
+  "unit-hypergraph-io"
+  "unit-hypergraph-io.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-hypergraph-io.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-kdtree.dir/kdtree.cpp.o"
+  "CMakeFiles/unit-kdtree.dir/kdtree.cpp.o.d"
+  "unit-kdtree"
+  "unit-kdtree.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-kdtree.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-papi.dir/papi.cpp.o"
+  "CMakeFiles/unit-papi.dir/papi.cpp.o.d"
+  "unit-papi"
+  "unit-papi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-papi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
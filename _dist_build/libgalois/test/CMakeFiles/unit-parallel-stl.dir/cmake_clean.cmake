@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-parallel-stl.dir/parallel-stl.cpp.o"
+  "CMakeFiles/unit-parallel-stl.dir/parallel-stl.cpp.o.d"
+  "unit-parallel-stl"
+  "unit-parallel-stl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-parallel-stl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-parameter.dir/parameter.cpp.o"
+  "CMakeFiles/unit-parameter.dir/parameter.cpp.o.d"
+  "unit-parameter"
+  "unit-parameter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-parameter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
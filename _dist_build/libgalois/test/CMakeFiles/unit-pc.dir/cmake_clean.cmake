@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-pc.dir/pc.cpp.o"
+  "CMakeFiles/unit-pc.dir/pc.cpp.o.d"
+  "unit-pc"
+  "unit-pc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-pc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-per-thread-storage.dir/per-thread-storage.cpp.o"
+  "CMakeFiles/unit-per-thread-storage.dir/per-thread-storage.cpp.o.d"
+  "unit-per-thread-storage"
+  "unit-per-thread-storage.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-per-thread-storage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
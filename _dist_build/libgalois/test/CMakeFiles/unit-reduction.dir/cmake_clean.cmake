@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-reduction.dir/reduction.cpp.o"
+  "CMakeFiles/unit-reduction.dir/reduction.cpp.o.d"
+  "unit-reduction"
+  "unit-reduction.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-reduction.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
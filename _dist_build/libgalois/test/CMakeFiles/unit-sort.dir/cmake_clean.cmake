@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-sort.dir/sort.cpp.o"
+  "CMakeFiles/unit-sort.dir/sort.cpp.o.d"
+  "unit-sort"
+  "unit-sort.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-sort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
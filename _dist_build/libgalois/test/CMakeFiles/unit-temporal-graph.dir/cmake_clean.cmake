@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-temporal-graph.dir/temporal-graph.cpp.o"
+  "CMakeFiles/unit-temporal-graph.dir/temporal-graph.cpp.o.d"
+  "unit-temporal-graph"
+  "unit-temporal-graph.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-temporal-graph.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
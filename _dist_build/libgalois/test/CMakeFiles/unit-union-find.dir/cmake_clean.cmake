@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-union-find.dir/union-find.cpp.o"
+  "CMakeFiles/unit-union-find.dir/union-find.cpp.o.d"
+  "unit-union-find"
+  "unit-union-find.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-union-find.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
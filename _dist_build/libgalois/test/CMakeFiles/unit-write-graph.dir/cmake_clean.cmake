@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-write-graph.dir/write-graph.cpp.o"
+  "CMakeFiles/unit-write-graph.dir/write-graph.cpp.o.d"
+  "unit-write-graph"
+  "unit-write-graph.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-write-graph.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pangolin.dir/src/BfsMining/embedding_list.cpp.o"
+  "CMakeFiles/pangolin.dir/src/BfsMining/embedding_list.cpp.o.d"
+  "CMakeFiles/pangolin.dir/src/base_embedding.cpp.o"
+  "CMakeFiles/pangolin.dir/src/base_embedding.cpp.o.d"
+  "CMakeFiles/pangolin.dir/src/equivalence.cpp.o"
+  "CMakeFiles/pangolin.dir/src/equivalence.cpp.o.d"
+  "CMakeFiles/pangolin.dir/src/quick_pattern.cpp.o"
+  "CMakeFiles/pangolin.dir/src/quick_pattern.cpp.o.d"
+  "CMakeFiles/pangolin.dir/src/vertex_embedding.cpp.o"
+  "CMakeFiles/pangolin.dir/src/vertex_embedding.cpp.o.d"
+  "libpangolin.a"
+  "libpangolin.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pangolin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-pangolin-domain-support.dir/domain-support.cpp.o"
+  "CMakeFiles/unit-pangolin-domain-support.dir/domain-support.cpp.o.d"
+  "unit-pangolin-domain-support"
+  "unit-pangolin-domain-support.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-pangolin-domain-support.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-pangolin-orbit-counter.dir/orbit-counter.cpp.o"
+  "CMakeFiles/unit-pangolin-orbit-counter.dir/orbit-counter.cpp.o.d"
+  "unit-pangolin-orbit-counter"
+  "unit-pangolin-orbit-counter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-pangolin-orbit-counter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
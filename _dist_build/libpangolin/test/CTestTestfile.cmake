@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libpangolin/test
+# Build directory: /root/repo/_dist_build/libpangolin/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(unit-pangolin-domain-support "/root/repo/_dist_build/libpangolin/test/unit-pangolin-domain-support")
+set_tests_properties(unit-pangolin-domain-support PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/libpangolin/test/CMakeLists.txt;7;add_test;/root/repo/libpangolin/test/CMakeLists.txt;16;add_pangolin_test_unit;/root/repo/libpangolin/test/CMakeLists.txt;0;")
+add_test(unit-pangolin-orbit-counter "/root/repo/_dist_build/libpangolin/test/unit-pangolin-orbit-counter")
+set_tests_properties(unit-pangolin-orbit-counter PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/libpangolin/test/CMakeLists.txt;7;add_test;/root/repo/libpangolin/test/CMakeLists.txt;17;add_pangolin_test_unit;/root/repo/libpangolin/test/CMakeLists.txt;0;")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/galois_support.dir/src/GetEnv.cpp.o"
+  "CMakeFiles/galois_support.dir/src/GetEnv.cpp.o.d"
+  "CMakeFiles/galois_support.dir/src/Logging.cpp.o"
+  "CMakeFiles/galois_support.dir/src/Logging.cpp.o.d"
+  "libgalois_support.a"
+  "libgalois_support.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/galois_support.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
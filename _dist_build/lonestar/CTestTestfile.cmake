@@ -0,0 +1,13 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar
+# Build directory: /root/repo/_dist_build/lonestar
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("libdistbench")
+subdirs("liblonestar")
+subdirs("tutorial_examples")
+subdirs("analytics")
+subdirs("eda")
+subdirs("mining")
+subdirs("scientific")
@@ -0,0 +1,28 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/analytics/cpu
+# Build directory: /root/repo/_dist_build/lonestar/analytics/cpu
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("betweennesscentrality")
+subdirs("bfs")
+subdirs("bipart")
+subdirs("spanningtree")
+subdirs("clustering")
+subdirs("connected-components")
+subdirs("distance-oracle")
+subdirs("gmetis")
+subdirs("independentset")
+subdirs("k-core")
+subdirs("k-truss")
+subdirs("matching")
+subdirs("matrixcompletion")
+subdirs("pagerank")
+subdirs("pointstoanalysis")
+subdirs("preflowpush")
+subdirs("random-walks")
+subdirs("scc")
+subdirs("similarity")
+subdirs("sssp")
+subdirs("temporal")
+subdirs("triangle-counting")
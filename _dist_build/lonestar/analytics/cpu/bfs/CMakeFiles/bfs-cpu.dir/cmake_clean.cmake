@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bfs-cpu.dir/bfs.cpp.o"
+  "CMakeFiles/bfs-cpu.dir/bfs.cpp.o.d"
+  "bfs-cpu"
+  "bfs-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bfs-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bipart-cpu.dir/Coarsening.cpp.o"
+  "CMakeFiles/bipart-cpu.dir/Coarsening.cpp.o.d"
+  "CMakeFiles/bipart-cpu.dir/Metric.cpp.o"
+  "CMakeFiles/bipart-cpu.dir/Metric.cpp.o.d"
+  "CMakeFiles/bipart-cpu.dir/Partitioning.cpp.o"
+  "CMakeFiles/bipart-cpu.dir/Partitioning.cpp.o.d"
+  "CMakeFiles/bipart-cpu.dir/Refine.cpp.o"
+  "CMakeFiles/bipart-cpu.dir/Refine.cpp.o.d"
+  "CMakeFiles/bipart-cpu.dir/bipart.cpp.o"
+  "CMakeFiles/bipart-cpu.dir/bipart.cpp.o.d"
+  "bipart-cpu"
+  "bipart-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bipart-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
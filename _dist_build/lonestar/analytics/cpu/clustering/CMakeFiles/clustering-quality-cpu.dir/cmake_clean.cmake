@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/clustering-quality-cpu.dir/clusteringQuality.cpp.o"
+  "CMakeFiles/clustering-quality-cpu.dir/clusteringQuality.cpp.o.d"
+  "clustering-quality-cpu"
+  "clustering-quality-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clustering-quality-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
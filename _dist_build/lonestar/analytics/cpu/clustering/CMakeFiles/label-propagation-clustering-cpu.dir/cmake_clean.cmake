@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/label-propagation-clustering-cpu.dir/labelPropagation.cpp.o"
+  "CMakeFiles/label-propagation-clustering-cpu.dir/labelPropagation.cpp.o.d"
+  "label-propagation-clustering-cpu"
+  "label-propagation-clustering-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/label-propagation-clustering-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/louvain-clustering-cpu.dir/louvainClustering.cpp.o"
+  "CMakeFiles/louvain-clustering-cpu.dir/louvainClustering.cpp.o.d"
+  "louvain-clustering-cpu"
+  "louvain-clustering-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/louvain-clustering-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
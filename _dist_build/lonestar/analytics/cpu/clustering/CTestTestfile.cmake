@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/analytics/cpu/clustering
+# Build directory: /root/repo/_dist_build/lonestar/analytics/cpu/clustering
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run-small1-louvain-clustering-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/clustering/louvain-clustering-cpu" "-symmetricGraph" "/root/repo/_dist_build/inputs/scalefree/symmetric/rmat10.sgr" "-t" "1")
+set_tests_properties(run-small1-louvain-clustering-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/clustering/CMakeLists.txt;5;add_test_scale;/root/repo/lonestar/analytics/cpu/clustering/CMakeLists.txt;0;")
+add_test(run-small1-leiden-clustering-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/clustering/leiden-clustering-cpu" "-symmetricGraph" "/root/repo/_dist_build/inputs/scalefree/symmetric/rmat10.sgr" "-t" "1")
+set_tests_properties(run-small1-leiden-clustering-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/clustering/CMakeLists.txt;11;add_test_scale;/root/repo/lonestar/analytics/cpu/clustering/CMakeLists.txt;0;")
+add_test(run-small1-label-propagation-clustering-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/clustering/label-propagation-clustering-cpu" "-symmetricGraph" "/root/repo/_dist_build/inputs/scalefree/symmetric/rmat10.sgr" "-t" "1")
+set_tests_properties(run-small1-label-propagation-clustering-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/clustering/CMakeLists.txt;17;add_test_scale;/root/repo/lonestar/analytics/cpu/clustering/CMakeLists.txt;0;")
+add_test(create-clustering-quality-small "/root/repo/_dist_build/tools/graph-convert/graph-convert" "-edgelist2gr" "/root/repo/lonestar/analytics/cpu/clustering/test-inputs/small.edgelist" "clustering-small.gr")
+set_tests_properties(create-clustering-quality-small PROPERTIES  LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/analytics/cpu/clustering/CMakeLists.txt;25;add_test;/root/repo/lonestar/analytics/cpu/clustering/CMakeLists.txt;0;")
+add_test(run-small-clustering-quality-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/clustering/clustering-quality-cpu" "-symmetricGraph" "clustering-small.gr" "-communities=/root/repo/lonestar/analytics/cpu/clustering/test-inputs/small.communities" "-groundTruth=/root/repo/lonestar/analytics/cpu/clustering/test-inputs/small.truth" "-t" "1")
+set_tests_properties(run-small-clustering-quality-cpu-1 PROPERTIES  DEPENDS "create-clustering-quality-small" ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "Communities: 5 \\(3 singletons\\).*NMI 1, ARI 1" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/clustering/CMakeLists.txt;29;add_test_scale;/root/repo/lonestar/analytics/cpu/clustering/CMakeLists.txt;0;")
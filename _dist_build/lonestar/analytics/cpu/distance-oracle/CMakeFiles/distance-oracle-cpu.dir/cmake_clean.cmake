@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/distance-oracle-cpu.dir/DistanceOracle.cpp.o"
+  "CMakeFiles/distance-oracle-cpu.dir/DistanceOracle.cpp.o.d"
+  "distance-oracle-cpu"
+  "distance-oracle-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/distance-oracle-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lonestar/analytics/cpu/gmetis/Coarsening.cpp" "lonestar/analytics/cpu/gmetis/CMakeFiles/gmetis-cpu.dir/Coarsening.cpp.o" "gcc" "lonestar/analytics/cpu/gmetis/CMakeFiles/gmetis-cpu.dir/Coarsening.cpp.o.d"
+  "/root/repo/lonestar/analytics/cpu/gmetis/GMetis.cpp" "lonestar/analytics/cpu/gmetis/CMakeFiles/gmetis-cpu.dir/GMetis.cpp.o" "gcc" "lonestar/analytics/cpu/gmetis/CMakeFiles/gmetis-cpu.dir/GMetis.cpp.o.d"
+  "/root/repo/lonestar/analytics/cpu/gmetis/Metric.cpp" "lonestar/analytics/cpu/gmetis/CMakeFiles/gmetis-cpu.dir/Metric.cpp.o" "gcc" "lonestar/analytics/cpu/gmetis/CMakeFiles/gmetis-cpu.dir/Metric.cpp.o.d"
+  "/root/repo/lonestar/analytics/cpu/gmetis/Partitioning.cpp" "lonestar/analytics/cpu/gmetis/CMakeFiles/gmetis-cpu.dir/Partitioning.cpp.o" "gcc" "lonestar/analytics/cpu/gmetis/CMakeFiles/gmetis-cpu.dir/Partitioning.cpp.o.d"
+  "/root/repo/lonestar/analytics/cpu/gmetis/Refine.cpp" "lonestar/analytics/cpu/gmetis/CMakeFiles/gmetis-cpu.dir/Refine.cpp.o" "gcc" "lonestar/analytics/cpu/gmetis/CMakeFiles/gmetis-cpu.dir/Refine.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dist_build/libgalois/CMakeFiles/galois_shmem.dir/DependInfo.cmake"
+  "/root/repo/_dist_build/lonestar/liblonestar/CMakeFiles/lonestar.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
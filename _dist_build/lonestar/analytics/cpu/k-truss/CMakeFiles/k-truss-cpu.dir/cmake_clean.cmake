@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/k-truss-cpu.dir/K-Truss.cpp.o"
+  "CMakeFiles/k-truss-cpu.dir/K-Truss.cpp.o.d"
+  "k-truss-cpu"
+  "k-truss-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/k-truss-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
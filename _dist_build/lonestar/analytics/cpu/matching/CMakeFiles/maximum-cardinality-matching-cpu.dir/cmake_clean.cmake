@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/maximum-cardinality-matching-cpu.dir/bipartite-mcm.cpp.o"
+  "CMakeFiles/maximum-cardinality-matching-cpu.dir/bipartite-mcm.cpp.o.d"
+  "maximum-cardinality-matching-cpu"
+  "maximum-cardinality-matching-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/maximum-cardinality-matching-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/analytics/cpu/matrixcompletion
+# Build directory: /root/repo/_dist_build/lonestar/analytics/cpu/matrixcompletion
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run-small-edge-matrixcompletion-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/matrixcompletion/matrixcompletion-cpu" "-algo=sgdBlockEdge" "-lambda=0.001" "-learningRate=0.01" "-learningRateFunction=intel" "-tolerance=0.01" "-useSameLatentVector" "-useDetInit" "/root/repo/_dist_build/inputs/weighted/bipartite/Epinions_dataset.gr" "-t" "1")
+set_tests_properties(run-small-edge-matrixcompletion-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/matrixcompletion/CMakeLists.txt;23;add_test_scale;/root/repo/lonestar/analytics/cpu/matrixcompletion/CMakeLists.txt;0;")
+add_test(run-small-jump-matrixcompletion-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/matrixcompletion/matrixcompletion-cpu" "-algo=sgdBlockJump" "-lambda=0.001" "-learningRate=0.01" "-learningRateFunction=intel" "-tolerance=0.01" "-useSameLatentVector" "-useDetInit" "/root/repo/_dist_build/inputs/weighted/bipartite/Epinions_dataset.gr" "-t" "1")
+set_tests_properties(run-small-jump-matrixcompletion-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/matrixcompletion/CMakeLists.txt;25;add_test_scale;/root/repo/lonestar/analytics/cpu/matrixcompletion/CMakeLists.txt;0;")
+add_test(run-small-byitems-matrixcompletion-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/matrixcompletion/matrixcompletion-cpu" "-algo=sgdByItems" "-lambda=0.001" "-learningRate=0.01" "-learningRateFunction=intel" "-tolerance=0.01" "-useSameLatentVector" "-useDetInit" "/root/repo/_dist_build/inputs/weighted/bipartite/Epinions_dataset.gr" "-t" "1")
+set_tests_properties(run-small-byitems-matrixcompletion-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/matrixcompletion/CMakeLists.txt;27;add_test_scale;/root/repo/lonestar/analytics/cpu/matrixcompletion/CMakeLists.txt;0;")
+add_test(run-small-byedges-matrixcompletion-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/matrixcompletion/matrixcompletion-cpu" "-algo=sgdByEdges" "-lambda=0.001" "-learningRate=0.01" "-learningRateFunction=intel" "-tolerance=0.01" "-useSameLatentVector" "-useDetInit" "/root/repo/_dist_build/inputs/weighted/bipartite/Epinions_dataset.gr" "-t" "1")
+set_tests_properties(run-small-byedges-matrixcompletion-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/matrixcompletion/CMakeLists.txt;29;add_test_scale;/root/repo/lonestar/analytics/cpu/matrixcompletion/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pagerank-personalized-cpu.dir/PageRank-personalized.cpp.o"
+  "CMakeFiles/pagerank-personalized-cpu.dir/PageRank-personalized.cpp.o.d"
+  "pagerank-personalized-cpu"
+  "pagerank-personalized-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pagerank-personalized-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pagerank-pull-cpu.dir/PageRank-pull.cpp.o"
+  "CMakeFiles/pagerank-pull-cpu.dir/PageRank-pull.cpp.o.d"
+  "pagerank-pull-cpu"
+  "pagerank-pull-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pagerank-pull-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
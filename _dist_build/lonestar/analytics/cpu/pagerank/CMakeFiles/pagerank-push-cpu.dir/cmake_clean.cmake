@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pagerank-push-cpu.dir/PageRank-push.cpp.o"
+  "CMakeFiles/pagerank-push-cpu.dir/PageRank-push.cpp.o.d"
+  "pagerank-push-cpu"
+  "pagerank-push-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pagerank-push-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
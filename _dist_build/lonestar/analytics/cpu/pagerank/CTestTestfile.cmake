@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/analytics/cpu/pagerank
+# Build directory: /root/repo/_dist_build/lonestar/analytics/cpu/pagerank
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run-small-pagerank-pull-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/pagerank/pagerank-pull-cpu" "-transposedGraph" "-tolerance=0.01" "/root/repo/_dist_build/inputs/scalefree/transpose/rmat10.tgr" "-t" "1")
+set_tests_properties(run-small-pagerank-pull-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/pagerank/CMakeLists.txt;6;add_test_scale;/root/repo/lonestar/analytics/cpu/pagerank/CMakeLists.txt;0;")
+add_test(run-small-topo-pagerank-pull-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/pagerank/pagerank-pull-cpu" "-transposedGraph" "-tolerance=0.01" "-algo=Topo" "/root/repo/_dist_build/inputs/scalefree/transpose/rmat10.tgr" "-t" "1")
+set_tests_properties(run-small-topo-pagerank-pull-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/pagerank/CMakeLists.txt;7;add_test_scale;/root/repo/lonestar/analytics/cpu/pagerank/CMakeLists.txt;0;")
+add_test(run-small-pagerank-push-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/pagerank/pagerank-push-cpu" "-tolerance=0.01" "/root/repo/_dist_build/inputs/scalefree/transpose/rmat10.tgr" "-t" "1")
+set_tests_properties(run-small-pagerank-push-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/pagerank/CMakeLists.txt;14;add_test_scale;/root/repo/lonestar/analytics/cpu/pagerank/CMakeLists.txt;0;")
+add_test(run-small-sync-pagerank-push-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/pagerank/pagerank-push-cpu" "-tolerance=0.01" "-algo=Sync" "/root/repo/_dist_build/inputs/scalefree/transpose/rmat10.tgr" "-t" "1")
+set_tests_properties(run-small-sync-pagerank-push-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/pagerank/CMakeLists.txt;15;add_test_scale;/root/repo/lonestar/analytics/cpu/pagerank/CMakeLists.txt;0;")
+add_test(run-small-pagerank-personalized-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/pagerank/pagerank-personalized-cpu" "-epsilon=1e-7" "/root/repo/_dist_build/inputs/scalefree/rmat10.gr" "-t" "1")
+set_tests_properties(run-small-pagerank-personalized-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/pagerank/CMakeLists.txt;22;add_test_scale;/root/repo/lonestar/analytics/cpu/pagerank/CMakeLists.txt;0;")
+add_test(run-small-hub-pagerank-personalized-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/pagerank/pagerank-personalized-cpu" "-hubDegree=1" "-numSources=4" "/root/repo/_dist_build/inputs/scalefree/rmat10.gr" "-t" "1")
+set_tests_properties(run-small-hub-pagerank-personalized-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/pagerank/CMakeLists.txt;23;add_test_scale;/root/repo/lonestar/analytics/cpu/pagerank/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pointstoanalysis-cpu.dir/PointsTo.cpp.o"
+  "CMakeFiles/pointstoanalysis-cpu.dir/PointsTo.cpp.o.d"
+  "pointstoanalysis-cpu"
+  "pointstoanalysis-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pointstoanalysis-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
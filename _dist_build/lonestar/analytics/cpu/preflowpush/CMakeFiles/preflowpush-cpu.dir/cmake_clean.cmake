@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/preflowpush-cpu.dir/Preflowpush.cpp.o"
+  "CMakeFiles/preflowpush-cpu.dir/Preflowpush.cpp.o.d"
+  "preflowpush-cpu"
+  "preflowpush-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/preflowpush-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
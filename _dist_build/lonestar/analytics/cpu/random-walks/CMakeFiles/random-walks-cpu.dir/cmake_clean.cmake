@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/random-walks-cpu.dir/RandomWalks.cpp.o"
+  "CMakeFiles/random-walks-cpu.dir/RandomWalks.cpp.o.d"
+  "random-walks-cpu"
+  "random-walks-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/random-walks-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
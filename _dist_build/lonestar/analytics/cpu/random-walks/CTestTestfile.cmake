@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/analytics/cpu/random-walks
+# Build directory: /root/repo/_dist_build/lonestar/analytics/cpu/random-walks
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run-small1-random-walks-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/random-walks/random-walks-cpu" "/root/repo/_dist_build/inputs/scalefree/rmat10.gr" "-walkLength=20" "-walksPerNode=2" "-t" "1")
+set_tests_properties(run-small1-random-walks-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/random-walks/CMakeLists.txt;6;add_test_scale;/root/repo/lonestar/analytics/cpu/random-walks/CMakeLists.txt;0;")
+add_test(run-small2-random-walks-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/random-walks/random-walks-cpu" "/root/repo/_dist_build/inputs/reference/structured/rome99.gr" "-algo=WeightedNode2vec" "-p=0.5" "-q=2" "-walkLength=20" "-walksPerNode=2" "-t" "1")
+set_tests_properties(run-small2-random-walks-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/random-walks/CMakeLists.txt;7;add_test_scale;/root/repo/lonestar/analytics/cpu/random-walks/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/scc-cpu.dir/scc.cpp.o"
+  "CMakeFiles/scc-cpu.dir/scc.cpp.o.d"
+  "scc-cpu"
+  "scc-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scc-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/analytics/cpu/scc
+# Build directory: /root/repo/_dist_build/lonestar/analytics/cpu/scc
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run-small1-scc-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/scc/scc-cpu" "/root/repo/_dist_build/inputs/reference/structured/rome99.gr" "-t" "1")
+set_tests_properties(run-small1-scc-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/scc/CMakeLists.txt;6;add_test_scale;/root/repo/lonestar/analytics/cpu/scc/CMakeLists.txt;0;")
+add_test(run-small2-scc-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/scc/scc-cpu" "/root/repo/_dist_build/inputs/scalefree/rmat10.gr" "-t" "1")
+set_tests_properties(run-small2-scc-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/scc/CMakeLists.txt;7;add_test_scale;/root/repo/lonestar/analytics/cpu/scc/CMakeLists.txt;0;")
+add_test(run-small3-scc-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/scc/scc-cpu" "/root/repo/_dist_build/inputs/scalefree/rmat10.gr" "-algo=Color" "-trim=false" "-t" "1")
+set_tests_properties(run-small3-scc-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/scc/CMakeLists.txt;8;add_test_scale;/root/repo/lonestar/analytics/cpu/scc/CMakeLists.txt;0;")
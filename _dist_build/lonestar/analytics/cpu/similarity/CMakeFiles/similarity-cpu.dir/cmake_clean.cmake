@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/similarity-cpu.dir/Similarity.cpp.o"
+  "CMakeFiles/similarity-cpu.dir/Similarity.cpp.o.d"
+  "similarity-cpu"
+  "similarity-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/similarity-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
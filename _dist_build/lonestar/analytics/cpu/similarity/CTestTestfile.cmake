@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/analytics/cpu/similarity
+# Build directory: /root/repo/_dist_build/lonestar/analytics/cpu/similarity
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run-small-jaccard-similarity-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/similarity/similarity-cpu" "-symmetricGraph" "/root/repo/_dist_build/inputs/scalefree/symmetric/rmat10.sgr" "-t" "1")
+set_tests_properties(run-small-jaccard-similarity-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/similarity/CMakeLists.txt;6;add_test_scale;/root/repo/lonestar/analytics/cpu/similarity/CMakeLists.txt;0;")
+add_test(run-small-adamic-similarity-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/similarity/similarity-cpu" "-symmetricGraph" "-measure=AdamicAdar" "-excludeNeighbors" "-maxDegree=64" "/root/repo/_dist_build/inputs/scalefree/symmetric/rmat10.sgr" "-t" "1")
+set_tests_properties(run-small-adamic-similarity-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/similarity/CMakeLists.txt;7;add_test_scale;/root/repo/lonestar/analytics/cpu/similarity/CMakeLists.txt;0;")
+add_test(run-small-allpairs-similarity-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/similarity/similarity-cpu" "-symmetricGraph" "-measure=Cosine" "-allPairs" "-threshold=0.5" "/root/repo/_dist_build/inputs/scalefree/symmetric/rmat10.sgr" "-t" "1")
+set_tests_properties(run-small-allpairs-similarity-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/similarity/CMakeLists.txt;8;add_test_scale;/root/repo/lonestar/analytics/cpu/similarity/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sssp-cpu.dir/SSSP.cpp.o"
+  "CMakeFiles/sssp-cpu.dir/SSSP.cpp.o.d"
+  "sssp-cpu"
+  "sssp-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sssp-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
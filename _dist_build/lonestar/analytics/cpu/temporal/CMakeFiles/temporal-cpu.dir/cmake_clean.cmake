@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/temporal-cpu.dir/Temporal.cpp.o"
+  "CMakeFiles/temporal-cpu.dir/Temporal.cpp.o.d"
+  "temporal-cpu"
+  "temporal-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/temporal-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/analytics/distributed
+# Build directory: /root/repo/_dist_build/lonestar/analytics/distributed
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("betweennesscentrality")
+subdirs("bfs")
+subdirs("connected-components")
+subdirs("k-core")
+subdirs("pagerank")
+subdirs("partition")
+subdirs("matrixcompletion")
+subdirs("sssp")
+subdirs("triangle-counting")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bfs-push-dist.dir/bfs_push.cpp.o"
+  "CMakeFiles/bfs-push-dist.dir/bfs_push.cpp.o.d"
+  "bfs-push-dist"
+  "bfs-push-dist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bfs-push-dist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
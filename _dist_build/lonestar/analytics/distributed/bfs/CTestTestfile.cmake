@@ -0,0 +1,64 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/analytics/distributed/bfs
+# Build directory: /root/repo/_dist_build/lonestar/analytics/distributed/bfs
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run-bfs-push-dist-sync-cpu-rmat15-oec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=oec")
+set_tests_properties(run-bfs-push-dist-sync-cpu-rmat15-oec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-async-cpu-rmat15-oec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=oec")
+set_tests_properties(run-bfs-push-dist-async-cpu-rmat15-oec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-sync-cpu-rmat15-iec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=iec")
+set_tests_properties(run-bfs-push-dist-sync-cpu-rmat15-iec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-async-cpu-rmat15-iec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=iec")
+set_tests_properties(run-bfs-push-dist-async-cpu-rmat15-iec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-sync-cpu-rmat15-cvc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=cvc")
+set_tests_properties(run-bfs-push-dist-sync-cpu-rmat15-cvc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-async-cpu-rmat15-cvc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=cvc")
+set_tests_properties(run-bfs-push-dist-async-cpu-rmat15-cvc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-sync-cpu-rmat15-cvc-iec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=cvc-iec")
+set_tests_properties(run-bfs-push-dist-sync-cpu-rmat15-cvc-iec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-async-cpu-rmat15-cvc-iec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=cvc-iec")
+set_tests_properties(run-bfs-push-dist-async-cpu-rmat15-cvc-iec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-sync-cpu-rmat15-hovc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=hovc")
+set_tests_properties(run-bfs-push-dist-sync-cpu-rmat15-hovc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-async-cpu-rmat15-hovc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=hovc")
+set_tests_properties(run-bfs-push-dist-async-cpu-rmat15-hovc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-sync-cpu-rmat15-hivc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=hivc")
+set_tests_properties(run-bfs-push-dist-sync-cpu-rmat15-hivc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-async-cpu-rmat15-hivc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=hivc")
+set_tests_properties(run-bfs-push-dist-async-cpu-rmat15-hivc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-sync-cpu-rmat15-oec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=oec")
+set_tests_properties(run-bfs-pull-dist-sync-cpu-rmat15-oec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-async-cpu-rmat15-oec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=oec")
+set_tests_properties(run-bfs-pull-dist-async-cpu-rmat15-oec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-sync-cpu-rmat15-iec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=iec")
+set_tests_properties(run-bfs-pull-dist-sync-cpu-rmat15-iec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-async-cpu-rmat15-iec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=iec")
+set_tests_properties(run-bfs-pull-dist-async-cpu-rmat15-iec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-sync-cpu-rmat15-cvc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=cvc")
+set_tests_properties(run-bfs-pull-dist-sync-cpu-rmat15-cvc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-async-cpu-rmat15-cvc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=cvc")
+set_tests_properties(run-bfs-pull-dist-async-cpu-rmat15-cvc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-sync-cpu-rmat15-cvc-iec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=cvc-iec")
+set_tests_properties(run-bfs-pull-dist-sync-cpu-rmat15-cvc-iec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-async-cpu-rmat15-cvc-iec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=cvc-iec")
+set_tests_properties(run-bfs-pull-dist-async-cpu-rmat15-cvc-iec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-sync-cpu-rmat15-hovc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=hovc")
+set_tests_properties(run-bfs-pull-dist-sync-cpu-rmat15-hovc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-async-cpu-rmat15-hovc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=hovc")
+set_tests_properties(run-bfs-pull-dist-async-cpu-rmat15-hovc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-sync-cpu-rmat15-hivc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=hivc")
+set_tests_properties(run-bfs-pull-dist-sync-cpu-rmat15-hivc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-async-cpu-rmat15-hivc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=hivc")
+set_tests_properties(run-bfs-pull-dist-async-cpu-rmat15-hivc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(create-bfs-sim-grid "/root/repo/_dist_build/tools/graph-generate/graph-generate" "-model" "grid2d" "-width" "16" "-height" "16" "bfs-sim-grid.gr")
+set_tests_properties(create-bfs-sim-grid PROPERTIES  LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;9;add_test;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-sim-oec "/root/repo/_dist_build/lonestar/analytics/distributed/bfs/bfs-push-dist" "bfs-sim-grid.gr" "-t=2" "-runs=2" "-simulateHosts=3")
+set_tests_properties(run-bfs-push-dist-sim-oec PROPERTIES  DEPENDS "create-bfs-sim-grid" ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1;" LABELS "quick" PASS_REGULAR_EXPRESSION "Number of nodes visited from source 0 is 256.*Max distance from source 0 is 30" _BACKTRACE_TRIPLES "/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;14;add_test;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;25;add_test_bfs_sim;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-sim-async "/root/repo/_dist_build/lonestar/analytics/distributed/bfs/bfs-push-dist" "bfs-sim-grid.gr" "-t=2" "-runs=2" "-simulateHosts=4" "-exec=Async")
+set_tests_properties(run-bfs-push-dist-sim-async PROPERTIES  DEPENDS "create-bfs-sim-grid" ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1;" LABELS "quick" PASS_REGULAR_EXPRESSION "Number of nodes visited from source 0 is 256.*Max distance from source 0 is 30" _BACKTRACE_TRIPLES "/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;14;add_test;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;26;add_test_bfs_sim;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-sim-hovc "/root/repo/_dist_build/lonestar/analytics/distributed/bfs/bfs-push-dist" "bfs-sim-grid.gr" "-t=2" "-runs=2" "-simulateHosts=2" "-partition=hovc")
+set_tests_properties(run-bfs-push-dist-sim-hovc PROPERTIES  DEPENDS "create-bfs-sim-grid" ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1;" LABELS "quick" PASS_REGULAR_EXPRESSION "Number of nodes visited from source 0 is 256.*Max distance from source 0 is 30" _BACKTRACE_TRIPLES "/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;14;add_test;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;27;add_test_bfs_sim;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-sim-jitter "/root/repo/_dist_build/lonestar/analytics/distributed/bfs/bfs-push-dist" "bfs-sim-grid.gr" "-t=2" "-runs=2" "-simulateHosts=3")
+set_tests_properties(run-bfs-push-dist-sim-jitter PROPERTIES  DEPENDS "create-bfs-sim-grid" ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1;GALOIS_SIM_DETERMINISTIC=0;GALOIS_SIM_SEED=7;GALOIS_SIM_LATENCY=2;GALOIS_SIM_JITTER=5" LABELS "quick" PASS_REGULAR_EXPRESSION "Number of nodes visited from source 0 is 256.*Max distance from source 0 is 30" _BACKTRACE_TRIPLES "/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;14;add_test;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;29;add_test_bfs_sim;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
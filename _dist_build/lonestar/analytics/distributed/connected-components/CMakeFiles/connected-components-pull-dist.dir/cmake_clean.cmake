@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/connected-components-pull-dist.dir/cc_pull.cpp.o"
+  "CMakeFiles/connected-components-pull-dist.dir/cc_pull.cpp.o.d"
+  "connected-components-pull-dist"
+  "connected-components-pull-dist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/connected-components-pull-dist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
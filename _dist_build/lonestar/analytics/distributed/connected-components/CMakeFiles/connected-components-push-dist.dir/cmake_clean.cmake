@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/connected-components-push-dist.dir/cc_push.cpp.o"
+  "CMakeFiles/connected-components-push-dist.dir/cc_push.cpp.o.d"
+  "connected-components-push-dist"
+  "connected-components-push-dist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/connected-components-push-dist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/k-core-pull-dist.dir/kcore_pull.cpp.o"
+  "CMakeFiles/k-core-pull-dist.dir/kcore_pull.cpp.o.d"
+  "k-core-pull-dist"
+  "k-core-pull-dist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/k-core-pull-dist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
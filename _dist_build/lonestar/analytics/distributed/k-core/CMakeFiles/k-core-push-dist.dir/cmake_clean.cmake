@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/k-core-push-dist.dir/kcore_push.cpp.o"
+  "CMakeFiles/k-core-push-dist.dir/kcore_push.cpp.o.d"
+  "k-core-push-dist"
+  "k-core-push-dist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/k-core-push-dist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/matrixcompletion-dist.dir/matrixCompletion.cpp.o"
+  "CMakeFiles/matrixcompletion-dist.dir/matrixCompletion.cpp.o.d"
+  "matrixcompletion-dist"
+  "matrixcompletion-dist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/matrixcompletion-dist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pagerank-pull-dist.dir/pagerank_pull.cpp.o"
+  "CMakeFiles/pagerank-pull-dist.dir/pagerank_pull.cpp.o.d"
+  "pagerank-pull-dist"
+  "pagerank-pull-dist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pagerank-pull-dist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/partition-dist.dir/partition.cpp.o"
+  "CMakeFiles/partition-dist.dir/partition.cpp.o.d"
+  "partition-dist"
+  "partition-dist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/partition-dist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/analytics/distributed/partition
+# Build directory: /root/repo/_dist_build/lonestar/analytics/distributed/partition
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sssp-push-dist.dir/sssp_push.cpp.o"
+  "CMakeFiles/sssp-push-dist.dir/sssp_push.cpp.o.d"
+  "sssp-push-dist"
+  "sssp-push-dist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sssp-push-dist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/triangle-counting-dist.dir/tc.cpp.o"
+  "CMakeFiles/triangle-counting-dist.dir/tc.cpp.o.d"
+  "CMakeFiles/triangle-counting-dist.dir/tc_oriented.cpp.o"
+  "CMakeFiles/triangle-counting-dist.dir/tc_oriented.cpp.o.d"
+  "triangle-counting-dist"
+  "triangle-counting-dist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/triangle-counting-dist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
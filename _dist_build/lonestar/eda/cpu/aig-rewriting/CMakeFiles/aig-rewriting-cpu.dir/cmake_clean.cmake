@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/aig-rewriting-cpu.dir/main.cpp.o"
+  "CMakeFiles/aig-rewriting-cpu.dir/main.cpp.o.d"
+  "aig-rewriting-cpu"
+  "aig-rewriting-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/aig-rewriting-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
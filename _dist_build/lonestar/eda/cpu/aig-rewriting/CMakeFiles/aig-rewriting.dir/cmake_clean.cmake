@@ -0,0 +1,51 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/aig-rewriting.dir/algorithms/ChoiceManager.cpp.o"
+  "CMakeFiles/aig-rewriting.dir/algorithms/ChoiceManager.cpp.o.d"
+  "CMakeFiles/aig-rewriting.dir/algorithms/CutManager.cpp.o"
+  "CMakeFiles/aig-rewriting.dir/algorithms/CutManager.cpp.o.d"
+  "CMakeFiles/aig-rewriting.dir/algorithms/CutPool.cpp.o"
+  "CMakeFiles/aig-rewriting.dir/algorithms/CutPool.cpp.o.d"
+  "CMakeFiles/aig-rewriting.dir/algorithms/EquivalenceChecker.cpp.o"
+  "CMakeFiles/aig-rewriting.dir/algorithms/EquivalenceChecker.cpp.o.d"
+  "CMakeFiles/aig-rewriting.dir/algorithms/NPNManager.cpp.o"
+  "CMakeFiles/aig-rewriting.dir/algorithms/NPNManager.cpp.o.d"
+  "CMakeFiles/aig-rewriting.dir/algorithms/PreCompGraphManager.cpp.o"
+  "CMakeFiles/aig-rewriting.dir/algorithms/PreCompGraphManager.cpp.o.d"
+  "CMakeFiles/aig-rewriting.dir/algorithms/PriorityCutManager.cpp.o"
+  "CMakeFiles/aig-rewriting.dir/algorithms/PriorityCutManager.cpp.o.d"
+  "CMakeFiles/aig-rewriting.dir/algorithms/PriorityCutPool.cpp.o"
+  "CMakeFiles/aig-rewriting.dir/algorithms/PriorityCutPool.cpp.o.d"
+  "CMakeFiles/aig-rewriting.dir/algorithms/ReconvDrivenCut.cpp.o"
+  "CMakeFiles/aig-rewriting.dir/algorithms/ReconvDrivenCut.cpp.o.d"
+  "CMakeFiles/aig-rewriting.dir/algorithms/RewriteManager.cpp.o"
+  "CMakeFiles/aig-rewriting.dir/algorithms/RewriteManager.cpp.o.d"
+  "CMakeFiles/aig-rewriting.dir/functional/BitVectorPool.cpp.o"
+  "CMakeFiles/aig-rewriting.dir/functional/BitVectorPool.cpp.o.d"
+  "CMakeFiles/aig-rewriting.dir/functional/FunctionUtil.cpp.o"
+  "CMakeFiles/aig-rewriting.dir/functional/FunctionUtil.cpp.o.d"
+  "CMakeFiles/aig-rewriting.dir/misc/util/utilString.cpp.o"
+  "CMakeFiles/aig-rewriting.dir/misc/util/utilString.cpp.o.d"
+  "CMakeFiles/aig-rewriting.dir/parsers/AigParser.cpp.o"
+  "CMakeFiles/aig-rewriting.dir/parsers/AigParser.cpp.o.d"
+  "CMakeFiles/aig-rewriting.dir/parsers/LookupTableParser.cpp.o"
+  "CMakeFiles/aig-rewriting.dir/parsers/LookupTableParser.cpp.o.d"
+  "CMakeFiles/aig-rewriting.dir/parsers/semantic_error.cpp.o"
+  "CMakeFiles/aig-rewriting.dir/parsers/semantic_error.cpp.o.d"
+  "CMakeFiles/aig-rewriting.dir/parsers/syntax_error.cpp.o"
+  "CMakeFiles/aig-rewriting.dir/parsers/syntax_error.cpp.o.d"
+  "CMakeFiles/aig-rewriting.dir/parsers/unexpected_eof.cpp.o"
+  "CMakeFiles/aig-rewriting.dir/parsers/unexpected_eof.cpp.o.d"
+  "CMakeFiles/aig-rewriting.dir/subjectgraph/aig/Aig.cpp.o"
+  "CMakeFiles/aig-rewriting.dir/subjectgraph/aig/Aig.cpp.o.d"
+  "CMakeFiles/aig-rewriting.dir/writers/AigWriter.cpp.o"
+  "CMakeFiles/aig-rewriting.dir/writers/AigWriter.cpp.o.d"
+  "CMakeFiles/aig-rewriting.dir/writers/BlifWriter.cpp.o"
+  "CMakeFiles/aig-rewriting.dir/writers/BlifWriter.cpp.o.d"
+  "CMakeFiles/aig-rewriting.dir/xxHash/xxhash.c.o"
+  "CMakeFiles/aig-rewriting.dir/xxHash/xxhash.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/aig-rewriting.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-aig-equivalence.dir/test/equivalence.cpp.o"
+  "CMakeFiles/unit-aig-equivalence.dir/test/equivalence.cpp.o.d"
+  "unit-aig-equivalence"
+  "unit-aig-equivalence.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/unit-aig-equivalence.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/eda/cpu/aig-rewriting
+# Build directory: /root/repo/_dist_build/lonestar/eda/cpu/aig-rewriting
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run-small1-aig-rewriting-cpu-1 "/root/repo/_dist_build/lonestar/eda/cpu/aig-rewriting/aig-rewriting-cpu" "-AIG" "/root/repo/_dist_build/inputs/eda/logic-synthesis/EPFL/arithmetic/adder/aiger/adder.aig" "-v" "-t" "1")
+set_tests_properties(run-small1-aig-rewriting-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/eda/cpu/aig-rewriting/CMakeLists.txt;30;add_test_scale;/root/repo/lonestar/eda/cpu/aig-rewriting/CMakeLists.txt;0;")
+add_test(run-small2-aig-rewriting-cpu-1 "/root/repo/_dist_build/lonestar/eda/cpu/aig-rewriting/aig-rewriting-cpu" "-AIG" "/root/repo/_dist_build/inputs/eda/logic-synthesis/EPFL/random_control/voter/aiger/voter.aig" "-v" "-t" "1")
+set_tests_properties(run-small2-aig-rewriting-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/eda/cpu/aig-rewriting/CMakeLists.txt;31;add_test_scale;/root/repo/lonestar/eda/cpu/aig-rewriting/CMakeLists.txt;0;")
+add_test(unit-aig-equivalence "/root/repo/_dist_build/lonestar/eda/cpu/aig-rewriting/unit-aig-equivalence" "/root/repo/lonestar/eda/cpu/aig-rewriting/test-inputs")
+set_tests_properties(unit-aig-equivalence PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/eda/cpu/aig-rewriting/CMakeLists.txt;35;add_test;/root/repo/lonestar/eda/cpu/aig-rewriting/CMakeLists.txt;0;")
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sproute-cpu.dir/bookshelf_IO.c.o"
+  "CMakeFiles/sproute-cpu.dir/bookshelf_IO.c.o.d"
+  "CMakeFiles/sproute-cpu.dir/dist.c.o"
+  "CMakeFiles/sproute-cpu.dir/dist.c.o.d"
+  "CMakeFiles/sproute-cpu.dir/dl.c.o"
+  "CMakeFiles/sproute-cpu.dir/dl.c.o.d"
+  "CMakeFiles/sproute-cpu.dir/err.c.o"
+  "CMakeFiles/sproute-cpu.dir/err.c.o.d"
+  "CMakeFiles/sproute-cpu.dir/heap.c.o"
+  "CMakeFiles/sproute-cpu.dir/heap.c.o.d"
+  "CMakeFiles/sproute-cpu.dir/main.cpp.o"
+  "CMakeFiles/sproute-cpu.dir/main.cpp.o.d"
+  "CMakeFiles/sproute-cpu.dir/memAlloc.c.o"
+  "CMakeFiles/sproute-cpu.dir/memAlloc.c.o.d"
+  "CMakeFiles/sproute-cpu.dir/mst2.c.o"
+  "CMakeFiles/sproute-cpu.dir/mst2.c.o.d"
+  "CMakeFiles/sproute-cpu.dir/neighbors.c.o"
+  "CMakeFiles/sproute-cpu.dir/neighbors.c.o.d"
+  "sproute-cpu"
+  "sproute-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/sproute-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lonestar.dir/src/BoilerPlate.cpp.o"
+  "CMakeFiles/lonestar.dir/src/BoilerPlate.cpp.o.d"
+  "liblonestar.a"
+  "liblonestar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lonestar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
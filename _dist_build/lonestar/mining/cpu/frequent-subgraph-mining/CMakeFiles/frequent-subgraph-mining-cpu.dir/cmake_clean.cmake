@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/frequent-subgraph-mining-cpu.dir/fsm.cpp.o"
+  "CMakeFiles/frequent-subgraph-mining-cpu.dir/fsm.cpp.o.d"
+  "frequent-subgraph-mining-cpu"
+  "frequent-subgraph-mining-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/frequent-subgraph-mining-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/mining/cpu/k-clique-listing
+# Build directory: /root/repo/_dist_build/lonestar/mining/cpu/k-clique-listing
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run-small1-k-clique-listing-cpu-1 "/root/repo/_dist_build/lonestar/mining/cpu/k-clique-listing/k-clique-listing-cpu" "-symmetricGraph" "-simpleGraph" "/root/repo/_dist_build/inputs/Mining/citeseer.csgr" "-t" "1")
+set_tests_properties(run-small1-k-clique-listing-cpu-1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/lonestar/mining/cpu/CMakeLists.txt;17;add_test;/root/repo/lonestar/mining/cpu/k-clique-listing/CMakeLists.txt;6;add_test_mine;/root/repo/lonestar/mining/cpu/k-clique-listing/CMakeLists.txt;0;")
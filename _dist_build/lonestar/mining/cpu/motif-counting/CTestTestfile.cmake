@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/mining/cpu/motif-counting
+# Build directory: /root/repo/_dist_build/lonestar/mining/cpu/motif-counting
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run-small1-motif-counting-cpu-1 "/root/repo/_dist_build/lonestar/mining/cpu/motif-counting/motif-counting-cpu" "-symmetricGraph" "-simpleGraph" "/root/repo/_dist_build/inputs/Mining/citeseer.csgr" "-t" "1")
+set_tests_properties(run-small1-motif-counting-cpu-1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/lonestar/mining/cpu/CMakeLists.txt;17;add_test;/root/repo/lonestar/mining/cpu/motif-counting/CMakeLists.txt;6;add_test_mine;/root/repo/lonestar/mining/cpu/motif-counting/CMakeLists.txt;0;")
+add_test(create-motif-counting-small "/root/repo/_dist_build/tools/graph-convert/graph-convert" "-edgelist2gr" "/root/repo/lonestar/mining/cpu/motif-counting/test-inputs/small.edgelist" "small.csgr")
+set_tests_properties(create-motif-counting-small PROPERTIES  LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/mining/cpu/motif-counting/CMakeLists.txt;9;add_test;/root/repo/lonestar/mining/cpu/motif-counting/CMakeLists.txt;0;")
+add_test(run-analytic3-motif-counting-cpu "/root/repo/_dist_build/lonestar/mining/cpu/motif-counting/motif-counting-cpu" "-symmetricGraph" "-simpleGraph" "small.csgr" "-k=3" "-analytic" "-v" "-t" "2")
+set_tests_properties(run-analytic3-motif-counting-cpu PROPERTIES  DEPENDS "create-motif-counting-small" ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "analytic counts match enumeration" _BACKTRACE_TRIPLES "/root/repo/lonestar/mining/cpu/motif-counting/CMakeLists.txt;15;add_test;/root/repo/lonestar/mining/cpu/motif-counting/CMakeLists.txt;0;")
+add_test(run-analytic4-motif-counting-cpu "/root/repo/_dist_build/lonestar/mining/cpu/motif-counting/motif-counting-cpu" "-symmetricGraph" "-simpleGraph" "small.csgr" "-k=4" "-analytic" "-v" "-t" "2")
+set_tests_properties(run-analytic4-motif-counting-cpu PROPERTIES  DEPENDS "create-motif-counting-small" ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "analytic counts match enumeration" _BACKTRACE_TRIPLES "/root/repo/lonestar/mining/cpu/motif-counting/CMakeLists.txt;15;add_test;/root/repo/lonestar/mining/cpu/motif-counting/CMakeLists.txt;0;")
+add_test(run-analytic5-motif-counting-cpu "/root/repo/_dist_build/lonestar/mining/cpu/motif-counting/motif-counting-cpu" "-symmetricGraph" "-simpleGraph" "small.csgr" "-k=5" "-analytic" "-v" "-t" "2")
+set_tests_properties(run-analytic5-motif-counting-cpu PROPERTIES  DEPENDS "create-motif-counting-small" ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "analytic counts match enumeration" _BACKTRACE_TRIPLES "/root/repo/lonestar/mining/cpu/motif-counting/CMakeLists.txt;15;add_test;/root/repo/lonestar/mining/cpu/motif-counting/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/triangle-counting-mining-cpu.dir/tc_mine.cpp.o"
+  "CMakeFiles/triangle-counting-mining-cpu.dir/tc_mine.cpp.o.d"
+  "triangle-counting-mining-cpu"
+  "triangle-counting-mining-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/triangle-counting-mining-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
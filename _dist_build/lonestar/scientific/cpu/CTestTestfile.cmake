@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/scientific/cpu
+# Build directory: /root/repo/_dist_build/lonestar/scientific/cpu
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("barneshut")
+subdirs("delaunayrefinement")
+subdirs("delaunaytriangulation")
+subdirs("longestedge")
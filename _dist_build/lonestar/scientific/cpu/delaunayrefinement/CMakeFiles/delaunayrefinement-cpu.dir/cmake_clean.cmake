@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/delaunayrefinement-cpu.dir/DelaunayRefinement.cpp.o"
+  "CMakeFiles/delaunayrefinement-cpu.dir/DelaunayRefinement.cpp.o.d"
+  "delaunayrefinement-cpu"
+  "delaunayrefinement-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/delaunayrefinement-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
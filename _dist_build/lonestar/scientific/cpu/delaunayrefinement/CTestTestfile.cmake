@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/scientific/cpu/delaunayrefinement
+# Build directory: /root/repo/_dist_build/lonestar/scientific/cpu/delaunayrefinement
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run-small1-delaunayrefinement-cpu-1 "/root/repo/_dist_build/lonestar/scientific/cpu/delaunayrefinement/delaunayrefinement-cpu" "-meshGraph" "/root/repo/_dist_build/inputs/reference/meshes/r10k.1" "-t" "1")
+set_tests_properties(run-small1-delaunayrefinement-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/scientific/cpu/delaunayrefinement/CMakeLists.txt;10;add_test_scale;/root/repo/lonestar/scientific/cpu/delaunayrefinement/CMakeLists.txt;0;")
+add_test(run-small2-delaunayrefinement-cpu-1 "/root/repo/_dist_build/lonestar/scientific/cpu/delaunayrefinement/delaunayrefinement-cpu" "-meshGraph" "/root/repo/_dist_build/inputs/meshes/250k.2" "-t" "1")
+set_tests_properties(run-small2-delaunayrefinement-cpu-1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/scientific/cpu/delaunayrefinement/CMakeLists.txt;11;add_test_scale;/root/repo/lonestar/scientific/cpu/delaunayrefinement/CMakeLists.txt;0;")
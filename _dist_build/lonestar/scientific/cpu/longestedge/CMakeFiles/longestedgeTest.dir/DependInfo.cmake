@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lonestar/scientific/cpu/longestedge/src/libmgrs/mgrs.c" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedgeTest.dir/src/libmgrs/mgrs.c.o" "gcc" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedgeTest.dir/src/libmgrs/mgrs.c.o.d"
+  "/root/repo/lonestar/scientific/cpu/longestedge/src/libmgrs/polarst.c" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedgeTest.dir/src/libmgrs/polarst.c.o" "gcc" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedgeTest.dir/src/libmgrs/polarst.c.o.d"
+  "/root/repo/lonestar/scientific/cpu/longestedge/src/libmgrs/tranmerc.c" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedgeTest.dir/src/libmgrs/tranmerc.c.o" "gcc" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedgeTest.dir/src/libmgrs/tranmerc.c.o.d"
+  "/root/repo/lonestar/scientific/cpu/longestedge/src/libmgrs/ups.c" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedgeTest.dir/src/libmgrs/ups.c.o" "gcc" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedgeTest.dir/src/libmgrs/ups.c.o.d"
+  "/root/repo/lonestar/scientific/cpu/longestedge/src/libmgrs/utm.c" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedgeTest.dir/src/libmgrs/utm.c.o" "gcc" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedgeTest.dir/src/libmgrs/utm.c.o.d"
+  "/root/repo/lonestar/scientific/cpu/longestedge/src/model/Map.cpp" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedgeTest.dir/src/model/Map.cpp.o" "gcc" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedgeTest.dir/src/model/Map.cpp.o.d"
+  "/root/repo/lonestar/scientific/cpu/longestedge/src/readers/SrtmReader.cpp" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedgeTest.dir/src/readers/SrtmReader.cpp.o" "gcc" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedgeTest.dir/src/readers/SrtmReader.cpp.o.d"
+  "/root/repo/lonestar/scientific/cpu/longestedge/src/readers/SrtmTiles.cpp" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedgeTest.dir/src/readers/SrtmTiles.cpp.o" "gcc" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedgeTest.dir/src/readers/SrtmTiles.cpp.o.d"
+  "/root/repo/lonestar/scientific/cpu/longestedge/src/utils/Utils.cpp" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedgeTest.dir/src/utils/Utils.cpp.o" "gcc" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedgeTest.dir/src/utils/Utils.cpp.o.d"
+  "/root/repo/lonestar/scientific/cpu/longestedge/test/TestMain.cpp" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedgeTest.dir/test/TestMain.cpp.o" "gcc" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedgeTest.dir/test/TestMain.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dist_build/libgalois/CMakeFiles/galois_shmem.dir/DependInfo.cmake"
+  "/root/repo/_dist_build/lonestar/liblonestar/CMakeFiles/lonestar.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/longestedgeTest.dir/src/libmgrs/mgrs.c.o"
+  "CMakeFiles/longestedgeTest.dir/src/libmgrs/mgrs.c.o.d"
+  "CMakeFiles/longestedgeTest.dir/src/libmgrs/polarst.c.o"
+  "CMakeFiles/longestedgeTest.dir/src/libmgrs/polarst.c.o.d"
+  "CMakeFiles/longestedgeTest.dir/src/libmgrs/tranmerc.c.o"
+  "CMakeFiles/longestedgeTest.dir/src/libmgrs/tranmerc.c.o.d"
+  "CMakeFiles/longestedgeTest.dir/src/libmgrs/ups.c.o"
+  "CMakeFiles/longestedgeTest.dir/src/libmgrs/ups.c.o.d"
+  "CMakeFiles/longestedgeTest.dir/src/libmgrs/utm.c.o"
+  "CMakeFiles/longestedgeTest.dir/src/libmgrs/utm.c.o.d"
+  "CMakeFiles/longestedgeTest.dir/src/model/Map.cpp.o"
+  "CMakeFiles/longestedgeTest.dir/src/model/Map.cpp.o.d"
+  "CMakeFiles/longestedgeTest.dir/src/readers/SrtmReader.cpp.o"
+  "CMakeFiles/longestedgeTest.dir/src/readers/SrtmReader.cpp.o.d"
+  "CMakeFiles/longestedgeTest.dir/src/readers/SrtmTiles.cpp.o"
+  "CMakeFiles/longestedgeTest.dir/src/readers/SrtmTiles.cpp.o.d"
+  "CMakeFiles/longestedgeTest.dir/src/utils/Utils.cpp.o"
+  "CMakeFiles/longestedgeTest.dir/src/utils/Utils.cpp.o.d"
+  "CMakeFiles/longestedgeTest.dir/test/TestMain.cpp.o"
+  "CMakeFiles/longestedgeTest.dir/test/TestMain.cpp.o.d"
+  "longestedgeTest"
+  "longestedgeTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/longestedgeTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example-conflict-aware-torus.dir/ConflictAwareTorus.cpp.o"
+  "CMakeFiles/example-conflict-aware-torus.dir/ConflictAwareTorus.cpp.o.d"
+  "example-conflict-aware-torus"
+  "example-conflict-aware-torus.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example-conflict-aware-torus.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example-graph-traversal-pull.dir/GraphTraversalPullOperator.cpp.o"
+  "CMakeFiles/example-graph-traversal-pull.dir/GraphTraversalPullOperator.cpp.o.d"
+  "example-graph-traversal-pull"
+  "example-graph-traversal-pull.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example-graph-traversal-pull.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example-graph-traversal-push.dir/GraphTraversalPushOperator.cpp.o"
+  "CMakeFiles/example-graph-traversal-push.dir/GraphTraversalPushOperator.cpp.o.d"
+  "example-graph-traversal-push"
+  "example-graph-traversal-push.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example-graph-traversal-push.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example-malloc.dir/ThirdPartyMalloc.cpp.o"
+  "CMakeFiles/example-malloc.dir/ThirdPartyMalloc.cpp.o.d"
+  "example-malloc"
+  "example-malloc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example-malloc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example-spanningtree.dir/SpanningTree.cpp.o"
+  "CMakeFiles/example-spanningtree.dir/SpanningTree.cpp.o.d"
+  "example-spanningtree"
+  "example-spanningtree.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example-spanningtree.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example-sssp-pull-simple.dir/SSSPPullSimple.cpp.o"
+  "CMakeFiles/example-sssp-pull-simple.dir/SSSPPullSimple.cpp.o.d"
+  "example-sssp-pull-simple"
+  "example-sssp-pull-simple.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example-sssp-pull-simple.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example-sssp-push-simple.dir/SSSPPushSimple.cpp.o"
+  "CMakeFiles/example-sssp-push-simple.dir/SSSPPushSimple.cpp.o.d"
+  "example-sssp-push-simple"
+  "example-sssp-push-simple.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example-sssp-push-simple.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
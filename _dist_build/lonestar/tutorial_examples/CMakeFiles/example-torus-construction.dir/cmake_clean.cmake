@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example-torus-construction.dir/TorusConstruction.cpp.o"
+  "CMakeFiles/example-torus-construction.dir/TorusConstruction.cpp.o.d"
+  "example-torus-construction"
+  "example-torus-construction.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example-torus-construction.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example-torus-improved.dir/TorusImproved.cpp.o"
+  "CMakeFiles/example-torus-improved.dir/TorusImproved.cpp.o.d"
+  "example-torus-improved"
+  "example-torus-improved.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example-torus-improved.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
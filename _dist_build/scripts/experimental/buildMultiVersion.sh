@@ -0,0 +1,8 @@
+#!/bin/bash
+
+scriptsDir=$(dirname $0)
+
+source $scriptsDir/buildFunc.sh
+
+galoisBuildMultiVer
+
@@ -0,0 +1,7 @@
+#!/bin/bash
+
+scriptsDir=$(dirname $0)
+
+source $scriptsDir/buildFunc.sh
+
+galoisRunBuild
@@ -0,0 +1,3 @@
+#!/bin/bash
+
+python ../bmk2/test2.py --max-output-bytes 0 --log ${BMK_LOGS}/bmkrunlog.log --verbose run
@@ -0,0 +1,5 @@
+#!/usr/bin/perl
+
+require "backend.pl";
+# ../inputs/sssp/USA-road-d.W.structure
+run_prog("../debug/apps/boruvka/boruvka /net/faraday/workspace/inputs/weighted/random4-26.structure 1 2");
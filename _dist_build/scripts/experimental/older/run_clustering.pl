@@ -0,0 +1,4 @@
+#!/usr/bin/perl
+
+require "backend.pl";
+run_prog("../debug/apps/clustering/boruvka 10000");
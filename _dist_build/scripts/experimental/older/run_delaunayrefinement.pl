@@ -0,0 +1,5 @@
+#!/usr/bin/perl
+
+require "backend.pl";
+
+run_prog("../apps/delaunayrefinement/delaunayrefinement ../inputs/delaunayrefinement/test.1");
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tools
+# Build directory: /root/repo/_dist_build/tools
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("graph-convert")
+subdirs("graph-generate")
+subdirs("graph-knn")
+subdirs("graph-remap")
+subdirs("graph-stats")
+subdirs("dist-graph-convert")
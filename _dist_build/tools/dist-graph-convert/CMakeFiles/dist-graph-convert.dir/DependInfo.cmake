@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tools/dist-graph-convert/dist-graph-convert-helpers.cpp" "tools/dist-graph-convert/CMakeFiles/dist-graph-convert.dir/dist-graph-convert-helpers.cpp.o" "gcc" "tools/dist-graph-convert/CMakeFiles/dist-graph-convert.dir/dist-graph-convert-helpers.cpp.o.d"
+  "/root/repo/tools/dist-graph-convert/dist-graph-convert.cpp" "tools/dist-graph-convert/CMakeFiles/dist-graph-convert.dir/dist-graph-convert.cpp.o" "gcc" "tools/dist-graph-convert/CMakeFiles/dist-graph-convert.dir/dist-graph-convert.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dist_build/libdist/CMakeFiles/galois_dist_async.dir/DependInfo.cmake"
+  "/root/repo/_dist_build/libgalois/CMakeFiles/galois_shmem.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/graph-convert-huge.dir/graph-convert-huge.cpp.o"
+  "CMakeFiles/graph-convert-huge.dir/graph-convert-huge.cpp.o.d"
+  "graph-convert-huge"
+  "graph-convert-huge.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/graph-convert-huge.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
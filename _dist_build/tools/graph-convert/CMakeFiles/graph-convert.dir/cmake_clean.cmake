@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/graph-convert.dir/graph-convert.cpp.o"
+  "CMakeFiles/graph-convert.dir/graph-convert.cpp.o.d"
+  "graph-convert"
+  "graph-convert.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/graph-convert.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,38 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tools/graph-convert
+# Build directory: /root/repo/_dist_build/tools/graph-convert
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(create-edgelist2gr-gr2edgelist-test-inputs/with-blank-lines.edgelist "/root/repo/_dist_build/tools/graph-convert/graph-convert" "-edgelist2gr" "/root/repo/tools/graph-convert/test-inputs/with-blank-lines.edgelist" "with-blank-lines.edgelist.test")
+set_tests_properties(create-edgelist2gr-gr2edgelist-test-inputs/with-blank-lines.edgelist PROPERTIES  LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-convert/CMakeLists.txt;14;add_test;/root/repo/tools/graph-convert/CMakeLists.txt;32;compare_with_sample;/root/repo/tools/graph-convert/CMakeLists.txt;0;")
+add_test(convert-edgelist2gr-gr2edgelist-test-inputs/with-blank-lines.edgelist "/root/repo/_dist_build/tools/graph-convert/graph-convert" "-gr2edgelist" "with-blank-lines.edgelist.test" "with-blank-lines.edgelist.compare")
+set_tests_properties(convert-edgelist2gr-gr2edgelist-test-inputs/with-blank-lines.edgelist PROPERTIES  DEPENDS "create-edgelist2gr-gr2edgelist-test-inputs/with-blank-lines.edgelist" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-convert/CMakeLists.txt;19;add_test;/root/repo/tools/graph-convert/CMakeLists.txt;32;compare_with_sample;/root/repo/tools/graph-convert/CMakeLists.txt;0;")
+add_test(compare-edgelist2gr-gr2edgelist-test-inputs/with-blank-lines.edgelist "/usr/bin/cmake" "-E" "compare_files" "with-blank-lines.edgelist.compare" "/root/repo/tools/graph-convert/test-inputs/with-blank-lines.edgelist.expected")
+set_tests_properties(compare-edgelist2gr-gr2edgelist-test-inputs/with-blank-lines.edgelist PROPERTIES  DEPENDS "convert-edgelist2gr-gr2edgelist-test-inputs/with-blank-lines.edgelist" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-convert/CMakeLists.txt;25;add_test;/root/repo/tools/graph-convert/CMakeLists.txt;32;compare_with_sample;/root/repo/tools/graph-convert/CMakeLists.txt;0;")
+add_test(create-csv2gr-gr2edgelist-test-inputs/sample.csv "/root/repo/_dist_build/tools/graph-convert/graph-convert" "-csv2gr" "/root/repo/tools/graph-convert/test-inputs/sample.csv" "sample.csv.test")
+set_tests_properties(create-csv2gr-gr2edgelist-test-inputs/sample.csv PROPERTIES  LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-convert/CMakeLists.txt;14;add_test;/root/repo/tools/graph-convert/CMakeLists.txt;33;compare_with_sample;/root/repo/tools/graph-convert/CMakeLists.txt;0;")
+add_test(convert-csv2gr-gr2edgelist-test-inputs/sample.csv "/root/repo/_dist_build/tools/graph-convert/graph-convert" "-gr2edgelist" "sample.csv.test" "sample.csv.compare")
+set_tests_properties(convert-csv2gr-gr2edgelist-test-inputs/sample.csv PROPERTIES  DEPENDS "create-csv2gr-gr2edgelist-test-inputs/sample.csv" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-convert/CMakeLists.txt;19;add_test;/root/repo/tools/graph-convert/CMakeLists.txt;33;compare_with_sample;/root/repo/tools/graph-convert/CMakeLists.txt;0;")
+add_test(compare-csv2gr-gr2edgelist-test-inputs/sample.csv "/usr/bin/cmake" "-E" "compare_files" "sample.csv.compare" "/root/repo/tools/graph-convert/test-inputs/with-blank-lines.edgelist.expected")
+set_tests_properties(compare-csv2gr-gr2edgelist-test-inputs/sample.csv PROPERTIES  DEPENDS "convert-csv2gr-gr2edgelist-test-inputs/sample.csv" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-convert/CMakeLists.txt;25;add_test;/root/repo/tools/graph-convert/CMakeLists.txt;33;compare_with_sample;/root/repo/tools/graph-convert/CMakeLists.txt;0;")
+add_test(create-edgelist2gr-gr2edgelist-test-inputs/with-comments.edgelist "/root/repo/_dist_build/tools/graph-convert/graph-convert" "-edgelist2gr" "/root/repo/tools/graph-convert/test-inputs/with-comments.edgelist" "with-comments.edgelist.test")
+set_tests_properties(create-edgelist2gr-gr2edgelist-test-inputs/with-comments.edgelist PROPERTIES  LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-convert/CMakeLists.txt;14;add_test;/root/repo/tools/graph-convert/CMakeLists.txt;34;compare_with_sample;/root/repo/tools/graph-convert/CMakeLists.txt;0;")
+add_test(convert-edgelist2gr-gr2edgelist-test-inputs/with-comments.edgelist "/root/repo/_dist_build/tools/graph-convert/graph-convert" "-gr2edgelist" "with-comments.edgelist.test" "with-comments.edgelist.compare")
+set_tests_properties(convert-edgelist2gr-gr2edgelist-test-inputs/with-comments.edgelist PROPERTIES  DEPENDS "create-edgelist2gr-gr2edgelist-test-inputs/with-comments.edgelist" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-convert/CMakeLists.txt;19;add_test;/root/repo/tools/graph-convert/CMakeLists.txt;34;compare_with_sample;/root/repo/tools/graph-convert/CMakeLists.txt;0;")
+add_test(compare-edgelist2gr-gr2edgelist-test-inputs/with-comments.edgelist "/usr/bin/cmake" "-E" "compare_files" "with-comments.edgelist.compare" "/root/repo/tools/graph-convert/test-inputs/with-comments.edgelist.expected")
+set_tests_properties(compare-edgelist2gr-gr2edgelist-test-inputs/with-comments.edgelist PROPERTIES  DEPENDS "convert-edgelist2gr-gr2edgelist-test-inputs/with-comments.edgelist" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-convert/CMakeLists.txt;25;add_test;/root/repo/tools/graph-convert/CMakeLists.txt;34;compare_with_sample;/root/repo/tools/graph-convert/CMakeLists.txt;0;")
+add_test(metadata-create "/root/repo/_dist_build/tools/graph-convert/graph-convert" "-edgelist2gr" "-metadata" "/root/repo/tools/graph-convert/test-inputs/with-comments.edgelist" "with-metadata.gr")
+set_tests_properties(metadata-create PROPERTIES  LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-convert/CMakeLists.txt;36;add_test;/root/repo/tools/graph-convert/CMakeLists.txt;0;")
+add_test(metadata-verify "/root/repo/_dist_build/tools/graph-convert/graph-convert" "-verifygr" "with-metadata.gr")
+set_tests_properties(metadata-verify PROPERTIES  DEPENDS "metadata-create" LABELS "quick" PASS_REGULAR_EXPRESSION "metadata OK" _BACKTRACE_TRIPLES "/root/repo/tools/graph-convert/CMakeLists.txt;40;add_test;/root/repo/tools/graph-convert/CMakeLists.txt;0;")
+add_test(metadata-verify-corrupted "/usr/bin/cmake" "-P" "/root/repo/tools/graph-convert/expect-failure.cmake" "/root/repo/_dist_build/tools/graph-convert/graph-convert" "-verifygr" "/root/repo/tools/graph-convert/test-inputs/corrupted-trailer.gr")
+set_tests_properties(metadata-verify-corrupted PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "topology checksum does not match.*metadata check failed" _BACKTRACE_TRIPLES "/root/repo/tools/graph-convert/CMakeLists.txt;52;add_test;/root/repo/tools/graph-convert/CMakeLists.txt;65;add_failure_test;/root/repo/tools/graph-convert/CMakeLists.txt;0;")
+add_test(metadata-verify-truncated "/usr/bin/cmake" "-P" "/root/repo/tools/graph-convert/expect-failure.cmake" "/root/repo/_dist_build/tools/graph-convert/graph-convert" "-verifygr" "/root/repo/tools/graph-convert/test-inputs/truncated-trailer.gr")
+set_tests_properties(metadata-verify-truncated PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "has no metadata" _BACKTRACE_TRIPLES "/root/repo/tools/graph-convert/CMakeLists.txt;52;add_test;/root/repo/tools/graph-convert/CMakeLists.txt;69;add_failure_test;/root/repo/tools/graph-convert/CMakeLists.txt;0;")
+add_test(metadata-reject-symmetric "/usr/bin/cmake" "-P" "/root/repo/tools/graph-convert/expect-failure.cmake" "/root/repo/_dist_build/lonestar/analytics/cpu/connected-components/connected-components-cpu" "-symmetricGraph" "-t" "1" "with-metadata.gr")
+set_tests_properties(metadata-reject-symmetric PROPERTIES  DEPENDS "metadata-create" ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "is not symmetric according to its metadata" _BACKTRACE_TRIPLES "/root/repo/tools/graph-convert/CMakeLists.txt;52;add_test;/root/repo/tools/graph-convert/CMakeLists.txt;75;add_failure_test;/root/repo/tools/graph-convert/CMakeLists.txt;0;")
+add_test(metadata-create-symmetric "/root/repo/_dist_build/tools/graph-generate/graph-generate" "-model" "grid2d" "-width" "4" "-height" "3" "metadata-grid.gr")
+set_tests_properties(metadata-create-symmetric PROPERTIES  LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-convert/CMakeLists.txt;81;add_test;/root/repo/tools/graph-convert/CMakeLists.txt;0;")
+add_test(metadata-accept-symmetric "/root/repo/_dist_build/lonestar/analytics/cpu/connected-components/connected-components-cpu" "-t" "1" "metadata-grid.gr")
+set_tests_properties(metadata-accept-symmetric PROPERTIES  DEPENDS "metadata-create-symmetric" ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "input is symmetric according to its metadata.*Total components: 1" _BACKTRACE_TRIPLES "/root/repo/tools/graph-convert/CMakeLists.txt;85;add_test;/root/repo/tools/graph-convert/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/graph-generate.dir/graph-generate.cpp.o"
+  "CMakeFiles/graph-generate.dir/graph-generate.cpp.o.d"
+  "graph-generate"
+  "graph-generate.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/graph-generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
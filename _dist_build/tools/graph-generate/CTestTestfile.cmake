@@ -0,0 +1,46 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tools/graph-generate
+# Build directory: /root/repo/_dist_build/tools/graph-generate
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(graph-generate-grid2d "/root/repo/_dist_build/tools/graph-generate/graph-generate" "-t" "2" "-model" "grid2d" "-width" "4" "-height" "3" "generated-grid2d.gr")
+set_tests_properties(graph-generate-grid2d PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "Wrote 12 nodes and 34 edges" _BACKTRACE_TRIPLES "/root/repo/tools/graph-generate/CMakeLists.txt;10;add_test;/root/repo/tools/graph-generate/CMakeLists.txt;21;add_graph_generate_test;/root/repo/tools/graph-generate/CMakeLists.txt;0;")
+add_test(graph-generate-grid3d "/root/repo/_dist_build/tools/graph-generate/graph-generate" "-t" "2" "-model" "grid3d" "-width" "3" "-height" "3" "-depth" "3" "-edgeType=uint32" "generated-grid3d.gr")
+set_tests_properties(graph-generate-grid3d PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "Wrote 27 nodes and 108 edges" _BACKTRACE_TRIPLES "/root/repo/tools/graph-generate/CMakeLists.txt;10;add_test;/root/repo/tools/graph-generate/CMakeLists.txt;22;add_graph_generate_test;/root/repo/tools/graph-generate/CMakeLists.txt;0;")
+add_test(graph-generate-rmat "/root/repo/_dist_build/tools/graph-generate/graph-generate" "-t" "2" "-model" "rmat" "-n" "1024" "-degree" "8" "generated-rmat.gr")
+set_tests_properties(graph-generate-rmat PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "Wrote 1024 nodes" _BACKTRACE_TRIPLES "/root/repo/tools/graph-generate/CMakeLists.txt;10;add_test;/root/repo/tools/graph-generate/CMakeLists.txt;23;add_graph_generate_test;/root/repo/tools/graph-generate/CMakeLists.txt;0;")
+add_test(graph-generate-er "/root/repo/_dist_build/tools/graph-generate/graph-generate" "-t" "2" "-model" "er" "-n" "1000" "-degree" "5" "-edgeType=float32" "generated-er.gr")
+set_tests_properties(graph-generate-er PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "Wrote 1000 nodes" _BACKTRACE_TRIPLES "/root/repo/tools/graph-generate/CMakeLists.txt;10;add_test;/root/repo/tools/graph-generate/CMakeLists.txt;24;add_graph_generate_test;/root/repo/tools/graph-generate/CMakeLists.txt;0;")
+add_test(graph-generate-road "/root/repo/_dist_build/tools/graph-generate/graph-generate" "-t" "2" "-model" "road" "-width" "20" "-height" "20" "-edgeType=uint32" "generated-road.gr")
+set_tests_properties(graph-generate-road PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "Wrote 400 nodes" _BACKTRACE_TRIPLES "/root/repo/tools/graph-generate/CMakeLists.txt;10;add_test;/root/repo/tools/graph-generate/CMakeLists.txt;25;add_graph_generate_test;/root/repo/tools/graph-generate/CMakeLists.txt;0;")
+add_test(graph-generate-ba "/root/repo/_dist_build/tools/graph-generate/graph-generate" "-t" "2" "-model" "ba" "-n" "1000" "-degree" "6" "generated-ba.gr")
+set_tests_properties(graph-generate-ba PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "Wrote 1000 nodes" _BACKTRACE_TRIPLES "/root/repo/tools/graph-generate/CMakeLists.txt;10;add_test;/root/repo/tools/graph-generate/CMakeLists.txt;26;add_graph_generate_test;/root/repo/tools/graph-generate/CMakeLists.txt;0;")
+add_test(graph-generate-lfr "/root/repo/_dist_build/tools/graph-generate/graph-generate" "-t" "2" "-model" "lfr" "-n" "1000" "-degree" "10" "generated-lfr.gr")
+set_tests_properties(graph-generate-lfr PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "Planted .* communities.*Wrote 1000 nodes" _BACKTRACE_TRIPLES "/root/repo/tools/graph-generate/CMakeLists.txt;10;add_test;/root/repo/tools/graph-generate/CMakeLists.txt;27;add_graph_generate_test;/root/repo/tools/graph-generate/CMakeLists.txt;0;")
+add_test(graph-generate-er-empty "/root/repo/_dist_build/tools/graph-generate/graph-generate" "-t" "2" "-model" "er" "-n" "1" "generated-er-empty.gr")
+set_tests_properties(graph-generate-er-empty PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "Wrote 1 nodes and 0 edges" _BACKTRACE_TRIPLES "/root/repo/tools/graph-generate/CMakeLists.txt;10;add_test;/root/repo/tools/graph-generate/CMakeLists.txt;28;add_graph_generate_test;/root/repo/tools/graph-generate/CMakeLists.txt;0;")
+add_test(graph-generate-rmat-t1 "/root/repo/_dist_build/tools/graph-generate/graph-generate" "-t" "1" "-model" "rmat" "-n" "1000" "-degree" "8" "generated-rmat-t1.gr")
+set_tests_properties(graph-generate-rmat-t1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-generate/CMakeLists.txt;32;add_test;/root/repo/tools/graph-generate/CMakeLists.txt;0;")
+add_test(graph-generate-rmat-t2 "/root/repo/_dist_build/tools/graph-generate/graph-generate" "-t" "2" "-model" "rmat" "-n" "1000" "-degree" "8" "generated-rmat-t2.gr")
+set_tests_properties(graph-generate-rmat-t2 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-generate/CMakeLists.txt;38;add_test;/root/repo/tools/graph-generate/CMakeLists.txt;0;")
+add_test(graph-generate-rmat-reproducible "/usr/bin/cmake" "-E" "compare_files" "generated-rmat-t1.gr" "generated-rmat-t2.gr")
+set_tests_properties(graph-generate-rmat-reproducible PROPERTIES  DEPENDS "graph-generate-rmat-t1;graph-generate-rmat-t2" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-generate/CMakeLists.txt;44;add_test;/root/repo/tools/graph-generate/CMakeLists.txt;0;")
+add_test(graph-generate-er-t1 "/root/repo/_dist_build/tools/graph-generate/graph-generate" "-t" "1" "-model" "er" "-n" "1000" "-degree" "8" "generated-er-t1.gr")
+set_tests_properties(graph-generate-er-t1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-generate/CMakeLists.txt;32;add_test;/root/repo/tools/graph-generate/CMakeLists.txt;0;")
+add_test(graph-generate-er-t2 "/root/repo/_dist_build/tools/graph-generate/graph-generate" "-t" "2" "-model" "er" "-n" "1000" "-degree" "8" "generated-er-t2.gr")
+set_tests_properties(graph-generate-er-t2 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-generate/CMakeLists.txt;38;add_test;/root/repo/tools/graph-generate/CMakeLists.txt;0;")
+add_test(graph-generate-er-reproducible "/usr/bin/cmake" "-E" "compare_files" "generated-er-t1.gr" "generated-er-t2.gr")
+set_tests_properties(graph-generate-er-reproducible PROPERTIES  DEPENDS "graph-generate-er-t1;graph-generate-er-t2" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-generate/CMakeLists.txt;44;add_test;/root/repo/tools/graph-generate/CMakeLists.txt;0;")
+add_test(graph-generate-ba-t1 "/root/repo/_dist_build/tools/graph-generate/graph-generate" "-t" "1" "-model" "ba" "-n" "1000" "-degree" "8" "generated-ba-t1.gr")
+set_tests_properties(graph-generate-ba-t1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-generate/CMakeLists.txt;32;add_test;/root/repo/tools/graph-generate/CMakeLists.txt;0;")
+add_test(graph-generate-ba-t2 "/root/repo/_dist_build/tools/graph-generate/graph-generate" "-t" "2" "-model" "ba" "-n" "1000" "-degree" "8" "generated-ba-t2.gr")
+set_tests_properties(graph-generate-ba-t2 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-generate/CMakeLists.txt;38;add_test;/root/repo/tools/graph-generate/CMakeLists.txt;0;")
+add_test(graph-generate-ba-reproducible "/usr/bin/cmake" "-E" "compare_files" "generated-ba-t1.gr" "generated-ba-t2.gr")
+set_tests_properties(graph-generate-ba-reproducible PROPERTIES  DEPENDS "graph-generate-ba-t1;graph-generate-ba-t2" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-generate/CMakeLists.txt;44;add_test;/root/repo/tools/graph-generate/CMakeLists.txt;0;")
+add_test(graph-generate-lfr-t1 "/root/repo/_dist_build/tools/graph-generate/graph-generate" "-t" "1" "-model" "lfr" "-n" "1000" "-degree" "8" "generated-lfr-t1.gr")
+set_tests_properties(graph-generate-lfr-t1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-generate/CMakeLists.txt;32;add_test;/root/repo/tools/graph-generate/CMakeLists.txt;0;")
+add_test(graph-generate-lfr-t2 "/root/repo/_dist_build/tools/graph-generate/graph-generate" "-t" "2" "-model" "lfr" "-n" "1000" "-degree" "8" "generated-lfr-t2.gr")
+set_tests_properties(graph-generate-lfr-t2 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-generate/CMakeLists.txt;38;add_test;/root/repo/tools/graph-generate/CMakeLists.txt;0;")
+add_test(graph-generate-lfr-reproducible "/usr/bin/cmake" "-E" "compare_files" "generated-lfr-t1.gr" "generated-lfr-t2.gr")
+set_tests_properties(graph-generate-lfr-reproducible PROPERTIES  DEPENDS "graph-generate-lfr-t1;graph-generate-lfr-t2" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-generate/CMakeLists.txt;44;add_test;/root/repo/tools/graph-generate/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/graph-knn.dir/graph-knn.cpp.o"
+  "CMakeFiles/graph-knn.dir/graph-knn.cpp.o.d"
+  "graph-knn"
+  "graph-knn.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/graph-knn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tools/graph-knn
+# Build directory: /root/repo/_dist_build/tools/graph-knn
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(graph-knn-k1 "/root/repo/_dist_build/tools/graph-knn/graph-knn" "-t" "2" "-k" "1" "/root/repo/tools/graph-knn/test-inputs/two-clusters.txt" "two-clusters-k1.gr")
+set_tests_properties(graph-knn-k1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "Wrote 6 nodes and 6 edges" _BACKTRACE_TRIPLES "/root/repo/tools/graph-knn/CMakeLists.txt;10;add_test;/root/repo/tools/graph-knn/CMakeLists.txt;22;add_graph_knn_test;/root/repo/tools/graph-knn/CMakeLists.txt;0;")
+add_test(graph-knn-k1-symmetric "/root/repo/_dist_build/tools/graph-knn/graph-knn" "-t" "2" "-k" "1" "-symmetric" "/root/repo/tools/graph-knn/test-inputs/two-clusters.txt" "two-clusters-k1-symmetric.gr")
+set_tests_properties(graph-knn-k1-symmetric PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "Wrote 6 nodes and 8 edges" _BACKTRACE_TRIPLES "/root/repo/tools/graph-knn/CMakeLists.txt;10;add_test;/root/repo/tools/graph-knn/CMakeLists.txt;23;add_graph_knn_test;/root/repo/tools/graph-knn/CMakeLists.txt;0;")
+add_test(graph-knn-k2 "/root/repo/_dist_build/tools/graph-knn/graph-knn" "-t" "2" "-k" "2" "-edgeType=uint32" "-scale=100" "/root/repo/tools/graph-knn/test-inputs/two-clusters.txt" "two-clusters-k2.gr")
+set_tests_properties(graph-knn-k2 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "Wrote 6 nodes and 12 edges" _BACKTRACE_TRIPLES "/root/repo/tools/graph-knn/CMakeLists.txt;10;add_test;/root/repo/tools/graph-knn/CMakeLists.txt;24;add_graph_knn_test;/root/repo/tools/graph-knn/CMakeLists.txt;0;")
+add_test(graph-knn-radius "/root/repo/_dist_build/tools/graph-knn/graph-knn" "-t" "2" "-radius" "1.5" "/root/repo/tools/graph-knn/test-inputs/two-clusters.txt" "two-clusters-radius.gr")
+set_tests_properties(graph-knn-radius PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "Wrote 6 nodes and 12 edges" _BACKTRACE_TRIPLES "/root/repo/tools/graph-knn/CMakeLists.txt;10;add_test;/root/repo/tools/graph-knn/CMakeLists.txt;25;add_graph_knn_test;/root/repo/tools/graph-knn/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/graph-remap.dir/graph-remap.cpp.o"
+  "CMakeFiles/graph-remap.dir/graph-remap.cpp.o.d"
+  "graph-remap"
+  "graph-remap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/graph-remap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/graph-stats.dir/graph-stats.cpp.o"
+  "CMakeFiles/graph-stats.dir/graph-stats.cpp.o.d"
+  "graph-stats"
+  "graph-stats.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/graph-stats.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tools/graph-stats
+# Build directory: /root/repo/_dist_build/tools/graph-stats
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(create-graph-stats-two-triangles "/root/repo/_dist_build/tools/graph-convert/graph-convert" "-edgelist2gr" "/root/repo/tools/graph-stats/test-inputs/two-triangles.edgelist" "two-triangles.gr")
+set_tests_properties(create-graph-stats-two-triangles PROPERTIES  LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-stats/CMakeLists.txt;4;add_test;/root/repo/tools/graph-stats/CMakeLists.txt;0;")
+add_test(graph-stats-clusteringCoefficient-two-triangles "/root/repo/_dist_build/tools/graph-stats/graph-stats" "-clusteringCoefficient" "-t" "2" "two-triangles.gr")
+set_tests_properties(graph-stats-clusteringCoefficient-two-triangles PROPERTIES  DEPENDS "create-graph-stats-two-triangles" ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "GlobalClusteringCoefficient: 0.6
+" _BACKTRACE_TRIPLES "/root/repo/tools/graph-stats/CMakeLists.txt;11;add_test;/root/repo/tools/graph-stats/CMakeLists.txt;21;add_graph_stats_test;/root/repo/tools/graph-stats/CMakeLists.txt;0;")
+add_test(graph-stats-componentHist-two-triangles "/root/repo/_dist_build/tools/graph-stats/graph-stats" "-componentHist" "-t" "2" "two-triangles.gr")
+set_tests_properties(graph-stats-componentHist-two-triangles PROPERTIES  DEPENDS "create-graph-stats-two-triangles" ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "NumComponents: 1
+" _BACKTRACE_TRIPLES "/root/repo/tools/graph-stats/CMakeLists.txt;11;add_test;/root/repo/tools/graph-stats/CMakeLists.txt;22;add_graph_stats_test;/root/repo/tools/graph-stats/CMakeLists.txt;0;")
+add_test(graph-stats-sccHist-two-triangles "/root/repo/_dist_build/tools/graph-stats/graph-stats" "-sccHist" "-t" "2" "two-triangles.gr")
+set_tests_properties(graph-stats-sccHist-two-triangles PROPERTIES  DEPENDS "create-graph-stats-two-triangles" ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "LargestSCC: 6
+" _BACKTRACE_TRIPLES "/root/repo/tools/graph-stats/CMakeLists.txt;11;add_test;/root/repo/tools/graph-stats/CMakeLists.txt;23;add_graph_stats_test;/root/repo/tools/graph-stats/CMakeLists.txt;0;")
+add_test(graph-stats-diameter-two-triangles "/root/repo/_dist_build/tools/graph-stats/graph-stats" "-diameter" "-t" "2" "-symmetricGraph" "two-triangles.gr")
+set_tests_properties(graph-stats-diameter-two-triangles PROPERTIES  DEPENDS "create-graph-stats-two-triangles" ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "DiameterLowerBound: 3
+" _BACKTRACE_TRIPLES "/root/repo/tools/graph-stats/CMakeLists.txt;11;add_test;/root/repo/tools/graph-stats/CMakeLists.txt;24;add_graph_stats_test;/root/repo/tools/graph-stats/CMakeLists.txt;0;")
+add_test(graph-stats-degeneracy-two-triangles "/root/repo/_dist_build/tools/graph-stats/graph-stats" "-degeneracy" "-t" "2" "two-triangles.gr")
+set_tests_properties(graph-stats-degeneracy-two-triangles PROPERTIES  DEPENDS "create-graph-stats-two-triangles" ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "Degeneracy: 2
+" _BACKTRACE_TRIPLES "/root/repo/tools/graph-stats/CMakeLists.txt;11;add_test;/root/repo/tools/graph-stats/CMakeLists.txt;25;add_graph_stats_test;/root/repo/tools/graph-stats/CMakeLists.txt;0;")
+add_test(graph-stats-powerLaw-two-triangles "/root/repo/_dist_build/tools/graph-stats/graph-stats" "-powerLaw" "-t" "2" "two-triangles.gr")
+set_tests_properties(graph-stats-powerLaw-two-triangles PROPERTIES  DEPENDS "create-graph-stats-two-triangles" ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "not enough nodes in the tail" _BACKTRACE_TRIPLES "/root/repo/tools/graph-stats/CMakeLists.txt;11;add_test;/root/repo/tools/graph-stats/CMakeLists.txt;26;add_graph_stats_test;/root/repo/tools/graph-stats/CMakeLists.txt;0;")
+add_test(create-graph-stats-rmat "/root/repo/_dist_build/tools/graph-generate/graph-generate" "-t" "2" "-model" "rmat" "-n" "4096" "-degree" "16" "graph-stats-rmat.gr")
+set_tests_properties(create-graph-stats-rmat PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/tools/graph-stats/CMakeLists.txt;29;add_test;/root/repo/tools/graph-stats/CMakeLists.txt;0;")
+add_test(graph-stats-powerLaw-rmat "/root/repo/_dist_build/tools/graph-stats/graph-stats" "-powerLaw" "-t" "2" "graph-stats-rmat.gr")
+set_tests_properties(graph-stats-powerLaw-rmat PROPERTIES  DEPENDS "create-graph-stats-rmat" ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" PASS_REGULAR_EXPRESSION "PowerLawAlpha: (1\\.[5-9]|2\\.)[0-9]*
+PowerLawMinDegree: [0-9]+
+PowerLawTailSize: [0-9]+
+" _BACKTRACE_TRIPLES "/root/repo/tools/graph-stats/CMakeLists.txt;35;add_test;/root/repo/tools/graph-stats/CMakeLists.txt;0;")
@@ -176,11 +176,16 @@ public:
     if (local_mdata == 0)
       local_mdata = mdata.reduce();
 
+    if (galois::runtime::internal::simulatingHosts()) {
+      global_mdata = galois::runtime::internal::simulatedAllReduce(
+          local_mdata, std::plus<Ty>());
+    } else {
 #ifdef GALOIS_USE_LCI
-    reduce_lwci();
+      reduce_lwci();
 #else
-    reduce_mpi();
+      reduce_mpi();
 #endif
+    }
 
     reduceTimer.stop();
 
@@ -312,11 +317,16 @@ public:
     if (local_mdata == 0)
       local_mdata = mdata.reduce();
 
+    if (galois::runtime::internal::simulatingHosts()) {
+      global_mdata = galois::runtime::internal::simulatedAllReduce(
+          local_mdata, [](const Ty& a, const Ty& b) { return std::max(a, b); });
+    } else {
 #ifdef GALOIS_USE_LCI
-    reduce_lwci();
+      reduce_lwci();
 #else
-    reduce_mpi();
+      reduce_mpi();
 #endif
+    }
     reduceTimer.stop();
 
     return global_mdata;
@@ -448,11 +458,16 @@ public:
     if (local_mdata == std::numeric_limits<Ty>::max())
       local_mdata = mdata.reduce();
 
+    if (galois::runtime::internal::simulatingHosts()) {
+      global_mdata = galois::runtime::internal::simulatedAllReduce(
+          local_mdata, [](const Ty& a, const Ty& b) { return std::min(a, b); });
+    } else {
 #ifdef GALOIS_USE_LCI
-    reduce_lwci();
+      reduce_lwci();
 #else
-    reduce_mpi();
+      reduce_mpi();
 #endif
+    }
     reduceTimer.stop();
 
     return global_mdata;
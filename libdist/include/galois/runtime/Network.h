@@ -34,8 +34,12 @@
 #include <mpi.h>
 
 #include <cstdint>
+#include <cstring>
+#include <functional>
 #include <optional>
 #include <tuple>
+#include <type_traits>
+#include <vector>
 
 namespace galois::runtime {
 
@@ -179,6 +183,31 @@ NetworkInterface& getSystemNetworkInterface();
 namespace internal {
 //! Deletes the system network interface (if it exists).
 void destroySystemNetworkInterface();
+
+//! @returns true while simulateHosts is running hosts inside this process
+bool simulatingHosts();
+
+//! Combines size bytes at data across all simulated hosts in host order
+//! using combine(accumulator, other) and leaves the result at data on every
+//! host; stands in for MPI collectives, which cannot be used among simulated
+//! hosts. Must be called by the host's main thread.
+void simulatedAllReduce(void* data, size_t size,
+                        const std::function<void(void*, const void*)>& combine);
+
+//! Typed wrapper around simulatedAllReduce
+template <typename Ty, typename OpTy>
+Ty simulatedAllReduce(Ty value, OpTy op) {
+  static_assert(std::is_trivially_copyable<Ty>::value,
+                "simulated reductions only support trivially copyable types");
+  simulatedAllReduce(&value, sizeof(Ty), [&](void* acc, const void* other) {
+    Ty a, b;
+    std::memcpy(&a, acc, sizeof(Ty));
+    std::memcpy(&b, other, sizeof(Ty));
+    a = op(a, b);
+    std::memcpy(acc, &a, sizeof(Ty));
+  });
+  return value;
+}
 } // namespace internal
 
 //! Gets this host's ID
@@ -191,6 +220,127 @@ NetworkInterface& makeNetworkBuffered();
 //! Returns a LCINetwork interface
 NetworkInterface& makeNetworkLCI();
 
+//! Returns the in-process network shared by the hosts of simulateHosts;
+//! only valid while a simulation is running
+NetworkInterface& makeNetworkSim();
+
+/**
+ * Parameters of the in-process network used by simulateHosts. Times are
+ * counted in scheduler steps: a step passes every time a simulated host
+ * blocks and hands the processor to another host.
+ */
+struct SimNetworkConfig {
+  //! schedule hosts round-robin; otherwise hosts are picked at random
+  bool deterministic = true;
+  //! seed for host scheduling, jitter and dropped messages; 0 draws a fresh
+  //! seed (and prints it) for non-deterministic runs
+  uint64_t seed = 0;
+  //! steps before a message can be received
+  uint32_t latency = 0;
+  //! random extra delay of each message in steps; messages from one host to
+  //! another are still received in the order they were sent
+  uint32_t jitter = 0;
+  //! probability that a message is silently lost
+  double dropRate = 0.0;
+  //! steps without any message traffic after which the run is considered
+  //! deadlocked and aborted
+  uint64_t deadlockSteps = 1 << 16;
+
+  /**
+   * Reads the configuration from the environment: GALOIS_SIM_DETERMINISTIC
+   * (0 or 1), GALOIS_SIM_SEED, GALOIS_SIM_LATENCY, GALOIS_SIM_JITTER,
+   * GALOIS_SIM_DROP and GALOIS_SIM_DEADLOCK_STEPS.
+   */
+  static SimNetworkConfig fromEnv();
+};
+
+/**
+ * Runs fn(hostID) for numHosts simulated hosts inside this process. While it
+ * runs, getSystemNetworkInterface(), host barriers and fences and the
+ * distributed reducers operate on an in-process network, so code written
+ * against NetworkInterface can be tested on a single machine without MPI.
+ *
+ * Every host gets its own thread, but only one host runs at a time: a host
+ * keeps the processor until it waits on the network (a failed receive, a
+ * barrier or a reduction), at which point the scheduler switches to the next
+ * host. Hosts therefore share the thread pool and per-thread storage safely,
+ * and a run is reproducible for a given configuration. NetworkInterface::ID,
+ * NetworkInterface::Num and evilPhase are switched along with the host.
+ *
+ * Limitations: state kept in globals or statics by fn is shared by all hosts
+ * unless it is a HostLocal, receives that wait for remote messages must be
+ * issued by the host's main thread, and fn must not create its own
+ * DistMemSys. Aborts if all hosts block with no message left to deliver,
+ * e.g., after a dropped message.
+ *
+ * @param numHosts number of hosts to simulate
+ * @param fn function run by every host with its host ID
+ * @param config network parameters
+ */
+void simulateHosts(
+    uint32_t numHosts, const std::function<void(uint32_t)>& fn,
+    const SimNetworkConfig& config = SimNetworkConfig::fromEnv());
+
+namespace internal {
+//! State that simulateHosts keeps separately for every simulated host
+class HostLocalBase {
+public:
+  HostLocalBase();
+  virtual ~HostLocalBase();
+  HostLocalBase(const HostLocalBase&) = delete;
+  HostLocalBase& operator=(const HostLocalBase&) = delete;
+
+  //! Sets aside the current state and gives numHosts hosts a fresh one each;
+  //! host 0 runs first
+  virtual void beginHosts(uint32_t numHosts) = 0;
+  //! Puts away the state of host from and brings in the state of host to
+  virtual void switchHost(uint32_t from, uint32_t to) = 0;
+  //! Drops the state of the hosts and restores the state set aside by
+  //! beginHosts; host current ran last
+  virtual void endHosts(uint32_t current) = 0;
+};
+} // namespace internal
+
+/**
+ * A global (or static) object of class type T that every host of
+ * simulateHosts sees a separate instance of, e.g. an application's
+ * GluonSubstrate or the bitsets of its sync structures. It is a T, so code
+ * uses it like the plain global it replaces.
+ *
+ * Only one simulated host runs at a time, so the object simply holds the
+ * state of the running host, also for the worker threads of its parallel
+ * loops, and the scheduler swaps the states of the other hosts in and out
+ * when it switches hosts. Outside of simulateHosts it is a plain T.
+ */
+template <typename T>
+class HostLocal : public T, private internal::HostLocalBase {
+  T saved;                  //!< state outside of simulateHosts
+  std::vector<T> hostState; //!< states of the hosts that are not running
+
+public:
+  using T::T;
+  using T::operator=;
+
+  void beginHosts(uint32_t numHosts) override {
+    using std::swap;
+    hostState.resize(numHosts);
+    swap(static_cast<T&>(*this), saved);
+  }
+
+  void switchHost(uint32_t from, uint32_t to) override {
+    using std::swap;
+    swap(static_cast<T&>(*this), hostState[from]);
+    swap(static_cast<T&>(*this), hostState[to]);
+  }
+
+  void endHosts(uint32_t current) override {
+    using std::swap;
+    swap(static_cast<T&>(*this), hostState[current]);
+    swap(static_cast<T&>(*this), saved);
+    hostState.clear();
+  }
+};
+
 //! Returns a host barrier, which is a regular MPI-Like Barrier for all hosts.
 //! @warning Should not be called within a parallel region; assumes only one
 //! thread is calling it
@@ -52,6 +52,12 @@ class DeSerializeBuffer; // forward declaration for friend declaration
 
 /**
  * Buffer for serialization of data. Mainly used during network communication.
+ *
+ * Besides the data copied into it, the buffer can hold references to large
+ * ranges of contiguous memory owned by someone else (see gSerializeRef). Such
+ * segments are only copied when the buffer is linearized or gathered into a
+ * network message, so large payloads are copied once on their way out instead
+ * of once into the buffer and once more into the message.
  */
 class SerializeBuffer {
   //! Access to a deserialize buffer
@@ -63,7 +69,23 @@ class SerializeBuffer {
   //! the actual data stored in this buffer
   vTy bufdata;
 
+  //! Memory referenced by the buffer; logically placed right before
+  //! bufdata[at]
+  struct Segment {
+    size_t at;
+    const uint8_t* data;
+    size_t bytes;
+  };
+  //! referenced segments in the order they were inserted
+  std::vector<Segment> segments;
+  //! total size of the referenced segments
+  size_t segmentBytes = 0;
+
 public:
+  //! Ranges smaller than this are copied by insertRef; copying them is
+  //! cheaper than tracking them
+  static constexpr size_t minRefBytes = 4096;
+
   //! default constructor
   SerializeBuffer() = default;
   //! disabled copy constructor
@@ -81,6 +103,23 @@ public:
     bufdata.insert(bufdata.end(), c, c + bytes);
   }
 
+  /**
+   * Append a range of memory to the serialize buffer without copying it.
+   * The memory must stay valid and unmodified until the buffer is handed to
+   * the network (which gathers it) or linearized.
+   *
+   * @param c start of the memory to reference
+   * @param bytes number of bytes to reference
+   */
+  void insertRef(const uint8_t* c, size_t bytes) {
+    if (bytes < minRefBytes) {
+      insert(c, bytes);
+      return;
+    }
+    segments.push_back(Segment{bufdata.size(), c, bytes});
+    segmentBytes += bytes;
+  }
+
   //! Insert characters from a buffer into the serialize buffer at a particular
   //! offset
   void insertAt(const uint8_t* c, size_t bytes, size_t offset) {
@@ -100,7 +139,15 @@ public:
     return retval;
   }
 
-  void resize(size_t bytes) { bufdata.resize(bytes); }
+  void resize(size_t bytes) {
+    if (bytes == 0) {
+      segments.clear();
+      segmentBytes = 0;
+    } else {
+      linearize();
+    }
+    bufdata.resize(bytes);
+  }
 
   /**
    * Reserve more space in the serialize buffer.
@@ -109,27 +156,80 @@ public:
    */
   void reserve(size_t s) { bufdata.reserve(bufdata.size() + s); }
 
+  //! Returns true if all data of this buffer is stored in the buffer itself
+  bool isLinear() const { return segments.empty(); }
+
+  /**
+   * Calls f(data, bytes) on each contiguous piece of the buffer in order.
+   */
+  template <typename F>
+  void forEachChunk(F f) const {
+    size_t pos = 0;
+    for (auto& s : segments) {
+      if (s.at > pos)
+        f(bufdata.data() + pos, s.at - pos);
+      f(s.data, s.bytes);
+      pos = s.at;
+    }
+    if (bufdata.size() > pos)
+      f(bufdata.data() + pos, bufdata.size() - pos);
+  }
+
+  //! Copies the contents of the buffer to dst, which must have room for
+  //! size() bytes
+  void gather(uint8_t* dst) const {
+    forEachChunk([&](const uint8_t* c, size_t bytes) {
+      std::copy_n(c, bytes, dst);
+      dst += bytes;
+    });
+  }
+
+  //! Copies referenced segments into the buffer itself
+  void linearize() {
+    if (segments.empty())
+      return;
+    vTy data(size());
+    gather(data.data());
+    bufdata.swap(data);
+    segments.clear();
+    segmentBytes = 0;
+  }
+
   //! Returns a pointer to the data stored in this serialize buffer
-  const uint8_t* linearData() const { return bufdata.data(); }
+  const uint8_t* linearData() {
+    linearize();
+    return bufdata.data();
+  }
   //! Returns vector of data stored in this serialize buffer
-  vTy& getVec() { return bufdata; }
+  vTy& getVec() {
+    linearize();
+    return bufdata;
+  }
 
   //! Returns an iterator to the beginning of the data in this serialize buffer
-  vTy::const_iterator begin() const { return bufdata.cbegin(); }
+  vTy::const_iterator begin() {
+    linearize();
+    return bufdata.cbegin();
+  }
   //! Returns an iterator to the end of the data in this serialize buffer
-  vTy::const_iterator end() const { return bufdata.cend(); }
+  vTy::const_iterator end() {
+    linearize();
+    return bufdata.cend();
+  }
 
   using size_type = vTy::size_type;
 
   //! Returns the size of the serialize buffer
-  size_type size() const { return bufdata.size(); }
+  size_type size() const { return bufdata.size() + segmentBytes; }
 
   //! Utility print function for the serialize buffer
   //! @param o stream to print to
   void print(std::ostream& o) const {
     o << "<{" << std::hex;
-    for (auto& i : bufdata)
-      o << (unsigned int)i << " ";
+    forEachChunk([&](const uint8_t* c, size_t bytes) {
+      for (size_t i = 0; i < bytes; ++i)
+        o << (unsigned int)c[i] << " ";
+    });
     o << std::dec << "}>";
   }
 
@@ -189,6 +289,7 @@ public:
    * Initialize a deserialize buffer from a serialize buffer
    */
   explicit DeSerializeBuffer(SerializeBuffer&& buf) : offset(0) {
+    buf.linearize();
     bufdata.swap(buf.bufdata);
   }
 
@@ -276,6 +377,47 @@ public:
   }
 };
 
+/**
+ * Read-only view of a sequence of memory copyable elements in a deserialize
+ * buffer. Deserializing a vector, PODResizeableArray or gSerializeRef
+ * sequence into a view does not copy the elements out of the buffer, so the
+ * view is only valid as long as the buffer is. Elements that are not aligned
+ * in the buffer are copied into storage owned by the view.
+ */
+template <typename T>
+class DeSerializeView {
+  static_assert(is_memory_copyable<T>::value, "Not POD Sequence");
+  const T* ptr = nullptr;
+  size_t num   = 0;
+  //! holds the elements if they could not be used in place
+  galois::PODResizeableArray<T> unaligned;
+
+public:
+  using value_type     = T;
+  using size_type      = size_t;
+  using const_iterator = const T*;
+
+  //! Points the view to n elements starting at p
+  void refer(const T* p, size_t n) {
+    ptr = p;
+    num = n;
+  }
+
+  //! Copies the next n elements out of buf into the view
+  void copyFrom(DeSerializeBuffer& buf, size_t n) {
+    unaligned.resize(n);
+    buf.extract((uint8_t*)unaligned.data(), n * sizeof(T));
+    refer(unaligned.data(), n);
+  }
+
+  const T* data() const { return ptr; }
+  size_t size() const { return num; }
+  bool empty() const { return num == 0; }
+  const T& operator[](size_t i) const { return ptr[i]; }
+  const_iterator begin() const { return ptr; }
+  const_iterator end() const { return ptr + num; }
+};
+
 namespace internal {
 
 /**
@@ -654,7 +796,8 @@ inline void gSerializeObj(SerializeBuffer& buf,
  * @param [in] data serialize buffer to get data from
  */
 inline void gSerializeObj(SerializeBuffer& buf, const SerializeBuffer& data) {
-  buf.insert(data.linearData(), data.size());
+  data.forEachChunk(
+      [&](const uint8_t* c, size_t bytes) { buf.insert(c, bytes); });
 }
 
 /**
@@ -766,6 +909,40 @@ static inline void gSerialize(SerializeBuffer& buf, T1&& t1, Args&&... args) {
  */
 static inline void gSerialize(SerializeBuffer&) {}
 
+/**
+ * Serialize a vector or PODResizeableArray of memory copyable elements by
+ * reference: the elements are not copied into the buffer (see
+ * SerializeBuffer::insertRef), so the sequence must not be modified until the
+ * buffer is sent. The message is the same as the one gSerialize produces.
+ * Sequences of other elements are serialized as usual.
+ *
+ * @param [in,out] buf Serialize buffer to serialize into
+ * @param [in] seq sequence to serialize
+ */
+template <typename Seq>
+static inline void gSerializeRef(SerializeBuffer& buf, const Seq& seq) {
+  typedef typename Seq::value_type T;
+  if constexpr (is_memory_copyable<T>::value) {
+    typename Seq::size_type size = seq.size();
+    internal::gSerializeObj(buf, size);
+    buf.insertRef((const uint8_t*)seq.data(), size * sizeof(T));
+  } else {
+    internal::gSerializeObj(buf, seq);
+  }
+}
+
+/**
+ * Serialize a dynamic bitset by reference.
+ *
+ * @param [in,out] buf Serialize buffer to serialize into
+ * @param [in] data dynamic bitset to serialize
+ */
+static inline void gSerializeRef(SerializeBuffer& buf,
+                                 const galois::DynamicBitSet& data) {
+  internal::gSerializeObj(buf, data.size());
+  gSerializeRef(buf, data.get_vec());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Deserialize support
 ////////////////////////////////////////////////////////////////////////////////
@@ -1000,6 +1177,25 @@ void gDeserializeObj(DeSerializeBuffer& buf,
   gDeserializeLinearSeq(buf, data);
 }
 
+/**
+ * Deserialize a sequence in place, i.e. without copying its elements out of
+ * the buffer if they are aligned
+ *
+ * @param buf [in,out] Buffer to deserialize from
+ * @param view [in,out] view to point to the sequence
+ */
+template <typename T>
+void gDeserializeObj(DeSerializeBuffer& buf, DeSerializeView<T>& view) {
+  size_t size;
+  gDeserializeObj(buf, size);
+  if (buf.atAlignment(alignof(T))) {
+    view.refer((const T*)buf.r_linearData(), size);
+    buf.setOffset(buf.getOffset() + size * sizeof(T));
+  } else {
+    view.copyFrom(buf, size);
+  }
+}
+
 /**
  * Deserialize into a galois deque
  *
@@ -96,6 +96,11 @@ public:
 
   //! Control-flow barrier across distributed hosts
   virtual void wait() {
+    if (galois::runtime::internal::simulatingHosts()) {
+      galois::runtime::internal::simulatedAllReduce(nullptr, 0,
+                                                    [](void*, const void*) {});
+      return;
+    }
 #ifdef GALOIS_USE_LCI
     lc_barrier(lc_col_ep);
 #else
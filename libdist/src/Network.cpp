@@ -129,6 +129,8 @@ void NetworkInterface::handleReceives() {
 }
 
 NetworkInterface& galois::runtime::getSystemNetworkInterface() {
+  if (internal::simulatingHosts())
+    return makeNetworkSim();
 #ifndef GALOIS_USE_LCI
   return makeNetworkBuffered();
 #else
@@ -245,7 +245,14 @@ class NetworkInterfaceBuffered : public NetworkInterface {
     struct msg {
       uint32_t tag;
       vTy data;
-      msg(uint32_t t, vTy& _data) : tag(t), data(std::move(_data)) {}
+      //! true if data already starts with its length
+      bool framed;
+      msg(uint32_t t, vTy& _data, bool f)
+          : tag(t), data(std::move(_data)), framed(f) {}
+      //! size of the message in an aggregated send
+      size_t wireSize() const {
+        return data.size() + (framed ? 0 : sizeof(uint32_t));
+      }
     };
 
     std::deque<msg> messages;
@@ -306,7 +313,7 @@ class NetworkInterfaceBuffered : public NetworkInterface {
         return std::make_pair(~0, vTy());
 #ifndef NO_AGG
       // compute message size
-      uint32_t len = 0;
+      size_t len   = 0;
       int num      = 0;
       uint32_t tag = messages.front().tag;
       for (auto& m : messages) {
@@ -315,38 +322,49 @@ class NetworkInterfaceBuffered : public NetworkInterface {
         } else {
           // do not let it go over the integer limit because MPI_Isend cannot
           // deal with it
-          if ((m.data.size() + sizeof(uint32_t) + len + num) >
+          if ((m.wireSize() + len) >
               static_cast<size_t>(std::numeric_limits<int>::max())) {
             break;
           }
-          len += m.data.size();
-          num += sizeof(uint32_t);
+          len += m.wireSize();
+          ++num;
         }
       }
+      // a lone framed message is sent as is
+      if (num <= 1 && messages.front().framed) {
+        vTy vec(std::move(messages.front().data));
+        if (urgent)
+          --urgent;
+        messages.pop_front();
+        numBytes -= vec.size();
+        return std::make_pair(tag, std::move(vec));
+      }
       lg.unlock();
       // construct message
       vTy vec;
-      vec.reserve(len + num);
+      vec.reserve(len);
       // go out of our way to avoid locking out senders when making messages
       lg.lock();
       do {
         auto& m = messages.front();
         lg.unlock();
-        union {
-          uint32_t a;
-          uint8_t b[sizeof(uint32_t)];
-        } foo;
-        foo.a = m.data.size();
-        vec.insert(vec.end(), &foo.b[0], &foo.b[sizeof(uint32_t)]);
+        if (!m.framed) {
+          union {
+            uint32_t a;
+            uint8_t b[sizeof(uint32_t)];
+          } foo;
+          foo.a = m.data.size();
+          vec.insert(vec.end(), &foo.b[0], &foo.b[sizeof(uint32_t)]);
+        }
         vec.insert(vec.end(), m.data.begin(), m.data.end());
+        numBytes -= m.data.size();
         if (urgent)
           --urgent;
         lg.lock();
         messages.pop_front();
         --inflightSends;
-      } while (vec.size() < len + num);
+      } while (vec.size() < len);
       ++inflightSends;
-      numBytes -= len;
 #else
       uint32_t tag = messages.front().tag;
       vTy vec(std::move(messages.front().data));
@@ -355,7 +373,7 @@ class NetworkInterfaceBuffered : public NetworkInterface {
       return std::make_pair(tag, std::move(vec));
     }
 
-    void add(uint32_t tag, vTy& b) {
+    void add(uint32_t tag, vTy& b, bool framed = false) {
       std::lock_guard<SimpleLock> lg(lock);
       if (messages.empty()) {
         std::lock_guard<SimpleLock> lg(timelock);
@@ -365,7 +383,7 @@ class NetworkInterfaceBuffered : public NetworkInterface {
       numBytes += b.size();
       galois::runtime::trace("BufferedAdd", oldNumBytes, numBytes, tag,
                              galois::runtime::printVec(b));
-      messages.emplace_back(tag, b);
+      messages.emplace_back(tag, b, framed);
     }
   }; // end send buffer class
 
@@ -460,9 +478,28 @@ public:
     tag += phase;
     statSendNum += 1;
     statSendBytes += buf.size();
-    galois::runtime::trace("sendTagged", dest, tag,
-                           galois::runtime::printVec(buf.getVec()));
+    // trace arguments are evaluated even when tracing is off, and printing
+    // the bytes would linearize buf
+    galois::runtime::trace("sendTagged", dest, tag, buf.size());
     auto& sd = sendData[dest];
+#ifndef NO_AGG
+    if (!buf.isLinear()) {
+      // gather the referenced data straight into a framed message so that
+      // it is copied once on its way to the network
+      union {
+        uint32_t a;
+        uint8_t b[sizeof(uint32_t)];
+      } foo;
+      foo.a = buf.size();
+      vTy vec;
+      vec.resize(sizeof(uint32_t) + buf.size());
+      std::copy_n(&foo.b[0], sizeof(uint32_t), vec.data());
+      buf.gather(vec.data() + sizeof(uint32_t));
+      buf.resize(0);
+      sd.add(tag, vec, true);
+      return;
+    }
+#endif
     sd.add(tag, buf.getVec());
   }
 
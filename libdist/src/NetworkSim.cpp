@@ -0,0 +1,422 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+/**
+ * @file NetworkSim.cpp
+ *
+ * Contains NetworkInterfaceSim, an in-process network that connects hosts
+ * simulated by simulateHosts, and the scheduler that runs those hosts.
+ */
+
+#include "galois/runtime/Network.h"
+#include "galois/runtime/Tracer.h"
+#include "galois/substrate/PerThreadStorage.h"
+#include "galois/substrate/ThreadPool.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <random>
+#include <thread>
+
+using namespace galois::runtime;
+
+namespace {
+
+//! host run by the current thread, or ~0 for threads that are not the main
+//! thread of a simulated host
+thread_local uint32_t simHost = ~0U;
+
+//! every HostLocal in the process
+std::vector<internal::HostLocalBase*>& hostLocals() {
+  static std::vector<internal::HostLocalBase*> objects;
+  return objects;
+}
+
+/**
+ * @class NetworkInterfaceSim
+ *
+ * Network among hosts that are simulated inside one process. Each host runs
+ * on its own thread, but a single host holds the processor at any time and
+ * hands it over whenever it has to wait for other hosts. Messages from one
+ * host to another are received in the order they were sent, and only the
+ * oldest message from each host can be received, like in the buffered
+ * network.
+ */
+class NetworkInterfaceSim : public NetworkInterface {
+  using vTy = galois::PODResizeableArray<uint8_t>;
+
+  struct Message {
+    uint32_t tag;
+    uint64_t readyAt; //!< step at which the message can be received
+    vTy data;
+  };
+
+  struct Collective {
+    uint32_t arrived = 0;
+    uint32_t left    = 0;
+    bool done        = false;
+    std::vector<std::vector<uint8_t>> values;
+  };
+
+  struct Host {
+    uint32_t phase       = 1; //!< evilPhase while the host is switched out
+    uint64_t collectives = 0; //!< collectives started by this host
+    bool finished        = false;
+    bool received        = false; //!< received since anyPendingReceives
+    unsigned long sendMsgs  = 0;
+    unsigned long sendBytes = 0;
+    unsigned long recvMsgs  = 0;
+    unsigned long recvBytes = 0;
+  };
+
+  const SimNetworkConfig config;
+  const uint32_t numHosts;
+
+  std::mutex lock; //!< protects everything below
+  std::condition_variable turnChanged;
+  uint32_t current; //!< host holding the processor
+  uint32_t numLive;
+  uint32_t resident    = 0; //!< host whose HostLocal states are swapped in
+  uint64_t clock       = 0; //!< scheduler steps taken so far
+  uint64_t lastTraffic = 0; //!< step of the last send, receive or collective
+  uint64_t numDropped  = 0;
+  std::mt19937_64 rng;
+  std::vector<Host> hosts;
+  //! inbox[dest][src] holds the messages from src to dest
+  std::vector<std::vector<std::deque<Message>>> inbox;
+  //! lastReady[src][dest] is the ready step of the last message src sent to
+  //! dest; later messages must not become ready earlier
+  std::vector<std::vector<uint64_t>> lastReady;
+  std::map<uint64_t, Collective> collectives;
+
+  bool anyInTransit() const {
+    for (auto& from : inbox)
+      for (auto& q : from)
+        for (auto& m : q)
+          if (m.readyAt > clock)
+            return true;
+    return false;
+  }
+
+  uint32_t nextHost(uint32_t me) {
+    if (config.deterministic) {
+      for (uint32_t i = 1; i <= numHosts; ++i) {
+        uint32_t h = (me + i) % numHosts;
+        if (!hosts[h].finished)
+          return h;
+      }
+      return me;
+    }
+    std::uniform_int_distribution<uint32_t> pick(0, numLive - 1);
+    uint32_t n = pick(rng);
+    for (uint32_t h = 0; h < numHosts; ++h) {
+      if (!hosts[h].finished && n-- == 0)
+        return h;
+    }
+    return me;
+  }
+
+  void resume(uint32_t me) {
+    NetworkInterface::ID = me;
+    evilPhase            = hosts[me].phase;
+    if (resident != me) {
+      for (auto* object : hostLocals())
+        object->switchHost(resident, me);
+      resident = me;
+    }
+  }
+
+  //! Hands the processor to another host and returns once it is back
+  void yieldTurn(std::unique_lock<std::mutex>& lg, uint32_t me) {
+    hosts[me].phase = evilPhase;
+    ++clock;
+    if (clock - lastTraffic > config.deadlockSteps && !anyInTransit()) {
+      GALOIS_DIE("simulated hosts deadlocked: every host is waiting and no "
+                 "message is in transit (",
+                 numDropped, " messages dropped)");
+    }
+    current = nextHost(me);
+    if (current != me) {
+      turnChanged.notify_all();
+      turnChanged.wait(lg, [&] { return current == me; });
+    }
+    resume(me);
+  }
+
+  //! true if the calling thread may give up the processor: it must be the
+  //! main thread of the running host and outside of any parallel loop
+  bool canYield(uint32_t me) const {
+    return simHost == me && !galois::substrate::getThreadPool().isRunning();
+  }
+
+  void hostMain(uint32_t me, const std::function<void(uint32_t)>& fn,
+                std::exception_ptr& error) {
+    simHost = me;
+    // act as thread 0 of the shared thread pool, like the main thread
+    galois::substrate::ptsBase = static_cast<char*>(
+        galois::substrate::getPTSBackend().getRemote(0, 0));
+    galois::substrate::pssBase = static_cast<char*>(
+        galois::substrate::getPPSBackend().getRemote(0, 0));
+    {
+      std::unique_lock<std::mutex> lg(lock);
+      turnChanged.wait(lg, [&] { return current == me; });
+      resume(me);
+    }
+    try {
+      fn(me);
+    } catch (...) {
+      error = std::current_exception();
+    }
+    std::unique_lock<std::mutex> lg(lock);
+    hosts[me].finished = true;
+    --numLive;
+    if (numLive > 0)
+      current = nextHost(me);
+    turnChanged.notify_all();
+  }
+
+public:
+  NetworkInterfaceSim(uint32_t n, const SimNetworkConfig& c)
+      : config(c), numHosts(n), current(0), numLive(n), hosts(n), inbox(n),
+        lastReady(n, std::vector<uint64_t>(n, 0)) {
+    for (auto& from : inbox)
+      from.resize(n);
+    uint64_t seed = config.seed;
+    if (!config.deterministic && seed == 0) {
+      seed = std::random_device()();
+      galois::gPrint("simulated network seed: ", seed, "\n");
+    }
+    rng.seed(seed);
+  }
+
+  void run(const std::function<void(uint32_t)>& fn) {
+    std::vector<std::exception_ptr> errors(numHosts);
+    std::vector<std::thread> threads;
+    for (auto* object : hostLocals())
+      object->beginHosts(numHosts);
+    for (uint32_t h = 0; h < numHosts; ++h) {
+      threads.emplace_back([&, h] { hostMain(h, fn, errors[h]); });
+    }
+    for (auto& t : threads)
+      t.join();
+    for (auto* object : hostLocals())
+      object->endHosts(resident);
+    for (auto& e : errors)
+      if (e)
+        std::rethrow_exception(e);
+  }
+
+  void allReduce(void* data, size_t size,
+                 const std::function<void(void*, const void*)>& combine) {
+    uint32_t me = ID;
+    if (!canYield(me))
+      GALOIS_DIE("simulated collectives must be called by the host's main "
+                 "thread outside of parallel loops");
+    std::unique_lock<std::mutex> lg(lock);
+    uint64_t seq = hosts[me].collectives++;
+    auto& c      = collectives[seq];
+    c.values.resize(numHosts);
+    auto* bytes = static_cast<uint8_t*>(data);
+    c.values[me].assign(bytes, bytes + size);
+    lastTraffic = clock;
+    if (++c.arrived == numHosts) {
+      // combine in host order so that every run gives the same result
+      for (uint32_t h = 1; h < numHosts; ++h)
+        combine(c.values[0].data(), c.values[h].data());
+      c.done = true;
+    }
+    while (!c.done)
+      yieldTurn(lg, me);
+    std::copy(c.values[0].begin(), c.values[0].end(), bytes);
+    if (++c.left == numHosts)
+      collectives.erase(seq);
+  }
+
+  virtual void sendTagged(uint32_t dest, uint32_t tag, SendBuffer& buf,
+                          int phase) {
+    tag += phase;
+    uint32_t src = ID;
+    Message m{tag, 0, std::move(buf.getVec())};
+    galois::runtime::trace("sendTagged", dest, tag,
+                           galois::runtime::printVec(m.data));
+    std::lock_guard<std::mutex> lg(lock);
+    hosts[src].sendMsgs += 1;
+    hosts[src].sendBytes += m.data.size();
+    lastTraffic = clock;
+    if (config.dropRate > 0 &&
+        std::uniform_real_distribution<double>()(rng) < config.dropRate) {
+      ++numDropped;
+      return;
+    }
+    uint64_t delay = config.latency;
+    if (config.jitter > 0)
+      delay += rng() % (config.jitter + 1);
+    m.readyAt = std::max(clock + delay, lastReady[src][dest]);
+    lastReady[src][dest] = m.readyAt;
+    inbox[dest][src].push_back(std::move(m));
+  }
+
+  virtual std::optional<std::pair<uint32_t, RecvBuffer>>
+  recieveTagged(uint32_t tag, std::unique_lock<galois::substrate::SimpleLock>*,
+                int phase) {
+    tag += phase;
+    uint32_t me = ID;
+    std::unique_lock<std::mutex> lg(lock);
+    for (uint32_t h = 0; h < numHosts; ++h) {
+      auto& q = inbox[me][h];
+      if (q.empty() || q.front().tag != tag || q.front().readyAt > clock)
+        continue;
+      RecvBuffer buf(std::move(q.front().data));
+      q.pop_front();
+      hosts[me].recvMsgs += 1;
+      hosts[me].recvBytes += buf.size();
+      hosts[me].received = true;
+      lastTraffic        = clock;
+      galois::runtime::trace("recvTagged", h, tag,
+                             galois::runtime::printVec(buf.getVec()));
+      return std::optional<std::pair<uint32_t, RecvBuffer>>(
+          std::make_pair(h, std::move(buf)));
+    }
+    // callers poll until the message shows up, so let the others run
+    if (canYield(me))
+      yieldTurn(lg, me);
+    return std::optional<std::pair<uint32_t, RecvBuffer>>();
+  }
+
+  virtual void flush() {}
+
+  virtual bool anyPendingSends() { return false; }
+
+  virtual bool anyPendingReceives() {
+    std::lock_guard<std::mutex> lg(lock);
+    auto& host = hosts[ID];
+    if (host.received) {
+      host.received = false;
+      return true;
+    }
+    for (auto& q : inbox[ID])
+      if (!q.empty())
+        return true;
+    return false;
+  }
+
+  virtual unsigned long reportSendBytes() const { return hosts[ID].sendBytes; }
+  virtual unsigned long reportSendMsgs() const { return hosts[ID].sendMsgs; }
+  virtual unsigned long reportRecvBytes() const { return hosts[ID].recvBytes; }
+  virtual unsigned long reportRecvMsgs() const { return hosts[ID].recvMsgs; }
+
+  virtual std::vector<unsigned long> reportExtra() const {
+    return {static_cast<unsigned long>(numDropped)};
+  }
+
+  virtual std::vector<std::pair<std::string, unsigned long>>
+  reportExtraNamed() const {
+    return {{"SimDroppedMessages", static_cast<unsigned long>(numDropped)}};
+  }
+};
+
+std::atomic<NetworkInterfaceSim*> activeSim;
+
+template <typename T>
+T envOr(const char* name, T dflt) {
+  const char* value = std::getenv(name);
+  if (!value || !*value)
+    return dflt;
+  if constexpr (std::is_floating_point<T>::value)
+    return static_cast<T>(std::strtod(value, nullptr));
+  else
+    return static_cast<T>(std::strtoull(value, nullptr, 10));
+}
+
+} // namespace
+
+internal::HostLocalBase::HostLocalBase() { hostLocals().push_back(this); }
+
+internal::HostLocalBase::~HostLocalBase() {
+  auto& objects = hostLocals();
+  objects.erase(std::find(objects.begin(), objects.end(), this));
+}
+
+SimNetworkConfig SimNetworkConfig::fromEnv() {
+  SimNetworkConfig c;
+  c.deterministic = envOr<unsigned>("GALOIS_SIM_DETERMINISTIC", 1) != 0;
+  c.seed          = envOr<uint64_t>("GALOIS_SIM_SEED", c.seed);
+  c.latency       = envOr<uint32_t>("GALOIS_SIM_LATENCY", c.latency);
+  c.jitter        = envOr<uint32_t>("GALOIS_SIM_JITTER", c.jitter);
+  c.dropRate      = envOr<double>("GALOIS_SIM_DROP", c.dropRate);
+  c.deadlockSteps =
+      envOr<uint64_t>("GALOIS_SIM_DEADLOCK_STEPS", c.deadlockSteps);
+  return c;
+}
+
+bool galois::runtime::internal::simulatingHosts() {
+  return activeSim.load() != nullptr;
+}
+
+void galois::runtime::internal::simulatedAllReduce(
+    void* data, size_t size,
+    const std::function<void(void*, const void*)>& combine) {
+  auto* net = activeSim.load();
+  assert(net);
+  net->allReduce(data, size, combine);
+}
+
+NetworkInterface& galois::runtime::makeNetworkSim() {
+  auto* net = activeSim.load();
+  if (!net)
+    GALOIS_DIE("no simulated network: not inside simulateHosts");
+  return *net;
+}
+
+void galois::runtime::simulateHosts(
+    uint32_t numHosts, const std::function<void(uint32_t)>& fn,
+    const SimNetworkConfig& config) {
+  if (numHosts == 0)
+    GALOIS_DIE("cannot simulate 0 hosts");
+  if (activeSim.load())
+    GALOIS_DIE("simulateHosts cannot be nested");
+  // make sure per-thread storage exists before the hosts borrow it
+  galois::substrate::getThreadPool();
+
+  uint32_t savedID    = NetworkInterface::ID;
+  uint32_t savedNum   = NetworkInterface::Num;
+  uint32_t savedPhase = evilPhase;
+
+  NetworkInterfaceSim net(numHosts, config);
+  NetworkInterface::Num = numHosts;
+  activeSim             = &net;
+  try {
+    net.run(fn);
+  } catch (...) {
+    activeSim             = nullptr;
+    NetworkInterface::ID  = savedID;
+    NetworkInterface::Num = savedNum;
+    evilPhase             = savedPhase;
+    throw;
+  }
+  activeSim             = nullptr;
+  NetworkInterface::ID  = savedID;
+  NetworkInterface::Num = savedNum;
+  evilPhase             = savedPhase;
+}
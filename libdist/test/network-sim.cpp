@@ -0,0 +1,104 @@
+#include "galois/Galois.h"
+#include "galois/SharedMemSys.h"
+#include "galois/DReducible.h"
+#include "galois/runtime/Network.h"
+
+#include <string>
+#include <vector>
+
+using namespace galois::runtime;
+
+constexpr uint32_t numHosts = 4;
+constexpr uint32_t numMsgs  = 16;
+
+//! every host sends numMsgs messages to every host (itself included) and
+//! checks that each sender's messages arrive in order; returns the sources in
+//! the order this host received from them
+std::vector<uint32_t> exchange(uint32_t host) {
+  auto& net = getSystemNetworkInterface();
+  GALOIS_ASSERT(net.ID == host && net.Num == numHosts);
+
+  for (uint32_t i = 0; i < numMsgs; ++i) {
+    for (uint32_t h = 0; h < net.Num; ++h) {
+      SendBuffer b;
+      gSerialize(b, host, i);
+      net.sendTagged(h, evilPhase, b);
+    }
+  }
+
+  std::vector<uint32_t> next(net.Num, 0);
+  std::vector<uint32_t> order;
+  while (order.size() < numMsgs * net.Num) {
+    auto p = net.recieveTagged(evilPhase, nullptr);
+    if (!p)
+      continue;
+    uint32_t src, i;
+    gDeserialize(p->second, src, i);
+    GALOIS_ASSERT(src == p->first);
+    GALOIS_ASSERT(i == next[src]++, "messages from ", src, " out of order");
+    order.push_back(src);
+  }
+  ++evilPhase;
+  getHostFence().wait();
+  return order;
+}
+
+void reduce(uint32_t host) {
+  galois::DGAccumulator<uint64_t> sum;
+  galois::DGReduceMax<uint32_t> max;
+  galois::DGReduceMin<uint32_t> min;
+  sum.reset();
+  max.reset();
+  min.reset();
+
+  galois::do_all(galois::iterate(0u, 1000u),
+                 [&](uint32_t i) { sum += i + host; });
+  max.update(host);
+  min.update(host);
+
+  GALOIS_ASSERT(sum.reduce() == numHosts * 999 * 500 + 1000 * 6);
+  GALOIS_ASSERT(max.reduce() == numHosts - 1);
+  GALOIS_ASSERT(min.reduce() == 0);
+  getHostBarrier().wait();
+}
+
+std::vector<std::vector<uint32_t>> run(const SimNetworkConfig& config) {
+  std::vector<std::vector<uint32_t>> orders(numHosts);
+  simulateHosts(
+      numHosts,
+      [&](uint32_t host) {
+        orders[host] = exchange(host);
+        reduce(host);
+        orders[host] = exchange(host);
+      },
+      config);
+  GALOIS_ASSERT(NetworkInterface::Num == 1);
+  return orders;
+}
+
+int main(int argc, char** argv) {
+  galois::SharedMemSys sys;
+  galois::setActiveThreads(2);
+
+  SimNetworkConfig config;
+  if (argc > 1 && std::string(argv[1]) == "drop") {
+    // a lost message leaves its receiver waiting forever, which the
+    // simulator reports as a deadlock
+    config.dropRate      = 1.0;
+    config.deadlockSteps = 1000;
+    run(config);
+    return 0;
+  }
+
+  run(config);
+
+  config.latency = 3;
+  config.jitter  = 5;
+  config.seed    = 42;
+  GALOIS_ASSERT(run(config) == run(config), "deterministic runs differ");
+
+  config.deterministic = false;
+  run(config);
+
+  return 0;
+}
@@ -0,0 +1,120 @@
+#include "galois/DistGalois.h"
+#include "galois/DynamicBitset.h"
+#include "galois/runtime/Network.h"
+#include "galois/runtime/Serialize.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace galois::runtime;
+
+//! large enough for gSerializeRef to reference the elements
+constexpr size_t numLarge = 3 * SendBuffer::minRefBytes / sizeof(uint64_t);
+//! small enough for gSerializeRef to copy them
+constexpr size_t numSmall = 100;
+
+struct Payload {
+  std::vector<uint64_t> large;
+  std::vector<uint16_t> small;
+  galois::PODResizeableArray<uint32_t> pod;
+  galois::DynamicBitSet bits;
+
+  Payload() {
+    for (size_t i = 0; i < numLarge; ++i)
+      large.push_back(i * i + 1);
+    for (size_t i = 0; i < numSmall; ++i)
+      small.push_back(3 * i);
+    pod.resize(numLarge);
+    for (size_t i = 0; i < numLarge; ++i)
+      pod[i] = 7 * i;
+    bits.resize(64 * numLarge);
+    for (size_t i = 0; i < bits.size(); i += 3)
+      bits.set(i);
+  }
+};
+
+//! an odd-sized byte first, so that some sequences are not aligned
+void serialize(SendBuffer& buf, const Payload& p, bool byRef) {
+  gSerialize(buf, uint8_t(42));
+  if (byRef) {
+    gSerializeRef(buf, p.large);
+    gSerializeRef(buf, p.small);
+    gSerialize(buf, uint32_t(43));
+    gSerializeRef(buf, p.pod);
+    gSerializeRef(buf, p.bits);
+  } else {
+    gSerialize(buf, p.large, p.small, uint32_t(43), p.pod, p.bits);
+  }
+}
+
+template <typename T, typename Seq>
+void checkView(const DeSerializeView<T>& view, const Seq& expected) {
+  GALOIS_ASSERT(view.size() == expected.size());
+  GALOIS_ASSERT(std::equal(view.begin(), view.end(), expected.begin()));
+}
+
+void deserializeAndCheck(RecvBuffer& rb, const Payload& p) {
+  uint8_t first;
+  uint32_t middle;
+  DeSerializeView<uint64_t> large;
+  DeSerializeView<uint16_t> small;
+  DeSerializeView<uint32_t> pod;
+  galois::DynamicBitSet bits;
+  gDeserialize(rb, first, large, small, middle, pod, bits);
+  GALOIS_ASSERT(first == 42 && middle == 43);
+  checkView(large, p.large);
+  checkView(small, p.small);
+  checkView(pod, p.pod);
+  GALOIS_ASSERT(bits.size() == p.bits.size());
+  for (size_t i = 0; i < bits.size(); ++i)
+    GALOIS_ASSERT(bits.test(i) == p.bits.test(i));
+  GALOIS_ASSERT(rb.r_size() == 0, "bytes left over");
+}
+
+//! by reference, a buffer holds the same bytes as serialized by copy
+void checkBytes(const Payload& p) {
+  SendBuffer byRef, byCopy;
+  serialize(byRef, p, true);
+  serialize(byCopy, p, false);
+  GALOIS_ASSERT(!byRef.isLinear() && byCopy.isLinear());
+  GALOIS_ASSERT(byRef.size() == byCopy.size());
+
+  std::vector<uint8_t> gathered(byRef.size());
+  byRef.gather(gathered.data());
+  GALOIS_ASSERT(!byRef.isLinear(), "gather must not linearize");
+  GALOIS_ASSERT(!std::memcmp(gathered.data(), byCopy.getVec().data(),
+                             gathered.size()));
+
+  RecvBuffer rb(std::move(byRef));
+  deserializeAndCheck(rb, p);
+}
+
+//! a non-linear buffer sent to this host comes back intact
+void checkNetwork(const Payload& p) {
+  auto& net = getSystemNetworkInterface();
+  for (uint32_t h = 0; h < net.Num; ++h) {
+    SendBuffer buf;
+    serialize(buf, p, true);
+    GALOIS_ASSERT(!buf.isLinear());
+    net.sendTagged(h, evilPhase, buf);
+  }
+  net.flush();
+
+  for (uint32_t received = 0; received < net.Num;) {
+    auto msg = net.recieveTagged(evilPhase, nullptr);
+    if (!msg)
+      continue;
+    deserializeAndCheck(msg->second, p);
+    ++received;
+  }
+  ++evilPhase;
+  getHostFence().wait();
+}
+
+int main() {
+  galois::DistMemSys G;
+  Payload p;
+  checkBytes(p);
+  checkNetwork(p);
+  return 0;
+}
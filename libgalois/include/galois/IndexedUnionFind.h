@@ -0,0 +1,351 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef GALOIS_INDEXEDUNIONFIND_H
+#define GALOIS_INDEXEDUNIONFIND_H
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "galois/config.h"
+#include "galois/AtomicHelpers.h"
+#include "galois/LargeArray.h"
+#include "galois/Loops.h"
+#include "galois/Reduction.h"
+#include "galois/Threads.h"
+#include "galois/gIO.h"
+#include "galois/substrate/PerThreadStorage.h"
+
+namespace galois {
+namespace uf {
+
+//! How two roots are ordered when they are linked; the lower one is placed
+//! below the higher one
+enum class Link {
+  Index,  //!< by element index; the root of a set is its smallest element
+  Rank,   //!< by rank (an upper bound on tree height), ties by index
+  Random, //!< by a fixed pseudo-random permutation of the indices
+};
+
+//! What a find does to the path it walks
+enum class Compress {
+  None,      //!< leave the path alone
+  Halving,   //!< every other node on the path skips to its grandparent
+  Splitting, //!< every node on the path skips to its grandparent
+  Full,      //!< every node on the path points to the root (two passes)
+};
+
+//! Which component labels finalize produces
+enum class Labels {
+  Root,     //!< the root of each set; depends on the schedule for Link::Rank
+  MinIndex, //!< the smallest element of each set
+  Dense,    //!< 0 .. k-1, numbering sets in order of their smallest element
+};
+
+} // namespace uf
+
+/**
+ * Index-based concurrent union-find over the elements 0 .. n-1.
+ *
+ * Unlike @ref UnionFindNode it is not embedded in user data: each element
+ * costs a single IndexTy word. A root stores its rank with the high bit set;
+ * any other element stores its parent's index. Because of that bit at most
+ * 2^(bits - 1) elements can be held.
+ *
+ * unite, find and sameSet may be called concurrently with each other. Links
+ * are made with a compare-and-swap on the lower root's word, which also
+ * checks the rank that was read, so the link order along any path is strictly
+ * increasing and no cycle can form. Compression only moves a node's pointer
+ * to one of its ancestors, so it is safe under concurrent links as well.
+ *
+ * finalize must not run concurrently with anything else.
+ */
+template <typename IndexTy = uint32_t, uf::Link LinkPolicy = uf::Link::Index,
+          uf::Compress CompressPolicy = uf::Compress::Halving>
+class IndexedUnionFind {
+  static_assert(std::is_unsigned<IndexTy>::value,
+                "IndexedUnionFind needs an unsigned index type");
+
+  static constexpr IndexTy ROOT = IndexTy(1)
+                                  << (std::numeric_limits<IndexTy>::digits - 1);
+
+  LargeArray<std::atomic<IndexTy>> parent;
+
+  static bool isRoot(IndexTy w) { return w & ROOT; }
+  static IndexTy rank(IndexTy w) { return w & ~ROOT; }
+
+  //! bijective mix of the index, used as a fixed random priority
+  static IndexTy scramble(IndexTy x) {
+    if (sizeof(IndexTy) <= 4) {
+      uint32_t h = x;
+      h ^= h >> 16;
+      h *= 0x7feb352dU;
+      h ^= h >> 15;
+      h *= 0x846ca68bU;
+      h ^= h >> 16;
+      return h;
+    }
+    uint64_t h = x;
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return h;
+  }
+
+  //! true if root a (with word wa) should be linked below root b
+  static bool below(IndexTy a, IndexTy wa, IndexTy b, IndexTy wb) {
+    switch (LinkPolicy) {
+    case uf::Link::Rank:
+      return rank(wa) < rank(wb) || (rank(wa) == rank(wb) && a > b);
+    case uf::Link::Random:
+      return scramble(a) < scramble(b);
+    default:
+      return a > b;
+    }
+  }
+
+  IndexTy load(IndexTy n) const {
+    return parent[n].load(std::memory_order_relaxed);
+  }
+
+  //! walks to the root of n, compressing as the policy says; the returned
+  //! root may have been linked below another one by the time it is used
+  IndexTy findRoot(IndexTy n) {
+    IndexTy start = n;
+    while (true) {
+      IndexTy p = load(n);
+      if (isRoot(p))
+        break;
+      IndexTy gp = load(p);
+      if (isRoot(gp)) {
+        n = p;
+        break;
+      }
+      switch (CompressPolicy) {
+      case uf::Compress::Halving:
+        parent[n].compare_exchange_weak(p, gp, std::memory_order_relaxed);
+        n = gp;
+        break;
+      case uf::Compress::Splitting:
+        parent[n].compare_exchange_weak(p, gp, std::memory_order_relaxed);
+        n = p;
+        break;
+      default:
+        n = p;
+        break;
+      }
+    }
+
+    if (CompressPolicy == uf::Compress::Full) {
+      // second pass: point everything on the path at the root found
+      IndexTy root = n;
+      n            = start;
+      while (n != root) {
+        IndexTy p = load(n);
+        if (isRoot(p))
+          break;
+        if (p != root)
+          parent[n].compare_exchange_weak(p, root, std::memory_order_relaxed);
+        n = p;
+      }
+      return root;
+    }
+    return n;
+  }
+
+public:
+  typedef IndexTy index_type;
+
+  IndexedUnionFind() = default;
+
+  //! creates n singleton sets
+  explicit IndexedUnionFind(size_t n) { allocate(n); }
+
+  //! (re)creates n singleton sets
+  void allocate(size_t n) {
+    if (n > size_t(ROOT))
+      GALOIS_DIE("IndexedUnionFind: ", n, " elements do not fit the index");
+    if (parent.size() != n) {
+      parent.destroy();
+      parent.deallocate();
+      parent.allocateInterleaved(n);
+    }
+    reset();
+  }
+
+  //! makes every element a singleton set again
+  void reset() {
+    galois::do_all(
+        galois::iterate(size_t{0}, parent.size()),
+        [&](size_t n) { parent.constructAt(n, ROOT); }, galois::no_stats());
+  }
+
+  size_t size() const { return parent.size(); }
+
+  //! returns the current root of n's set
+  IndexTy find(IndexTy n) { return findRoot(n); }
+
+  //! true if a and b are in the same set; linearizable under concurrent
+  //! unites
+  bool sameSet(IndexTy a, IndexTy b) {
+    while (true) {
+      a = findRoot(a);
+      b = findRoot(b);
+      if (a == b)
+        return true;
+      // a is still a root, so the two sets were disjoint at that point
+      if (isRoot(load(a)))
+        return false;
+    }
+  }
+
+  //! merges the sets of a and b; returns false if they were already one set
+  bool unite(IndexTy a, IndexTy b) {
+    while (true) {
+      a = findRoot(a);
+      b = findRoot(b);
+      if (a == b)
+        return false;
+      IndexTy wa = load(a);
+      IndexTy wb = load(b);
+      if (!isRoot(wa) || !isRoot(wb))
+        continue;
+      if (!below(a, wa, b, wb)) {
+        std::swap(a, b);
+        std::swap(wa, wb);
+      }
+      if (!parent[a].compare_exchange_strong(wa, b,
+                                             std::memory_order_relaxed))
+        continue;
+      if (LinkPolicy == uf::Link::Rank && rank(wa) == rank(wb)) {
+        // best effort: if b changed meanwhile its rank is already fine
+        parent[b].compare_exchange_strong(wb, wb + 1,
+                                          std::memory_order_relaxed);
+      }
+      return true;
+    }
+  }
+
+  /**
+   * Points every element directly at its root and writes a component label
+   * for every element into labels (which must hold size() elements).
+   * MinIndex and Dense labels are deterministic whatever the link policy and
+   * schedule. Returns the number of sets.
+   */
+  template <typename LabelArray>
+  size_t finalize(LabelArray& labels, uf::Labels kind = uf::Labels::MinIndex) {
+    size_t n = parent.size();
+    galois::GAccumulator<size_t> numSets;
+    galois::do_all(
+        galois::iterate(size_t{0}, n),
+        [&](size_t i) {
+          IndexTy r = findRoot(i);
+          labels[i] = r;
+          if (r == i)
+            numSets += 1;
+        },
+        galois::steal(), galois::loopname("UnionFindFlatten"));
+    // every find above has finished, so the roots are final; make every
+    // element point at its root directly
+    galois::do_all(
+        galois::iterate(size_t{0}, n),
+        [&](size_t i) {
+          if (labels[i] != i)
+            parent[i].store(labels[i], std::memory_order_relaxed);
+        },
+        galois::no_stats());
+
+    if (kind == uf::Labels::Root)
+      return numSets.reduce();
+
+    if (LinkPolicy != uf::Link::Index) {
+      // roots are not the minima: collect the minimum of each set at its
+      // root and relabel
+      LargeArray<std::atomic<IndexTy>> minimum;
+      minimum.allocateInterleaved(n);
+      galois::do_all(
+          galois::iterate(size_t{0}, n),
+          [&](size_t i) { minimum.constructAt(i, IndexTy(i)); },
+          galois::no_stats());
+      galois::do_all(
+          galois::iterate(size_t{0}, n),
+          [&](size_t i) {
+            if (labels[i] != i)
+              galois::atomicMin(minimum[labels[i]], IndexTy(i));
+          },
+          galois::no_stats());
+      galois::do_all(
+          galois::iterate(size_t{0}, n),
+          [&](size_t i) { labels[i] = minimum[labels[i]].load(); },
+          galois::no_stats());
+    }
+
+    if (kind == uf::Labels::Dense)
+      denseLabels(labels);
+    return numSets.reduce();
+  }
+
+  //! finalize, then fill a new array with the labels
+  LargeArray<IndexTy> finalize(uf::Labels kind = uf::Labels::MinIndex) {
+    LargeArray<IndexTy> labels;
+    labels.allocateInterleaved(parent.size());
+    finalize(labels, kind);
+    return labels;
+  }
+
+private:
+  //! renumbers MinIndex labels to 0 .. k-1 with a blocked parallel scan over
+  //! the set minima (the elements labeled with themselves)
+  template <typename LabelArray>
+  void denseLabels(LabelArray& labels) {
+    size_t n          = parent.size();
+    unsigned nblocks  = galois::getActiveThreads();
+    size_t blockSize  = (n + nblocks - 1) / nblocks;
+    std::vector<size_t> offsets(nblocks + 1, 0);
+    LargeArray<IndexTy> dense;
+    dense.allocateInterleaved(n);
+
+    galois::on_each([&](unsigned tid, unsigned) {
+      size_t count = 0;
+      for (size_t i = tid * blockSize, e = std::min(n, i + blockSize); i < e;
+           ++i)
+        count += labels[i] == i;
+      offsets[tid + 1] = count;
+    });
+    for (unsigned b = 0; b < nblocks; ++b)
+      offsets[b + 1] += offsets[b];
+    galois::on_each([&](unsigned tid, unsigned) {
+      size_t next = offsets[tid];
+      for (size_t i = tid * blockSize, e = std::min(n, i + blockSize); i < e;
+           ++i)
+        if (labels[i] == i)
+          dense[i] = next++;
+    });
+    galois::do_all(
+        galois::iterate(size_t{0}, n),
+        [&](size_t i) { labels[i] = dense[labels[i]]; }, galois::no_stats());
+  }
+};
+
+} // namespace galois
+#endif
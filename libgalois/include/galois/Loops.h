@@ -58,7 +58,8 @@ void for_each(const RangeFunc& rangeMaker, FunctionTy&& fn,
 /**
  * Standard do-all loop. All iterations should be independent.
  * Operator should conform to <code>fn(item)</code> where item is a value from
- * the iteration range.
+ * the iteration range. Passing <code>wl<worklists::ParaMeter<>>()</code>
+ * profiles the loop with the ParaMeter tool instead of running it normally.
  *
  * @param rangeMaker an iterate range maker typically returned by
  * <code>galois::iterate(...)</code>
@@ -70,7 +71,11 @@ void for_each(const RangeFunc& rangeMaker, FunctionTy&& fn,
 template <typename RangeFunc, typename FunctionTy, typename... Args>
 void do_all(const RangeFunc& rangeMaker, FunctionTy&& fn, const Args&... args) {
   auto tpl = std::make_tuple(args...);
-  runtime::do_all_gen(rangeMaker(tpl), std::forward<FunctionTy>(fn), tpl);
+  if constexpr (runtime::isParaMeterLoop<decltype(tpl)>()) {
+    runtime::do_all_ParaMeter(rangeMaker(tpl), fn, tpl);
+  } else {
+    runtime::do_all_gen(rangeMaker(tpl), std::forward<FunctionTy>(fn), tpl);
+  }
 }
 
 /**
@@ -113,6 +118,17 @@ static inline void reportPageAlloc(const char* label) {
   runtime::reportPageAlloc(label);
 }
 
+/**
+ * Reports how much per-thread and per-socket storage (reducers, bags,
+ * worklists, ...) is in use and its high-water marks so far. The values are
+ * printed using the statistics infrastructure.
+ *
+ * @param label Label to associated with report at this program point
+ */
+static inline void reportPerThreadStorage(const char* label) {
+  runtime::reportPerThreadStorage(label);
+}
+
 /**
  * Galois ordered set iterator for stable source algorithms.
  *
@@ -29,6 +29,14 @@
 #include "galois/UserContext.h"
 #include "galois/Threads.h"
 #include "galois/worklists/Chunk.h"
+#include "galois/substrate/PerThreadStorage.h"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <vector>
 
 namespace galois {
 //! Parallel versions of STL library algorithms.
@@ -377,6 +385,490 @@ OutputIt partial_sum(InputIt first, InputIt last, OutputIt d_first) {
   }
 }
 
+namespace internal {
+
+//! [begin, end) of block b when n items are cut into numBlocks equal blocks
+inline std::pair<size_t, size_t> blockRange(size_t n, size_t numBlocks,
+                                            size_t b) {
+  size_t size = (n + numBlocks - 1) / numBlocks;
+  return std::make_pair(std::min(n, b * size), std::min(n, (b + 1) * size));
+}
+
+//! output iterator that only counts what is written to it
+struct CountingOutput {
+  size_t count = 0;
+
+  CountingOutput& operator*() { return *this; }
+  CountingOutput& operator++() { return *this; }
+  CountingOutput& operator++(int) { return *this; }
+  template <typename T>
+  CountingOutput& operator=(const T&) {
+    ++count;
+    return *this;
+  }
+};
+
+/**
+ * Number of elements of the first range among the first k elements of the
+ * stable merge of two sorted ranges (merge path partitioning).
+ */
+template <class It1, class It2, class Compare>
+size_t mergeSplit(It1 first1, size_t n1, It2 first2, size_t n2, size_t k,
+                  Compare comp) {
+  size_t lo = k > n2 ? k - n2 : 0;
+  size_t hi = std::min(k, n1);
+  while (lo < hi) {
+    size_t i = lo + (hi - lo) / 2;
+    size_t j = k - i;
+    // on ties the first range goes first, so take more of it while its next
+    // element is not greater than the last one taken from the second range
+    if (!comp(*(first2 + (j - 1)), *(first1 + i)))
+      lo = i + 1;
+    else
+      hi = i;
+  }
+  return lo;
+}
+
+/**
+ * Splits two sorted ranges into numBlocks pairs of subranges of about equal
+ * total size such that all elements equivalent to each other fall in the same
+ * pair. Returns numBlocks + 1 split points.
+ */
+template <class It1, class It2, class Compare>
+std::vector<std::pair<size_t, size_t>>
+splitByValue(It1 first1, size_t n1, It2 first2, size_t n2, size_t numBlocks,
+             Compare comp) {
+  std::vector<std::pair<size_t, size_t>> splits(numBlocks + 1);
+  splits[numBlocks] = std::make_pair(n1, n2);
+  galois::do_all(
+      galois::iterate(size_t(0), numBlocks),
+      [&](size_t b) {
+        size_t k = internal::blockRange(n1 + n2, numBlocks, b).first;
+        size_t i = mergeSplit(first1, n1, first2, n2, k, comp);
+        size_t j = k - i;
+        if (i == n1 && j == n2) {
+          splits[b] = std::make_pair(n1, n2);
+          return;
+        }
+        // start at the first copy of the next value so that equal elements
+        // never straddle two blocks
+        bool fromFirst =
+            j == n2 || (i < n1 && !comp(*(first2 + j), *(first1 + i)));
+        const auto& v = fromFirst ? *(first1 + i) : *(first2 + j);
+        splits[b] = std::make_pair(
+            size_t(std::lower_bound(first1, first1 + i, v, comp) - first1),
+            size_t(std::lower_bound(first2, first2 + j, v, comp) - first2));
+      },
+      galois::no_stats());
+  return splits;
+}
+
+/**
+ * Runs a sorted-range set operation blockwise: one pass counts each block's
+ * output, a scan places the blocks, and a second pass writes them.
+ */
+template <class It1, class It2, class OutputIt, class Compare, class SetOp>
+OutputIt blockedSetOp(It1 first1, It1 last1, It2 first2, It2 last2,
+                      OutputIt d_first, Compare comp, SetOp op) {
+  size_t n1 = std::distance(first1, last1);
+  size_t n2 = std::distance(first2, last2);
+  if (n1 + n2 <= 1024)
+    return op(first1, last1, first2, last2, d_first, comp);
+
+  size_t numBlocks = galois::getActiveThreads();
+  auto splits = splitByValue(first1, n1, first2, n2, numBlocks, comp);
+  std::vector<size_t> offsets(numBlocks + 1, 0);
+  galois::do_all(
+      galois::iterate(size_t(0), numBlocks),
+      [&](size_t b) {
+        offsets[b + 1] =
+            op(first1 + splits[b].first, first1 + splits[b + 1].first,
+               first2 + splits[b].second, first2 + splits[b + 1].second,
+               CountingOutput(), comp)
+                .count;
+      },
+      galois::no_stats());
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  galois::do_all(
+      galois::iterate(size_t(0), numBlocks),
+      [&](size_t b) {
+        op(first1 + splits[b].first, first1 + splits[b + 1].first,
+           first2 + splits[b].second, first2 + splits[b + 1].second,
+           d_first + offsets[b], comp);
+      },
+      galois::no_stats());
+  return d_first + offsets[numBlocks];
+}
+
+} // namespace internal
+
+/**
+ * Copies the elements satisfying pred to d_first, keeping their order
+ * (stream compaction). Both ranges must be random access; the output must not
+ * overlap the input.
+ *
+ * @returns iterator past the last element written
+ */
+template <class InputIt, class OutputIt, class Predicate>
+OutputIt copy_if(InputIt first, InputIt last, OutputIt d_first,
+                 Predicate pred) {
+  size_t n = std::distance(first, last);
+  if (n <= 1024)
+    return std::copy_if(first, last, d_first, pred);
+
+  size_t numBlocks = galois::getActiveThreads();
+  std::vector<size_t> offsets(numBlocks + 1, 0);
+  galois::on_each([&](unsigned tid, unsigned) {
+    auto r           = internal::blockRange(n, numBlocks, tid);
+    offsets[tid + 1] = std::count_if(first + r.first, first + r.second, pred);
+  });
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  galois::on_each([&](unsigned tid, unsigned) {
+    auto r = internal::blockRange(n, numBlocks, tid);
+    std::copy_if(first + r.first, first + r.second, d_first + offsets[tid],
+                 pred);
+  });
+  return d_first + offsets[numBlocks];
+}
+
+/**
+ * Copies the first element of every run of consecutive elements equivalent
+ * under pred to d_first. The output must not overlap the input.
+ *
+ * @returns iterator past the last element written
+ */
+template <class InputIt, class OutputIt, class BinaryPredicate>
+OutputIt unique_copy(InputIt first, InputIt last, OutputIt d_first,
+                     BinaryPredicate pred) {
+  size_t n = std::distance(first, last);
+  if (n <= 1024)
+    return std::unique_copy(first, last, d_first, pred);
+
+  size_t numBlocks = galois::getActiveThreads();
+  auto isHead      = [&](size_t i) {
+    return i == 0 || !pred(*(first + (i - 1)), *(first + i));
+  };
+  std::vector<size_t> offsets(numBlocks + 1, 0);
+  galois::on_each([&](unsigned tid, unsigned) {
+    auto r       = internal::blockRange(n, numBlocks, tid);
+    size_t count = 0;
+    for (size_t i = r.first; i < r.second; ++i)
+      count += isHead(i);
+    offsets[tid + 1] = count;
+  });
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  galois::on_each([&](unsigned tid, unsigned) {
+    auto r      = internal::blockRange(n, numBlocks, tid);
+    OutputIt out = d_first + offsets[tid];
+    for (size_t i = r.first; i < r.second; ++i)
+      if (isHead(i))
+        *out++ = *(first + i);
+  });
+  return d_first + offsets[numBlocks];
+}
+
+template <class InputIt, class OutputIt>
+OutputIt unique_copy(InputIt first, InputIt last, OutputIt d_first) {
+  return galois::ParallelSTL::unique_copy(first, last, d_first,
+                                          std::equal_to<>());
+}
+
+/**
+ * Removes all but the first element of every run of consecutive equivalent
+ * elements, like std::unique. The survivors are staged in a temporary buffer.
+ *
+ * @returns the new end of the range
+ */
+template <class RandomIt, class BinaryPredicate>
+RandomIt unique(RandomIt first, RandomIt last, BinaryPredicate pred) {
+  size_t n = std::distance(first, last);
+  if (n <= 1024)
+    return std::unique(first, last, pred);
+
+  using ValueType = typename std::iterator_traits<RandomIt>::value_type;
+  std::vector<ValueType> buffer(n);
+  size_t count = galois::ParallelSTL::unique_copy(first, last, buffer.begin(),
+                                                  pred) -
+                 buffer.begin();
+  galois::do_all(
+      galois::iterate(size_t(0), count),
+      [&](size_t i) { *(first + i) = std::move(buffer[i]); },
+      galois::no_stats());
+  return first + count;
+}
+
+template <class RandomIt>
+RandomIt unique(RandomIt first, RandomIt last) {
+  return galois::ParallelSTL::unique(first, last, std::equal_to<>());
+}
+
+/**
+ * Stable merge of two sorted ranges into d_first, which must not overlap
+ * either input. The output is cut into equal blocks whose inputs are found by
+ * binary search, so the work is balanced however skewed the inputs are.
+ *
+ * @returns iterator past the last element written
+ */
+template <class It1, class It2, class OutputIt, class Compare>
+OutputIt merge(It1 first1, It1 last1, It2 first2, It2 last2, OutputIt d_first,
+               Compare comp) {
+  size_t n1 = std::distance(first1, last1);
+  size_t n2 = std::distance(first2, last2);
+  if (n1 + n2 <= 1024)
+    return std::merge(first1, last1, first2, last2, d_first, comp);
+
+  size_t numBlocks = galois::getActiveThreads();
+  galois::on_each([&](unsigned tid, unsigned) {
+    auto r    = internal::blockRange(n1 + n2, numBlocks, tid);
+    size_t i0 = internal::mergeSplit(first1, n1, first2, n2, r.first, comp);
+    size_t i1 = internal::mergeSplit(first1, n1, first2, n2, r.second, comp);
+    std::merge(first1 + i0, first1 + i1, first2 + (r.first - i0),
+               first2 + (r.second - i1), d_first + r.first, comp);
+  });
+  return d_first + (n1 + n2);
+}
+
+template <class It1, class It2, class OutputIt>
+OutputIt merge(It1 first1, It1 last1, It2 first2, It2 last2,
+               OutputIt d_first) {
+  return galois::ParallelSTL::merge(first1, last1, first2, last2, d_first,
+                                    std::less<>());
+}
+
+/**
+ * Parallel std::set_union of two sorted ranges, with the same multiset
+ * semantics. The inputs are split so that equivalent elements are handled by
+ * one block.
+ */
+template <class It1, class It2, class OutputIt, class Compare>
+OutputIt set_union(It1 first1, It1 last1, It2 first2, It2 last2,
+                   OutputIt d_first, Compare comp) {
+  return internal::blockedSetOp(
+      first1, last1, first2, last2, d_first, comp,
+      [](auto f1, auto l1, auto f2, auto l2, auto out, auto c) {
+        return std::set_union(f1, l1, f2, l2, out, c);
+      });
+}
+
+template <class It1, class It2, class OutputIt>
+OutputIt set_union(It1 first1, It1 last1, It2 first2, It2 last2,
+                   OutputIt d_first) {
+  return galois::ParallelSTL::set_union(first1, last1, first2, last2, d_first,
+                                        std::less<>());
+}
+
+//! Parallel std::set_difference: elements of the first range not in the second
+template <class It1, class It2, class OutputIt, class Compare>
+OutputIt set_difference(It1 first1, It1 last1, It2 first2, It2 last2,
+                        OutputIt d_first, Compare comp) {
+  return internal::blockedSetOp(
+      first1, last1, first2, last2, d_first, comp,
+      [](auto f1, auto l1, auto f2, auto l2, auto out, auto c) {
+        return std::set_difference(f1, l1, f2, l2, out, c);
+      });
+}
+
+template <class It1, class It2, class OutputIt>
+OutputIt set_difference(It1 first1, It1 last1, It2 first2, It2 last2,
+                        OutputIt d_first) {
+  return galois::ParallelSTL::set_difference(first1, last1, first2, last2,
+                                             d_first, std::less<>());
+}
+
+//! Parallel std::set_intersection
+template <class It1, class It2, class OutputIt, class Compare>
+OutputIt set_intersection(It1 first1, It1 last1, It2 first2, It2 last2,
+                          OutputIt d_first, Compare comp) {
+  return internal::blockedSetOp(
+      first1, last1, first2, last2, d_first, comp,
+      [](auto f1, auto l1, auto f2, auto l2, auto out, auto c) {
+        return std::set_intersection(f1, l1, f2, l2, out, c);
+      });
+}
+
+template <class It1, class It2, class OutputIt>
+OutputIt set_intersection(It1 first1, It1 last1, It2 first2, It2 last2,
+                          OutputIt d_first) {
+  return galois::ParallelSTL::set_intersection(first1, last1, first2, last2,
+                                               d_first, std::less<>());
+}
+
+/**
+ * Counts how many elements fall in each of numBins integer bins:
+ * counts[b] = |{x in [first, last) : key(x) == b}|. Every key must be below
+ * numBins; counts must have room for numBins values and is overwritten.
+ *
+ * When the bins are few compared to the input, every thread counts its block
+ * into private bins allocated in its own memory and the bins are summed in
+ * parallel. Otherwise threads count with atomic increments into shared bins.
+ */
+template <class InputIt, class CountIt, class KeyFn>
+void histogram(InputIt first, InputIt last, size_t numBins, CountIt counts,
+               KeyFn key) {
+  using CountTy    = typename std::iterator_traits<CountIt>::value_type;
+  size_t n         = std::distance(first, last);
+  size_t numBlocks = galois::getActiveThreads();
+
+  if (n <= 1024) {
+    std::fill(counts, counts + numBins, CountTy(0));
+    for (; first != last; ++first)
+      ++*(counts + key(*first));
+    return;
+  }
+
+  if (numBins * numBlocks <= 4 * n) {
+    substrate::PerThreadStorage<std::vector<CountTy>> local;
+    galois::on_each([&](unsigned tid, unsigned) {
+      auto& bins = *local.getLocal();
+      bins.assign(numBins, CountTy(0));
+      auto r = internal::blockRange(n, numBlocks, tid);
+      for (size_t i = r.first; i < r.second; ++i)
+        ++bins[key(*(first + i))];
+    });
+    galois::do_all(
+        galois::iterate(size_t(0), numBins),
+        [&](size_t b) {
+          CountTy sum = 0;
+          for (unsigned t = 0; t < numBlocks; ++t)
+            sum += (*local.getRemote(t))[b];
+          *(counts + b) = sum;
+        },
+        galois::no_stats());
+    return;
+  }
+
+  std::unique_ptr<std::atomic<CountTy>[]> shared(
+      new std::atomic<CountTy>[numBins]);
+  galois::do_all(
+      galois::iterate(size_t(0), numBins),
+      [&](size_t b) { shared[b].store(0, std::memory_order_relaxed); },
+      galois::no_stats());
+  galois::do_all(
+      galois::iterate(size_t(0), n),
+      [&](size_t i) {
+        shared[key(*(first + i))].fetch_add(1, std::memory_order_relaxed);
+      },
+      galois::no_stats());
+  galois::do_all(
+      galois::iterate(size_t(0), numBins),
+      [&](size_t b) {
+        *(counts + b) = shared[b].load(std::memory_order_relaxed);
+      },
+      galois::no_stats());
+}
+
+/**
+ * Stable counting sort on small integer keys: copies [first, last) to
+ * d_first grouped by key(x) in [0, numKeys), keeping the input order within a
+ * key. If offsets is given it receives numKeys + 1 values, the start of each
+ * key's group followed by the total.
+ *
+ * Each thread counts and scatters its own block of the input, so the
+ * temporary space is numKeys counters per thread.
+ */
+template <class InputIt, class OutputIt, class KeyFn, class OffsetIt>
+void counting_sort(InputIt first, InputIt last, OutputIt d_first,
+                   size_t numKeys, KeyFn key, OffsetIt offsets) {
+  size_t n = std::distance(first, last);
+  std::vector<size_t> starts(numKeys + 1, 0);
+
+  if (n <= 1024) {
+    for (InputIt ii = first; ii != last; ++ii)
+      ++starts[key(*ii) + 1];
+    std::partial_sum(starts.begin(), starts.end(), starts.begin());
+    std::vector<size_t> cursor(starts.begin(), starts.end() - 1);
+    for (; first != last; ++first)
+      *(d_first + cursor[key(*first)]++) = *first;
+    std::copy(starts.begin(), starts.end(), offsets);
+    return;
+  }
+
+  size_t numBlocks = galois::getActiveThreads();
+  substrate::PerThreadStorage<std::vector<size_t>> local;
+  galois::on_each([&](unsigned tid, unsigned) {
+    auto& counts = *local.getLocal();
+    counts.assign(numKeys, 0);
+    auto r = internal::blockRange(n, numBlocks, tid);
+    for (size_t i = r.first; i < r.second; ++i)
+      ++counts[key(*(first + i))];
+  });
+  galois::do_all(
+      galois::iterate(size_t(0), numKeys),
+      [&](size_t k) {
+        size_t sum = 0;
+        for (unsigned t = 0; t < numBlocks; ++t)
+          sum += (*local.getRemote(t))[k];
+        starts[k + 1] = sum;
+      },
+      galois::no_stats());
+  galois::ParallelSTL::partial_sum(starts.begin(), starts.end(),
+                                   starts.begin());
+  // turn each block's counts into its write cursors
+  galois::do_all(
+      galois::iterate(size_t(0), numKeys),
+      [&](size_t k) {
+        size_t pos = starts[k];
+        for (unsigned t = 0; t < numBlocks; ++t) {
+          size_t& c     = (*local.getRemote(t))[k];
+          size_t blockN = c;
+          c             = pos;
+          pos += blockN;
+        }
+      },
+      galois::no_stats());
+  galois::on_each([&](unsigned tid, unsigned) {
+    auto& cursor = *local.getLocal();
+    auto r       = internal::blockRange(n, numBlocks, tid);
+    for (size_t i = r.first; i < r.second; ++i)
+      *(d_first + cursor[key(*(first + i))]++) = *(first + i);
+  });
+  std::copy(starts.begin(), starts.end(), offsets);
+}
+
+template <class InputIt, class OutputIt, class KeyFn>
+void counting_sort(InputIt first, InputIt last, OutputIt d_first,
+                   size_t numKeys, KeyFn key) {
+  internal::CountingOutput discard;
+  galois::ParallelSTL::counting_sort(first, last, d_first, numKeys, key,
+                                     discard);
+}
+
+/**
+ * Semisort: copies [first, last) to d_first so that elements with equal keys
+ * are contiguous. Groups come in no particular order. Keys may be any type
+ * with std::hash and operator<.
+ *
+ * Elements are first scattered by a hash of their key into about n / 16
+ * buckets with counting_sort, then every bucket is sorted by key in parallel.
+ */
+template <class InputIt, class RandomIt, class KeyFn>
+void semisort(InputIt first, InputIt last, RandomIt d_first, KeyFn key) {
+  size_t n = std::distance(first, last);
+  unsigned logBuckets = 0;
+  while ((size_t(1) << logBuckets) < n / 16)
+    ++logBuckets;
+  size_t numBuckets = size_t(1) << logBuckets;
+
+  auto bucketOf = [&](const auto& v) -> size_t {
+    if (logBuckets == 0)
+      return 0;
+    uint64_t h = std::hash<std::decay_t<decltype(key(v))>>()(key(v));
+    // Fibonacci hashing spreads structured keys such as consecutive ids
+    return (h * 0x9E3779B97F4A7C15ull) >> (64 - logBuckets);
+  };
+  std::vector<size_t> starts(numBuckets + 1);
+  galois::ParallelSTL::counting_sort(first, last, d_first, numBuckets,
+                                     bucketOf, starts.begin());
+  auto byKey = [&](const auto& a, const auto& b) { return key(a) < key(b); };
+  galois::do_all(
+      galois::iterate(size_t(0), numBuckets),
+      [&](size_t b) {
+        std::sort(d_first + starts[b], d_first + starts[b + 1], byKey);
+      },
+      galois::steal(), galois::no_stats());
+}
+
 } // end namespace ParallelSTL
 } // end namespace galois
 #endif
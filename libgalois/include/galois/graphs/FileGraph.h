@@ -41,6 +41,7 @@
 #include "galois/MethodFlags.h"
 #include "galois/LargeArray.h"
 #include "galois/graphs/Details.h"
+#include "galois/graphs/GraphMetadata.h"
 #include "galois/graphs/GraphHelpers.h"
 #include "galois/runtime/Context.h"
 #include "galois/substrate/CacheLineStorage.h"
@@ -99,6 +100,11 @@ protected:
   //! adjustments to edge index when we load only part of a graph
   uint64_t edgeOffset;
 
+  //! Self-description of the file; all unknown if it had no trailer
+  GraphMetadata metadata;
+  //! Where the metadata trailer starts in the file, 0 if there is none
+  size_t metadataOffset;
+
 private:
   //! If initialized, this array stores node degrees in memory for fast access
   //! via the getDegree function
@@ -177,7 +183,19 @@ private:
   size_t findIndex(size_t nodeSize, size_t edgeSize, size_t targetSize,
                    size_t lb, size_t ub);
 
-  void fromFileInterleaved(const std::string& filename, size_t sizeofEdgeData);
+  /**
+   * Loads the file and pages it in. type is checked against the file's
+   * metadata before any edge data is touched.
+   */
+  void fromFileInterleaved(const std::string& filename, size_t sizeofEdgeData,
+                           GraphMetadata::EdgeType type);
+
+  /**
+   * Dies if the file's metadata says its edge data has a different size
+   * than the type it is read as; warns if only the type differs.
+   */
+  void checkEdgeType(GraphMetadata::EdgeType type, size_t size,
+                     const std::string& filename) const;
 
   /**
    * Page in a portion of the loaded graph data based based on division of labor
@@ -632,7 +650,8 @@ public:
   void fromFileInterleaved(
       const std::string& filename,
       typename std::enable_if<!std::is_void<EdgeTy>::value>::type* = 0) {
-    fromFileInterleaved(filename, sizeof(EdgeTy));
+    fromFileInterleaved(filename, sizeof(EdgeTy),
+                        GraphMetadata::typeOf<EdgeTy>());
   }
 
   /**
@@ -645,7 +664,7 @@ public:
   void fromFileInterleaved(
       const std::string& filename,
       typename std::enable_if<std::is_void<EdgeTy>::value>::type* = 0) {
-    fromFileInterleaved(filename, 0);
+    fromFileInterleaved(filename, 0, GraphMetadata::UNKNOWN_TYPE);
   }
 
   /**
@@ -658,12 +677,29 @@ public:
   }
 
   /**
-   * Write current contents of mappings to a file
+   * Write current contents of mappings to a file. A metadata trailer read
+   * with the graph is not written since the graph may have been changed in
+   * place; use writeGraphMetadata to attach new metadata.
    *
    * @param file File to write to
    * @todo perform host -> le on data
    */
   void toFile(const std::string& file);
+
+  //! True if the file carried a metadata trailer
+  bool hasMetadata() const { return metadataOffset != 0; }
+
+  //! Metadata read with the file; every property is unknown if it had none
+  const GraphMetadata& getMetadata() const { return metadata; }
+
+  /**
+   * Scans the graph in parallel and returns its exact properties and
+   * checksums. The whole graph must be loaded (not with partFromFile).
+   * Symmetry of unsorted graphs is checked on a sorted copy of the edges.
+   *
+   * @param type edge data type to record; its size must match the file's
+   */
+  GraphMetadata computeMetadata(GraphMetadata::EdgeType type);
 };
 
 /**
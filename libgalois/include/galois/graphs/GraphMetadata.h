@@ -0,0 +1,163 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef GALOIS_GRAPHS_GRAPHMETADATA_H
+#define GALOIS_GRAPHS_GRAPHMETADATA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include "galois/config.h"
+
+namespace galois {
+namespace graphs {
+
+/**
+ * Self-description of a .gr file: structural properties, the type of the
+ * edge data and checksums of its contents.
+ *
+ * It is stored in an optional trailer after the edge data (see FileGraph.cpp
+ * for the layout), so files with metadata are still valid version 1 and 2
+ * files for readers that do not know about it, and files without it simply
+ * have every property unknown.
+ */
+struct GraphMetadata {
+  //! Each property is known to hold, known not to hold, or unknown
+  enum Property : uint64_t {
+    //! (u, v) is an edge iff (v, u) is
+    SYMMETRIC = 1 << 0,
+    //! the neighbors of every node are in increasing order
+    SORTED = 1 << 1,
+    //! no edge appears twice
+    NO_DUPLICATES = 1 << 2,
+    //! no edge (u, u)
+    NO_SELF_LOOPS = 1 << 3,
+    //! the edges are the in-edges of some original graph
+    TRANSPOSE = 1 << 4,
+  };
+  static constexpr uint64_t ALL_PROPERTIES = (TRANSPOSE << 1) - 1;
+
+  enum EdgeType : uint64_t {
+    UNKNOWN_TYPE = 0,
+    VOID_TYPE,
+    INT32_TYPE,
+    UINT32_TYPE,
+    INT64_TYPE,
+    UINT64_TYPE,
+    FLOAT32_TYPE,
+    FLOAT64_TYPE,
+  };
+
+  uint64_t known      = 0;
+  uint64_t properties = 0;
+  EdgeType edgeType   = UNKNOWN_TYPE;
+  //! checksums are over the little-endian 64-bit words of the file; the
+  //! topology covers the header, node indices and destinations
+  bool hasChecksums         = false;
+  uint64_t topologyChecksum = 0;
+  uint64_t edgeDataChecksum = 0;
+
+  void set(Property p, bool holds) {
+    known |= p;
+    properties = holds ? properties | p : properties & ~uint64_t(p);
+  }
+  void forget(Property p) {
+    known &= ~uint64_t(p);
+    properties &= ~uint64_t(p);
+  }
+  bool isKnown(Property p) const { return known & p; }
+  //! known to hold
+  bool has(Property p) const { return known & properties & p; }
+  //! known not to hold
+  bool lacks(Property p) const { return known & ~properties & p; }
+
+  /**
+   * Dies if a property in required is known not to hold or if the edge
+   * data is known to be of another type. Unknown properties pass, so files
+   * without metadata load as before.
+   *
+   * @param required bitwise or of Property values
+   * @param type edge data type expected; UNKNOWN_TYPE accepts any
+   * @param filename used in the error message
+   */
+  void require(uint64_t required, EdgeType type,
+               const std::string& filename) const;
+
+  //! Human-readable summary, e.g. "symmetric sorted !self-loops uint32"
+  std::string describe() const;
+
+  static const char* name(Property p);
+  static const char* name(EdgeType t);
+  //! Size in bytes of one edge of type t; 0 for void and unknown
+  static size_t sizeOf(EdgeType t);
+
+  //! The EdgeType for C++ type T, UNKNOWN_TYPE for anything else
+  template <typename T>
+  static constexpr EdgeType typeOf() {
+    if (std::is_void<T>::value)
+      return VOID_TYPE;
+    if (std::is_same<T, int32_t>::value)
+      return INT32_TYPE;
+    if (std::is_same<T, uint32_t>::value)
+      return UINT32_TYPE;
+    if (std::is_same<T, int64_t>::value)
+      return INT64_TYPE;
+    if (std::is_same<T, uint64_t>::value)
+      return UINT64_TYPE;
+    if (std::is_same<T, float>::value)
+      return FLOAT32_TYPE;
+    if (std::is_same<T, double>::value)
+      return FLOAT64_TYPE;
+    return UNKNOWN_TYPE;
+  }
+};
+
+namespace internal {
+/**
+ * Parses the metadata trailer of a whole .gr file held in memory.
+ *
+ * @param offset receives the position of the trailer, i.e., the size of the
+ * graph proper
+ * @returns false if there is no valid trailer
+ */
+bool parseGraphMetadata(const void* file, size_t len, GraphMetadata& meta,
+                        size_t& offset);
+} // namespace internal
+
+/**
+ * Reads only the metadata trailer of a .gr file, without loading the graph.
+ *
+ * @returns false if the file cannot be opened, is not a .gr file or has no
+ * trailer
+ */
+bool readGraphMetadata(const std::string& filename, GraphMetadata& meta);
+
+/**
+ * Replaces the metadata trailer of a .gr file, appending one if it has
+ * none. The graph itself is not touched.
+ */
+void writeGraphMetadata(const std::string& filename,
+                        const GraphMetadata& meta);
+
+} // namespace graphs
+} // namespace galois
+
+#endif
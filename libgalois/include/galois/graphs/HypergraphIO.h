@@ -0,0 +1,76 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "galois/config.h"
+#include "galois/LargeArray.h"
+
+namespace galois {
+namespace graphs {
+
+/**
+ * A hypergraph in CSR form: the pins of net i are
+ * pins[netEnd[i-1] .. netEnd[i]), as 0-based node ids. Weight arrays are
+ * empty when the input carries no weights of that kind.
+ */
+struct HypergraphCSR {
+  uint64_t numNets  = 0;
+  uint64_t numNodes = 0;
+  LargeArray<uint64_t> netEnd;
+  LargeArray<uint32_t> pins;
+  LargeArray<uint32_t> netWeights;
+  LargeArray<uint32_t> nodeWeights;
+
+  uint64_t numPins() const { return numNets ? netEnd[numNets - 1] : 0; }
+  uint64_t netBegin(uint64_t net) const { return net ? netEnd[net - 1] : 0; }
+  bool hasNetWeights() const { return netWeights.size() != 0; }
+  bool hasNodeWeights() const { return nodeWeights.size() != 0; }
+};
+
+enum class HypergraphFormat {
+  hMetis, //!< hMetis text; header "nets nodes [fmt]", 1-based pins
+  PaToH,  //!< PaToH text; header "base cells nets pins [scheme [ncon]]"
+  Binary, //!< binary CSR written by writeHypergraphBinary
+  Auto,   //!< Binary if the file starts with its magic number, else hMetis
+};
+
+/**
+ * Reads a hypergraph. Text inputs are split into lines and parsed in
+ * parallel. Lines starting with '%' and blank lines are skipped. For
+ * multi-constraint PaToH inputs only the first node weight is kept.
+ *
+ * Dies with a message naming the offending net on malformed input.
+ */
+HypergraphCSR readHypergraph(const std::string& filename,
+                             HypergraphFormat format = HypergraphFormat::Auto);
+
+/**
+ * Writes the binary format: a header of six uint64_t (magic, version,
+ * numNets, numNodes, numPins, flags), netEnd, pins padded to 8 bytes, then
+ * net weights and node weights if flags bits 0 and 1 are set.
+ */
+void writeHypergraphBinary(const HypergraphCSR& hg,
+                           const std::string& filename);
+
+} // namespace graphs
+} // namespace galois
@@ -0,0 +1,274 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef GALOIS_GRAPHS_KDTREE_H
+#define GALOIS_GRAPHS_KDTREE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "galois/config.h"
+#include "galois/Galois.h"
+#include "galois/LargeArray.h"
+#include "galois/gIO.h"
+
+namespace galois {
+namespace graphs {
+
+/**
+ * A static k-d tree over points with any number of dimensions, bulk loaded
+ * in parallel and queried from any number of threads at once.
+ *
+ * The tree is balanced and implicit: node i covers a range [b, e) of the
+ * point permutation, its children are 2i+1 and 2i+2 and split that range at
+ * its midpoint, and a node with at most leafSize points is a leaf. Each inner
+ * node only stores the split dimension, chosen as the one with the widest
+ * spread, and the split value. Points are copied in tree order, so a leaf is
+ * one contiguous block of coordinates.
+ *
+ * Distances are squared Euclidean.
+ *
+ * @tparam T coordinate type
+ */
+template <typename T = float>
+class KdTree {
+public:
+  //! a query result; dist2 is the squared distance to the query
+  struct Neighbor {
+    uint32_t id;
+    T dist2;
+
+    bool operator<(const Neighbor& o) const {
+      return dist2 < o.dist2 || (dist2 == o.dist2 && id < o.id);
+    }
+  };
+
+  static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+private:
+  unsigned numDims  = 0;
+  unsigned leafSize = 0;
+  size_t numPoints  = 0;
+  //! coordinates in tree order
+  LargeArray<T> points;
+  //! original id of each point in tree order
+  LargeArray<uint32_t> ids;
+  LargeArray<uint8_t> splitDim;
+  LargeArray<T> splitValue;
+
+  struct Task {
+    size_t node;
+    size_t begin;
+    size_t end;
+  };
+
+  template <typename U>
+  static void reallocate(LargeArray<U>& a, size_t n) {
+    a.destroy();
+    a.deallocate();
+    a.allocateBlocked(n);
+  }
+
+  bool isLeaf(size_t begin, size_t end) const { return end - begin <= leafSize; }
+
+  T dist2(const T* a, const T* b) const {
+    T d = 0;
+    for (unsigned i = 0; i < numDims; ++i) {
+      T x = a[i] - b[i];
+      d += x * x;
+    }
+    return d;
+  }
+
+  //! dimension with the widest spread over a strided sample of the range
+  unsigned widestDim(const T* coords, size_t begin, size_t end) const {
+    constexpr size_t maxSample = 1024;
+    size_t stride = std::max<size_t>(1, (end - begin) / maxSample);
+    unsigned best = 0;
+    T bestSpread  = -1;
+    for (unsigned d = 0; d < numDims; ++d) {
+      T lo = std::numeric_limits<T>::max();
+      T hi = std::numeric_limits<T>::lowest();
+      for (size_t i = begin; i < end; i += stride) {
+        T x = coords[size_t(ids[i]) * numDims + d];
+        lo  = std::min(lo, x);
+        hi  = std::max(hi, x);
+      }
+      if (hi - lo > bestSpread) {
+        bestSpread = hi - lo;
+        best       = d;
+      }
+    }
+    return best;
+  }
+
+  void knn(size_t node, size_t begin, size_t end, const T* q, unsigned k,
+           uint32_t exclude, std::vector<Neighbor>& heap) const {
+    if (isLeaf(begin, end)) {
+      for (size_t i = begin; i < end; ++i) {
+        if (ids[i] == exclude)
+          continue;
+        Neighbor n{ids[i], dist2(q, &points[i * numDims])};
+        if (heap.size() < k) {
+          heap.push_back(n);
+          std::push_heap(heap.begin(), heap.end());
+        } else if (n < heap.front()) {
+          std::pop_heap(heap.begin(), heap.end());
+          heap.back() = n;
+          std::push_heap(heap.begin(), heap.end());
+        }
+      }
+      return;
+    }
+    size_t mid = begin + (end - begin) / 2;
+    T diff     = q[splitDim[node]] - splitValue[node];
+    if (diff < 0) {
+      knn(2 * node + 1, begin, mid, q, k, exclude, heap);
+      if (heap.size() < k || diff * diff <= heap.front().dist2)
+        knn(2 * node + 2, mid, end, q, k, exclude, heap);
+    } else {
+      knn(2 * node + 2, mid, end, q, k, exclude, heap);
+      if (heap.size() < k || diff * diff <= heap.front().dist2)
+        knn(2 * node + 1, begin, mid, q, k, exclude, heap);
+    }
+  }
+
+  void radius(size_t node, size_t begin, size_t end, const T* q, T eps2,
+              uint32_t exclude, std::vector<Neighbor>& out) const {
+    if (isLeaf(begin, end)) {
+      for (size_t i = begin; i < end; ++i) {
+        T d = dist2(q, &points[i * numDims]);
+        if (d <= eps2 && ids[i] != exclude)
+          out.push_back(Neighbor{ids[i], d});
+      }
+      return;
+    }
+    size_t mid = begin + (end - begin) / 2;
+    T diff     = q[splitDim[node]] - splitValue[node];
+    if (diff < 0 || diff * diff <= eps2)
+      radius(2 * node + 1, begin, mid, q, eps2, exclude, out);
+    if (diff >= 0 || diff * diff <= eps2)
+      radius(2 * node + 2, mid, end, q, eps2, exclude, out);
+  }
+
+public:
+  /**
+   * Builds the tree over n points stored row-major in coords
+   * (n * dims values). The coordinates are copied, so coords may be
+   * freed afterwards.
+   *
+   * Subtrees are built as independent tasks of a for_each, so the build
+   * only serializes over the selection at the top few levels.
+   */
+  void build(const T* coords, size_t n, unsigned dims, unsigned leaf = 16) {
+    if (dims == 0 || dims > std::numeric_limits<uint8_t>::max())
+      GALOIS_DIE("k-d tree dimension must be in [1, 255], got ", dims);
+    if (n >= NONE)
+      GALOIS_DIE("k-d tree supports fewer than 2^32 - 1 points");
+    numDims   = dims;
+    leafSize  = std::max(1u, leaf);
+    numPoints = n;
+
+    // the tree is complete down to the first level whose ranges all fit in
+    // a leaf
+    size_t levels = 1;
+    for (size_t span = n; span > leafSize; span = (span + 1) / 2)
+      ++levels;
+    size_t numNodes = (size_t(1) << levels) - 1;
+
+    reallocate(ids, n);
+    reallocate(splitDim, numNodes);
+    reallocate(splitValue, numNodes);
+    reallocate(points, n * dims);
+
+    galois::do_all(
+        galois::iterate(size_t(0), n), [&](size_t i) { ids[i] = i; },
+        galois::no_stats());
+
+    if (!isLeaf(0, n)) {
+      galois::for_each(
+          galois::iterate({Task{0, 0, n}}),
+          [&](const Task& t, auto& ctx) {
+            unsigned d = widestDim(coords, t.begin, t.end);
+            size_t mid = t.begin + (t.end - t.begin) / 2;
+            std::nth_element(&ids[t.begin], &ids[mid], &ids[0] + t.end,
+                             [&](uint32_t a, uint32_t b) {
+                               return coords[size_t(a) * numDims + d] <
+                                      coords[size_t(b) * numDims + d];
+                             });
+            splitDim[t.node]   = d;
+            splitValue[t.node] = coords[size_t(ids[mid]) * numDims + d];
+            if (!isLeaf(t.begin, mid))
+              ctx.push(Task{2 * t.node + 1, t.begin, mid});
+            if (!isLeaf(mid, t.end))
+              ctx.push(Task{2 * t.node + 2, mid, t.end});
+          },
+          galois::wl<galois::worklists::PerSocketChunkLIFO<1>>(),
+          galois::disable_conflict_detection(), galois::no_stats(),
+          galois::loopname("KdTreeBuild"));
+    }
+
+    galois::do_all(
+        galois::iterate(size_t(0), n),
+        [&](size_t i) {
+          std::copy_n(coords + size_t(ids[i]) * numDims, numDims,
+                      &points[i * numDims]);
+        },
+        galois::no_stats());
+  }
+
+  size_t size() const { return numPoints; }
+  unsigned dims() const { return numDims; }
+
+  /**
+   * The k points nearest to q, closest first; ties are broken by id. The
+   * point with id exclude, typically the query itself, is skipped.
+   *
+   * @param out overwritten with the result; reusing it across queries
+   * avoids allocation
+   */
+  void knn(const T* q, unsigned k, std::vector<Neighbor>& out,
+           uint32_t exclude = NONE) const {
+    out.clear();
+    if (k == 0 || numPoints == 0)
+      return;
+    knn(0, 0, numPoints, q, k, exclude, out);
+    std::sort_heap(out.begin(), out.end());
+  }
+
+  /**
+   * All points within distance eps of q (boundary included), closest first.
+   * The point with id exclude is skipped.
+   */
+  void radius(const T* q, T eps, std::vector<Neighbor>& out,
+              uint32_t exclude = NONE) const {
+    out.clear();
+    if (numPoints == 0)
+      return;
+    radius(0, 0, numPoints, q, eps * eps, exclude, out);
+    std::sort(out.begin(), out.end());
+  }
+};
+
+} // namespace graphs
+} // namespace galois
+
+#endif
@@ -0,0 +1,251 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+/**
+ * @file LC_CSR_Temporal_Graph.h
+ *
+ * Contains the implementation of an LC_CSR_Graph whose edges carry
+ * timestamps.
+ */
+#ifndef GALOIS_GRAPHS_LC_CSR_TEMPORAL_GRAPH_H
+#define GALOIS_GRAPHS_LC_CSR_TEMPORAL_GRAPH_H
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "galois/config.h"
+#include "galois/Reduction.h"
+#include "galois/graphs/LC_CSR_Graph.h"
+#include "galois/graphs/ReadGraph.h"
+
+namespace galois {
+namespace graphs {
+
+//! Times in [begin, end)
+template <typename TimeTy>
+struct TimeWindow {
+  TimeTy begin;
+  TimeTy end;
+
+  bool contains(TimeTy t) const { return !(t < begin) && t < end; }
+  bool empty() const { return !(begin < end); }
+};
+
+struct read_lc_temporal_graph_tag {};
+
+/**
+ * An LC_CSR_Graph whose edge data is the time of the edge, e.g. of a
+ * transaction or a contact. The out-edges of every node are kept sorted by
+ * time, ties by destination, so the edges of a node within a time window are
+ * a contiguous range found by binary search: a traversal restricted to a
+ * window touches only the edges in it, and a time-respecting traversal that
+ * reaches a node at time t skips the edges before t.
+ *
+ * readGraph() reads the times from the edge data of the file and sorts the
+ * edges; a graph constructed otherwise must call sortAllEdgesByTime() before
+ * the windowed accessors are used.
+ *
+ * @tparam NodeTy type of the node data
+ * @tparam TimeTy arithmetic type of the edge times
+ * @tparam HasNoLockable If set to true, then node accesses will cannot acquire
+ * an abstract lock. Otherwise, accessing nodes can get a lock.
+ * @tparam UseNumaAlloc If set to true, allocate data in a possibly more NUMA
+ * friendly way.
+ * @tparam HasOutOfLineLockable
+ * @tparam FileEdgeTy type of the edge data in graph files
+ */
+template <typename NodeTy, typename TimeTy = uint32_t,
+          bool HasNoLockable = false, bool UseNumaAlloc = false,
+          bool HasOutOfLineLockable = false, typename FileEdgeTy = TimeTy>
+class LC_CSR_Temporal_Graph
+    : public LC_CSR_Graph<NodeTy, TimeTy, HasNoLockable, UseNumaAlloc,
+                          HasOutOfLineLockable, FileEdgeTy> {
+  static_assert(std::is_arithmetic<TimeTy>::value,
+                "edge times must be of an arithmetic type");
+
+  //! Typedef referring to base LC_CSR_Graph
+  using BaseGraph = LC_CSR_Graph<NodeTy, TimeTy, HasNoLockable, UseNumaAlloc,
+                                 HasOutOfLineLockable, FileEdgeTy>;
+
+public:
+  template <typename _node_data>
+  struct with_node_data {
+    using type =
+        LC_CSR_Temporal_Graph<_node_data, TimeTy, HasNoLockable, UseNumaAlloc,
+                              HasOutOfLineLockable, FileEdgeTy>;
+  };
+
+  //! Edge times of type _time, read from files as _time as well
+  template <typename _time>
+  struct with_time_type {
+    using type = LC_CSR_Temporal_Graph<NodeTy, _time, HasNoLockable,
+                                       UseNumaAlloc, HasOutOfLineLockable,
+                                       _time>;
+  };
+
+  template <typename _file_edge_data>
+  struct with_file_edge_data {
+    using type =
+        LC_CSR_Temporal_Graph<NodeTy, TimeTy, HasNoLockable, UseNumaAlloc,
+                              HasOutOfLineLockable, _file_edge_data>;
+  };
+
+  //! If true, do not use abstract locks in graph
+  template <bool _has_no_lockable>
+  struct with_no_lockable {
+    using type =
+        LC_CSR_Temporal_Graph<NodeTy, TimeTy, _has_no_lockable, UseNumaAlloc,
+                              HasOutOfLineLockable, FileEdgeTy>;
+  };
+
+  //! If true, use NUMA-aware graph allocation; otherwise, use NUMA interleaved
+  //! allocation.
+  template <bool _use_numa_alloc>
+  struct with_numa_alloc {
+    using type =
+        LC_CSR_Temporal_Graph<NodeTy, TimeTy, HasNoLockable, _use_numa_alloc,
+                              HasOutOfLineLockable, FileEdgeTy>;
+  };
+
+  //! If true, store abstract locks separate from nodes
+  template <bool _has_out_of_line_lockable>
+  struct with_out_of_line_lockable {
+    using type =
+        LC_CSR_Temporal_Graph<NodeTy, TimeTy, HasNoLockable, UseNumaAlloc,
+                              _has_out_of_line_lockable, FileEdgeTy>;
+  };
+
+  using read_tag = read_lc_temporal_graph_tag;
+
+  //! Graph node typedef
+  using GraphNode = uint32_t;
+  //! iterator for edges
+  using edge_iterator = typename BaseGraph::edge_iterator;
+  using time_type     = TimeTy;
+  using window_type   = TimeWindow<TimeTy>;
+  using edge_range =
+      decltype(internal::make_no_deref_range(edge_iterator(), edge_iterator()));
+
+  using BaseGraph::edges;
+
+  time_type getEdgeTime(edge_iterator ni) const {
+    return this->edgeData[*ni];
+  }
+
+  /**
+   * First out-edge of N at or after time t, or edge_end(N) if there is none.
+   * Takes O(log degree).
+   */
+  edge_iterator edge_lower_bound(GraphNode N, time_type t,
+                                 MethodFlag mflag = MethodFlag::WRITE) {
+    this->acquireNode(N, mflag);
+    return std::partition_point(
+        this->raw_begin(N), this->raw_end(N),
+        [&](uint64_t e) { return this->edgeData[e] < t; });
+  }
+
+  //! Out-edges of N whose time is in w, in order of time
+  edge_range edges(GraphNode N, const window_type& w,
+                   MethodFlag mflag = MethodFlag::WRITE) {
+    edge_iterator first = edge_lower_bound(N, w.begin, mflag);
+    if (w.empty())
+      return internal::make_no_deref_range(first, first);
+    return internal::make_no_deref_range(
+        first, std::partition_point(first, this->raw_end(N), [&](uint64_t e) {
+          return this->edgeData[e] < w.end;
+        }));
+  }
+
+  //! Out-edges of N at or after time t, in order of time
+  edge_range edges_from(GraphNode N, time_type t,
+                        MethodFlag mflag = MethodFlag::WRITE) {
+    return internal::make_no_deref_range(edge_lower_bound(N, t, mflag),
+                                         this->raw_end(N));
+  }
+
+  //! Number of out-edges of N whose time is in w
+  size_t degree(GraphNode N, const window_type& w,
+                MethodFlag mflag = MethodFlag::WRITE) {
+    auto r = edges(N, w, mflag);
+    return std::distance(r.begin(), r.end());
+  }
+
+  /**
+   * Sorts the out-edges of every node by time, ties by destination, in
+   * parallel.
+   */
+  void sortAllEdgesByTime() {
+    using EdgeSortVal = EdgeSortValue<GraphNode, TimeTy>;
+    galois::do_all(
+        galois::iterate(size_t{0}, this->size()),
+        [=](GraphNode N) {
+          this->sortEdges(
+              N,
+              [](const EdgeSortVal& e1, const EdgeSortVal& e2) {
+                return e1.get() < e2.get() ||
+                       (!(e2.get() < e1.get()) && e1.dst < e2.dst);
+              },
+              MethodFlag::UNPROTECTED);
+        },
+        galois::no_stats(), galois::steal());
+  }
+
+  /**
+   * Smallest and largest edge time; as the edges of each node are sorted,
+   * only the first and last edge of every node are read. Both are
+   * time_type() if the graph has no edges.
+   */
+  std::pair<time_type, time_type> timeSpan() {
+    galois::GReduceMin<time_type> first;
+    // GReduceMax starts from numeric_limits::min, which is positive for
+    // floating-point times
+    auto last = galois::make_reducible(galois::gmax<time_type>(), [] {
+      return std::numeric_limits<time_type>::lowest();
+    });
+    galois::do_all(
+        galois::iterate(size_t{0}, this->size()),
+        [&](GraphNode N) {
+          auto b = this->raw_begin(N), e = this->raw_end(N);
+          if (b != e) {
+            first.update(this->edgeData[*b]);
+            last.update(this->edgeData[*(e - 1)]);
+          }
+        },
+        galois::no_stats());
+    if (!this->sizeEdges())
+      return std::make_pair(time_type(), time_type());
+    return std::make_pair(first.reduce(), last.reduce());
+  }
+};
+
+//! Reads a temporal graph as an LC_CSR_Graph and sorts its edges by time
+template <typename GraphTy, typename... Args>
+void readGraphDispatch(GraphTy& graph, read_lc_temporal_graph_tag,
+                       Args&&... args) {
+  readGraphDispatch(graph, read_default_graph_tag(),
+                    std::forward<Args>(args)...);
+  graph.sortAllEdgesByTime();
+}
+
+} // namespace graphs
+} // namespace galois
+
+#endif
@@ -0,0 +1,79 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef GALOIS_GRAPHS_WRITEGRAPH_H
+#define GALOIS_GRAPHS_WRITEGRAPH_H
+
+#include <algorithm>
+#include <cstdint>
+
+#include "galois/config.h"
+#include "galois/Loops.h"
+#include "galois/graphs/FileGraph.h"
+
+namespace galois {
+namespace graphs {
+
+/**
+ * Writes the edges in [begin, end), which must be sorted by source, into a
+ * FileGraphWriter in parallel and finishes it.
+ *
+ * srcOf(edge) returns the source of an edge and addEdge(writer, src, edge)
+ * adds it with one of the writer's addNeighbor calls. Every node is written
+ * by a single iteration, so the writer's per-node counters are not shared.
+ *
+ * @tparam EdgeTy edge data type of the written graph, void for none
+ */
+template <typename EdgeTy, typename RandomIt, typename SrcFn, typename AddFn>
+void writeSortedEdges(FileGraphWriter& writer, size_t numNodes,
+                      RandomIt begin, RandomIt end, SrcFn srcOf,
+                      AddFn addEdge) {
+  auto rangeOf = [&](size_t n) {
+    auto before = [&](const auto& e, size_t x) { return srcOf(e) < x; };
+    auto first  = std::lower_bound(begin, end, n, before);
+    return std::make_pair(first, std::lower_bound(first, end, n + 1, before));
+  };
+
+  writer.setNumNodes(numNodes);
+  writer.setNumEdges<EdgeTy>(end - begin);
+  writer.phase1();
+  galois::do_all(
+      galois::iterate(size_t(0), numNodes),
+      [&](size_t n) {
+        auto r = rangeOf(n);
+        if (r.second != r.first)
+          writer.incrementDegree(n, r.second - r.first);
+      },
+      galois::no_stats());
+  writer.phase2();
+  galois::do_all(
+      galois::iterate(size_t(0), numNodes),
+      [&](size_t n) {
+        auto r = rangeOf(n);
+        for (auto ii = r.first; ii != r.second; ++ii)
+          addEdge(writer, n, *ii);
+      },
+      galois::no_stats());
+  writer.finish();
+}
+
+} // namespace graphs
+} // namespace galois
+
+#endif
@@ -21,30 +21,183 @@
 #define GALOIS_RUNTIME_EXECUTOR_ORDERED_H
 
 #include "galois/config.h"
+#include "galois/ParallelSTL.h"
+#include "galois/PerThreadContainer.h"
+#include "galois/runtime/Context.h"
+#include "galois/runtime/Executor_DoAll.h"
+#include "galois/runtime/Executor_OnEach.h"
+#include "galois/runtime/Executor_ParaMeter.h"
+#include "galois/runtime/UserContextAccess.h"
+
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <utility>
+#include <vector>
 
 namespace galois {
 namespace runtime {
 
 // TODO(ddn): Pull in and integrate in executors from exp
 
+namespace internal {
+
+inline auto indexRange(size_t beg, size_t end) {
+  return makeStandardRange(boost::counting_iterator<size_t>(beg),
+                           boost::counting_iterator<size_t>(end));
+}
+
+//! Conflict detection context that lists the locks an item's neighborhood
+//! function visits without acquiring them
+class NhoodRecorder : public SimpleRuntimeContext {
+public:
+  std::vector<Lockable*> nhood;
+
+  NhoodRecorder() : SimpleRuntimeContext(true) {}
+
+  virtual void subAcquire(Lockable* lockable, galois::MethodFlag) {
+    nhood.push_back(lockable);
+  }
+};
+
+/**
+ * Executes an ordered loop in rounds, in the style of the ParaMeter tool.
+ * Each round sorts the pending items by priority, visits their
+ * neighborhoods, and runs in parallel every item that has the highest
+ * priority in all of its neighborhood (a source) and passes the stability
+ * test; the highest priority item always runs, so every round makes
+ * progress. Remaining items and newly pushed ones wait for the next round.
+ * When GALOIS_PARAMETER_PROFILE is set, every round is written to the
+ * ParaMeter stats file and the loop to the summary file; CONFLICTS then
+ * counts items that had to wait for a higher priority neighbor.
+ */
+template <typename T, typename Cmp, typename NhFunc, typename OpFunc,
+          typename StableTest>
+void for_each_ordered_rounds(std::vector<T>&& initial, const Cmp& cmp,
+                             const NhFunc& nhFunc, const OpFunc& opFunc,
+                             const StableTest& stabilityTest,
+                             const char* loopname) {
+  if (!loopname)
+    loopname = "for_each_ordered";
+  const bool profile = ParaMeter::profileOrderedLoops();
+
+  // cmp(a, b) is true if a is not after b; sort needs a strict order
+  auto before = [&](const T& a, const T& b) { return !cmp(b, a); };
+
+  std::vector<T> pending(std::move(initial));
+  galois::PerThreadVector<T> pushed;
+  substrate::PerThreadStorage<UserContextAccess<T>> userCtx;
+  ParaMeter::StepStats stats;
+  ParaMeter::LoopProfile loopProfile;
+  FILE* statsFile = profile ? ParaMeter::getStatsFile() : nullptr;
+
+  while (!pending.empty()) {
+    std::stable_sort(pending.begin(), pending.end(), before);
+    const size_t n = pending.size();
+
+    std::vector<std::vector<Lockable*>> nhoods(n);
+    galois::runtime::do_all_gen(
+        indexRange(0, n),
+        [&](size_t i) {
+          NhoodRecorder rec;
+          setThreadContext(&rec);
+          nhFunc(pending[i]);
+          setThreadContext(nullptr);
+          nhoods[i] = std::move(rec.nhood);
+        },
+        std::make_tuple(galois::steal(),
+                        galois::loopname("Ordered-Neighborhoods")));
+
+    // every lock belongs to the highest priority item that visits it
+    std::vector<std::pair<Lockable*, size_t>> claims;
+    for (size_t i = 0; i < n; ++i)
+      for (Lockable* l : nhoods[i])
+        claims.emplace_back(l, i);
+    galois::ParallelSTL::sort(claims.begin(), claims.end());
+
+    std::vector<std::atomic<bool>> isSource(n);
+    galois::runtime::do_all_gen(
+        indexRange(0, n), [&](size_t i) { isSource[i] = true; },
+        std::make_tuple());
+    if (claims.size() > 1) {
+      galois::runtime::do_all_gen(
+          indexRange(1, claims.size()),
+          [&](size_t k) {
+            if (claims[k - 1].first == claims[k].first &&
+                claims[k - 1].second != claims[k].second)
+              isSource[claims[k].second] = false;
+          },
+          std::make_tuple());
+    }
+    galois::runtime::do_all_gen(
+        indexRange(1, n),
+        [&](size_t i) {
+          if (isSource[i] && !stabilityTest(pending[i]))
+            isSource[i] = false;
+        },
+        std::make_tuple(galois::steal()));
+
+    galois::runtime::do_all_gen(
+        indexRange(0, n),
+        [&](size_t i) {
+          if (!isSource[i]) {
+            stats.conflicts += 1;
+            return;
+          }
+          auto& facing = *userCtx.getLocal();
+          auto start   = std::chrono::steady_clock::now();
+          opFunc(pending[i], facing.data());
+          stats.commit(nhoods[i].size(), ParaMeter::elapsedNs(start));
+          for (const T& item : facing.getPushBuffer())
+            pushed.get().push_back(item);
+          facing.resetPushBuffer();
+        },
+        std::make_tuple(galois::steal(), galois::loopname("Ordered-Execute")));
+
+    std::vector<T> next;
+    for (size_t i = 0; i < n; ++i)
+      if (!isSource[i])
+        next.push_back(std::move(pending[i]));
+    for (auto ii = pushed.begin_all(), ei = pushed.end_all(); ii != ei; ++ii)
+      next.push_back(std::move(*ii));
+    pushed.clear_all_parallel();
+    pending = std::move(next);
+
+    stats.wlSize += n;
+    if (profile) {
+      stats.dump(statsFile, loopname);
+      loopProfile.add(stats);
+    }
+    stats.nextStep();
+  }
+
+  if (profile) {
+    ParaMeter::closeStatsFile();
+    ParaMeter::dumpSummary(loopProfile, loopname, "ordered");
+  }
+}
+
+} // namespace internal
+
 template <typename Iter, typename Cmp, typename NhFunc, typename OpFunc>
-void for_each_ordered_impl(Iter GALOIS_UNUSED(beg), Iter GALOIS_UNUSED(end),
-                           const Cmp& GALOIS_UNUSED(cmp),
-                           const NhFunc& GALOIS_UNUSED(nhFunc),
-                           const OpFunc& GALOIS_UNUSED(opFunc),
-                           const char* GALOIS_UNUSED(loopname)) {
-  GALOIS_DIE("not yet implemented");
+void for_each_ordered_impl(Iter beg, Iter end, const Cmp& cmp,
+                           const NhFunc& nhFunc, const OpFunc& opFunc,
+                           const char* loopname) {
+  using T = typename std::iterator_traits<Iter>::value_type;
+  internal::for_each_ordered_rounds(
+      std::vector<T>(beg, end), cmp, nhFunc, opFunc,
+      [](const T&) { return true; }, loopname);
 }
 
 template <typename Iter, typename Cmp, typename NhFunc, typename OpFunc,
           typename StableTest>
-void for_each_ordered_impl(Iter GALOIS_UNUSED(beg), Iter GALOIS_UNUSED(end),
-                           const Cmp& GALOIS_UNUSED(cmp),
-                           const NhFunc& GALOIS_UNUSED(nhFunc),
-                           const OpFunc& GALOIS_UNUSED(opFunc),
-                           const StableTest& GALOIS_UNUSED(stabilityTest),
-                           const char* GALOIS_UNUSED(loopname)) {
-  GALOIS_DIE("not yet implemented");
+void for_each_ordered_impl(Iter beg, Iter end, const Cmp& cmp,
+                           const NhFunc& nhFunc, const OpFunc& opFunc,
+                           const StableTest& stabilityTest,
+                           const char* loopname) {
+  using T = typename std::iterator_traits<Iter>::value_type;
+  internal::for_each_ordered_rounds(std::vector<T>(beg, end), cmp, nhFunc,
+                                    opFunc, stabilityTest, loopname);
 }
 
 } // end namespace runtime
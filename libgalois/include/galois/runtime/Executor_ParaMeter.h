@@ -21,6 +21,7 @@
 #define GALOIS_RUNTIME_EXECUTOR_PARAMETER_H
 
 #include <algorithm>
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <ctime>
@@ -32,6 +33,7 @@
 #include "galois/gIO.h"
 #include "galois/Mem.h"
 #include "galois/Reduction.h"
+#include "galois/Threads.h"
 #include "galois/runtime/Context.h"
 #include "galois/runtime/Executor_ForEach.h"
 #include "galois/runtime/Executor_DoAll.h"
@@ -45,60 +47,118 @@ namespace runtime {
 
 namespace ParaMeter {
 
-struct StepStatsBase {
+/**
+ * Statistics of one ParaMeter step: the set of iterations that are executed
+ * together because none of them conflicts with another. PARALLELISM is the
+ * number of iterations that committed, WORKLIST_SIZE the number attempted,
+ * NEIGHBORHOOD_SIZE the total number of locks the committed iterations held
+ * and CONFLICTS the number of iterations that conflicted with another one
+ * (and were deferred to a later step, except in do_all loops). WORK_NS and
+ * MAX_ITER_NS are the total and the longest running time of the committed
+ * iterations.
+ */
+struct StepStats {
+  size_t step;
+  GAccumulator<size_t> parallelism;
+  GAccumulator<size_t> wlSize;
+  GAccumulator<size_t> nhSize;
+  GAccumulator<size_t> conflicts;
+  GAccumulator<uint64_t> work;
+  GReduceMax<uint64_t> maxIter;
+
+  StepStats(void) : step(0) {}
+
   static inline void printHeader(FILE* out) {
-    fprintf(out,
-            "LOOPNAME, STEP, PARALLELISM, WORKLIST_SIZE, NEIGHBORHOOD_SIZE\n");
+    fprintf(out, "LOOPNAME, STEP, PARALLELISM, WORKLIST_SIZE, "
+                 "NEIGHBORHOOD_SIZE, CONFLICTS, WORK_NS, MAX_ITER_NS\n");
   }
 
-  static inline void dump(FILE* out, const char* loopname, size_t step,
-                          size_t parallelism, size_t wlSize, size_t nhSize) {
-    assert(out && "StepStatsBase::dump() file handle is null");
-    fprintf(out, "%s, %zu, %zu, %zu, %zu\n", loopname, step, parallelism,
-            wlSize, nhSize);
+  //! records a committed iteration that held nh locks and ran for ns
+  void commit(size_t nh, uint64_t ns) {
+    parallelism += 1;
+    nhSize += nh;
+    work += ns;
+    maxIter.update(ns);
   }
-};
-
-struct OrderedStepStats : public StepStatsBase {
-  using Base = StepStatsBase;
 
-  const size_t step;
-  GAccumulator<size_t> parallelism;
-  const size_t wlSize;
-
-  explicit OrderedStepStats(size_t _step, size_t _wlsz)
-      : Base(), step(_step), parallelism(), wlSize(_wlsz) {}
-
-  explicit OrderedStepStats(size_t _step, size_t par, size_t _wlsz)
-      : Base(), step(_step), parallelism(), wlSize(_wlsz) {
-    parallelism += par;
+  void nextStep(void) {
+    ++step;
+    parallelism.reset();
+    wlSize.reset();
+    nhSize.reset();
+    conflicts.reset();
+    work.reset();
+    maxIter.reset();
   }
 
   void dump(FILE* out, const char* loopname) {
-    Base::dump(out, loopname, step, parallelism.reduce(), wlSize, 0ul);
+    assert(out && "StepStats::dump() file handle is null");
+    fprintf(out, "%s, %zu, %zu, %zu, %zu, %zu, %lu, %lu\n", loopname, step,
+            parallelism.reduce(), wlSize.reduce(), nhSize.reduce(),
+            conflicts.reduce(), (unsigned long)work.reduce(),
+            (unsigned long)maxIter.reduce());
   }
 };
 
-struct UnorderedStepStats : public StepStatsBase {
-  using Base = StepStatsBase;
+/**
+ * Summary of a whole loop built from its steps, with the speedup the loop
+ * could reach on P threads. As in the ParaMeter model, every iteration takes
+ * unit time and steps run one after another, so a step of k iterations takes
+ * ceil(k / P) rounds. The prediction only depends on the parallelism the
+ * algorithm exposes: when it is well below P, the loop is limited by the
+ * algorithm, otherwise any shortfall in measured speedup comes from the
+ * runtime (scheduling, contention, locality). WORK_NS and MAX_ITER_NS in the
+ * stats file show where iteration costs are uneven.
+ */
+class LoopProfile {
+  std::vector<size_t> steps; //!< parallelism of each step
+  size_t attempted = 0;
+  size_t conflicts = 0;
+  size_t nhSize    = 0;
 
-  size_t step;
-  GAccumulator<size_t> parallelism;
-  GAccumulator<size_t> wlSize;
-  GAccumulator<size_t> nhSize;
+public:
+  static inline void printHeader(FILE* out) {
+    fprintf(out, "LOOPNAME, KIND, STEPS, ITERATIONS, CONFLICT_RATE, "
+                 "AVG_PARALLELISM, MAX_PARALLELISM, AVG_NEIGHBORHOOD_SIZE, "
+                 "SPEEDUP_8, SPEEDUP_32, SPEEDUP_128, THREADS, "
+                 "SPEEDUP_THREADS, LIMITED_BY\n");
+  }
 
-  UnorderedStepStats(void) : Base(), step(0) {}
+  void add(StepStats& s) {
+    steps.push_back(s.parallelism.reduce());
+    attempted += s.wlSize.reduce();
+    conflicts += s.conflicts.reduce();
+    nhSize += s.nhSize.reduce();
+  }
 
-  void nextStep(void) {
-    ++step;
-    parallelism.reset();
-    wlSize.reset();
-    nhSize.reset();
+  //! predicted speedup of the loop on numThreads threads
+  double predictSpeedup(unsigned numThreads) const {
+    size_t work = 0, rounds = 0;
+    for (size_t par : steps) {
+      work += par;
+      rounds += (par + numThreads - 1) / numThreads;
+    }
+    return rounds ? double(work) / rounds : 1.0;
   }
 
-  void dump(FILE* out, const char* loopname) {
-    Base::dump(out, loopname, step, parallelism.reduce(), wlSize.reduce(),
-               nhSize.reduce());
+  void dump(FILE* out, const char* loopname, const char* kind) const {
+    assert(out && "LoopProfile::dump() file handle is null");
+    size_t iterations = 0, maxPar = 0;
+    for (size_t par : steps) {
+      iterations += par;
+      maxPar = std::max(maxPar, par);
+    }
+    unsigned numThreads = galois::getActiveThreads();
+    double atThreads    = predictSpeedup(numThreads);
+    fprintf(out,
+            "%s, %s, %zu, %zu, %.4f, %.2f, %zu, %.2f, %.2f, %.2f, %.2f, %u, "
+            "%.2f, %s\n",
+            loopname, kind, steps.size(), iterations,
+            attempted ? double(conflicts) / attempted : 0.0,
+            steps.empty() ? 0.0 : double(iterations) / steps.size(), maxPar,
+            iterations ? double(nhSize) / iterations : 0.0, predictSpeedup(8),
+            predictSpeedup(32), predictSpeedup(128), numThreads, atThreads,
+            atThreads < 0.8 * numThreads ? "algorithm" : "runtime");
   }
 };
 
@@ -108,6 +168,61 @@ struct UnorderedStepStats : public StepStatsBase {
 FILE* getStatsFile(void);
 void closeStatsFile(void);
 
+// Single summary file per run of an app with one LoopProfile per loop
+FILE* getSummaryFile(void);
+void closeSummaryFile(void);
+
+//! true if ordered loops should write ParaMeter profiles; set by the
+//! GALOIS_PARAMETER_PROFILE environment variable
+bool profileOrderedLoops(void);
+
+//! Writes the profile of a finished loop to the summary file
+inline void dumpSummary(const LoopProfile& profile, const char* loopname,
+                        const char* kind) {
+  profile.dump(getSummaryFile(), loopname, kind);
+  closeSummaryFile();
+}
+
+//! @returns the time elapsed since start in nanoseconds
+inline uint64_t elapsedNs(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+/**
+ * Conflict detection context used to profile do_all loops. Locks stay held
+ * until the end of the step, like in the ParaMeter for_each executor, but a
+ * lock owned by another iteration only marks the iteration as conflicting
+ * instead of aborting it, because do_all iterations cannot be rolled back.
+ */
+class ProfileContext : public SimpleRuntimeContext {
+  unsigned shared = 0;
+
+public:
+  bool conflicted = false;
+  uint64_t cost   = 0; //!< running time of the iteration in ns
+
+  ProfileContext() : SimpleRuntimeContext(true) {}
+
+  virtual void subAcquire(Lockable* lockable, galois::MethodFlag) {
+    switch (tryAcquire(lockable)) {
+    case NEW_OWNER:
+      addToNhood(lockable);
+      break;
+    case FAIL:
+      conflicted = true;
+      ++shared;
+      break;
+    default:
+      break;
+    }
+  }
+
+  //! releases the locks and returns the size of the neighborhood
+  unsigned finish() { return commitIteration() + shared; }
+};
+
 template <typename T>
 class FIFO_WL {
 
@@ -216,10 +331,11 @@ class ParaMeterExecutor {
   struct IterationContext {
     T item;
     bool doabort;
+    uint64_t cost; //!< running time of the last execution in ns
     galois::runtime::UserContextAccess<value_type> facing;
     SimpleRuntimeContext ctx;
 
-    explicit IterationContext(const T& v) : item(v), doabort(false) {}
+    explicit IterationContext(const T& v) : item(v), doabort(false), cost(0) {}
 
     void reset() {
       doabort = false;
@@ -283,7 +399,7 @@ private:
   }
 
 private:
-  void runSimpleStep(UnorderedStepStats& stats) {
+  void runSimpleStep(StepStats& stats) {
     galois::runtime::do_all_gen(
         m_wl.iterateCurr(),
         [&, this](IterationContext* it) {
@@ -291,17 +407,18 @@ private:
 
           setThreadContext(&(it->ctx));
 
+          auto start = std::chrono::steady_clock::now();
           m_func(it->item, it->facing.data());
-          stats.parallelism += 1;
-          unsigned nh = commitIteration(it);
-          stats.nhSize += nh;
+          uint64_t cost = elapsedNs(start);
+          unsigned nh   = commitIteration(it);
+          stats.commit(nh, cost);
 
           setThreadContext(nullptr);
         },
         std::make_tuple(galois::steal(), galois::loopname("ParaM-Simple")));
   }
 
-  void runCautiousStep(UnorderedStepStats& stats){galois::runtime::do_all_gen(
+  void runCautiousStep(StepStats& stats){galois::runtime::do_all_gen(
       m_wl.iterateCurr(),
       [&, this](IterationContext* it) {
         stats.wlSize += 1;
@@ -312,6 +429,7 @@ private:
         if (needsBreak) {
           it->facing.setBreakFlag(&broke);
         }
+        auto start = std::chrono::steady_clock::now();
 #ifdef GALOIS_USE_LONGJMP_ABORT
         int flag = 0;
         if ((flag = setjmp(execFrame)) == 0) {
@@ -334,6 +452,8 @@ private:
           }
         }
 
+        it->cost = elapsedNs(start);
+
         if (needsBreak && broke) {
           m_broken.update(true);
         }
@@ -346,12 +466,13 @@ private:
       m_wl.iterateCurr(),
       [&, this](IterationContext* it) {
         if (it->doabort) {
+          stats.conflicts += 1;
           abortIteration(it);
 
         } else {
-          stats.parallelism += 1;
-          unsigned nh = commitIteration(it);
-          stats.nhSize += nh;
+          uint64_t cost = it->cost;
+          unsigned nh   = commitIteration(it);
+          stats.commit(nh, cost);
         }
       },
       std::make_tuple(galois::steal(), galois::loopname("ParaM-Commit")));
@@ -371,7 +492,8 @@ void execute(const R& range) {
       },
       std::make_tuple());
 
-  UnorderedStepStats stats;
+  StepStats stats;
+  LoopProfile profile;
 
   while (!m_wl.empty()) {
 
@@ -389,6 +511,7 @@ void execute(const R& range) {
     assert(stats.parallelism.reduce() && "ERROR: No Progress");
 
     stats.dump(m_statsFile, loopname);
+    profile.add(stats);
     stats.nextStep();
 
     if (needsBreak && m_broken.reduce()) {
@@ -398,6 +521,7 @@ void execute(const R& range) {
   } // end while
 
   closeStatsFile();
+  dumpSummary(profile, loopname, "for_each");
 }
 
 public:
@@ -475,6 +599,67 @@ void for_each_ParaMeter(const R& range, const F& func,
   exec.execute(range);
 }
 
+template <typename WL>
+struct IsParaMeterWL : public std::false_type {};
+
+template <typename T, ParaMeter::SchedType SCHED>
+struct IsParaMeterWL<galois::worklists::ParaMeter<T, SCHED>>
+    : public std::true_type {};
+
+//! true if the worklist chosen in ArgsTy is worklists::ParaMeter
+template <typename ArgsTy>
+constexpr bool isParaMeterLoop() {
+  if constexpr (has_trait<wl_tag, ArgsTy>()) {
+    return IsParaMeterWL<
+        typename get_trait_type<wl_tag, ArgsTy>::type::type>::value;
+  } else {
+    return false;
+  }
+}
+
+//! invoke ParaMeter tool to profile a do_all loop. do_all iterations are
+//! independent by contract, so the loop is a single step; conflicts show
+//! iterations that share data through locks
+template <typename R, typename F, typename ArgsTuple>
+void do_all_ParaMeter(const R& range, F&& func, const ArgsTuple& argsTuple) {
+  using ParaMeter::ProfileContext;
+  const char* loopname = galois::internal::getLoopName(argsTuple);
+
+  // contexts hold their locks until the end of the step
+  substrate::PerThreadStorage<std::deque<ProfileContext>> contexts;
+  ParaMeter::StepStats stats;
+
+  galois::runtime::do_all_gen(
+      range,
+      [&](const auto& item) {
+        auto& ctx = contexts.getLocal()->emplace_back();
+        setThreadContext(&ctx);
+        auto start = std::chrono::steady_clock::now();
+        func(item);
+        ctx.cost = ParaMeter::elapsedNs(start);
+        setThreadContext(nullptr);
+
+        stats.wlSize += 1;
+        if (ctx.conflicted)
+          stats.conflicts += 1;
+      },
+      std::make_tuple(galois::steal(), galois::loopname("ParaM-DoAll")));
+
+  galois::runtime::on_each_gen(
+      [&](const unsigned, const unsigned) {
+        for (auto& ctx : *contexts.getLocal())
+          stats.commit(ctx.finish(), ctx.cost);
+        contexts.getLocal()->clear();
+      },
+      std::make_tuple());
+
+  ParaMeter::LoopProfile profile;
+  stats.dump(ParaMeter::getStatsFile(), loopname);
+  ParaMeter::closeStatsFile();
+  profile.add(stats);
+  ParaMeter::dumpSummary(profile, loopname, "do_all");
+}
+
 } // end namespace runtime
 } // end namespace galois
 #endif
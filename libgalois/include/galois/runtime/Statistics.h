@@ -627,6 +627,10 @@ void reportRUsage(const std::string& id);
 // TODO: switch to gstl::Str in here
 //! Reports Galois system memory stats for all threads
 void reportPageAlloc(const char* category);
+//! Reports bytes in use and high-water marks of the per-thread and
+//! per-socket storage regions (sizes are per region)
+//! @param id Identifier to prefix stat with in statistics output
+void reportPerThreadStorage(const std::string& id);
 //! Reports NUMA memory stats for all NUMA nodes
 void reportNumaAlloc(const char* category);
 
@@ -71,6 +71,14 @@ void* allocPages(unsigned num, bool preFault);
 // free page range
 void freePages(void* ptr, unsigned num);
 
+// reserve address space for pages without committing memory; pages are
+// backed on first touch
+void* reservePages(unsigned num);
+
+// return the memory behind a page range to the OS but keep the range mapped;
+// it reads as zero when touched again
+void releasePages(void* ptr, unsigned num);
+
 } // namespace substrate
 } // namespace galois
 
@@ -22,6 +22,8 @@
 
 #include <cassert>
 #include <cstddef>
+#include <map>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -33,37 +35,54 @@
 namespace galois {
 namespace substrate {
 
+/**
+ * Hands out offsets that are valid in every thread's (or socket's) storage
+ * region, so that a PerThreadStorage lookup is a single base + offset.
+ *
+ * Each region is a contiguous reservation of address space that is only
+ * backed by memory as offsets are used. Blocks are power-of-two sized and
+ * aligned; freed blocks are merged with their buddies and the bump pointer
+ * retreats over free blocks at the end, so creating and destroying storage
+ * objects in any order does not exhaust the region.
+ */
 class PerBackend {
   typedef substrate::SimpleLock Lock;
 
   std::atomic<unsigned int> nextLoc{0};
   std::atomic<char*>* heads{nullptr};
+  unsigned numHeads{0};
   Lock freeOffsetsLock;
-  std::vector<std::vector<unsigned>> freeOffsets;
-  /**
-   * Guards access to non-POD objects that can be accessed after PerBackend
-   * is destroyed. Access can occur through destroying PerThread/PerSocket
-   * objects with static storage duration, which have a reference to a
-   * PerBackend object, which may have be destroyed before the PerThread
-   * object itself.
-   */
-  bool invalid{false};
+  //! free blocks by offset; the value is the log2 of the block size
+  std::map<unsigned, unsigned> freeBlocks;
+  //! offsets of the free blocks of each log2 size
+  std::vector<std::set<unsigned>> freeOffsets;
+  //! end of the range that may have been touched since the last release
+  unsigned committedEnd{0};
+  size_t inUse{0};
+  size_t peakInUse{0};
+  size_t peakFootprint{0};
 
   void initCommon(unsigned maxT);
   static unsigned nextLog2(unsigned size);
+  void addFree(unsigned offset, unsigned ll);
+  void removeFree(unsigned offset, unsigned ll);
+  void trimEnd();
 
 public:
+  //! Storage usage of a backend; sizes are per thread (or socket) region
+  struct Usage {
+    size_t inUse;         //!< bytes in live allocations
+    size_t peakInUse;     //!< high-water mark of inUse
+    size_t footprint;     //!< bytes spanned by live and free blocks
+    size_t peakFootprint; //!< high-water mark of footprint
+    size_t reserved;      //!< address space reserved for each region
+  };
+
   PerBackend();
 
   PerBackend(const PerBackend&) = delete;
   PerBackend& operator=(const PerBackend&) = delete;
 
-  ~PerBackend() {
-    // Intentionally leak heads so that other PerThread operations are
-    // still valid after we are gone
-    invalid = true;
-  }
-
   char* initPerThread(unsigned maxT);
   char* initPerSocket(unsigned maxT);
 
@@ -74,6 +93,8 @@ public:
   // faster when (1) you already know the id and (2) shared access to heads is
   // not to expensive; otherwise use getLocal(unsigned,char*)
   void* getLocal(unsigned offset, unsigned id) { return &heads[id][offset]; }
+
+  Usage usage();
 };
 
 extern thread_local char* ptsBase;
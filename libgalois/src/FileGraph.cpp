@@ -51,14 +51,24 @@ namespace graphs {
 // outedges[numEdges] {uint32_t LE or uint64_t LE for ver == 2}
 // potential padding (32bit max) to Re-Align to 64bits
 // EdgeType[numEdges] {EdgeType size}
+//
+// Optional metadata trailer (see GraphMetadata.h), ignored by older readers:
+// trailer version (1) {uint64_t LE}
+// known properties, properties {uint64_t LE each}
+// edge data type {uint64_t LE}
+// checksum block size, 0 if there are no checksums {uint64_t LE}
+// topology checksum, edge data checksum {uint64_t LE each}
+// size of the fields above in bytes {uint64_t LE}
+// magic "GRMETA\0\1" {8 bytes}
 
 FileGraph::FileGraph()
     : sizeofEdge(0), numNodes(0), numEdges(0), outIdx(0), outs(0), edgeData(0),
-      graphVersion(-1), nodeOffset(0), edgeOffset(0) {}
+      graphVersion(-1), nodeOffset(0), edgeOffset(0), metadataOffset(0) {}
 
-FileGraph::FileGraph(const FileGraph& o) {
+FileGraph::FileGraph(const FileGraph& o) : metadataOffset(0) {
   fromArrays(o.outIdx, o.numNodes, o.outs, o.numEdges, o.edgeData, o.sizeofEdge,
              o.nodeOffset, o.edgeOffset, true, o.graphVersion);
+  metadata = o.metadata;
 }
 
 FileGraph& FileGraph::operator=(const FileGraph& other) {
@@ -71,7 +81,7 @@ FileGraph& FileGraph::operator=(const FileGraph& other) {
 
 FileGraph::FileGraph(FileGraph&& other)
     : sizeofEdge(0), numNodes(0), numEdges(0), outIdx(0), outs(0), edgeData(0),
-      graphVersion(-1), nodeOffset(0), edgeOffset(0) {
+      graphVersion(-1), nodeOffset(0), edgeOffset(0), metadataOffset(0) {
   move_assign(std::move(other));
 }
 
@@ -99,6 +109,8 @@ void FileGraph::move_assign(FileGraph&& o) {
   std::swap(graphVersion, o.graphVersion);
   std::swap(nodeOffset, o.nodeOffset);
   std::swap(edgeOffset, o.edgeOffset);
+  std::swap(metadata, o.metadata);
+  std::swap(metadataOffset, o.metadataOffset);
 }
 
 void FileGraph::fromMem(void* m, uint64_t node_offset, uint64_t edge_offset,
@@ -186,6 +198,8 @@ void* FileGraph::fromArrays(uint64_t* out_idx, uint64_t num_nodes, void* outs,
                             size_t sizeof_edge_data, uint64_t node_offset,
                             uint64_t edge_offset, bool converted,
                             int oGraphVersion) {
+  metadata       = GraphMetadata();
+  metadataOffset = 0;
   size_t bytes =
       rawBlockSize(num_nodes, num_edges, sizeof_edge_data, oGraphVersion);
 
@@ -291,6 +305,10 @@ void FileGraph::fromFile(const std::string& filename) {
   mappings.push_back({base, static_cast<size_t>(buf.st_size)});
 
   fromMem(base, 0, 0, buf.st_size);
+  metadata = GraphMetadata();
+  if (!internal::parseGraphMetadata(base, buf.st_size, metadata,
+                                    metadataOffset))
+    metadataOffset = 0;
 }
 
 /**
@@ -489,7 +507,7 @@ void FileGraph::toFile(const std::string& file) {
   mapping mm  = mappings.back();
   mappings.pop_back();
 
-  size_t total = mm.len;
+  size_t total = metadataOffset ? metadataOffset : mm.len;
   char* ptr    = (char*)mm.ptr;
   while (total) {
     retval = write(fd, ptr, total);
@@ -28,8 +28,11 @@ namespace galois {
 namespace graphs {
 
 void FileGraph::fromFileInterleaved(const std::string& filename,
-                                    size_t sizeofEdgeData) {
+                                    size_t sizeofEdgeData,
+                                    GraphMetadata::EdgeType type) {
   fromFile(filename);
+  if (sizeofEdgeData)
+    checkEdgeType(type, sizeofEdgeData, filename);
 
   std::mutex lock;
   std::condition_variable cond;
@@ -0,0 +1,410 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#include "galois/graphs/GraphMetadata.h"
+#include "galois/graphs/FileGraph.h"
+#include "galois/Galois.h"
+#include "galois/Endian.h"
+#include "galois/gIO.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace galois {
+namespace graphs {
+
+namespace {
+
+const char trailerMagic[8] = {'G', 'R', 'M', 'E', 'T', 'A', '\0', '\1'};
+const uint64_t trailerVersion = 1;
+//! number of 64-bit fields written by this version
+const size_t trailerFields = 7;
+//! checksums hash blocks of this size independently, then the block hashes
+const uint64_t checksumBlock = 1 << 20;
+
+uint64_t readLE64(const char* p) {
+  uint64_t w;
+  memcpy(&w, p, sizeof(w));
+  return convert_le64toh(w);
+}
+
+//! where the edge data starts; the same layout as FileGraph::fromMem
+uint64_t edgeDataOffset(uint64_t version, uint64_t numNodes,
+                        uint64_t numEdges) {
+  return (4 + numNodes) * sizeof(uint64_t) +
+         (version == 1 ? sizeof(uint32_t) : sizeof(uint64_t)) *
+             (numEdges + numEdges % 2);
+}
+
+/**
+ * Size of the graph proper given its header, or 0 if the header is not
+ * that of a .gr file.
+ */
+uint64_t graphBytes(const char* header, uint64_t fileSize) {
+  uint64_t version  = readLE64(header);
+  uint64_t edgeSize = readLE64(header + 8);
+  uint64_t numNodes = readLE64(header + 16);
+  uint64_t numEdges = readLE64(header + 24);
+  if (version != 1 && version != 2)
+    return 0;
+  // reject sizes that cannot fit before computing offsets with them
+  if (numNodes > fileSize || numEdges > fileSize || edgeSize > fileSize)
+    return 0;
+  return edgeDataOffset(version, numNodes, numEdges) + edgeSize * numEdges;
+}
+
+uint64_t mixWord(uint64_t h, uint64_t w) {
+  h ^= w * 0x9e3779b97f4a7c15ULL;
+  h = (h << 29) | (h >> 35);
+  return h * 0xbf58476d1ce4e5b9ULL;
+}
+
+uint64_t finalize(uint64_t h) {
+  h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+  return h ^ (h >> 31);
+}
+
+//! hash of the little-endian 64-bit words of [p, p + len), zero padded
+uint64_t hashBytes(const char* p, size_t len, uint64_t seed) {
+  uint64_t h = finalize(seed ^ len);
+  size_t i   = 0;
+  for (; i + 8 <= len; i += 8)
+    h = mixWord(h, readLE64(p + i));
+  if (i < len) {
+    char tail[8] = {};
+    memcpy(tail, p + i, len - i);
+    h = mixWord(h, readLE64(tail));
+  }
+  return finalize(h);
+}
+
+//! hashes blocks in parallel, then the sequence of block hashes
+uint64_t checksum(const char* p, size_t len) {
+  size_t numBlocks = (len + checksumBlock - 1) / checksumBlock;
+  std::vector<uint64_t> blocks(numBlocks);
+  galois::do_all(
+      galois::iterate(size_t(0), numBlocks),
+      [&](size_t b) {
+        size_t begin = b * checksumBlock;
+        size_t size  = std::min<size_t>(checksumBlock, len - begin);
+        blocks[b]    = convert_htole64(hashBytes(p + begin, size, b));
+      },
+      galois::no_stats());
+  return hashBytes(reinterpret_cast<const char*>(blocks.data()),
+                   numBlocks * sizeof(uint64_t), len);
+}
+
+std::vector<char> serialize(const GraphMetadata& meta) {
+  uint64_t fields[trailerFields] = {
+      trailerVersion,
+      meta.known,
+      meta.properties & meta.known,
+      meta.edgeType,
+      meta.hasChecksums ? checksumBlock : 0,
+      meta.topologyChecksum,
+      meta.edgeDataChecksum};
+  std::vector<char> out((trailerFields + 1) * sizeof(uint64_t) +
+                        sizeof(trailerMagic));
+  char* p = out.data();
+  for (uint64_t f : fields) {
+    f = convert_htole64(f);
+    memcpy(p, &f, sizeof(f));
+    p += sizeof(f);
+  }
+  uint64_t size = convert_htole64(trailerFields * sizeof(uint64_t));
+  memcpy(p, &size, sizeof(size));
+  memcpy(p + sizeof(size), trailerMagic, sizeof(trailerMagic));
+  return out;
+}
+
+} // namespace
+
+bool internal::parseGraphMetadata(const void* file, size_t len,
+                                  GraphMetadata& meta, size_t& offset) {
+  const char* base = static_cast<const char*>(file);
+  const size_t footer = sizeof(uint64_t) + sizeof(trailerMagic);
+  if (len < 4 * sizeof(uint64_t))
+    return false;
+  uint64_t end = graphBytes(base, len);
+  if (!end || len < end + footer ||
+      memcmp(base + len - sizeof(trailerMagic), trailerMagic,
+             sizeof(trailerMagic)))
+    return false;
+  uint64_t size = readLE64(base + len - footer);
+  if (end + size + footer != len || size % sizeof(uint64_t) ||
+      size < trailerFields * sizeof(uint64_t)) {
+    galois::gWarn("ignoring malformed graph metadata");
+    return false;
+  }
+
+  // later versions may append fields, which this reader skips
+  const char* f = base + end;
+  if (readLE64(f) < 1)
+    return false;
+  GraphMetadata m;
+  m.known      = readLE64(f + 8) & GraphMetadata::ALL_PROPERTIES;
+  m.properties = readLE64(f + 16) & m.known;
+  uint64_t type = readLE64(f + 24);
+  if (type <= GraphMetadata::FLOAT64_TYPE &&
+      GraphMetadata::sizeOf(GraphMetadata::EdgeType(type)) ==
+          readLE64(base + 8))
+    m.edgeType = GraphMetadata::EdgeType(type);
+  m.hasChecksums     = readLE64(f + 32) == checksumBlock;
+  m.topologyChecksum = readLE64(f + 40);
+  m.edgeDataChecksum = readLE64(f + 48);
+
+  meta   = m;
+  offset = end;
+  return true;
+}
+
+bool readGraphMetadata(const std::string& filename, GraphMetadata& meta) {
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd == -1)
+    return false;
+  struct stat buf;
+  bool found = false;
+  if (fstat(fd, &buf) == 0 && buf.st_size > 0) {
+    // only the header and the trailer are touched
+    void* base = mmap(nullptr, buf.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (base != MAP_FAILED) {
+      size_t offset;
+      found = internal::parseGraphMetadata(base, buf.st_size, meta, offset);
+      munmap(base, buf.st_size);
+    }
+  }
+  close(fd);
+  return found;
+}
+
+void writeGraphMetadata(const std::string& filename,
+                        const GraphMetadata& meta) {
+  int fd = open(filename.c_str(), O_RDWR);
+  if (fd == -1)
+    GALOIS_SYS_DIE("failed opening ", "'", filename, "'");
+  struct stat buf;
+  char header[4 * sizeof(uint64_t)];
+  if (fstat(fd, &buf) == -1 ||
+      pread(fd, header, sizeof(header), 0) != ssize_t(sizeof(header)))
+    GALOIS_SYS_DIE("failed reading ", "'", filename, "'");
+  uint64_t end = graphBytes(header, buf.st_size);
+  if (!end)
+    GALOIS_DIE("'", filename, "' is not a .gr file");
+  if (uint64_t(buf.st_size) < end)
+    GALOIS_DIE("'", filename, "' is truncated");
+
+  std::vector<char> trailer = serialize(meta);
+  if (ftruncate(fd, end) == -1 ||
+      pwrite(fd, trailer.data(), trailer.size(), end) !=
+          ssize_t(trailer.size()))
+    GALOIS_SYS_DIE("failed writing to ", "'", filename, "'");
+  close(fd);
+}
+
+void GraphMetadata::require(uint64_t required, EdgeType type,
+                            const std::string& filename) const {
+  for (uint64_t p = 1; p <= ALL_PROPERTIES; p <<= 1)
+    if ((required & p) && lacks(Property(p)))
+      GALOIS_DIE("'", filename, "' is not ", name(Property(p)),
+                 " according to its metadata");
+  if (type == UNKNOWN_TYPE || edgeType == UNKNOWN_TYPE || type == edgeType)
+    return;
+  if (sizeOf(type) != sizeOf(edgeType))
+    GALOIS_DIE("'", filename, "' has ", name(edgeType),
+               " edge data, not ", name(type));
+  galois::gWarn("'", filename, "' has ", name(edgeType),
+                " edge data; reading it as ", name(type));
+}
+
+std::string GraphMetadata::describe() const {
+  std::string s;
+  for (uint64_t p = 1; p <= ALL_PROPERTIES; p <<= 1) {
+    if (!isKnown(Property(p)))
+      continue;
+    s += s.empty() ? "" : " ";
+    s += has(Property(p)) ? "" : "!";
+    s += name(Property(p));
+  }
+  s += s.empty() ? "" : " ";
+  s += name(edgeType);
+  if (hasChecksums)
+    s += " checksummed";
+  return s;
+}
+
+const char* GraphMetadata::name(Property p) {
+  switch (p) {
+  case SYMMETRIC:
+    return "symmetric";
+  case SORTED:
+    return "sorted";
+  case NO_DUPLICATES:
+    return "no-duplicates";
+  case NO_SELF_LOOPS:
+    return "no-self-loops";
+  case TRANSPOSE:
+    return "transpose";
+  }
+  return "unknown-property";
+}
+
+const char* GraphMetadata::name(EdgeType t) {
+  switch (t) {
+  case UNKNOWN_TYPE:
+    return "unknown-type";
+  case VOID_TYPE:
+    return "void";
+  case INT32_TYPE:
+    return "int32";
+  case UINT32_TYPE:
+    return "uint32";
+  case INT64_TYPE:
+    return "int64";
+  case UINT64_TYPE:
+    return "uint64";
+  case FLOAT32_TYPE:
+    return "float32";
+  case FLOAT64_TYPE:
+    return "float64";
+  }
+  return "unknown-type";
+}
+
+size_t GraphMetadata::sizeOf(EdgeType t) {
+  switch (t) {
+  case INT32_TYPE:
+  case UINT32_TYPE:
+  case FLOAT32_TYPE:
+    return 4;
+  case INT64_TYPE:
+  case UINT64_TYPE:
+  case FLOAT64_TYPE:
+    return 8;
+  default:
+    return 0;
+  }
+}
+
+void FileGraph::checkEdgeType(GraphMetadata::EdgeType type, size_t size,
+                              const std::string& filename) const {
+  if (!hasMetadata() || metadata.edgeType == GraphMetadata::UNKNOWN_TYPE)
+    return;
+  if (GraphMetadata::sizeOf(metadata.edgeType) != size)
+    GALOIS_DIE("'", filename, "' has ", GraphMetadata::name(metadata.edgeType),
+               " edge data, which cannot be read as ", size, "-byte values");
+  metadata.require(0, type, filename);
+}
+
+GraphMetadata FileGraph::computeMetadata(GraphMetadata::EdgeType type) {
+  GALOIS_ASSERT(mappings.size() == 1 && !nodeOffset && !edgeOffset,
+                "computeMetadata needs the whole graph loaded");
+  if (type != GraphMetadata::UNKNOWN_TYPE &&
+      GraphMetadata::sizeOf(type) != sizeofEdge)
+    GALOIS_DIE("edge data of ", sizeofEdge, " bytes cannot be ",
+               GraphMetadata::name(type));
+
+  GraphMetadata meta;
+  meta.edgeType = type;
+
+  galois::GReduceLogicalAnd sorted, noSelfLoops, inRange;
+  galois::do_all(
+      galois::iterate(uint64_t(0), numNodes),
+      [&](uint64_t n) {
+        uint64_t begin = *edge_begin(n), end = *edge_end(n);
+        for (uint64_t e = begin; e != end; ++e) {
+          uint64_t dst = getEdgeDst(edge_iterator(e));
+          if (dst == n)
+            noSelfLoops.update(false);
+          if (dst >= numNodes)
+            inRange.update(false);
+          if (e != begin && dst < getEdgeDst(edge_iterator(e - 1)))
+            sorted.update(false);
+        }
+      },
+      galois::steal(), galois::no_stats());
+  meta.set(GraphMetadata::SORTED, sorted.reduce());
+  meta.set(GraphMetadata::NO_SELF_LOOPS, noSelfLoops.reduce());
+
+  // duplicates and reverse edges are found by binary search, on a sorted
+  // copy of the destinations if the file is not sorted
+  LargeArray<uint64_t> copy;
+  if (!meta.has(GraphMetadata::SORTED)) {
+    copy.allocateBlocked(numEdges);
+    galois::do_all(
+        galois::iterate(uint64_t(0), numNodes),
+        [&](uint64_t n) {
+          uint64_t begin = *edge_begin(n), end = *edge_end(n);
+          for (uint64_t e = begin; e != end; ++e)
+            copy[e] = getEdgeDst(edge_iterator(e));
+          std::sort(&copy[0] + begin, &copy[0] + end);
+        },
+        galois::steal(), galois::no_stats());
+  }
+  auto dstAt = [&](uint64_t e) {
+    return copy.size() ? copy[e] : getEdgeDst(edge_iterator(e));
+  };
+
+  galois::GReduceLogicalAnd noDuplicates, symmetric;
+  bool checkSymmetric = inRange.reduce();
+  galois::do_all(
+      galois::iterate(uint64_t(0), numNodes),
+      [&](uint64_t n) {
+        uint64_t begin = *edge_begin(n), end = *edge_end(n);
+        for (uint64_t e = begin; e != end; ++e) {
+          uint64_t dst = dstAt(e);
+          if (e != begin && dst == dstAt(e - 1))
+            noDuplicates.update(false);
+          if (!checkSymmetric)
+            continue;
+          uint64_t lo = *edge_begin(dst), hi = *edge_end(dst);
+          while (lo < hi) {
+            uint64_t mid = lo + (hi - lo) / 2;
+            if (dstAt(mid) < n)
+              lo = mid + 1;
+            else
+              hi = mid;
+          }
+          if (lo == *edge_end(dst) || dstAt(lo) != n)
+            symmetric.update(false);
+        }
+      },
+      galois::steal(), galois::no_stats());
+  meta.set(GraphMetadata::NO_DUPLICATES, noDuplicates.reduce());
+  meta.set(GraphMetadata::SYMMETRIC, checkSymmetric && symmetric.reduce());
+
+  const char* base = reinterpret_cast<const char*>(outIdx) -
+                     4 * sizeof(uint64_t);
+  uint64_t topology = edgeDataOffset(graphVersion, numNodes, numEdges);
+  meta.hasChecksums     = true;
+  meta.topologyChecksum = checksum(base, topology);
+  meta.edgeDataChecksum =
+      sizeofEdge ? checksum(edgeData, sizeofEdge * numEdges) : 0;
+  return meta;
+}
+
+} // namespace graphs
+} // namespace galois
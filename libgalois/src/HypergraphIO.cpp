@@ -0,0 +1,398 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#include "galois/graphs/HypergraphIO.h"
+
+#include "galois/Galois.h"
+#include "galois/ParallelSTL.h"
+#include "galois/gIO.h"
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+namespace {
+
+using galois::LargeArray;
+using galois::graphs::HypergraphCSR;
+
+constexpr uint64_t BINARY_MAGIC   = 0x4847422d53494f4cULL; // "LOIS-BGH"
+constexpr uint64_t BINARY_VERSION = 1;
+constexpr uint64_t NET_WEIGHTS    = 1;
+constexpr uint64_t NODE_WEIGHTS   = 2;
+
+//! the whole file, followed by a newline so every line is terminated
+struct TextFile {
+  LargeArray<char> data;
+  size_t size = 0;
+
+  explicit TextFile(const std::string& filename) {
+    std::ifstream in(filename, std::ios_base::binary | std::ios_base::ate);
+    if (!in) {
+      GALOIS_DIE("failed to open hypergraph ", filename);
+    }
+    size = in.tellg();
+    in.seekg(0);
+    data.allocateInterleaved(size + 1);
+    if (!in.read(data.data(), size)) {
+      GALOIS_DIE("failed to read hypergraph ", filename);
+    }
+    data[size] = '\n';
+  }
+};
+
+bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+//! calls fn on every unsigned integer of the line starting at p; returns
+//! false on a character that is not part of a number
+template <typename Fn>
+bool forEachNumber(const char* p, Fn fn) {
+  while (true) {
+    while (isSpace(*p))
+      ++p;
+    if (*p == '\n')
+      return true;
+    if (*p < '0' || *p > '9')
+      return false;
+    uint64_t v = 0;
+    while (*p >= '0' && *p <= '9')
+      v = v * 10 + (*p++ - '0');
+    fn(v);
+  }
+}
+
+uint64_t countNumbers(const char* p) {
+  uint64_t n = 0;
+  forEachNumber(p, [&](uint64_t) { ++n; });
+  return n;
+}
+
+//! turns per-element counts into inclusive end offsets, in parallel
+void prefixSum(LargeArray<uint64_t>& a) {
+  galois::ParallelSTL::partial_sum(a.begin(), a.end(), a.begin());
+}
+
+/**
+ * Start offsets of the lines that carry data, i.e. neither blank nor
+ * comments. Found with one parallel counting pass and one filling pass over
+ * fixed-size blocks of the file.
+ */
+LargeArray<uint64_t> findLines(const TextFile& file) {
+  const char* text = file.data.data();
+  size_t size      = file.size;
+  auto isDataLine  = [&](size_t p) {
+    if (p != 0 && text[p - 1] != '\n')
+      return false;
+    while (p < size && isSpace(text[p]))
+      ++p;
+    return p < size && text[p] != '\n' && text[p] != '%';
+  };
+
+  constexpr size_t blockSize = 1 << 20;
+  size_t nblocks             = (size + blockSize - 1) / blockSize;
+  LargeArray<uint64_t> counts;
+  counts.allocateInterleaved(nblocks);
+  galois::do_all(
+      galois::iterate(size_t{0}, nblocks),
+      [&](size_t b) {
+        uint64_t n = 0;
+        for (size_t p = b * blockSize, e = std::min(size, p + blockSize); p < e;
+             ++p)
+          n += isDataLine(p);
+        counts[b] = n;
+      },
+      galois::steal(), galois::no_stats());
+  prefixSum(counts);
+
+  LargeArray<uint64_t> lines;
+  lines.allocateInterleaved(nblocks ? counts[nblocks - 1] : 0);
+  galois::do_all(
+      galois::iterate(size_t{0}, nblocks),
+      [&](size_t b) {
+        uint64_t next = b ? counts[b - 1] : 0;
+        for (size_t p = b * blockSize, e = std::min(size, p + blockSize); p < e;
+             ++p)
+          if (isDataLine(p))
+            lines[next++] = p;
+      },
+      galois::steal(), galois::no_stats());
+  return lines;
+}
+
+std::vector<uint64_t> parseHeader(const TextFile& file,
+                                  const LargeArray<uint64_t>& lines,
+                                  const std::string& filename) {
+  if (lines.size() == 0) {
+    GALOIS_DIE("hypergraph ", filename, " is empty");
+  }
+  std::vector<uint64_t> header;
+  if (!forEachNumber(file.data.data() + lines[0],
+                     [&](uint64_t v) { header.push_back(v); })) {
+    GALOIS_DIE("malformed header in hypergraph ", filename);
+  }
+  return header;
+}
+
+/**
+ * Parses the net lines lines[1 .. numNets]. With netWeighted the first number
+ * of each line is the net weight. Pins are shifted down by base and checked
+ * against numNodes.
+ */
+void parseNets(const TextFile& file, const LargeArray<uint64_t>& lines,
+               HypergraphCSR& hg, bool netWeighted, uint64_t base) {
+  const char* text = file.data.data();
+  if (lines.size() < hg.numNets + 1) {
+    GALOIS_DIE("hypergraph declares ", hg.numNets, " nets but has ",
+               lines.size() - 1, " data lines");
+  }
+
+  hg.netEnd.allocateInterleaved(hg.numNets);
+  galois::do_all(
+      galois::iterate(uint64_t{0}, hg.numNets),
+      [&](uint64_t net) {
+        uint64_t n = countNumbers(text + lines[net + 1]);
+        if (n < (netWeighted ? 2u : 1u)) {
+          GALOIS_DIE("net ", net + 1, " has no pins");
+        }
+        hg.netEnd[net] = n - netWeighted;
+      },
+      galois::steal(), galois::loopname("HypergraphCountPins"));
+  prefixSum(hg.netEnd);
+
+  hg.pins.allocateInterleaved(hg.numPins());
+  if (netWeighted) {
+    hg.netWeights.allocateInterleaved(hg.numNets);
+  }
+  galois::do_all(
+      galois::iterate(uint64_t{0}, hg.numNets),
+      [&](uint64_t net) {
+        uint64_t next = hg.netBegin(net);
+        bool first    = netWeighted;
+        bool ok       = forEachNumber(text + lines[net + 1], [&](uint64_t v) {
+          if (first) {
+            hg.netWeights[net] = v;
+            first              = false;
+          } else if (v < base || v - base >= hg.numNodes) {
+            GALOIS_DIE("net ", net + 1, " has pin ", v, " out of range");
+          } else {
+            hg.pins[next++] = v - base;
+          }
+        });
+        if (!ok) {
+          GALOIS_DIE("net ", net + 1, " has a malformed number");
+        }
+      },
+      galois::steal(), galois::loopname("HypergraphReadPins"));
+}
+
+//! collects every number on lines[first ..] in order
+LargeArray<uint32_t> parseTrailingNumbers(const TextFile& file,
+                                          const LargeArray<uint64_t>& lines,
+                                          uint64_t first) {
+  const char* text = file.data.data();
+  uint64_t n       = lines.size() > first ? lines.size() - first : 0;
+  LargeArray<uint64_t> ends;
+  ends.allocateInterleaved(n);
+  galois::do_all(
+      galois::iterate(uint64_t{0}, n),
+      [&](uint64_t l) { ends[l] = countNumbers(text + lines[first + l]); },
+      galois::no_stats());
+  prefixSum(ends);
+
+  LargeArray<uint32_t> values;
+  values.allocateInterleaved(n ? ends[n - 1] : 0);
+  galois::do_all(
+      galois::iterate(uint64_t{0}, n),
+      [&](uint64_t l) {
+        uint64_t next = l ? ends[l - 1] : 0;
+        if (!forEachNumber(text + lines[first + l],
+                           [&](uint64_t v) { values[next++] = v; })) {
+          GALOIS_DIE("malformed weight on data line ", first + l + 1);
+        }
+      },
+      galois::no_stats());
+  return values;
+}
+
+HypergraphCSR readHMetis(const std::string& filename) {
+  TextFile file(filename);
+  auto lines  = findLines(file);
+  auto header = parseHeader(file, lines, filename);
+  if (header.size() < 2 || header.size() > 3) {
+    GALOIS_DIE("hMetis header must be \"nets nodes [fmt]\"");
+  }
+  uint64_t fmt = header.size() == 3 ? header[2] : 0;
+  if (fmt != 0 && fmt != 1 && fmt != 10 && fmt != 11) {
+    GALOIS_DIE("unknown hMetis fmt ", fmt);
+  }
+
+  HypergraphCSR hg;
+  hg.numNets  = header[0];
+  hg.numNodes = header[1];
+  parseNets(file, lines, hg, fmt % 10 == 1, 1);
+
+  if (fmt >= 10) {
+    // one weight per line after the nets
+    if (lines.size() != 1 + hg.numNets + hg.numNodes) {
+      GALOIS_DIE("hMetis input needs one weight line per node");
+    }
+    auto weights = parseTrailingNumbers(file, lines, 1 + hg.numNets);
+    if (weights.size() != hg.numNodes) {
+      GALOIS_DIE("hMetis input needs one weight per node");
+    }
+    hg.nodeWeights = std::move(weights);
+  } else if (lines.size() != 1 + hg.numNets) {
+    GALOIS_DIE("hMetis input has ", lines.size() - 1 - hg.numNets,
+               " lines after its ", hg.numNets, " nets");
+  }
+  return hg;
+}
+
+HypergraphCSR readPaToH(const std::string& filename) {
+  TextFile file(filename);
+  auto lines  = findLines(file);
+  auto header = parseHeader(file, lines, filename);
+  if (header.size() < 4 || header.size() > 6) {
+    GALOIS_DIE("PaToH header must be \"base cells nets pins [scheme [ncon]]\"");
+  }
+  uint64_t base   = header[0];
+  uint64_t scheme = header.size() > 4 ? header[4] : 0;
+  uint64_t ncon   = header.size() > 5 ? header[5] : 1;
+  if (base > 1 || scheme > 3 || ncon == 0) {
+    GALOIS_DIE("unsupported PaToH header");
+  }
+
+  HypergraphCSR hg;
+  hg.numNodes = header[1];
+  hg.numNets  = header[2];
+  parseNets(file, lines, hg, scheme >= 2, base);
+  if (hg.numPins() != header[3]) {
+    GALOIS_DIE("PaToH header declares ", header[3], " pins but nets have ",
+               hg.numPins());
+  }
+
+  if (scheme == 1 || scheme == 3) {
+    auto weights = parseTrailingNumbers(file, lines, 1 + hg.numNets);
+    if (weights.size() != hg.numNodes * ncon) {
+      GALOIS_DIE("PaToH input needs ", ncon, " weights per cell");
+    }
+    hg.nodeWeights.allocateInterleaved(hg.numNodes);
+    galois::do_all(
+        galois::iterate(uint64_t{0}, hg.numNodes),
+        [&](uint64_t n) { hg.nodeWeights[n] = weights[n * ncon]; },
+        galois::no_stats());
+  }
+  return hg;
+}
+
+template <typename T>
+void readArray(std::ifstream& in, LargeArray<T>& a, uint64_t n,
+               const std::string& filename) {
+  a.allocateInterleaved(n);
+  if (!in.read(reinterpret_cast<char*>(a.data()), n * sizeof(T))) {
+    GALOIS_DIE("truncated binary hypergraph ", filename);
+  }
+}
+
+template <typename T>
+void writeArray(std::ofstream& out, const LargeArray<T>& a) {
+  out.write(reinterpret_cast<const char*>(a.data()), a.size() * sizeof(T));
+}
+
+HypergraphCSR readBinary(const std::string& filename) {
+  std::ifstream in(filename, std::ios_base::binary);
+  uint64_t header[6];
+  if (!in.read(reinterpret_cast<char*>(header), sizeof(header)) ||
+      header[0] != BINARY_MAGIC) {
+    GALOIS_DIE(filename, " is not a binary hypergraph");
+  }
+  if (header[1] != BINARY_VERSION) {
+    GALOIS_DIE("unsupported binary hypergraph version ", header[1]);
+  }
+
+  HypergraphCSR hg;
+  hg.numNets     = header[2];
+  hg.numNodes    = header[3];
+  uint64_t flags = header[5];
+  readArray(in, hg.netEnd, hg.numNets, filename);
+  readArray(in, hg.pins, header[4], filename);
+  if (header[4] % 2) {
+    in.ignore(sizeof(uint32_t));
+  }
+  if (flags & NET_WEIGHTS) {
+    readArray(in, hg.netWeights, hg.numNets, filename);
+  }
+  if (flags & NODE_WEIGHTS) {
+    readArray(in, hg.nodeWeights, hg.numNodes, filename);
+  }
+  if (hg.numPins() != header[4]) {
+    GALOIS_DIE("corrupt binary hypergraph ", filename);
+  }
+  return hg;
+}
+
+bool isBinary(const std::string& filename) {
+  std::ifstream in(filename, std::ios_base::binary);
+  uint64_t magic = 0;
+  in.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+  return in && magic == BINARY_MAGIC;
+}
+
+} // namespace
+
+galois::graphs::HypergraphCSR
+galois::graphs::readHypergraph(const std::string& filename,
+                               HypergraphFormat format) {
+  if (format == HypergraphFormat::Auto) {
+    format =
+        isBinary(filename) ? HypergraphFormat::Binary : HypergraphFormat::hMetis;
+  }
+  switch (format) {
+  case HypergraphFormat::PaToH:
+    return readPaToH(filename);
+  case HypergraphFormat::Binary:
+    return readBinary(filename);
+  default:
+    return readHMetis(filename);
+  }
+}
+
+void galois::graphs::writeHypergraphBinary(const HypergraphCSR& hg,
+                                           const std::string& filename) {
+  std::ofstream out(filename, std::ios_base::binary | std::ios_base::trunc);
+  if (!out) {
+    GALOIS_DIE("failed to open ", filename, " for writing");
+  }
+  uint64_t flags = (hg.hasNetWeights() ? NET_WEIGHTS : 0) |
+                   (hg.hasNodeWeights() ? NODE_WEIGHTS : 0);
+  uint64_t header[6] = {BINARY_MAGIC, BINARY_VERSION, hg.numNets,
+                        hg.numNodes,  hg.numPins(),   flags};
+  out.write(reinterpret_cast<const char*>(header), sizeof(header));
+  writeArray(out, hg.netEnd);
+  writeArray(out, hg.pins);
+  if (hg.numPins() % 2) {
+    uint32_t pad = 0;
+    out.write(reinterpret_cast<const char*>(&pad), sizeof(pad));
+  }
+  writeArray(out, hg.netWeights);
+  writeArray(out, hg.nodeWeights);
+  if (!out) {
+    GALOIS_DIE("failed to write ", filename);
+  }
+}
@@ -83,6 +83,27 @@ void galois::substrate::freePages(void* ptr, unsigned num) {
     GALOIS_SYS_DIE("Unmap failed");
 }
 
+void* galois::substrate::reservePages(unsigned num) {
+  if (num == 0)
+    return nullptr;
+#ifdef MAP_NORESERVE
+  void* ptr = trymmap(num * hugePageSize, _MAP | MAP_NORESERVE);
+#else
+  void* ptr = trymmap(num * hugePageSize, _MAP);
+#endif
+  if (!ptr)
+    GALOIS_SYS_DIE("Out of address space");
+#ifdef MADV_HUGEPAGE
+  madvise(ptr, num * hugePageSize, MADV_HUGEPAGE);
+#endif
+  return ptr;
+}
+
+void galois::substrate::releasePages(void* ptr, unsigned num) {
+  if (madvise(ptr, num * hugePageSize, MADV_DONTNEED) != 0)
+    GALOIS_SYS_DIE("Release failed");
+}
+
 /*
 
 class PageSizeConf {
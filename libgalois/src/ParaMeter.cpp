@@ -25,8 +25,9 @@
 
 struct StatsFileManager {
 
-  constexpr static const char* const PARAM_FILE_ENV_VAR =
-      "GALOIS_PARAMETER_OUTFILE";
+  const char* const fileEnvVar;
+  const char* const fileNameFormat;
+  void (*const printHeader)(FILE*);
 
   bool init     = false;
   bool isOpen   = false;
@@ -34,9 +35,13 @@ struct StatsFileManager {
   // char statsFileName[FNAME_SIZE];
   std::string statsFileName;
 
+  StatsFileManager(const char* envVar, const char* nameFormat,
+                   void (*header)(FILE*))
+      : fileEnvVar(envVar), fileNameFormat(nameFormat), printHeader(header) {}
+
   ~StatsFileManager(void) { close(); }
 
-  static void getTimeStampedName(std::string& statsFileName) {
+  void getTimeStampedName(std::string& statsFileName) {
 
     constexpr unsigned FNAME_SIZE = 256;
     char buf[FNAME_SIZE];
@@ -47,8 +52,7 @@ struct StatsFileManager {
     time(&rawtime);
     timeinfo = localtime(&rawtime);
 
-    strftime(buf, FNAME_SIZE, "ParaMeter-Stats-%Y-%m-%d--%H-%M-%S.csv",
-             timeinfo);
+    strftime(buf, FNAME_SIZE, fileNameFormat, timeinfo);
     statsFileName = buf;
   }
 
@@ -56,7 +60,7 @@ struct StatsFileManager {
     if (!init) {
       init = true;
 
-      if (!galois::substrate::EnvCheck(PARAM_FILE_ENV_VAR, statsFileName)) {
+      if (!galois::substrate::EnvCheck(fileEnvVar, statsFileName)) {
         // statsFileName = "ParaMeter-Stats.csv";
         getTimeStampedName(statsFileName);
       }
@@ -64,7 +68,7 @@ struct StatsFileManager {
       statsFH = fopen(statsFileName.c_str(), "w");
       GALOIS_ASSERT(statsFH != nullptr, "ParaMeter stats file error");
 
-      galois::runtime::ParaMeter::StepStatsBase::printHeader(statsFH);
+      printHeader(statsFH);
 
       fclose(statsFH);
     }
@@ -89,7 +93,17 @@ struct StatsFileManager {
 };
 
 static StatsFileManager& getStatsFileManager(void) {
-  static StatsFileManager s;
+  static StatsFileManager s("GALOIS_PARAMETER_OUTFILE",
+                            "ParaMeter-Stats-%Y-%m-%d--%H-%M-%S.csv",
+                            galois::runtime::ParaMeter::StepStats::printHeader);
+  return s;
+}
+
+static StatsFileManager& getSummaryFileManager(void) {
+  static StatsFileManager s(
+      "GALOIS_PARAMETER_SUMMARY_OUTFILE",
+      "ParaMeter-Summary-%Y-%m-%d--%H-%M-%S.csv",
+      galois::runtime::ParaMeter::LoopProfile::printHeader);
   return s;
 }
 
@@ -100,3 +114,16 @@ FILE* galois::runtime::ParaMeter::getStatsFile(void) {
 void galois::runtime::ParaMeter::closeStatsFile(void) {
   getStatsFileManager().close();
 }
+
+FILE* galois::runtime::ParaMeter::getSummaryFile(void) {
+  return getSummaryFileManager().get();
+}
+
+void galois::runtime::ParaMeter::closeSummaryFile(void) {
+  getSummaryFileManager().close();
+}
+
+bool galois::runtime::ParaMeter::profileOrderedLoops(void) {
+  static bool profile = galois::substrate::EnvCheck("GALOIS_PARAMETER_PROFILE");
+  return profile;
+}
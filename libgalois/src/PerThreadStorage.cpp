@@ -18,35 +18,32 @@
  */
 
 #include "galois/substrate/PerThreadStorage.h"
+#include "galois/substrate/EnvCheck.h"
 #include "galois/substrate/PageAlloc.h"
 
 #include "galois/gIO.h"
+#include <algorithm>
 #include <atomic>
+#include <cstring>
 #include <mutex>
 
 thread_local char* galois::substrate::ptsBase;
 
+// The backends are never destroyed: PerThread/PerSocket objects with static
+// storage duration may still release their offsets during exit.
 galois::substrate::PerBackend& galois::substrate::getPTSBackend() {
-  static galois::substrate::PerBackend b;
-  return b;
+  static galois::substrate::PerBackend* b = new galois::substrate::PerBackend;
+  return *b;
 }
 
 thread_local char* galois::substrate::pssBase;
 
 galois::substrate::PerBackend& galois::substrate::getPPSBackend() {
-  static galois::substrate::PerBackend b;
-  return b;
+  static galois::substrate::PerBackend* b = new galois::substrate::PerBackend;
+  return *b;
 }
 
 const size_t ptAllocSize = galois::substrate::allocSize();
-inline void* alloc() {
-  // alloc a single page, don't prefault
-  void* toReturn = galois::substrate::allocPages(1, true);
-  if (toReturn == nullptr) {
-    GALOIS_DIE("per-thread storage out of memory");
-  }
-  return toReturn;
-}
 
 constexpr unsigned MAX_SIZE = 30;
 // PerBackend storage is typically cache-aligned. Simplify bookkeeping at the
@@ -55,6 +52,30 @@ constexpr unsigned MIN_SIZE = 7;
 
 static_assert((1 << MIN_SIZE) == galois::substrate::GALOIS_CACHE_LINE_SIZE);
 
+//! Pages of address space reserved for each region (GALOIS_PTS_RESERVE_MB)
+static unsigned reservedPages() {
+  static const unsigned pages = [] {
+    const size_t maxBytes = size_t(1) << MAX_SIZE;
+    int mb                = maxBytes >> 20;
+    galois::substrate::EnvCheck("GALOIS_PTS_RESERVE_MB", mb);
+    size_t bytes = std::min(std::max(size_t(std::max(mb, 0)) << 20,
+                                     ptAllocSize),
+                            maxBytes);
+    return unsigned(bytes / ptAllocSize);
+  }();
+  return pages;
+}
+
+static size_t reservedSize() { return reservedPages() * ptAllocSize; }
+
+inline char* alloc() {
+  // reserve the whole region but only fault in the first page; the owner
+  // touches it so that the common small allocations stay local
+  char* toReturn = (char*)galois::substrate::reservePages(reservedPages());
+  memset(toReturn, 0, ptAllocSize);
+  return toReturn;
+}
+
 galois::substrate::PerBackend::PerBackend() { freeOffsets.resize(MAX_SIZE); }
 
 unsigned galois::substrate::PerBackend::nextLog2(unsigned size) {
@@ -63,85 +84,110 @@ unsigned galois::substrate::PerBackend::nextLog2(unsigned size) {
     ++i;
   }
   if (i >= MAX_SIZE) {
-    abort();
+    GALOIS_DIE("per-thread storage object too large: ", size, " bytes");
   }
   return i;
 }
 
+void galois::substrate::PerBackend::addFree(unsigned offset, unsigned ll) {
+  freeBlocks.emplace(offset, ll);
+  freeOffsets[ll].insert(offset);
+}
+
+void galois::substrate::PerBackend::removeFree(unsigned offset, unsigned ll) {
+  freeBlocks.erase(offset);
+  freeOffsets[ll].erase(offset);
+}
+
 unsigned galois::substrate::PerBackend::allocOffset(const unsigned sz) {
   unsigned ll   = nextLog2(sz);
   unsigned size = (1 << ll);
 
-  if (nextLoc.load(std::memory_order_relaxed) + size <= ptAllocSize) {
-    // simple path, where we allocate bump ptr style
-    unsigned offset = nextLoc.fetch_add(size);
-    if (offset + size <= ptAllocSize) {
-      return offset;
-    }
-  }
-
-  if (invalid) {
-    GALOIS_DIE("allocating after delete");
-    return ptAllocSize;
-  }
-
-  // find a free offset
   std::lock_guard<Lock> llock(freeOffsetsLock);
 
+  // smallest free block that fits, splitting off the unused halves
   unsigned index = ll;
-  if (!freeOffsets[index].empty()) {
-    unsigned offset = freeOffsets[index].back();
-    freeOffsets[index].pop_back();
-    return offset;
-  }
-
-  // find a bigger size
-  for (; (index < MAX_SIZE) && (freeOffsets[index].empty()); ++index)
+  for (; index < MAX_SIZE && freeOffsets[index].empty(); ++index)
     ;
 
-  if (index == MAX_SIZE) {
-    GALOIS_DIE("per-thread storage out of memory");
-    return ptAllocSize;
-  }
-
-  // Found a bigger free offset. Use the first piece equal to required
-  // size and produce vending machine change for the rest.
-  assert(!freeOffsets[index].empty());
-  unsigned offset = freeOffsets[index].back();
-  freeOffsets[index].pop_back();
-
-  // remaining chunk
-  unsigned end   = offset + (1 << index);
-  unsigned start = offset + size;
-  for (unsigned i = index - 1; start < end; --i) {
-    freeOffsets[i].push_back(start);
-    start += (1 << i);
+  unsigned offset;
+  if (index < MAX_SIZE) {
+    offset = *freeOffsets[index].begin();
+    removeFree(offset, index);
+    while (index > ll) {
+      --index;
+      addFree(offset + (1U << index), index);
+    }
+  } else {
+    // bump allocate a size-aligned block; the skipped space becomes free
+    // blocks of their natural alignment
+    unsigned loc = nextLoc.load(std::memory_order_relaxed);
+    offset       = (loc + size - 1) & ~(size - 1);
+    if (size_t(offset) + size > reservedSize()) {
+      GALOIS_DIE("per-thread storage out of memory: ", inUse,
+                 " bytes in use of ", reservedSize(),
+                 " reserved (see GALOIS_PTS_RESERVE_MB)");
+    }
+    while (loc < offset) {
+      unsigned gap = MIN_SIZE;
+      while (!(loc & (1U << gap)))
+        ++gap;
+      addFree(loc, gap);
+      loc += 1U << gap;
+    }
+    nextLoc.store(offset + size, std::memory_order_relaxed);
+    committedEnd  = std::max(committedEnd, offset + size);
+    peakFootprint = std::max<size_t>(peakFootprint, offset + size);
   }
 
-  assert(offset != ptAllocSize);
-
+  inUse += size;
+  peakInUse = std::max(peakInUse, inUse);
   return offset;
 }
 
-void galois::substrate::PerBackend::deallocOffset(const unsigned offset,
-                                                  const unsigned sz) {
-  unsigned ll       = nextLog2(sz);
-  unsigned size     = (1 << ll);
-  unsigned expected = offset + size;
-
-  if (nextLoc.compare_exchange_strong(expected, offset)) {
-    // allocation was at the end, so recovered some memory
-    return;
+void galois::substrate::PerBackend::trimEnd() {
+  unsigned loc = nextLoc.load(std::memory_order_relaxed);
+  while (!freeBlocks.empty()) {
+    auto last = std::prev(freeBlocks.end());
+    if (last->first + (1U << last->second) != loc)
+      break;
+    loc = last->first;
+    removeFree(last->first, last->second);
   }
-
-  if (invalid) {
-    GALOIS_DIE("deallocing after delete");
-    return;
+  nextLoc.store(loc, std::memory_order_relaxed);
+
+  // Give back whole pages past the first once more than a page is unused.
+  // Only offsets below nextLoc are handed out, so nobody is using the pages.
+  size_t keep = std::max((loc + ptAllocSize - 1) / ptAllocSize, size_t(1));
+  size_t end  = (committedEnd + ptAllocSize - 1) / ptAllocSize;
+  if (end > keep + 1 && heads) {
+    for (unsigned i = 0; i < numHeads; ++i) {
+      char* base = heads[i].load(std::memory_order_relaxed);
+      if (base && (i == 0 || base != heads[i - 1].load()))
+        releasePages(base + keep * ptAllocSize, end - keep);
+    }
+    committedEnd = keep * ptAllocSize;
   }
+}
+
+void galois::substrate::PerBackend::deallocOffset(const unsigned offset,
+                                                  const unsigned sz) {
+  unsigned ll = nextLog2(sz);
 
-  // allocation not at the end
   std::lock_guard<Lock> llock(freeOffsetsLock);
-  freeOffsets[ll].push_back(offset);
+  inUse -= 1U << ll;
+
+  // merge with the buddy for as long as it is free as a whole
+  unsigned start = offset;
+  for (; ll + 1 < MAX_SIZE; ++ll) {
+    unsigned buddy = start ^ (1U << ll);
+    if (!freeOffsets[ll].count(buddy))
+      break;
+    removeFree(buddy, ll);
+    start = std::min(start, buddy);
+  }
+  addFree(start, ll);
+  trimEnd();
 }
 
 void* galois::substrate::PerBackend::getRemote(unsigned thread,
@@ -151,17 +197,23 @@ void* galois::substrate::PerBackend::getRemote(unsigned thread,
   return &rbase[offset];
 }
 
+galois::substrate::PerBackend::Usage galois::substrate::PerBackend::usage() {
+  std::lock_guard<Lock> llock(freeOffsetsLock);
+  return Usage{inUse, peakInUse, nextLoc.load(std::memory_order_relaxed),
+               peakFootprint, reservedSize()};
+}
+
 void galois::substrate::PerBackend::initCommon(unsigned maxT) {
   if (!heads) {
     assert(ThreadPool::getTID() == 0);
-    heads = new std::atomic<char*>[maxT] {};
+    heads    = new std::atomic<char*>[maxT] {};
+    numHeads = maxT;
   }
 }
 
 char* galois::substrate::PerBackend::initPerThread(unsigned maxT) {
   initCommon(maxT);
-  char* b = heads[ThreadPool::getTID()] = (char*)alloc();
-  memset(b, 0, ptAllocSize);
+  char* b = heads[ThreadPool::getTID()] = alloc();
   return b;
 }
 
@@ -170,8 +222,7 @@ char* galois::substrate::PerBackend::initPerSocket(unsigned maxT) {
   unsigned id     = ThreadPool::getTID();
   unsigned leader = ThreadPool::getLeader();
   if (id == leader) {
-    char* b = heads[id] = (char*)alloc();
-    memset(b, 0, ptAllocSize);
+    char* b = heads[id] = alloc();
     return b;
   }
   char* expected = nullptr;
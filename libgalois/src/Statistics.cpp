@@ -19,6 +19,7 @@
 
 #include "galois/runtime/Statistics.h"
 #include "galois/runtime/Executor_OnEach.h"
+#include "galois/substrate/PerThreadStorage.h"
 
 #include <iostream>
 #include <fstream>
@@ -133,6 +134,19 @@ void galois::runtime::reportPageAlloc(const char* category) {
       std::make_tuple());
 }
 
+void galois::runtime::reportPerThreadStorage(const std::string& id) {
+  auto report = [&id](const char* region, substrate::PerBackend& b) {
+    auto u = b.usage();
+    reportStat(region, "InUse_" + id, u.inUse, StatTotal::SINGLE);
+    reportStat(region, "PeakInUse_" + id, u.peakInUse, StatTotal::SINGLE);
+    reportStat(region, "Footprint_" + id, u.footprint, StatTotal::SINGLE);
+    reportStat(region, "PeakFootprint_" + id, u.peakFootprint,
+               StatTotal::SINGLE);
+  };
+  report("PerThreadStorage", substrate::getPTSBackend());
+  report("PerSocketStorage", substrate::getPPSBackend());
+}
+
 void galois::runtime::reportNumaAlloc(const char*) {
   galois::gWarn("reportNumaAlloc NOT IMPLEMENTED YET. TBD");
   int nodes = substrate::getThreadPool().getMaxNumaNodes();
@@ -0,0 +1,137 @@
+#include "galois/Galois.h"
+#include "galois/graphs/FileGraph.h"
+#include "galois/graphs/LCGraph.h"
+#include "Lonestar/Analytics/BetweennessCentrality.h"
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+using Graph = galois::graphs::LC_CSR_Graph<lonestar::analytics::BetweennessNode,
+                                           void>;
+using Arcs  = std::vector<std::pair<uint32_t, uint32_t>>;
+
+void readArcs(Graph& g, uint32_t numNodes, const Arcs& arcs) {
+  galois::graphs::FileGraphWriter writer;
+  writer.setNumNodes(numNodes);
+  writer.setNumEdges<void>(arcs.size());
+  writer.phase1();
+  for (auto& a : arcs)
+    writer.incrementDegree(a.first);
+  writer.phase2();
+  for (auto& a : arcs)
+    writer.addNeighbor(a.first, a.second);
+  writer.finish();
+  galois::graphs::readGraph(g, writer);
+}
+
+/**
+ * Centrality from its definition: the sum over the pairs (s, t) of the
+ * fraction of shortest s-t paths through the node, with s in [begin, end).
+ */
+std::vector<double> bruteForce(uint32_t numNodes, const Arcs& arcs,
+                               uint32_t begin, uint32_t end) {
+  const uint32_t infinity = std::numeric_limits<uint32_t>::max();
+  std::vector<std::vector<uint32_t>> out(numNodes);
+  for (auto& a : arcs)
+    out[a.first].push_back(a.second);
+
+  // distances and numbers of shortest paths between all pairs
+  std::vector<std::vector<uint32_t>> dist(numNodes);
+  std::vector<std::vector<double>> paths(numNodes);
+  for (uint32_t s = 0; s < numNodes; ++s) {
+    dist[s].assign(numNodes, infinity);
+    paths[s].assign(numNodes, 0);
+    dist[s][s]  = 0;
+    paths[s][s] = 1;
+    std::deque<uint32_t> queue{s};
+    while (!queue.empty()) {
+      uint32_t n = queue.front();
+      queue.pop_front();
+      for (uint32_t dst : out[n]) {
+        if (dist[s][dst] == infinity) {
+          dist[s][dst] = dist[s][n] + 1;
+          queue.push_back(dst);
+        }
+        if (dist[s][dst] == dist[s][n] + 1)
+          paths[s][dst] += paths[s][n];
+      }
+    }
+  }
+
+  std::vector<double> bc(numNodes, 0);
+  for (uint32_t s = begin; s < end; ++s)
+    for (uint32_t t = 0; t < numNodes; ++t)
+      for (uint32_t v = 0; v < numNodes; ++v)
+        if (v != s && v != t && s != t && dist[s][t] != infinity &&
+            dist[s][v] != infinity && dist[v][t] != infinity &&
+            dist[s][v] + dist[v][t] == dist[s][t])
+          bc[v] += paths[s][v] * paths[v][t] / paths[s][t];
+  return bc;
+}
+
+void check(Graph& g, const std::vector<double>& expected) {
+  for (auto n : g) {
+    double bc = g.getData(n).centrality;
+    GALOIS_ASSERT(std::abs(bc - expected[n]) <=
+                      1e-4 * std::max(1.0, expected[n]),
+                  "node ", n, " has centrality ", bc, " instead of ",
+                  expected[n]);
+  }
+}
+
+int main() {
+  galois::SharedMemSys sys;
+  galois::setActiveThreads(4);
+
+  // on a symmetric path, node i lies on the paths between its i left and
+  // n - 1 - i right neighbors in both directions
+  const uint32_t pathLength = 9;
+  Arcs path;
+  for (uint32_t i = 0; i + 1 < pathLength; ++i) {
+    path.emplace_back(i, i + 1);
+    path.emplace_back(i + 1, i);
+  }
+  std::vector<double> pathBC(pathLength);
+  for (uint32_t i = 0; i < pathLength; ++i)
+    pathBC[i] = 2.0 * i * (pathLength - 1 - i);
+  {
+    Graph g;
+    readArcs(g, pathLength, path);
+    lonestar::analytics::betweennessCentrality(g);
+    check(g, pathBC);
+  }
+
+  // directed, with nodes that no other node reaches and many equally short
+  // paths
+  const uint32_t numNodes = 60;
+  std::mt19937 gen(5);
+  std::uniform_int_distribution<uint32_t> node(0, numNodes - 1);
+  Arcs arcs;
+  for (uint32_t i = 0; i < 3 * numNodes; ++i) {
+    uint32_t src = node(gen);
+    uint32_t dst = std::max(node(gen), node(gen));
+    if (src != dst &&
+        std::find(arcs.begin(), arcs.end(), std::make_pair(src, dst)) ==
+            arcs.end())
+      arcs.emplace_back(src, dst);
+  }
+  std::sort(arcs.begin(), arcs.end());
+
+  Graph g;
+  readArcs(g, numNodes, arcs);
+  lonestar::analytics::betweennessCentrality(g);
+  check(g, bruteForce(numNodes, arcs, 0, numNodes));
+
+  lonestar::analytics::BetweennessPlan plan;
+  plan.startSource = 13;
+  plan.numSources  = 20;
+  lonestar::analytics::betweennessCentrality(g, plan);
+  check(g, bruteForce(numNodes, arcs, 13, 33));
+
+  return 0;
+}
@@ -0,0 +1,100 @@
+#include "galois/Galois.h"
+#include "galois/graphs/FileGraph.h"
+#include "galois/graphs/LCGraph.h"
+#include "Lonestar/Analytics/IndependentSet.h"
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+using Graph =
+    galois::graphs::LC_CSR_Graph<lonestar::analytics::IndependentSetNode,
+                                 void>::with_no_lockable<true>::type;
+using Edges = std::vector<std::pair<uint32_t, uint32_t>>;
+using lonestar::analytics::IndependentSetNode;
+
+//! symmetric graph of the edges with sorted, distinct neighbors
+void readSymmetric(Graph& g, uint32_t numNodes, const Edges& edges) {
+  std::vector<std::set<uint32_t>> adj(numNodes);
+  for (auto& e : edges) {
+    adj[e.first].insert(e.second);
+    adj[e.second].insert(e.first);
+  }
+  size_t numEdges = 0;
+  for (auto& a : adj)
+    numEdges += a.size();
+
+  galois::graphs::FileGraphWriter writer;
+  writer.setNumNodes(numNodes);
+  writer.setNumEdges<void>(numEdges);
+  writer.phase1();
+  for (uint32_t n = 0; n < numNodes; ++n)
+    writer.incrementDegree(n, adj[n].size());
+  writer.phase2();
+  for (uint32_t n = 0; n < numNodes; ++n)
+    for (uint32_t dst : adj[n])
+      writer.addNeighbor(n, dst);
+  writer.finish();
+  galois::graphs::readGraph(g, writer);
+}
+
+//! runs the algorithm and checks that the set is independent and maximal
+std::vector<bool> independentSet(Graph& g, uint64_t seed) {
+  lonestar::analytics::IndependentSetPlan plan;
+  plan.seed     = seed;
+  uint64_t size = lonestar::analytics::maximalIndependentSet(g, plan);
+
+  std::vector<bool> inSet;
+  for (auto n : g) {
+    auto flag = g.getData(n).flag;
+    GALOIS_ASSERT(flag == IndependentSetNode::IN_SET ||
+                  flag == IndependentSetNode::OUT_OF_SET);
+    inSet.push_back(flag == IndependentSetNode::IN_SET);
+  }
+  GALOIS_ASSERT(size == size_t(std::count(inSet.begin(), inSet.end(), true)));
+
+  for (auto n : g) {
+    bool hasNeighborInSet = false;
+    for (auto e : g.edges(n)) {
+      uint32_t dst = g.getEdgeDst(e);
+      if (dst != n && inSet[dst]) {
+        hasNeighborInSet = true;
+        GALOIS_ASSERT(!inSet[n], "neighbors ", n, " and ", dst,
+                      " are both in the set");
+      }
+    }
+    GALOIS_ASSERT(inSet[n] || hasNeighborInSet, "node ", n,
+                  " could be added to the set");
+  }
+  return inSet;
+}
+
+int main() {
+  galois::SharedMemSys sys;
+
+  // skewed degrees, a self loop and isolated nodes
+  const uint32_t numNodes = 500;
+  std::mt19937 gen(13);
+  std::uniform_int_distribution<uint32_t> node(0, numNodes - 11);
+  Edges edges;
+  for (uint32_t i = 0; i < 6 * numNodes; ++i)
+    edges.emplace_back(std::min(node(gen), node(gen)), node(gen));
+  edges.emplace_back(numNodes - 1, numNodes - 1);
+
+  Graph g;
+  readSymmetric(g, numNodes, edges);
+
+  galois::setActiveThreads(1);
+  std::vector<bool> serial = independentSet(g, 0);
+  GALOIS_ASSERT(serial[numNodes - 2], "isolated nodes belong to the set");
+
+  galois::setActiveThreads(4);
+  GALOIS_ASSERT(independentSet(g, 0) == serial,
+                "the set depends on the number of threads");
+  GALOIS_ASSERT(independentSet(g, 1) != serial,
+                "the seed does not change the priorities");
+
+  return 0;
+}
@@ -0,0 +1,120 @@
+#include "galois/Galois.h"
+#include "galois/graphs/FileGraph.h"
+#include "galois/graphs/LCGraph.h"
+#include "Lonestar/Analytics/KTruss.h"
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+using Graph = galois::graphs::LC_CSR_Graph<void, uint32_t>;
+using Edge  = std::pair<uint32_t, uint32_t>;
+using lonestar::analytics::KTRUSS_ALIVE;
+using lonestar::analytics::KTRUSS_REMOVED;
+
+//! symmetric graph of the edges with sorted, distinct neighbors
+void readSymmetric(Graph& g, uint32_t numNodes, const std::set<Edge>& edges) {
+  std::vector<std::set<uint32_t>> adj(numNodes);
+  for (auto& e : edges) {
+    adj[e.first].insert(e.second);
+    adj[e.second].insert(e.first);
+  }
+  size_t numEdges = 0;
+  for (auto& a : adj)
+    numEdges += a.size();
+
+  galois::graphs::FileGraphWriter writer;
+  writer.setNumNodes(numNodes);
+  writer.setNumEdges<uint32_t>(numEdges);
+  writer.phase1();
+  for (uint32_t n = 0; n < numNodes; ++n)
+    writer.incrementDegree(n, adj[n].size());
+  writer.phase2();
+  for (uint32_t n = 0; n < numNodes; ++n)
+    for (uint32_t dst : adj[n])
+      writer.addNeighbor<uint32_t>(n, dst, KTRUSS_ALIVE);
+  writer.finish();
+  galois::graphs::readGraph(g, writer);
+}
+
+//! removes edges in fewer than k - 2 triangles until none is left
+std::set<Edge> bruteForce(std::set<Edge> edges, unsigned k) {
+  auto connected = [&](uint32_t a, uint32_t b) {
+    return edges.count({std::min(a, b), std::max(a, b)}) != 0;
+  };
+  for (auto it = edges.begin(); it != edges.end();)
+    it = it->first == it->second ? edges.erase(it) : std::next(it);
+
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    std::set<uint32_t> nodes;
+    for (auto& e : edges) {
+      nodes.insert(e.first);
+      nodes.insert(e.second);
+    }
+    for (auto it = edges.begin(); it != edges.end();) {
+      unsigned support = 0;
+      for (uint32_t n : nodes)
+        support += connected(n, it->first) && connected(n, it->second);
+      if (support + 2 < k) {
+        it      = edges.erase(it);
+        changed = true;
+      } else {
+        ++it;
+      }
+    }
+  }
+  return edges;
+}
+
+void check(uint32_t numNodes, const std::set<Edge>& edges, unsigned k) {
+  std::set<Edge> expected = bruteForce(edges, k);
+
+  Graph g;
+  readSymmetric(g, numNodes, edges);
+  uint64_t size = lonestar::analytics::kTruss(g, k);
+  GALOIS_ASSERT(size == expected.size(), "the ", k, "-truss has ", size,
+                " edges instead of ", expected.size());
+
+  for (auto n : g) {
+    for (auto e : g.edges(n)) {
+      uint32_t dst  = g.getEdgeDst(e);
+      Edge edge     = {std::min<uint32_t>(n, dst), std::max<uint32_t>(n, dst)};
+      uint32_t flag = expected.count(edge) ? KTRUSS_ALIVE : KTRUSS_REMOVED;
+      GALOIS_ASSERT(g.getEdgeData(e) == flag, "edge (", n, ", ", dst,
+                    ") is wrongly in or out of the ", k, "-truss");
+    }
+  }
+}
+
+int main() {
+  galois::SharedMemSys sys;
+  galois::setActiveThreads(4);
+
+  // K4 with a pendant edge and a self loop: the 4-truss is the K4
+  std::set<Edge> k4 = {{0, 1}, {0, 2}, {0, 3}, {1, 2},
+                       {1, 3}, {2, 3}, {3, 4}, {4, 4}};
+  GALOIS_ASSERT(bruteForce(k4, 4).size() == 6);
+  check(5, k4, 4);
+  GALOIS_ASSERT(bruteForce(k4, 5).empty());
+  check(5, k4, 5);
+
+  // skewed degrees so that the trusses are nested and non-empty
+  const uint32_t numNodes = 70;
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<uint32_t> node(0, numNodes - 1);
+  std::set<Edge> edges;
+  for (uint32_t i = 0; i < 8 * numNodes; ++i) {
+    uint32_t a = std::min(node(gen), node(gen));
+    uint32_t b = node(gen);
+    edges.insert({std::min(a, b), std::max(a, b)});
+  }
+  GALOIS_ASSERT(!bruteForce(edges, 5).empty());
+  for (unsigned k = 2; k <= 7; ++k)
+    check(numNodes, edges, k);
+
+  return 0;
+}
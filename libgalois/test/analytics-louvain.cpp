@@ -0,0 +1,117 @@
+#include "galois/Galois.h"
+#include "galois/graphs/FileGraph.h"
+#include "galois/graphs/LCGraph.h"
+#include "Lonestar/Analytics/Louvain.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+using Graph = galois::graphs::LC_CSR_Graph<lonestar::analytics::LouvainNode,
+                                           void>::with_no_lockable<true>::type;
+using Edges = std::vector<std::pair<uint32_t, uint32_t>>;
+
+//! symmetric graph of the edges with sorted, distinct neighbors
+void readSymmetric(Graph& g, uint32_t numNodes, const Edges& edges) {
+  std::vector<std::set<uint32_t>> adj(numNodes);
+  for (auto& e : edges) {
+    adj[e.first].insert(e.second);
+    adj[e.second].insert(e.first);
+  }
+  size_t numEdges = 0;
+  for (auto& a : adj)
+    numEdges += a.size();
+
+  galois::graphs::FileGraphWriter writer;
+  writer.setNumNodes(numNodes);
+  writer.setNumEdges<void>(numEdges);
+  writer.phase1();
+  for (uint32_t n = 0; n < numNodes; ++n)
+    writer.incrementDegree(n, adj[n].size());
+  writer.phase2();
+  for (uint32_t n = 0; n < numNodes; ++n)
+    for (uint32_t dst : adj[n])
+      writer.addNeighbor(n, dst);
+  writer.finish();
+  galois::graphs::readGraph(g, writer);
+}
+
+//! runs the algorithm and checks the numbering and the reported modularity
+std::vector<uint64_t> communities(Graph& g) {
+  double modularity = lonestar::analytics::louvain(g);
+
+  std::vector<uint64_t> comm;
+  for (auto n : g)
+    comm.push_back(g.getData(n).community);
+  uint64_t numCommunities = *std::max_element(comm.begin(), comm.end()) + 1;
+  GALOIS_ASSERT(std::set<uint64_t>(comm.begin(), comm.end()).size() ==
+                    numCommunities,
+                "communities are not numbered contiguously");
+
+  // fraction of edge ends inside communities minus its expectation
+  double total = g.sizeEdges();
+  std::vector<double> degree(numCommunities, 0);
+  double internal = 0;
+  for (auto n : g) {
+    degree[comm[n]] += std::distance(g.edge_begin(n), g.edge_end(n));
+    for (auto e : g.edges(n))
+      internal += comm[g.getEdgeDst(e)] == comm[n];
+  }
+  double expected = internal / total;
+  for (double d : degree)
+    expected -= (d / total) * (d / total);
+  GALOIS_ASSERT(std::abs(modularity - expected) < 1e-9, "modularity is ",
+                modularity, " but the communities have ", expected);
+  return comm;
+}
+
+int main() {
+  galois::SharedMemSys sys;
+  galois::setActiveThreads(4);
+
+  // two 5-cliques joined by one edge
+  {
+    Edges edges;
+    for (uint32_t a = 0; a < 5; ++a) {
+      for (uint32_t b = a + 1; b < 5; ++b) {
+        edges.emplace_back(a, b);
+        edges.emplace_back(5 + a, 5 + b);
+      }
+    }
+    edges.emplace_back(4, 5);
+
+    Graph g;
+    readSymmetric(g, 10, edges);
+    std::vector<uint64_t> comm = communities(g);
+    for (uint32_t n = 0; n < 10; ++n)
+      GALOIS_ASSERT(comm[n] == comm[n < 5 ? 0 : 5], "node ", n,
+                    " left its clique");
+    GALOIS_ASSERT(comm[0] != comm[5]);
+  }
+
+  // planted communities of 20 nodes with some edges across them
+  const uint32_t numNodes = 400;
+  std::mt19937 gen(19);
+  std::uniform_int_distribution<uint32_t> node(0, numNodes - 1);
+  std::uniform_int_distribution<uint32_t> offset(0, 19);
+  Edges edges;
+  for (uint32_t i = 0; i < 6 * numNodes; ++i) {
+    uint32_t src = node(gen);
+    uint32_t dst = i % 8 ? src / 20 * 20 + offset(gen) : node(gen);
+    if (src != dst)
+      edges.emplace_back(src, dst);
+  }
+
+  Graph g;
+  readSymmetric(g, numNodes, edges);
+  std::vector<uint64_t> parallel = communities(g);
+
+  galois::setActiveThreads(1);
+  GALOIS_ASSERT(communities(g) == parallel,
+                "the communities depend on the number of threads");
+
+  return 0;
+}
@@ -0,0 +1,116 @@
+#include "galois/Galois.h"
+#include "galois/graphs/FileGraph.h"
+#include "galois/graphs/LCGraph.h"
+#include "Lonestar/Analytics/Matching.h"
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+using Graph = galois::graphs::LC_CSR_Graph<lonestar::analytics::MatchingNode,
+                                           void>::with_no_lockable<true>::type;
+using Edges = std::vector<std::pair<uint32_t, uint32_t>>;
+using lonestar::analytics::MATCHING_UNMATCHED;
+
+//! symmetric graph of the edges with sorted, distinct neighbors
+void readSymmetric(Graph& g, uint32_t numNodes, const Edges& edges) {
+  std::vector<std::set<uint32_t>> adj(numNodes);
+  for (auto& e : edges) {
+    adj[e.first].insert(e.second);
+    adj[e.second].insert(e.first);
+  }
+  size_t numEdges = 0;
+  for (auto& a : adj)
+    numEdges += a.size();
+
+  galois::graphs::FileGraphWriter writer;
+  writer.setNumNodes(numNodes);
+  writer.setNumEdges<void>(numEdges);
+  writer.phase1();
+  for (uint32_t n = 0; n < numNodes; ++n)
+    writer.incrementDegree(n, adj[n].size());
+  writer.phase2();
+  for (uint32_t n = 0; n < numNodes; ++n)
+    for (uint32_t dst : adj[n])
+      writer.addNeighbor(n, dst);
+  writer.finish();
+  galois::graphs::readGraph(g, writer);
+}
+
+//! runs the algorithm and checks that the matching is valid and maximal
+std::vector<uint32_t> matching(Graph& g, uint64_t seed) {
+  lonestar::analytics::MatchingPlan plan;
+  plan.seed     = seed;
+  uint64_t size = lonestar::analytics::maximalMatching(g, plan);
+
+  std::vector<uint32_t> mates;
+  for (auto n : g)
+    mates.push_back(g.getData(n).mate);
+
+  uint64_t matched = 0;
+  for (auto n : g) {
+    uint32_t mate = mates[n];
+    if (mate == MATCHING_UNMATCHED)
+      continue;
+    matched += 1;
+    GALOIS_ASSERT(mate != n && mates[mate] == n, "node ", n,
+                  " is matched to ", mate, " but not the other way around");
+    bool adjacent = false;
+    for (auto e : g.edges(n))
+      adjacent |= g.getEdgeDst(e) == mate;
+    GALOIS_ASSERT(adjacent, "node ", n, " is matched to non-neighbor ", mate);
+  }
+  GALOIS_ASSERT(size * 2 == matched);
+
+  for (auto n : g) {
+    for (auto e : g.edges(n)) {
+      uint32_t dst = g.getEdgeDst(e);
+      GALOIS_ASSERT(dst == n || mates[n] != MATCHING_UNMATCHED ||
+                        mates[dst] != MATCHING_UNMATCHED,
+                    "edge (", n, ", ", dst, ") could be added");
+    }
+  }
+  return mates;
+}
+
+int main() {
+  galois::SharedMemSys sys;
+
+  // the maximal matchings of a path of three edges are its middle edge and
+  // the pair of outer edges
+  {
+    Graph path;
+    readSymmetric(path, 4, {{0, 1}, {1, 2}, {2, 3}});
+    for (uint64_t seed = 0; seed < 8; ++seed) {
+      std::vector<uint32_t> mates = matching(path, seed);
+      bool middle = mates[1] == 2;
+      GALOIS_ASSERT(middle || (mates[0] == 1 && mates[2] == 3));
+    }
+  }
+
+  // skewed degrees, a self loop on its own and isolated nodes
+  const uint32_t numNodes = 500;
+  std::mt19937 gen(17);
+  std::uniform_int_distribution<uint32_t> node(0, numNodes - 11);
+  Edges edges;
+  for (uint32_t i = 0; i < 4 * numNodes; ++i)
+    edges.emplace_back(std::min(node(gen), node(gen)), node(gen));
+  edges.emplace_back(numNodes - 1, numNodes - 1);
+
+  Graph g;
+  readSymmetric(g, numNodes, edges);
+
+  galois::setActiveThreads(1);
+  std::vector<uint32_t> serial = matching(g, 0);
+  GALOIS_ASSERT(serial[numNodes - 1] == MATCHING_UNMATCHED);
+
+  galois::setActiveThreads(4);
+  GALOIS_ASSERT(matching(g, 0) == serial,
+                "the matching depends on the number of threads");
+  GALOIS_ASSERT(matching(g, 1) != serial,
+                "the seed does not change the priorities");
+
+  return 0;
+}
@@ -0,0 +1,98 @@
+#include "galois/Galois.h"
+#include "galois/graphs/FileGraph.h"
+#include "galois/graphs/LCGraph.h"
+#include "Lonestar/Analytics/TriangleCount.h"
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+using Graph = galois::graphs::LC_CSR_Graph<void, void>;
+using Edges = std::vector<std::pair<uint32_t, uint32_t>>;
+using lonestar::analytics::TriangleCountPlan;
+
+//! symmetric graph of the edges with sorted, distinct neighbors
+void readSymmetric(Graph& g, uint32_t numNodes, const Edges& edges) {
+  std::vector<std::set<uint32_t>> adj(numNodes);
+  for (auto& e : edges) {
+    adj[e.first].insert(e.second);
+    adj[e.second].insert(e.first);
+  }
+  size_t numEdges = 0;
+  for (auto& a : adj)
+    numEdges += a.size();
+
+  galois::graphs::FileGraphWriter writer;
+  writer.setNumNodes(numNodes);
+  writer.setNumEdges<void>(numEdges);
+  writer.phase1();
+  for (uint32_t n = 0; n < numNodes; ++n)
+    writer.incrementDegree(n, adj[n].size());
+  writer.phase2();
+  for (uint32_t n = 0; n < numNodes; ++n)
+    for (uint32_t dst : adj[n])
+      writer.addNeighbor(n, dst);
+  writer.finish();
+  galois::graphs::readGraph(g, writer);
+}
+
+uint64_t bruteForce(uint32_t numNodes, const Edges& edges) {
+  std::vector<std::vector<bool>> adj(numNodes,
+                                     std::vector<bool>(numNodes, false));
+  for (auto& e : edges)
+    adj[e.first][e.second] = adj[e.second][e.first] = true;
+  uint64_t count = 0;
+  for (uint32_t a = 0; a < numNodes; ++a)
+    for (uint32_t b = a + 1; b < numNodes; ++b)
+      for (uint32_t c = b + 1; c < numNodes; ++c)
+        count += adj[a][b] && adj[b][c] && adj[a][c];
+  return count;
+}
+
+void checkAllAlgorithms(uint32_t numNodes, const Edges& edges,
+                        uint64_t expected) {
+  Graph g;
+  readSymmetric(g, numNodes, edges);
+  for (auto algo :
+       {TriangleCountPlan::nodeIterator, TriangleCountPlan::edgeIterator,
+        TriangleCountPlan::orderedCount}) {
+    TriangleCountPlan plan;
+    plan.algorithm = algo;
+    uint64_t count = lonestar::analytics::triangleCount(g, plan);
+    GALOIS_ASSERT(count == expected, lonestar::analytics::algorithmName(algo),
+                  " counts ", count, " triangles instead of ", expected);
+  }
+}
+
+int main() {
+  galois::SharedMemSys sys;
+  galois::setActiveThreads(4);
+
+  Edges k5;
+  for (uint32_t a = 0; a < 5; ++a)
+    for (uint32_t b = a + 1; b < 5; ++b)
+      k5.emplace_back(a, b);
+  checkAllAlgorithms(5, k5, 10);
+
+  // a path and isolated nodes have no triangles
+  checkAllAlgorithms(6, {{0, 1}, {1, 2}, {2, 3}}, 0);
+
+  // skewed degrees so that the high degree nodes share many triangles
+  const uint32_t numNodes = 80;
+  std::mt19937 gen(3);
+  std::uniform_int_distribution<uint32_t> node(0, numNodes - 1);
+  Edges edges;
+  for (uint32_t i = 0; i < 8 * numNodes; ++i) {
+    uint32_t src = std::min(node(gen), node(gen));
+    uint32_t dst = node(gen);
+    if (src != dst)
+      edges.emplace_back(src, dst);
+  }
+  uint64_t expected = bruteForce(numNodes, edges);
+  GALOIS_ASSERT(expected > 100);
+  checkAllAlgorithms(numNodes, edges, expected);
+
+  return 0;
+}
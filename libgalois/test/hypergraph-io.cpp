@@ -0,0 +1,72 @@
+#include "galois/Galois.h"
+#include "galois/graphs/HypergraphIO.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+using galois::graphs::HypergraphCSR;
+using galois::graphs::HypergraphFormat;
+
+void writeFile(const std::string& name, const std::string& text) {
+  std::ofstream out(name);
+  out << text;
+}
+
+std::vector<uint32_t> toVector(const galois::LargeArray<uint32_t>& a) {
+  return std::vector<uint32_t>(a.begin(), a.end());
+}
+
+//! the hMetis manual's example with both kinds of weights
+void checkExample(const HypergraphCSR& hg) {
+  GALOIS_ASSERT(hg.numNets == 4 && hg.numNodes == 7 && hg.numPins() == 11);
+  GALOIS_ASSERT(hg.netBegin(1) == 2 && hg.netEnd[1] == 5);
+  GALOIS_ASSERT((toVector(hg.pins) ==
+                 std::vector<uint32_t>{0, 1, 0, 6, 4, 5, 4, 6, 2, 3, 4}));
+  GALOIS_ASSERT((toVector(hg.netWeights) == std::vector<uint32_t>{2, 3, 8, 7}));
+  GALOIS_ASSERT(
+      (toVector(hg.nodeWeights) == std::vector<uint32_t>{5, 1, 8, 7, 3, 9, 3}));
+}
+
+int main() {
+  galois::SharedMemSys sys;
+  galois::setActiveThreads(2);
+
+  writeFile("hypergraph-io.hgr", "% comment\n"
+                                 "4 7 11\n"
+                                 "2 1 2\n"
+                                 "3 1 7 5\n"
+                                 "\n"
+                                 "8 6 5 7\n"
+                                 "7 3 4 5\n"
+                                 "5\n1\n8\n7\n3\n9\n3\n");
+  auto hg = galois::graphs::readHypergraph("hypergraph-io.hgr");
+  checkExample(hg);
+
+  // same hypergraph in PaToH form: 0-based, weights of both kinds, two
+  // constraints per cell and the cell weights spread over lines
+  writeFile("hypergraph-io.patoh", "0 7 4 11 3 2\n"
+                                   "2 0 1\n"
+                                   "3 0 6 4\n"
+                                   "8 5 4 6\n"
+                                   "7 2 3 4\n"
+                                   "5 0 1 0 8 0\n"
+                                   "7 0 3 0 9 0 3 0\n");
+  checkExample(galois::graphs::readHypergraph("hypergraph-io.patoh",
+                                              HypergraphFormat::PaToH));
+
+  galois::graphs::writeHypergraphBinary(hg, "hypergraph-io.bin");
+  checkExample(galois::graphs::readHypergraph("hypergraph-io.bin"));
+
+  // unweighted, with an odd number of pins to exercise the binary padding
+  writeFile("hypergraph-io.hgr", "2 3\n1 2\n2 3 1\n");
+  hg = galois::graphs::readHypergraph("hypergraph-io.hgr");
+  GALOIS_ASSERT(!hg.hasNetWeights() && !hg.hasNodeWeights());
+  galois::graphs::writeHypergraphBinary(hg, "hypergraph-io.bin");
+  auto bin = galois::graphs::readHypergraph("hypergraph-io.bin",
+                                            HypergraphFormat::Binary);
+  GALOIS_ASSERT(bin.numPins() == 5 && !bin.hasNetWeights());
+  GALOIS_ASSERT((toVector(bin.pins) == std::vector<uint32_t>{0, 1, 1, 2, 0}));
+
+  return 0;
+}
@@ -0,0 +1,86 @@
+#include "galois/Galois.h"
+#include "galois/graphs/KdTree.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using Tree     = galois::graphs::KdTree<float>;
+using Neighbor = Tree::Neighbor;
+
+std::vector<Neighbor> bruteForce(const std::vector<float>& coords,
+                                 unsigned dims, const float* q,
+                                 uint32_t exclude) {
+  std::vector<Neighbor> all;
+  for (size_t i = 0; i < coords.size() / dims; ++i) {
+    if (i == exclude)
+      continue;
+    float d = 0;
+    for (unsigned j = 0; j < dims; ++j) {
+      float x = q[j] - coords[i * dims + j];
+      d += x * x;
+    }
+    all.push_back(Neighbor{uint32_t(i), d});
+  }
+  std::sort(all.begin(), all.end());
+  return all;
+}
+
+bool sameResult(const std::vector<Neighbor>& a,
+                const std::vector<Neighbor>& b) {
+  return a.size() == b.size() &&
+         std::equal(a.begin(), a.end(), b.begin(),
+                    [](const Neighbor& x, const Neighbor& y) {
+                      return x.id == y.id && x.dist2 == y.dist2;
+                    });
+}
+
+void check(size_t n, unsigned dims, unsigned leafSize, bool grid) {
+  std::mt19937 gen(n * dims);
+  std::uniform_real_distribution<float> dist(0, 1);
+  std::vector<float> coords(n * dims);
+  for (auto& c : coords) {
+    // a coarse grid has many ties in coordinates and distances
+    c = grid ? float(gen() % 4) : dist(gen);
+  }
+
+  Tree tree;
+  tree.build(coords.data(), n, dims, leafSize);
+  GALOIS_ASSERT(tree.size() == n && tree.dims() == dims);
+
+  std::vector<Neighbor> got;
+  for (size_t i = 0; i < n; i += 7) {
+    const float* q = &coords[i * dims];
+    auto expected  = bruteForce(coords, dims, q, i);
+
+    for (unsigned k : {1u, 5u, 17u}) {
+      tree.knn(q, k, got, i);
+      std::vector<Neighbor> prefix(
+          expected.begin(), expected.begin() + std::min<size_t>(k, n - 1));
+      GALOIS_ASSERT(sameResult(got, prefix), "knn n=", n, " dims=", dims,
+                    " k=", k);
+    }
+
+    float eps = grid ? 1.0f : 0.3f;
+    tree.radius(q, eps, got, i);
+    std::vector<Neighbor> inside;
+    for (auto& nb : expected)
+      if (nb.dist2 <= eps * eps)
+        inside.push_back(nb);
+    GALOIS_ASSERT(sameResult(got, inside), "radius n=", n, " dims=", dims);
+  }
+}
+
+int main() {
+  galois::SharedMemSys sys;
+  galois::setActiveThreads(2);
+
+  check(1, 2, 4, false);
+  check(10, 2, 4, false);
+  check(1000, 2, 1, false);
+  check(1000, 3, 8, true);
+  check(2000, 8, 16, false);
+  check(500, 16, 4, false);
+
+  return 0;
+}
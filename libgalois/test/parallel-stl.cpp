@@ -0,0 +1,151 @@
+#include "galois/Galois.h"
+#include "galois/ParallelSTL.h"
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+using Pair = std::pair<unsigned, unsigned>;
+
+//! pairs with keys in [0, range); the second field records the input position
+std::vector<Pair> randomPairs(size_t n, unsigned range, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::vector<Pair> v(n);
+  for (size_t i = 0; i < n; ++i)
+    v[i] = Pair(gen() % range, i);
+  return v;
+}
+
+bool firstLess(const Pair& a, const Pair& b) { return a.first < b.first; }
+bool firstEqual(const Pair& a, const Pair& b) { return a.first == b.first; }
+
+void checkPack(size_t n) {
+  auto in   = randomPairs(n, 10, n);
+  auto pred = [](const Pair& p) { return p.first % 3 == 0; };
+  std::vector<Pair> expected, got(n);
+  std::copy_if(in.begin(), in.end(), std::back_inserter(expected), pred);
+  got.resize(galois::ParallelSTL::copy_if(in.begin(), in.end(), got.begin(),
+                                          pred) -
+             got.begin());
+  GALOIS_ASSERT(got == expected, "copy_if n=", n);
+
+  std::vector<Pair> sorted = in;
+  std::stable_sort(sorted.begin(), sorted.end(), firstLess);
+  expected.clear();
+  std::unique_copy(sorted.begin(), sorted.end(), std::back_inserter(expected),
+                   firstEqual);
+  got = sorted;
+  got.erase(galois::ParallelSTL::unique(got.begin(), got.end(), firstEqual),
+            got.end());
+  GALOIS_ASSERT(got == expected, "unique n=", n);
+}
+
+void checkHistogram(size_t n, unsigned numBins) {
+  auto in = randomPairs(n, numBins, n + numBins);
+  std::vector<size_t> expected(numBins, 0), got(numBins, 7);
+  for (auto& p : in)
+    ++expected[p.first];
+  galois::ParallelSTL::histogram(in.begin(), in.end(), numBins, got.begin(),
+                                 [](const Pair& p) { return p.first; });
+  GALOIS_ASSERT(got == expected, "histogram n=", n, " bins=", numBins);
+}
+
+void checkGrouping(size_t n, unsigned numKeys) {
+  auto in       = randomPairs(n, numKeys, 2 * n + numKeys);
+  auto expected = in;
+  std::stable_sort(expected.begin(), expected.end(), firstLess);
+
+  std::vector<Pair> got(n);
+  std::vector<size_t> offsets(numKeys + 1);
+  galois::ParallelSTL::counting_sort(in.begin(), in.end(), got.begin(),
+                                     numKeys,
+                                     [](const Pair& p) { return p.first; },
+                                     offsets.begin());
+  GALOIS_ASSERT(got == expected, "counting_sort n=", n);
+  for (unsigned k = 0; k < numKeys; ++k)
+    GALOIS_ASSERT(offsets[k] == size_t(std::lower_bound(expected.begin(),
+                                                        expected.end(),
+                                                        Pair(k, 0)) -
+                                       expected.begin()));
+  GALOIS_ASSERT(offsets[numKeys] == n);
+
+  // groups may come in any order but each key must be one contiguous run
+  galois::ParallelSTL::semisort(in.begin(), in.end(), got.begin(),
+                                [](const Pair& p) { return p.first; });
+  std::vector<bool> seen(numKeys, false);
+  for (size_t i = 0; i < n; ++i) {
+    if (i == 0 || got[i].first != got[i - 1].first) {
+      GALOIS_ASSERT(!seen[got[i].first], "semisort split key ", got[i].first);
+      seen[got[i].first] = true;
+    }
+  }
+  std::sort(got.begin(), got.end());
+  std::sort(expected.begin(), expected.end());
+  GALOIS_ASSERT(got == expected, "semisort n=", n);
+}
+
+void checkMergeAndSets(size_t n1, size_t n2, unsigned range) {
+  auto a = randomPairs(n1, range, n1 + 3 * n2);
+  auto b = randomPairs(n2, range, n2 + 5 * n1);
+  std::sort(a.begin(), a.end(), firstLess);
+  std::sort(b.begin(), b.end(), firstLess);
+  for (auto& p : b)
+    p.second += n1;
+
+  std::vector<Pair> expected, got(n1 + n2);
+  std::merge(a.begin(), a.end(), b.begin(), b.end(),
+             std::back_inserter(expected), firstLess);
+  galois::ParallelSTL::merge(a.begin(), a.end(), b.begin(), b.end(),
+                             got.begin(), firstLess);
+  GALOIS_ASSERT(got == expected, "merge n1=", n1, " n2=", n2);
+
+  auto checkSetOp = [&](auto stdOp, auto parallelOp, const char* name) {
+    expected.clear();
+    stdOp(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected),
+          firstLess);
+    got.assign(n1 + n2, Pair());
+    got.resize(parallelOp(a.begin(), a.end(), b.begin(), b.end(), got.begin(),
+                          firstLess) -
+               got.begin());
+    GALOIS_ASSERT(got == expected, name, " n1=", n1, " n2=", n2,
+                  " range=", range);
+  };
+  using It  = std::vector<Pair>::iterator;
+  using Out = std::vector<Pair>::iterator;
+  using Cmp = bool (*)(const Pair&, const Pair&);
+  using Ins = std::back_insert_iterator<std::vector<Pair>>;
+  checkSetOp(std::set_union<It, It, Ins, Cmp>,
+             galois::ParallelSTL::set_union<It, It, Out, Cmp>, "set_union");
+  checkSetOp(std::set_difference<It, It, Ins, Cmp>,
+             galois::ParallelSTL::set_difference<It, It, Out, Cmp>,
+             "set_difference");
+  checkSetOp(std::set_intersection<It, It, Ins, Cmp>,
+             galois::ParallelSTL::set_intersection<It, It, Out, Cmp>,
+             "set_intersection");
+}
+
+int main() {
+  galois::SharedMemSys sys;
+  galois::setActiveThreads(2);
+
+  for (size_t n : {0, 1, 100, 5000, 100000}) {
+    checkPack(n);
+    checkHistogram(n, 16);
+    checkHistogram(n, 50000);
+    checkGrouping(n, 1);
+    checkGrouping(n, 300);
+    checkGrouping(n, 20000);
+  }
+
+  checkMergeAndSets(0, 0, 10);
+  checkMergeAndSets(500, 300, 100);
+  // many duplicates cross the block boundaries
+  checkMergeAndSets(20000, 30000, 7);
+  checkMergeAndSets(20000, 30000, 100000);
+  // skewed sizes
+  checkMergeAndSets(50000, 10, 1000);
+  checkMergeAndSets(3, 40000, 1000);
+
+  return 0;
+}
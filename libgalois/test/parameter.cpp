@@ -0,0 +1,97 @@
+#include "galois/Galois.h"
+#include "galois/runtime/Executor_ParaMeter.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+const char* statsFile   = "parameter-stats.csv";
+const char* summaryFile = "parameter-summary.csv";
+
+void test_for_each() {
+  galois::GAccumulator<int> count;
+  std::vector<int> init{0, 1, 2, 3};
+  galois::for_each(
+      galois::iterate(init),
+      [&](int i, auto& ctx) {
+        count += 1;
+        if (i < 64)
+          ctx.push(2 * i + 4);
+      },
+      galois::wl<galois::worklists::ParaMeter<>>(),
+      galois::loopname("param-for-each"));
+  GALOIS_ASSERT(count.reduce() > 4);
+}
+
+void test_do_all() {
+  galois::GAccumulator<int> sum;
+  galois::do_all(
+      galois::iterate(0, 1000), [&](int i) { sum += i; },
+      galois::wl<galois::worklists::ParaMeter<>>(),
+      galois::loopname("param-do-all"));
+  GALOIS_ASSERT(sum.reduce() == 999 * 500);
+}
+
+struct Cell : public galois::runtime::Lockable {
+  std::vector<int> log;
+};
+
+void test_ordered() {
+  constexpr int numCells = 10;
+  std::vector<Cell> cells(numCells);
+  std::vector<int> items;
+  for (int i = 99; i >= 0; --i)
+    items.push_back(i);
+
+  galois::for_each_ordered(
+      items.begin(), items.end(), [](int a, int b) { return a <= b; },
+      [&](int i) {
+        galois::runtime::acquire(&cells[i % numCells],
+                                 galois::MethodFlag::WRITE);
+      },
+      [&](int i, auto& ctx) {
+        cells[i % numCells].log.push_back(i);
+        if (i < 50)
+          ctx.push(i + 100);
+      },
+      "param-ordered");
+
+  size_t total = 0;
+  for (auto& c : cells) {
+    total += c.log.size();
+    for (size_t j = 1; j < c.log.size(); ++j)
+      GALOIS_ASSERT(c.log[j - 1] < c.log[j], "ordered loop out of order");
+  }
+  GALOIS_ASSERT(total == 150);
+}
+
+void check_summary() {
+  std::ifstream in(summaryFile);
+  std::string line;
+  std::vector<std::string> kinds;
+  std::getline(in, line); // header
+  while (std::getline(in, line)) {
+    auto b = line.find(", ") + 2;
+    kinds.push_back(line.substr(b, line.find(",", b) - b));
+  }
+  GALOIS_ASSERT((kinds == std::vector<std::string>{"for_each", "do_all",
+                                                    "ordered"}),
+                "unexpected summary file contents");
+}
+
+int main() {
+  setenv("GALOIS_PARAMETER_OUTFILE", statsFile, 1);
+  setenv("GALOIS_PARAMETER_SUMMARY_OUTFILE", summaryFile, 1);
+  setenv("GALOIS_PARAMETER_PROFILE", "1", 1);
+
+  galois::SharedMemSys sys;
+  galois::setActiveThreads(2);
+
+  test_for_each();
+  test_do_all();
+  test_ordered();
+  check_summary();
+
+  return 0;
+}
@@ -0,0 +1,101 @@
+#include "galois/Galois.h"
+#include "galois/substrate/PerThreadStorage.h"
+
+#include <array>
+#include <memory>
+#include <random>
+#include <vector>
+
+template <size_t N>
+using Block = std::array<unsigned, N / sizeof(unsigned)>;
+
+//! Each thread stamps its copy; a stamp that changes means storage overlaps
+template <typename PTS>
+void stamp(PTS& s, unsigned tag) {
+  for (unsigned t = 0; t < s.size(); ++t)
+    s.getRemote(t)->fill(tag * 64 + t);
+}
+
+template <typename PTS>
+void check(PTS& s, unsigned tag) {
+  for (unsigned t = 0; t < s.size(); ++t)
+    for (unsigned v : *s.getRemote(t))
+      GALOIS_ASSERT(v == tag * 64 + t, "storage ", tag, " overwritten");
+}
+
+struct Live {
+  virtual ~Live()                  = default;
+  virtual void verify(unsigned id) = 0;
+};
+
+template <size_t N>
+struct LiveBlock : public Live {
+  galois::substrate::PerThreadStorage<Block<N>> s;
+  explicit LiveBlock(unsigned id) { stamp(s, id); }
+  void verify(unsigned id) override { check(s, id); }
+};
+
+std::unique_ptr<Live> make(unsigned kind, unsigned id) {
+  switch (kind) {
+  case 0:
+    return std::make_unique<LiveBlock<64>>(id);
+  case 1:
+    return std::make_unique<LiveBlock<1000>>(id);
+  case 2:
+    return std::make_unique<LiveBlock<5000>>(id);
+  default:
+    return std::make_unique<LiveBlock<(1 << 18) + 4>>(id);
+  }
+}
+
+int main() {
+  galois::SharedMemSys sys;
+  galois::setActiveThreads(2);
+  auto& backend = galois::substrate::getPTSBackend();
+  auto before   = backend.usage();
+
+  {
+    // more than the 2MB a region used to be limited to, all live at once
+    std::vector<std::unique_ptr<galois::substrate::PerThreadStorage<
+        Block<(1 << 20)>>>>
+        big;
+    for (unsigned i = 0; i < 8; ++i) {
+      big.emplace_back(new galois::substrate::PerThreadStorage<
+                       Block<(1 << 20)>>());
+      stamp(*big.back(), i);
+    }
+    for (unsigned i = 0; i < 8; ++i)
+      check(*big[i], i);
+    GALOIS_ASSERT(backend.usage().inUse >= before.inUse + (8 << 20));
+  }
+  GALOIS_ASSERT(backend.usage().inUse == before.inUse);
+  GALOIS_ASSERT(backend.usage().footprint <= before.footprint + (1 << 20));
+
+  // create and destroy mixed sizes in random order, as reducers, bags and
+  // worklists of a long-running service would
+  std::mt19937 gen(7);
+  std::vector<std::unique_ptr<Live>> live(200);
+  for (unsigned round = 0; round < 20000; ++round) {
+    unsigned slot = gen() % live.size();
+    if (live[slot])
+      live[slot]->verify(slot);
+    live[slot] = make(gen() % 4 ? gen() % 3 : 3, slot);
+  }
+  for (unsigned slot = 0; slot < live.size(); ++slot)
+    if (live[slot])
+      live[slot]->verify(slot);
+  live.clear();
+
+  auto after = backend.usage();
+  GALOIS_ASSERT(after.inUse == before.inUse, "leaked ",
+                after.inUse - before.inUse, " bytes");
+  GALOIS_ASSERT(after.peakInUse >= after.inUse);
+  GALOIS_ASSERT(after.peakFootprint >= after.footprint);
+  GALOIS_ASSERT(after.peakFootprint <= after.reserved);
+  // freed blocks coalesce back so the bump pointer retreats
+  GALOIS_ASSERT(after.footprint <= before.footprint + (1 << 20),
+                "footprint ", after.footprint, " was ", before.footprint);
+
+  galois::runtime::reportPerThreadStorage("End");
+  return 0;
+}
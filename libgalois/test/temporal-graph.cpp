@@ -0,0 +1,129 @@
+#include "galois/Galois.h"
+#include "galois/graphs/FileGraph.h"
+#include "galois/graphs/LC_CSR_Temporal_Graph.h"
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <vector>
+
+using Graph = galois::graphs::LC_CSR_Temporal_Graph<unsigned, uint32_t>;
+using GNode = Graph::GraphNode;
+using Edge  = std::tuple<uint32_t, uint32_t, uint32_t>; // src, dst, time
+
+constexpr uint32_t numNodes = 300;
+constexpr uint32_t maxTime  = 1000;
+
+//! Edges of src with time in [begin, end), ordered as the graph orders them
+std::vector<std::pair<uint32_t, uint32_t>>
+expectedEdges(const std::vector<Edge>& edges, uint32_t src, uint32_t begin,
+              uint32_t end) {
+  std::vector<std::pair<uint32_t, uint32_t>> out;
+  for (auto& e : edges)
+    if (std::get<0>(e) == src && begin <= std::get<2>(e) &&
+        std::get<2>(e) < end)
+      out.emplace_back(std::get<2>(e), std::get<1>(e));
+  std::sort(out.begin(), out.end());
+  return out;
+}
+
+template <typename Range>
+std::vector<std::pair<uint32_t, uint32_t>> graphEdges(Graph& g,
+                                                      const Range& range) {
+  std::vector<std::pair<uint32_t, uint32_t>> out;
+  for (auto e : range)
+    out.emplace_back(g.getEdgeTime(e), g.getEdgeDst(e));
+  return out;
+}
+
+//! floating-point times at or below zero
+void checkFloatSpan() {
+  using FloatGraph = galois::graphs::LC_CSR_Temporal_Graph<unsigned, float>;
+  galois::graphs::FileGraphWriter writer;
+  writer.setNumNodes(3);
+  writer.setNumEdges<float>(3);
+  writer.phase1();
+  writer.incrementDegree(0);
+  writer.incrementDegree(0);
+  writer.incrementDegree(2);
+  writer.phase2();
+  writer.addNeighbor<float>(0, 1, -2.5f);
+  writer.addNeighbor<float>(0, 2, -7.0f);
+  writer.addNeighbor<float>(2, 1, -4.0f);
+  writer.finish();
+
+  FloatGraph g;
+  galois::graphs::readGraph(g, writer);
+  auto span = g.timeSpan();
+  GALOIS_ASSERT(span.first == -7.0f && span.second == -2.5f);
+}
+
+int main() {
+  galois::SharedMemSys sys;
+  galois::setActiveThreads(4);
+
+  // skewed degrees, repeated times and parallel edges
+  std::mt19937 gen(11);
+  std::uniform_int_distribution<uint32_t> node(0, numNodes - 1);
+  std::uniform_int_distribution<uint32_t> time(0, maxTime - 1);
+  std::vector<Edge> edges;
+  for (uint32_t i = 0; i < 20 * numNodes; ++i) {
+    uint32_t src = std::min(node(gen), node(gen));
+    edges.emplace_back(src, node(gen), time(gen) / 4 * 4);
+  }
+  edges.emplace_back(7, 8, 3);
+  edges.emplace_back(7, 8, 3);
+
+  galois::graphs::FileGraphWriter writer;
+  writer.setNumNodes(numNodes);
+  writer.setNumEdges<uint32_t>(edges.size());
+  writer.phase1();
+  for (auto& e : edges)
+    writer.incrementDegree(std::get<0>(e));
+  writer.phase2();
+  for (auto& e : edges)
+    writer.addNeighbor<uint32_t>(std::get<0>(e), std::get<1>(e),
+                                 std::get<2>(e));
+  writer.finish();
+
+  Graph g;
+  galois::graphs::readGraph(g, writer);
+  GALOIS_ASSERT(g.size() == numNodes && g.sizeEdges() == edges.size());
+
+  auto span = g.timeSpan();
+  uint32_t first = maxTime, last = 0;
+  for (auto& e : edges) {
+    first = std::min(first, std::get<2>(e));
+    last  = std::max(last, std::get<2>(e));
+  }
+  GALOIS_ASSERT(span.first == first && span.second == last);
+
+  std::vector<Graph::window_type> windows = {
+      {0, maxTime}, {0, 0}, {500, 400}, {3, 4}, {maxTime, maxTime + 10}};
+  for (int i = 0; i < 40; ++i) {
+    uint32_t a = time(gen), b = time(gen);
+    windows.push_back({std::min(a, b), std::max(a, b) + 1});
+  }
+
+  galois::do_all(galois::iterate(g), [&](GNode n) {
+    GALOIS_ASSERT(graphEdges(g, g.edges(n)) ==
+                      expectedEdges(edges, n, 0, maxTime),
+                  "edges of ", n, " are not sorted by time");
+    for (auto& w : windows) {
+      auto expected = expectedEdges(edges, n, w.begin, w.end);
+      GALOIS_ASSERT(graphEdges(g, g.edges(n, w)) == expected,
+                    "wrong edges of ", n, " in [", w.begin, ", ", w.end, ")");
+      GALOIS_ASSERT(g.degree(n, w) == expected.size());
+      GALOIS_ASSERT(graphEdges(g, g.edges_from(n, w.begin)) ==
+                    expectedEdges(edges, n, w.begin, maxTime));
+    }
+  });
+
+  auto e = g.edge_lower_bound(7, 3);
+  GALOIS_ASSERT(g.getEdgeTime(e) == 3 && g.getEdgeDst(e) == 8);
+  GALOIS_ASSERT(g.edge_lower_bound(0, maxTime) == g.edge_end(0));
+
+  checkFloatSpan();
+
+  return 0;
+}
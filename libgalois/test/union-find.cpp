@@ -0,0 +1,103 @@
+#include "galois/Galois.h"
+#include "galois/IndexedUnionFind.h"
+
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+using Edges = std::vector<std::pair<uint32_t, uint32_t>>;
+
+constexpr size_t numElements = 20000;
+
+//! minimum element of each set, computed serially
+std::vector<uint32_t> expectedLabels(const Edges& edges) {
+  std::vector<uint32_t> p(numElements);
+  std::iota(p.begin(), p.end(), 0);
+  auto find = [&](uint32_t n) {
+    while (p[n] != n)
+      n = p[n] = p[p[n]];
+    return n;
+  };
+  for (auto& e : edges) {
+    uint32_t a = find(e.first), b = find(e.second);
+    if (a != b)
+      p[std::max(a, b)] = std::min(a, b);
+  }
+  std::vector<uint32_t> labels(numElements);
+  for (uint32_t n = 0; n < numElements; ++n)
+    labels[n] = find(n);
+  return labels;
+}
+
+template <galois::uf::Link L, galois::uf::Compress C, typename IndexTy>
+void check(const Edges& edges, const std::vector<uint32_t>& expected) {
+  galois::IndexedUnionFind<IndexTy, L, C> uf(numElements);
+  galois::GAccumulator<size_t> merges;
+  galois::do_all(
+      galois::iterate(edges),
+      [&](const std::pair<uint32_t, uint32_t>& e) {
+        if (uf.unite(e.first, e.second))
+          merges += 1;
+      },
+      galois::steal());
+
+  size_t numSets = 0;
+  for (uint32_t n = 0; n < numElements; ++n)
+    numSets += expected[n] == n;
+  GALOIS_ASSERT(merges.reduce() == numElements - numSets);
+
+  galois::do_all(galois::iterate(edges),
+                 [&](const std::pair<uint32_t, uint32_t>& e) {
+                   GALOIS_ASSERT(uf.sameSet(e.first, e.second));
+                 });
+  GALOIS_ASSERT(uf.sameSet(0, 1) == (expected[0] == expected[1]));
+
+  auto labels = uf.finalize();
+  for (uint32_t n = 0; n < numElements; ++n)
+    GALOIS_ASSERT(labels[n] == expected[n], "wrong label for ", n);
+
+  std::vector<IndexTy> dense(numElements);
+  GALOIS_ASSERT(uf.finalize(dense, galois::uf::Labels::Dense) == numSets);
+  IndexTy next = 0;
+  for (uint32_t n = 0; n < numElements; ++n) {
+    if (expected[n] == n)
+      GALOIS_ASSERT(dense[n] == next++);
+    else
+      GALOIS_ASSERT(dense[n] == dense[expected[n]]);
+  }
+
+  uf.reset();
+  GALOIS_ASSERT(!uf.sameSet(0, 1));
+}
+
+template <galois::uf::Link L>
+void checkAll(const Edges& edges, const std::vector<uint32_t>& expected) {
+  check<L, galois::uf::Compress::None, uint32_t>(edges, expected);
+  check<L, galois::uf::Compress::Halving, uint32_t>(edges, expected);
+  check<L, galois::uf::Compress::Splitting, uint32_t>(edges, expected);
+  check<L, galois::uf::Compress::Full, uint32_t>(edges, expected);
+  check<L, galois::uf::Compress::Halving, uint64_t>(edges, expected);
+}
+
+int main() {
+  galois::SharedMemSys sys;
+  galois::setActiveThreads(4);
+
+  // a few long chains plus random edges, leaving many sets of varying size
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<uint32_t> dist(0, numElements - 1);
+  Edges edges;
+  for (uint32_t n = 1; n < numElements / 4; ++n)
+    edges.emplace_back(n - 1, n);
+  for (size_t i = 0; i < numElements / 2; ++i)
+    edges.emplace_back(dist(gen), dist(gen));
+  std::shuffle(edges.begin(), edges.end(), gen);
+
+  auto expected = expectedLabels(edges);
+  checkAll<galois::uf::Link::Index>(edges, expected);
+  checkAll<galois::uf::Link::Rank>(edges, expected);
+  checkAll<galois::uf::Link::Random>(edges, expected);
+
+  return 0;
+}
@@ -0,0 +1,48 @@
+#include "galois/Galois.h"
+#include "galois/graphs/FileGraph.h"
+#include "galois/graphs/WriteGraph.h"
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <vector>
+
+using Edge = std::tuple<uint32_t, uint32_t, uint32_t>; // src, dst, data
+
+int main() {
+  galois::SharedMemSys sys;
+  galois::setActiveThreads(4);
+
+  // skewed sources, with empty nodes in between and after the last source
+  constexpr uint32_t numNodes = 1000;
+  std::mt19937 gen(5);
+  std::uniform_int_distribution<uint32_t> node(0, numNodes / 2);
+  std::vector<Edge> edges;
+  for (uint32_t i = 0; i < 10 * numNodes; ++i)
+    edges.emplace_back(std::min(node(gen), node(gen)), node(gen), i);
+  std::sort(edges.begin(), edges.end());
+
+  galois::graphs::FileGraphWriter writer;
+  galois::graphs::writeSortedEdges<uint32_t>(
+      writer, numNodes, edges.begin(), edges.end(),
+      [](const Edge& e) { return std::get<0>(e); },
+      [](galois::graphs::FileGraphWriter& w, size_t n, const Edge& e) {
+        w.addNeighbor<uint32_t>(n, std::get<1>(e), std::get<2>(e));
+      });
+  GALOIS_ASSERT(writer.size() == numNodes);
+  GALOIS_ASSERT(writer.sizeEdges() == edges.size());
+
+  // edges of a node keep their order
+  auto expected = edges.begin();
+  for (uint32_t n = 0; n < numNodes; ++n) {
+    for (auto e : writer.edges(n)) {
+      GALOIS_ASSERT(expected != edges.end() && std::get<0>(*expected) == n);
+      GALOIS_ASSERT(writer.getEdgeDst(e) == std::get<1>(*expected));
+      GALOIS_ASSERT(writer.getEdgeData<uint32_t>(e) == std::get<2>(*expected));
+      ++expected;
+    }
+  }
+  GALOIS_ASSERT(expected == edges.end());
+
+  return 0;
+}
@@ -799,22 +799,29 @@ private:
       convertLIDToGID<syncType>(loopName, indices, offsets);
       val_vec.resize(bit_set_count);
       Tserialize.start();
-      gSerialize(b, data_mode, bit_set_count, offsets, val_vec);
+      gSerialize(b, data_mode, bit_set_count);
+      gSerializeRef(b, offsets);
+      gSerializeRef(b, val_vec);
       Tserialize.stop();
     } else if (data_mode == offsetsData) {
       offsets.resize(bit_set_count);
       val_vec.resize(bit_set_count);
       Tserialize.start();
-      gSerialize(b, data_mode, bit_set_count, offsets, val_vec);
+      gSerialize(b, data_mode, bit_set_count);
+      gSerializeRef(b, offsets);
+      gSerializeRef(b, val_vec);
       Tserialize.stop();
     } else if (data_mode == bitsetData) {
       val_vec.resize(bit_set_count);
       Tserialize.start();
-      gSerialize(b, data_mode, bit_set_count, bit_set_comm, val_vec);
+      gSerialize(b, data_mode, bit_set_count);
+      gSerializeRef(b, bit_set_comm);
+      gSerializeRef(b, val_vec);
       Tserialize.stop();
     } else { // onlyData
       Tserialize.start();
-      gSerialize(b, data_mode, val_vec);
+      gSerialize(b, data_mode);
+      gSerializeRef(b, val_vec);
       Tserialize.stop();
     }
   }
@@ -2125,8 +2132,8 @@ private:
             typename VecTy, bool async>
   void syncNetSend(std::string loopName) {
     static galois::runtime::SendBuffer
-        b; // although a static variable, allocation not reused
-           // due to std::move in net.sendTagged()
+        b; // the extracted data is referenced, not copied, by b and is
+           // gathered into the network message by net.sendTagged()
 
     auto& net               = galois::runtime::getSystemNetworkInterface();
     std::string syncTypeStr = (syncType == syncReduce) ? "Reduce" : "Broadcast";
@@ -66,6 +66,7 @@ public:
   }
   void initialize(std::string) { init_emb_list(); }
   void init_emb_list() {
+    DomainSet::set_universe(this->graph.size());
     this->emb_list.init(this->graph, this->max_size + 1);
     construct_edgemap();
   }
@@ -188,8 +189,10 @@ public:
                 (*lmap)[key] = new DomainSupport(2);
                 (*lmap)[key]->set_threshold(threshold);
               }
-              (*lmap)[key]->add_vertex(0, src);
-              (*lmap)[key]->add_vertex(1, dst);
+              if (!(*lmap)[key]->all_domains_reached_support()) {
+                (*lmap)[key]->add_vertex(0, src);
+                (*lmap)[key]->add_vertex(1, dst);
+              }
             }
           }
         },
@@ -224,9 +227,11 @@ public:
             qp_existed = true;
             this->emb_list.set_pid(pos, (it->first).get_id());
           }
-          for (unsigned i = 0; i < n; i++) {
-            if ((*lmap)[qp]->has_domain_reached_support(i) == false)
-              (*lmap)[qp]->add_vertex(i, emb.get_vertex(i));
+          DomainSupport* support = (*lmap)[qp];
+          for (unsigned i = 0;
+               i < n && !support->all_domains_reached_support(); i++) {
+            if (support->has_domain_reached_support(i) == false)
+              support->add_vertex(i, emb.get_vertex(i));
           }
           if (qp_existed)
             qp.clean();
@@ -262,7 +267,9 @@ public:
           }
           VertexPositionEquivalences equivalences;
           element.first.get_equivalences(equivalences);
-          for (unsigned i = 0; i < num_domains; i++) {
+          for (unsigned i = 0;
+               i < num_domains && !(*lmap)[cg]->all_domains_reached_support();
+               i++) {
             if ((*lmap)[cg]->has_domain_reached_support(i) == false) {
               unsigned qp_idx = cg.get_quick_pattern_index(i);
               assert(qp_idx < num_domains);
@@ -306,82 +313,45 @@ public:
       }
     }
   }
-  inline void merge_init_map() {
-    init_map = *(init_pattern_maps.getLocal(0));
-    for (auto i = 1; i < this->num_threads; i++) {
-      for (auto element : *init_pattern_maps.getLocal(i)) {
-        DomainSupport* support = element.second;
-        if (init_map.find(element.first) == init_map.end()) {
-          init_map[element.first] = support;
-        } else {
-          for (unsigned i = 0; i < 2; i++) {
-            if (!init_map[element.first]->has_domain_reached_support(i)) {
-              if (support->has_domain_reached_support(i))
-                init_map[element.first]->set_domain_frequent(i);
-              else
-                init_map[element.first]->add_vertices(i,
-                                                      support->domain_sets[i]);
-            }
+  // Merges the per-thread domain supports into one map. Every pattern keeps
+  // the support first seen for it; the supports of the other threads are
+  // folded into it in parallel over the patterns, stopping once all domains
+  // of a pattern reached the minimum support.
+  template <typename MapTy, typename LocalMapsTy>
+  inline void merge_domain_maps(LocalMapsTy& localmaps, MapTy& map,
+                                const char* loopname) {
+    map.clear();
+    for (auto i = 0; i < this->num_threads; i++)
+      for (auto element : *localmaps.getLocal(i))
+        map.insert(element);
+    std::vector<typename MapTy::value_type*> patterns;
+    patterns.reserve(map.size());
+    for (auto& element : map)
+      patterns.push_back(&element);
+    galois::do_all(
+        galois::iterate(patterns),
+        [&](typename MapTy::value_type* element) {
+          DomainSupport* support = element->second;
+          for (auto i = 0; i < this->num_threads; i++) {
+            if (support->all_domains_reached_support())
+              break;
+            auto lmap = localmaps.getLocal(i);
+            auto it   = lmap->find(element->first);
+            if (it != lmap->end() && it->second != support)
+              support->merge(*it->second);
           }
-        }
-      }
-    }
+        },
+        galois::chunk_size<CHUNK_SIZE>(), galois::steal(),
+        galois::loopname(loopname));
   }
-  inline void merge_qp_map(unsigned num_domains) {
-    qp_map.clear();
-    qp_map = *(qp_localmaps.getLocal(0));
-    for (auto i = 1; i < this->num_threads; i++) {
-      const QpMapDomain* lmap = qp_localmaps.getLocal(i);
-      for (auto element : *lmap) {
-        if (qp_map.find(element.first) == qp_map.end())
-          qp_map[element.first] = element.second;
-      }
-      galois::do_all(
-          galois::iterate(*lmap),
-          [&](std::pair<QPattern, DomainSupport*> element) {
-            DomainSupport* support = element.second;
-            for (unsigned i = 0; i < num_domains; i++) {
-              if (!qp_map[element.first]->has_domain_reached_support(i) &&
-                  qp_map[element.first] != support) {
-                if (support->has_domain_reached_support(i))
-                  qp_map[element.first]->set_domain_frequent(i);
-                else
-                  qp_map[element.first]->add_vertices(i,
-                                                      support->domain_sets[i]);
-              }
-            }
-          },
-          galois::chunk_size<CHUNK_SIZE>(), galois::steal(),
-          galois::loopname("MergeQuickPatterns"));
-    }
+  inline void merge_init_map() {
+    merge_domain_maps(init_pattern_maps, init_map, "MergeInitPatterns");
   }
-  inline void merge_cg_map(unsigned num_domains) {
-    cg_map.clear();
-    cg_map = *(cg_localmaps.getLocal(0));
-    for (auto i = 1; i < this->num_threads; i++) {
-      const CgMapDomain* lmap = cg_localmaps.getLocal(i);
-      for (auto element : *lmap) {
-        if (cg_map.find(element.first) == cg_map.end())
-          cg_map[element.first] = element.second;
-      }
-      galois::do_all(
-          galois::iterate(*lmap),
-          [&](std::pair<CPattern, DomainSupport*> element) {
-            DomainSupport* support = element.second;
-            for (unsigned i = 0; i < num_domains; i++) {
-              if (!cg_map[element.first]->has_domain_reached_support(i) &&
-                  cg_map[element.first] != support) {
-                if (support->has_domain_reached_support(i))
-                  cg_map[element.first]->set_domain_frequent(i);
-                else
-                  cg_map[element.first]->add_vertices(i,
-                                                      support->domain_sets[i]);
-              }
-            }
-          },
-          galois::chunk_size<CHUNK_SIZE>(), galois::steal(),
-          galois::loopname("MergeCanonicalPatterns"));
-    }
+  inline void merge_qp_map(unsigned) {
+    merge_domain_maps(qp_localmaps, qp_map, "MergeQuickPatterns");
+  }
+  inline void merge_cg_map(unsigned) {
+    merge_domain_maps(cg_localmaps, cg_map, "MergeCanonicalPatterns");
   }
 
   // Filtering for FSM
@@ -444,6 +444,8 @@ public:
 
   // Utilities
   Ulong get_total_count() { return accumulators[0].reduce(); }
+  // canonical patterns found for k >= 5, with their counts
+  const StrCgMapFreq& get_cg_map() const { return cg_map; }
   void printout_motifs() {
     std::cout << std::endl;
     if (accumulators.size() == 2) {
@@ -12,32 +12,130 @@
 
 #include "pangolin/gtypes.h"
 
+/**
+ * Compact set of the vertices mapped to one pattern domain.
+ *
+ * Vertices are appended to a vector whose sorted, duplicate-free prefix is
+ * extended lazily, so inserting one vertex is amortized constant time and an
+ * element costs 4 bytes instead of a tree node. Once the set would take more
+ * space than a bitmap over all vertices of the input graph it switches to the
+ * bitmap.
+ */
+class DomainSet {
+public:
+  DomainSet() : num_sorted(0), count(0) {}
+
+  //! number of vertices of the input graph; enables the bitmap form
+  static void set_universe(size_t n) { universe() = n; }
+
+  bool is_bitmap() const { return !bits.empty(); }
+
+  void insert(VertexId v) {
+    if (is_bitmap()) {
+      set_bit(v);
+    } else {
+      ids.push_back(v);
+    }
+  }
+
+  void insert(const DomainSet& other) {
+    if (other.is_bitmap() && !is_bitmap())
+      to_bitmap();
+    if (is_bitmap()) {
+      if (other.is_bitmap()) {
+        for (size_t w = 0; w < bits.size(); w++) {
+          count += __builtin_popcountll(other.bits[w] & ~bits[w]);
+          bits[w] |= other.bits[w];
+        }
+      } else {
+        for (auto v : other.ids)
+          set_bit(v);
+      }
+    } else {
+      ids.insert(ids.end(), other.ids.begin(), other.ids.end());
+    }
+  }
+
+  //! upper bound on the number of distinct vertices; compacts the set once
+  //! the unsorted tail is as long as the sorted prefix
+  size_t approx_size() {
+    if (!is_bitmap() && ids.size() - num_sorted > num_sorted)
+      compact();
+    return is_bitmap() ? count : ids.size();
+  }
+
+  //! exact number of distinct vertices
+  size_t size() {
+    if (!is_bitmap() && num_sorted != ids.size())
+      compact();
+    return is_bitmap() ? count : ids.size();
+  }
+
+  //! drops all vertices and releases their memory
+  void clear() {
+    galois::gstl::Vector<VertexId>().swap(ids);
+    galois::gstl::Vector<uint64_t>().swap(bits);
+    num_sorted = 0;
+    count      = 0;
+  }
+
+private:
+  galois::gstl::Vector<VertexId> ids;
+  galois::gstl::Vector<uint64_t> bits;
+  size_t num_sorted; // length of the sorted, duplicate-free prefix of ids
+  size_t count;      // number of bits set in bitmap form
+
+  static size_t& universe() {
+    static size_t n = 0;
+    return n;
+  }
+
+  void set_bit(VertexId v) {
+    uint64_t mask = uint64_t(1) << (v % 64);
+    if (!(bits[v / 64] & mask)) {
+      bits[v / 64] |= mask;
+      count++;
+    }
+  }
+
+  void compact() {
+    std::sort(ids.begin() + num_sorted, ids.end());
+    std::inplace_merge(ids.begin(), ids.begin() + num_sorted, ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    num_sorted = ids.size();
+    // a bitmap takes universe / 8 bytes
+    if (universe() && ids.size() * sizeof(VertexId) * 8 > universe())
+      to_bitmap();
+  }
+
+  void to_bitmap() {
+    assert(universe());
+    bits.assign((universe() + 63) / 64, 0);
+    count = 0;
+    for (auto v : ids)
+      set_bit(v);
+    galois::gstl::Vector<VertexId>().swap(ids);
+    num_sorted = 0;
+  }
+};
+
 class DomainSupport {
 public:
   DomainSupport() {
     num_domains    = 0;
+    num_reached    = 0;
     enough_support = false;
   }
-  DomainSupport(unsigned n) {
-    num_domains    = n;
-    enough_support = false;
-    domains_reached_support.resize(n);
-    std::fill(domains_reached_support.begin(), domains_reached_support.end(),
-              0);
-    domain_sets.resize(n);
-  }
+  DomainSupport(unsigned n) { resize(n); }
   ~DomainSupport() {}
-  void set_threshold(unsigned minsup) {
-    minimum_support = minsup;
-    // for (auto i = 0; i < num_domains; i++)
-    //	domain_sets[i].get_allocator().allocate(minsup+1);
-  }
+  void set_threshold(unsigned minsup) { minimum_support = minsup; }
   void clean() {
     domains_reached_support.clear();
     domain_sets.clear();
   }
   void resize(unsigned n) {
     num_domains    = n;
+    num_reached    = 0;
     enough_support = false;
     domains_reached_support.resize(n);
     std::fill(domains_reached_support.begin(), domains_reached_support.end(),
@@ -52,38 +150,61 @@ public:
   bool has_domain_reached_support(int i) {
     assert(i < num_domains);
     return domains_reached_support[i];
-    // return enough_support || domains_reached_support[i];
   }
+  //! true once every domain reached the minimum support; no more vertices
+  //! need to be added to the pattern after that
+  bool all_domains_reached_support() { return num_reached == num_domains; }
   void set_domain_frequent(int i) {
-    domains_reached_support[i] = 1;
+    if (!domains_reached_support[i]) {
+      domains_reached_support[i] = 1;
+      num_reached++;
+    }
     domain_sets[i].clear();
   }
   void add_vertex(int i, VertexId vid) {
+    if (domains_reached_support[i])
+      return;
     domain_sets[i].insert(vid);
-    if (domain_sets[i].size() >= minimum_support)
+    if (domain_sets[i].approx_size() >= minimum_support &&
+        domain_sets[i].size() >= minimum_support)
       set_domain_frequent(i);
   }
-  bool add_vertices(int i, IntSet& vertices) {
-    domains_reached_support[i] = 0;
-    domain_sets[i].insert(vertices.begin(), vertices.end());
+  bool add_vertices(int i, DomainSet& vertices) {
+    domain_sets[i].insert(vertices);
     if (domain_sets[i].size() >= minimum_support) {
       set_domain_frequent(i);
       return true;
     }
     return false;
   }
+  //! merges another support of the same pattern into this one
+  void merge(DomainSupport& other) {
+    for (int i = 0; i < num_domains && !all_domains_reached_support(); i++) {
+      if (domains_reached_support[i])
+        continue;
+      if (other.has_domain_reached_support(i))
+        set_domain_frequent(i);
+      else
+        add_vertices(i, other.domain_sets[i]);
+    }
+  }
   // counting the minimal image based support
   inline bool get_support() {
-    return std::all_of(domains_reached_support.begin(),
-                       domains_reached_support.end(), [](bool v) { return v; });
+    // domains are checked lazily while vertices are added; finish the check
+    for (int i = 0; i < num_domains && !all_domains_reached_support(); i++)
+      if (!domains_reached_support[i] &&
+          domain_sets[i].size() >= minimum_support)
+        set_domain_frequent(i);
+    return all_domains_reached_support();
   }
 
   // private:
   unsigned minimum_support;
   int num_domains;
+  int num_reached;
   bool enough_support;
   BoolVec domains_reached_support;
-  IntSets domain_sets;
+  galois::gstl::Vector<DomainSet> domain_sets;
 };
 
 // typedef galois::gstl::Map<InitPattern, DomainSupport> InitMap;
@@ -0,0 +1,718 @@
+#pragma once
+// Per-vertex graphlet orbit counts (graphlet degree vectors) for all
+// graphlets of up to 4 or up to 5 vertices, computed combinatorially instead
+// of by enumerating embeddings. Only 4-cliques (and 5-cliques) are listed;
+// every other orbit follows from per-edge triangle counts, common neighbor
+// counts and a system of linear relations between non-induced and induced
+// counts, in the spirit of ORCA [Hocevar and Demsar, Bioinformatics 2014].
+//
+// Orbit numbering follows Przulj's graphlet orbits:
+//   0: degree
+//   1, 2: end and middle of an induced 3-path (wedge)
+//   3: triangle
+//   4, 5: end and middle of an induced 4-path
+//   6, 7: leaf and center of a 3-star
+//   8: 4-cycle
+//   9, 10, 11: tail end, triangle vertex, and tail-attached triangle vertex
+//              of a tailed triangle
+//   12, 13: degree-2 and degree-3 vertices of a diamond
+//   14: 4-clique
+// and, for graphlets of 5 vertices (G9 to G29):
+//   15, 16, 17: end, next to end and middle of a 5-path
+//   18, 19, 20, 21: long leg end, short leg, long leg middle and center of
+//                   a chair (3-star with one leg extended)
+//   22, 23: leaf and center of a 4-star
+//   24, 25, 26: pendant, degree-2 vertex and center of a triangle with two
+//               pendants at one vertex
+//   27, 28, 29, 30: tail end, tail middle, triangle vertex and tail-attached
+//                   vertex of a triangle with a 2-edge tail
+//   31, 32, 33: pendant, degree-2 vertex and pendant-attached vertices of a
+//               bull
+//   34: 5-cycle
+//   35, 36, 37, 38: pendant, opposite vertex, other cycle vertices and
+//                   pendant-attached vertex of a 4-cycle with a pendant
+//   39, 40, 41, 42: pendant, degree-2 vertices, other degree-3 vertex and
+//                   pendant-attached vertex of a diamond with a pendant at a
+//                   degree-3 vertex
+//   43, 44: outer vertex and center of a bowtie
+//   45, 46, 47, 48: pendant, other degree-2 vertex, pendant-attached vertex
+//                   and degree-3 vertices of a diamond with a pendant at a
+//                   degree-2 vertex
+//   49, 50: degree-2 and degree-3 vertices of K(2,3)
+//   51, 52, 53: bottom, roof top and roof base of a house
+//   54, 55: degree-2 and degree-4 vertices of three triangles on one edge
+//   56, 57, 58: pendant, other clique vertex and pendant-attached vertex of
+//               a 4-clique with a pendant
+//   59, 60, 61: path end, path middle and hub of a 4-path joined to a hub
+//   62, 63, 64: outer vertex, degree-2 vertices and degree-3 vertices of a
+//               diamond with a vertex joined to both its degree-2 vertices
+//   65, 66, 67: outer vertex, other clique vertex and joined clique vertex
+//               of a 4-clique with a vertex joined to two of its vertices
+//   68, 69: rim and hub of a 4-wheel
+//   70, 71: degree-3 and degree-4 vertices of a 5-clique minus an edge
+//   72: 5-clique
+//
+// The input graph must be symmetric, simple and have sorted adjacency lists.
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <functional>
+#include "galois/Galois.h"
+#include "galois/LargeArray.h"
+#include "galois/substrate/PerThreadStorage.h"
+#include "pangolin/gtypes.h"
+
+template <typename GraphTy>
+class OrbitCounter {
+  typedef typename GraphTy::edge_iterator edge_iterator;
+
+public:
+  //! orbits of the graphlets of up to 4 and up to 5 vertices
+  static constexpr unsigned num_orbits4 = 15;
+  static constexpr unsigned num_orbits5 = 73;
+
+  //! counts the orbits of the graphlets of up to k vertices, k being 4 or 5
+  OrbitCounter(GraphTy& g, unsigned k = 4)
+      : graph(g), num_orbits(k > 4 ? num_orbits5 : num_orbits4) {
+    assert(k <= 5);
+  }
+
+  //! computes the orbit counts of every vertex
+  void count() {
+    size_t nv = graph.size();
+    degrees.resize(nv);
+    galois::do_all(
+        galois::iterate(graph.begin(), graph.end()),
+        [&](const auto& v) {
+          degrees[v] = std::distance(graph.edge_begin(v), graph.edge_end(v));
+        },
+        galois::loopname("OrbitDegrees"));
+    count_edge_triangles();
+    count_cliques();
+    orbits.resize(nv * num_orbits);
+    count_orbits();
+    if (num_orbits == num_orbits5)
+      count_orbits5();
+  }
+
+  unsigned get_num_orbits() const { return num_orbits; }
+
+  //! the get_num_orbits() orbit counts of vertex v
+  const uint64_t* get_orbits(VertexId v) const {
+    return &orbits[size_t(v) * num_orbits];
+  }
+
+  //! global counts of the connected induced k-vertex motifs, in the order
+  //! used by the enumerating motif miner: {triangles, wedges} for k = 3 and
+  //! {4-paths, 3-stars, 4-cycles, tailed-triangles, diamonds, 4-cliques} for
+  //! k = 4; for k = 5, Przulj's graphlets G9 to G29 (see graphlet_index)
+  std::vector<uint64_t> motif_counts(unsigned k) const {
+    std::vector<uint64_t> sum(num_orbits);
+    size_t nv = degrees.size();
+    for (unsigned o = 0; o < num_orbits; o++) {
+      galois::GAccumulator<uint64_t> accum;
+      galois::do_all(
+          galois::iterate(size_t(0), nv),
+          [&](const size_t& v) { accum += orbits[v * num_orbits + o]; },
+          galois::no_stats());
+      sum[o] = accum.reduce();
+    }
+    if (k == 3)
+      return {sum[3] / 3, sum[2]};
+    if (k == 4)
+      return {sum[5] / 2,  sum[7],      sum[8] / 4,
+              sum[11],     sum[13] / 2, sum[14] / 4};
+    // one orbit of each graphlet, divided by its number of vertices
+    assert(k == 5 && num_orbits == num_orbits5);
+    return {sum[17], sum[21],     sum[23], sum[26],     sum[30],
+            sum[32], sum[34] / 5, sum[38], sum[42],     sum[44],
+            sum[45], sum[50] / 2, sum[52], sum[55] / 2, sum[58],
+            sum[61], sum[62],     sum[65], sum[69],     sum[70] / 2,
+            sum[72] / 5};
+  }
+
+  //! position in motif_counts(5) of the connected 5-vertex graphlet with the
+  //! given edges between vertices 0 to 4; the degree sequence and the number
+  //! of triangles tell all of them apart
+  static unsigned
+  graphlet_index(const std::vector<std::pair<unsigned, unsigned>>& edges) {
+    // descending degrees as decimal digits, and triangles, of G9 to G29
+    static const unsigned keys[21][2] = {
+        {22211, 0}, {32111, 0}, {41111, 0}, {42211, 1}, {32221, 1},
+        {33211, 1}, {22222, 0}, {32221, 0}, {43221, 2}, {42222, 2},
+        {33321, 2}, {33222, 0}, {33222, 1}, {44222, 3}, {43331, 4},
+        {43322, 3}, {33332, 2}, {44332, 5}, {43333, 4}, {44433, 7},
+        {44444, 10}};
+    bool adj[5][5] = {};
+    for (auto& e : edges) {
+      assert(e.first < 5 && e.second < 5);
+      adj[e.first][e.second] = adj[e.second][e.first] = true;
+    }
+    unsigned deg[5] = {};
+    unsigned tri    = 0;
+    for (unsigned i = 0; i < 5; i++) {
+      for (unsigned j = 0; j < 5; j++) {
+        deg[i] += adj[i][j];
+        for (unsigned l = j + 1; l < 5; l++)
+          tri += i < j && adj[i][j] && adj[i][l] && adj[j][l];
+      }
+    }
+    std::sort(deg, deg + 5, std::greater<unsigned>());
+    unsigned key = 0;
+    for (unsigned i = 0; i < 5; i++)
+      key = key * 10 + deg[i];
+    for (unsigned g = 0; g < 21; g++)
+      if (keys[g][0] == key && keys[g][1] == tri)
+        return g;
+    GALOIS_DIE("not a connected 5-vertex graphlet");
+    return 0;
+  }
+
+  //! writes one line per vertex: the vertex id followed by its orbit counts
+  void write_orbits(std::string filename) const {
+    std::ofstream out(filename);
+    if (!out.good())
+      GALOIS_DIE("failed to open orbit output file ", filename);
+    for (size_t v = 0; v < degrees.size(); v++) {
+      out << v;
+      for (unsigned o = 0; o < num_orbits; o++)
+        out << " " << orbits[v * num_orbits + o];
+      out << "\n";
+    }
+  }
+
+private:
+  GraphTy& graph;
+  unsigned num_orbits;
+  std::vector<uint64_t> degrees;
+  galois::LargeArray<uint32_t> edge_tri; // triangles over each edge
+  std::vector<uint64_t> triangles;       // triangles at each vertex
+  std::vector<std::atomic<uint64_t>> cliques;      // 4-cliques at each vertex
+  std::vector<std::atomic<uint64_t>> five_cliques; // 5-cliques at each vertex
+  std::vector<uint64_t> orbits; // num_orbits counts per vertex
+
+  // per-thread counters indexed by vertex, cleared after each use
+  struct Scratch {
+    std::vector<uint32_t> common_x;  // common neighbors with x
+    std::vector<uint32_t> common_a;  // common neighbors with a neighbor of x
+    std::vector<uint8_t> adjacent_x; // neighbors of x
+  };
+  galois::substrate::PerThreadStorage<Scratch> scratch;
+
+  // vertices ordered by (degree, id) so every clique is listed once
+  bool lower_rank(VertexId a, VertexId b) const {
+    return degrees[a] < degrees[b] || (degrees[a] == degrees[b] && a < b);
+  }
+
+  edge_iterator find_edge(VertexId a, VertexId b) {
+    auto begin = graph.edge_begin(a);
+    auto end   = graph.edge_end(a);
+    while (begin < end) {
+      auto mid  = begin + (end - begin) / 2;
+      auto dst  = graph.getEdgeDst(mid);
+      if (dst == b)
+        return mid;
+      if (dst < b)
+        begin = mid + 1;
+      else
+        end = mid;
+    }
+    return graph.edge_end(a);
+  }
+
+  bool is_connected(VertexId a, VertexId b) {
+    return find_edge(a, b) != graph.edge_end(a);
+  }
+
+  // common neighbors of a, b and c
+  int64_t common3(VertexId a, VertexId b, VertexId c) {
+    if (degrees[b] < degrees[a])
+      std::swap(a, b);
+    if (degrees[c] < degrees[a])
+      std::swap(a, c);
+    int64_t count = 0;
+    for (auto e : graph.edges(a)) {
+      auto w = graph.getEdgeDst(e);
+      if (is_connected(b, w) && is_connected(c, w))
+        count++;
+    }
+    return count;
+  }
+
+  void count_edge_triangles() {
+    edge_tri.allocateBlocked(graph.sizeEdges());
+    triangles.resize(graph.size());
+    galois::do_all(
+        galois::iterate(graph.begin(), graph.end()),
+        [&](const auto& x) {
+          uint64_t tri = 0;
+          for (auto e : graph.edges(x)) {
+            auto y         = graph.getEdgeDst(e);
+            uint32_t count = 0;
+            auto xi = graph.edge_begin(x), xe = graph.edge_end(x);
+            auto yi = graph.edge_begin(y), ye = graph.edge_end(y);
+            while (xi < xe && yi < ye) {
+              auto a = graph.getEdgeDst(xi);
+              auto b = graph.getEdgeDst(yi);
+              if (a <= b)
+                xi++;
+              if (a >= b)
+                yi++;
+              if (a == b)
+                count++;
+            }
+            edge_tri[*e] = count;
+            tri += count;
+          }
+          triangles[x] = tri / 2;
+        },
+        galois::chunk_size<64>(), galois::steal(),
+        galois::loopname("OrbitEdgeTriangles"));
+  }
+
+  void count_cliques() {
+    cliques = std::vector<std::atomic<uint64_t>>(graph.size());
+    if (num_orbits == num_orbits5)
+      five_cliques = std::vector<std::atomic<uint64_t>>(graph.size());
+    galois::do_all(
+        galois::iterate(graph.begin(), graph.end()),
+        [&](const auto& x) {
+          std::vector<VertexId> higher;
+          for (auto e : graph.edges(x)) {
+            auto y = graph.getEdgeDst(e);
+            if (!lower_rank(x, y) || edge_tri[*e] < 2)
+              continue;
+            // common neighbors of x and y above y
+            higher.clear();
+            auto xi = graph.edge_begin(x), xe = graph.edge_end(x);
+            auto yi = graph.edge_begin(y), ye = graph.edge_end(y);
+            while (xi < xe && yi < ye) {
+              auto a = graph.getEdgeDst(xi);
+              auto b = graph.getEdgeDst(yi);
+              if (a <= b)
+                xi++;
+              if (a >= b)
+                yi++;
+              if (a == b && lower_rank(y, a))
+                higher.push_back(a);
+            }
+            for (size_t i = 0; i < higher.size(); i++) {
+              for (size_t j = i + 1; j < higher.size(); j++) {
+                if (!is_connected(higher[i], higher[j]))
+                  continue;
+                cliques[x] += 1;
+                cliques[y] += 1;
+                cliques[higher[i]] += 1;
+                cliques[higher[j]] += 1;
+                if (num_orbits != num_orbits5)
+                  continue;
+                for (size_t l = j + 1; l < higher.size(); l++) {
+                  if (is_connected(higher[i], higher[l]) &&
+                      is_connected(higher[j], higher[l])) {
+                    five_cliques[x] += 1;
+                    five_cliques[y] += 1;
+                    five_cliques[higher[i]] += 1;
+                    five_cliques[higher[j]] += 1;
+                    five_cliques[higher[l]] += 1;
+                  }
+                }
+              }
+            }
+          }
+        },
+        galois::chunk_size<64>(), galois::steal(),
+        galois::loopname("OrbitCliques"));
+  }
+
+  static int64_t choose2(int64_t n) { return n * (n - 1) / 2; }
+  static int64_t choose3(int64_t n) { return n * (n - 1) * (n - 2) / 6; }
+
+  // Each induced orbit count is the matching non-induced count minus the
+  // denser graphlets that contain that pattern, weighted by how many times
+  // the pattern occurs at the vertex within each of them.
+  void count_orbits() {
+    size_t nv = graph.size();
+    galois::do_all(
+        galois::iterate(graph.begin(), graph.end()),
+        [&](const auto& x) {
+          auto& common = scratch.getLocal()->common_x;
+          if (common.size() != nv)
+            common.assign(nv, 0);
+          std::vector<VertexId> touched;
+
+          int64_t d   = degrees[x];
+          int64_t tri = triangles[x];
+          // sums over the neighbors y of x
+          int64_t deg_minus_one = 0; // d(y) - 1
+          int64_t tri_pairs     = 0; // C(t(xy), 2)
+          int64_t tri_deg       = 0; // t(xy) * d(y)
+          int64_t other_tri     = 0; // T(y) - t(xy)
+          int64_t star_leaf     = 0; // C(d(y) - 1, 2)
+          int64_t path_mid      = 0; // (d - 1)(d(y) - 1) - t(xy)
+          int64_t path_end      = 0; // sum_{z in N(y)} (d(z) - 1) - ...
+          int64_t opposite_tri  = 0; // t(yz) over triangles xyz, twice
+          for (auto e : graph.edges(x)) {
+            auto y       = graph.getEdgeDst(e);
+            int64_t dy   = degrees[y];
+            int64_t txy  = edge_tri[*e];
+            deg_minus_one += dy - 1;
+            tri_pairs += choose2(txy);
+            tri_deg += txy * dy;
+            other_tri += triangles[y] - txy;
+            star_leaf += choose2(dy - 1);
+            path_mid += (d - 1) * (dy - 1) - txy;
+
+            int64_t two_hop = 0;
+            auto xi = graph.edge_begin(x), xe = graph.edge_end(x);
+            for (auto f : graph.edges(y)) {
+              auto z = graph.getEdgeDst(f);
+              two_hop += degrees[z] - 1;
+              if (z == x)
+                continue;
+              if (common[z]++ == 0)
+                touched.push_back(z);
+              while (xi < xe && graph.getEdgeDst(xi) < z)
+                xi++;
+              if (xi < xe && graph.getEdgeDst(xi) == z)
+                opposite_tri += edge_tri[*f];
+            }
+            path_end += two_hop - (d - 1) - txy;
+          }
+          int64_t cycles = 0; // C(c(x,w), 2) over 2-hop vertices w
+          for (auto w : touched) {
+            cycles += choose2(common[w]);
+            common[w] = 0;
+          }
+
+          int64_t o[num_orbits4];
+          o[0]  = d;
+          o[3]  = tri;
+          o[2]  = choose2(d) - tri;
+          o[1]  = deg_minus_one - 2 * tri;
+          o[14] = cliques[x];
+          o[13] = tri_pairs - 3 * o[14];
+          o[12] = (opposite_tri / 2 - tri) - 3 * o[14];
+          o[11] = tri * (d - 2) - 2 * o[13] - 3 * o[14];
+          o[10] = tri_deg - 4 * tri - 2 * o[12] - 2 * o[13] - 6 * o[14];
+          o[9]  = other_tri - 2 * o[12] - 3 * o[14];
+          o[8]  = cycles - o[12] - o[13] - 3 * o[14];
+          o[7]  = choose3(d) - o[11] - o[13] - o[14];
+          o[6]  = star_leaf - o[9] - o[10] - 2 * o[12] - o[13] - 3 * o[14];
+          o[5]  = path_mid - 2 * o[8] - o[10] - 2 * o[11] - 2 * o[12] -
+                 4 * o[13] - 6 * o[14];
+          o[4] = path_end - 2 * o[8] - 2 * o[9] - o[10] - 4 * o[12] -
+                 2 * o[13] - 6 * o[14];
+          for (unsigned i = 0; i < num_orbits4; i++) {
+            assert(o[i] >= 0);
+            orbits[size_t(x) * num_orbits + i] = o[i];
+          }
+        },
+        galois::chunk_size<64>(), galois::steal(),
+        galois::loopname("OrbitCounting"));
+  }
+
+  // The 5-vertex orbits are derived from the connected induced 4-vertex
+  // subgraphs around x, which are listed, and a fifth vertex w, which is
+  // only counted: f[o] sums, over the subgraphs in which x has a given
+  // 4-vertex orbit, the vertices w outside the subgraph that are adjacent
+  // to (at least) a given set of its vertices, from degrees, triangles per
+  // edge and common neighbor counts. Such a w may also be adjacent to the
+  // rest of the subgraph, so f[o] counts orbit o plus denser orbits, which
+  // are subtracted starting from the 5-cliques, as ORCA does.
+  void count_orbits5() {
+    size_t nv = graph.size();
+    galois::do_all(
+        galois::iterate(graph.begin(), graph.end()),
+        [&](const auto& x) {
+          auto& s = *scratch.getLocal();
+          if (s.common_a.size() != nv) {
+            s.common_x.assign(nv, 0);
+            s.common_a.assign(nv, 0);
+            s.adjacent_x.assign(nv, 0);
+          }
+          std::vector<VertexId> touched_x, touched_a;
+          for (auto e : graph.edges(x))
+            s.adjacent_x[graph.getEdgeDst(e)] = 1;
+          for (auto e : graph.edges(x)) {
+            for (auto f : graph.edges(graph.getEdgeDst(e))) {
+              auto z = graph.getEdgeDst(f);
+              if (z != x && s.common_x[z]++ == 0)
+                touched_x.push_back(z);
+            }
+          }
+          // x or a neighbor of x
+          auto near_x = [&](VertexId v) { return v == x || s.adjacent_x[v]; };
+          auto deg    = [&](VertexId v) { return int64_t(degrees[v]); };
+          int64_t dx  = degrees[x];
+          int64_t f[num_orbits5] = {};
+
+          for (auto ea : graph.edges(x)) {
+            auto a      = graph.getEdgeDst(ea);
+            int64_t txa = edge_tri[*ea];
+            for (auto eb : graph.edges(a)) {
+              for (auto ec : graph.edges(graph.getEdgeDst(eb))) {
+                auto c = graph.getEdgeDst(ec);
+                if (c != a && s.common_a[c]++ == 0)
+                  touched_a.push_back(c);
+              }
+            }
+
+            // a and b are both neighbors of x
+            for (auto eb : graph.edges(x)) {
+              auto b = graph.getEdgeDst(eb);
+              if (b == a)
+                continue;
+              int64_t txb = edge_tri[*eb];
+              auto ab     = find_edge(a, b);
+              if (ab == graph.edge_end(a)) {
+                // 4-path a-x-b-c
+                for (auto ec : graph.edges(b)) {
+                  auto c = graph.getEdgeDst(ec);
+                  if (!near_x(c) && !is_connected(a, c))
+                    f[17] += deg(a) - 1;
+                }
+                // 3-star at x with leaves a < b < c
+                if (b < a)
+                  continue;
+                for (auto ec : graph.edges(x)) {
+                  auto c = graph.getEdgeDst(ec);
+                  if (c > b && !is_connected(a, c) && !is_connected(b, c)) {
+                    f[21] += deg(a) + deg(b) + deg(c) - 3;
+                    f[23] += dx - 3;
+                  }
+                }
+                continue;
+              }
+              int64_t tab = edge_tri[*ab];
+              // diamond with the chord x-b and degree-2 vertices a < c
+              for (auto ec : graph.edges(x)) {
+                auto c = graph.getEdgeDst(ec);
+                if (c <= a || c == b)
+                  continue;
+                auto bc = find_edge(b, c);
+                if (bc == graph.edge_end(b) || is_connected(a, c))
+                  continue;
+                int64_t tbc = edge_tri[*bc];
+                int64_t txc = edge_tri[*ec];
+                f[41] += deg(b) - 3;
+                f[42] += dx - 3;
+                f[48] += deg(a) + deg(c) - 4;
+                f[55] += txb - 2;
+                f[60] += tab + tbc - 2;
+                f[61] += txa + txc - 2;
+                f[64] += int64_t(s.common_a[c]) - 2;
+                f[68] += common3(a, b, c) - 1;
+                f[69] += common3(x, a, c) - 1;
+              }
+              // triangle x-a-b with the tail b-c
+              for (auto ec : graph.edges(b)) {
+                auto c = graph.getEdgeDst(ec);
+                if (near_x(c) || is_connected(a, c))
+                  continue;
+                f[25] += deg(b) - 3;
+                f[29] += deg(c) - 1;
+                f[32] += deg(a) - 2;
+                f[43] += edge_tri[*ec];
+                f[52] += int64_t(s.common_a[c]) - 1;
+              }
+              if (b < a)
+                continue;
+              // 4-clique x, a < b < c, or triangle x-a-b with the tail x-c
+              for (auto ec : graph.edges(x)) {
+                auto c = graph.getEdgeDst(ec);
+                if (c == a || c == b)
+                  continue;
+                int64_t txc = edge_tri[*ec];
+                auto ac     = find_edge(a, c);
+                auto bc     = find_edge(b, c);
+                if (ac == graph.edge_end(a) && bc == graph.edge_end(b)) {
+                  f[26] += dx - 3;
+                  f[30] += deg(c) - 1;
+                  f[33] += deg(a) + deg(b) - 4;
+                  f[44] += txc;
+                } else if (c > b && ac != graph.edge_end(a) &&
+                           bc != graph.edge_end(b)) {
+                  int64_t tac = edge_tri[*ac];
+                  int64_t tbc = edge_tri[*bc];
+                  f[57] += deg(a) + deg(b) + deg(c) - 9;
+                  f[58] += dx - 3;
+                  f[66] += tab + tac + tbc - 6;
+                  f[67] += txa + txb + txc - 6;
+                  f[70] += common3(a, b, c) - 1;
+                  f[71] += common3(x, a, b) + common3(x, a, c) +
+                           common3(x, b, c) - 3;
+                }
+              }
+              // diamond with the chord a-b and degree-2 vertices x and c
+              for (auto ec : graph.edges(a)) {
+                auto c = graph.getEdgeDst(ec);
+                if (near_x(c))
+                  continue;
+                auto bc = find_edge(b, c);
+                if (bc == graph.edge_end(b))
+                  continue;
+                int64_t tac = edge_tri[*ec];
+                int64_t tbc = edge_tri[*bc];
+                f[40] += deg(a) + deg(b) - 6;
+                f[46] += deg(c) - 2;
+                f[47] += dx - 2;
+                f[54] += tab - 2;
+                f[59] += tac + tbc - 2;
+                f[63] += int64_t(s.common_x[c]) - 2;
+                f[65] += common3(a, b, c);
+              }
+            }
+
+            // b is a neighbor of a only
+            for (auto eb : graph.edges(a)) {
+              auto b = graph.getEdgeDst(eb);
+              if (near_x(b))
+                continue;
+              int64_t tab = edge_tri[*eb];
+              // triangle a-b-c with the tail a-x, or 3-star at a
+              for (auto ec : graph.edges(a)) {
+                auto c = graph.getEdgeDst(ec);
+                if (c <= b || near_x(c))
+                  continue;
+                auto bc = find_edge(b, c);
+                if (bc != graph.edge_end(b)) {
+                  int64_t tac = edge_tri[*ec];
+                  int64_t tbc = edge_tri[*bc];
+                  f[24] += deg(a) - 3;
+                  f[28] += dx - 1;
+                  f[31] += deg(b) + deg(c) - 4;
+                  f[39] += tab + tac - 2;
+                  f[45] += tbc - 1;
+                  f[56] += common3(a, b, c);
+                } else {
+                  f[19] += deg(b) + deg(c) - 2;
+                  f[20] += dx - 1;
+                  f[22] += deg(a) - 3;
+                }
+              }
+              // 4-cycle x-a-b-c with a < c, or 4-path x-a-b-c
+              for (auto ec : graph.edges(b)) {
+                auto c = graph.getEdgeDst(ec);
+                if (c == a || is_connected(a, c))
+                  continue;
+                int64_t tbc = edge_tri[*ec];
+                if (s.adjacent_x[c]) {
+                  if (c < a)
+                    continue;
+                  f[36] += deg(b) - 2;
+                  f[37] += deg(a) + deg(c) - 4;
+                  f[38] += dx - 2;
+                  f[49] += int64_t(s.common_a[c]) - 2;
+                  f[50] += int64_t(s.common_x[b]) - 2;
+                  f[51] += tab + tbc;
+                  f[53] += txa + edge_tri[*find_edge(x, c)];
+                  f[62] += common3(a, b, c);
+                } else {
+                  f[15] += deg(c) - 1;
+                  f[16] += dx - 1;
+                  f[18] += deg(b) - 2;
+                  f[27] += tbc;
+                  f[34] += s.common_x[c];
+                  f[35] += int64_t(s.common_a[c]) - 1;
+                }
+              }
+            }
+            for (auto c : touched_a)
+              s.common_a[c] = 0;
+            touched_a.clear();
+          }
+          for (auto z : touched_x)
+            s.common_x[z] = 0;
+          for (auto e : graph.edges(x))
+            s.adjacent_x[graph.getEdgeDst(e)] = 0;
+
+          int64_t o[num_orbits5];
+          o[72] = five_cliques[x];
+          o[71] = (f[71] - 12 * o[72]) / 2;
+          o[70] = f[70] - 4 * o[72];
+          o[69] = (f[69] - 2 * o[71]) / 4;
+          o[68] = f[68] - 2 * o[71];
+          o[67] = f[67] - 12 * o[72] - 4 * o[71];
+          o[66] = f[66] - 12 * o[72] - 2 * o[71] - 3 * o[70];
+          o[65] = (f[65] - 3 * o[70]) / 2;
+          o[64] = f[64] - 2 * o[71] - 4 * o[69] - o[68];
+          o[63] = f[63] - 3 * o[70] - 2 * o[68];
+          o[62] = (f[62] - o[68]) / 2;
+          o[61] = (f[61] - 4 * o[71] - 8 * o[69] - 2 * o[67]) / 2;
+          o[60] = f[60] - 4 * o[71] - 2 * o[68] - 2 * o[67];
+          o[59] = f[59] - 6 * o[70] - 2 * o[68] - 4 * o[65];
+          o[58] = f[58] - 4 * o[72] - 2 * o[71] - o[67];
+          o[57] = f[57] - 12 * o[72] - 4 * o[71] - 3 * o[70] - o[67] -
+                  2 * o[66];
+          o[56] = (f[56] - 2 * o[65]) / 3;
+          o[55] = (f[55] - 2 * o[71] - 2 * o[67]) / 3;
+          o[54] = (f[54] - 3 * o[70] - o[66] - 2 * o[65]) / 2;
+          o[53] = f[53] - 2 * o[68] - 2 * o[64] - 2 * o[63];
+          o[52] = (f[52] - 2 * o[66] - 2 * o[64] - o[59]) / 2;
+          o[51] = f[51] - 2 * o[68] - 2 * o[63] - 4 * o[62];
+          o[50] = (f[50] - o[68] - 2 * o[63]) / 3;
+          o[49] = (f[49] - o[68] - o[64] - 2 * o[62]) / 2;
+          o[48] = f[48] - 4 * o[71] - 8 * o[69] - 2 * o[68] - 2 * o[67] -
+                  2 * o[64] - 2 * o[61] - o[60];
+          o[47] = f[47] - 3 * o[70] - 2 * o[68] - o[66] - o[63] - o[60];
+          o[46] = f[46] - 3 * o[70] - 2 * o[68] - 2 * o[65] - o[63] - o[59];
+          o[45] = f[45] - 2 * o[65] - 2 * o[62] - 3 * o[56];
+          o[44] = (f[44] - o[67] - 2 * o[61]) / 4;
+          o[43] = (f[43] - 2 * o[66] - o[60] - o[59]) / 2;
+          o[42] = f[42] - 2 * o[71] - 4 * o[69] - 2 * o[67] - 2 * o[61] -
+                  3 * o[55];
+          o[41] = f[41] - 2 * o[71] - o[68] - 2 * o[67] - o[60] - 3 * o[55];
+          o[40] = f[40] - 6 * o[70] - 2 * o[68] - 2 * o[66] - 4 * o[65] -
+                  o[60] - o[59] - 4 * o[54];
+          o[39] = (f[39] - 4 * o[65] - o[59] - 6 * o[56]) / 2;
+          o[38] = f[38] - o[68] - o[64] - 2 * o[63] - o[53] - 3 * o[50];
+          o[37] = f[37] - 2 * o[68] - 2 * o[64] - 2 * o[63] - 4 * o[62] -
+                  o[53] - o[51] - 4 * o[49];
+          o[36] = f[36] - o[68] - 2 * o[63] - 2 * o[62] - o[51] - 3 * o[50];
+          o[35] = (f[35] - o[59] - 2 * o[52] - 2 * o[45]) / 2;
+          o[34] = (f[34] - o[59] - 2 * o[52] - o[51]) / 2;
+          o[33] = f[33] - 2 * o[67] - 2 * o[63] - 2 * o[61] - 6 * o[58] -
+                  o[53] - 2 * o[47] - 2 * o[42];
+          o[32] = (f[32] - 2 * o[66] - 2 * o[64] - o[59] - 2 * o[57] -
+                   2 * o[52] - o[48] - o[40]) /
+                  2;
+          o[31] = f[31] - 4 * o[65] - 4 * o[62] - o[59] - 6 * o[56] - o[51] -
+                  2 * o[45] - 2 * o[39];
+          o[30] = f[30] - o[67] - o[63] - 2 * o[61] - o[53] - 4 * o[44];
+          o[29] = f[29] - 2 * o[66] - 2 * o[64] - o[60] - o[59] - o[53] -
+                  2 * o[52] - 2 * o[43];
+          o[28] = f[28] - 2 * o[65] - 2 * o[62] - o[59] - o[51] - o[43];
+          o[27] = (f[27] - o[59] - o[51] - 2 * o[45]) / 2;
+          o[26] = (f[26] - o[67] - 2 * o[61] - 3 * o[58] - 4 * o[44] -
+                   2 * o[42]) /
+                  2;
+          o[25] = (f[25] - 2 * o[66] - o[60] - o[59] - 2 * o[57] -
+                   2 * o[43] - 2 * o[41] - o[40]) /
+                  2;
+          o[24] = f[24] - 2 * o[65] - o[59] - 3 * o[56] - o[43] - 2 * o[39];
+          o[23] = (f[23] - o[55] - o[42] - 2 * o[26]) / 4;
+          o[22] = (f[22] - 2 * o[54] - o[40] - o[39] - o[25] - 2 * o[24]) / 3;
+          o[21] = f[21] - 3 * o[55] - 3 * o[50] - 2 * o[42] - 2 * o[38] -
+                  2 * o[26];
+          o[20] = f[20] - 2 * o[54] - 2 * o[49] - o[40] - o[37] - o[25];
+          o[19] = f[19] - 4 * o[54] - 4 * o[49] - o[40] - 2 * o[39] - o[37] -
+                  2 * o[35] - 2 * o[24];
+          o[18] = (f[18] - o[59] - o[51] - 2 * o[46] - 2 * o[45] - 2 * o[36] -
+                   o[31] - 2 * o[27]) /
+                  2;
+          o[17] = (f[17] - o[60] - o[53] - o[51] - o[48] - o[37] - 2 * o[34] -
+                   2 * o[30]) /
+                  2;
+          o[16] = f[16] - o[59] - 2 * o[52] - o[51] - 2 * o[46] - 2 * o[36] -
+                  2 * o[34] - o[29];
+          o[15] = f[15] - o[59] - 2 * o[52] - o[51] - 2 * o[45] - 2 * o[35] -
+                  2 * o[34] - 2 * o[27];
+          for (unsigned i = num_orbits4; i < num_orbits5; i++) {
+            assert(o[i] >= 0);
+            orbits[size_t(x) * num_orbits + i] = o[i];
+          }
+        },
+        galois::chunk_size<64>(), galois::steal(),
+        galois::loopname("OrbitCounting5"));
+  }
+};
@@ -0,0 +1,124 @@
+#include "galois/Galois.h"
+#include "pangolin/domain_support.h"
+
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+// Aggregates the support of every label pair of a small labeled graph the
+// way EdgeMiner aggregates its init patterns: DomainSupports per block that
+// stop taking vertices once every domain is frequent, merged per pattern.
+// The result is compared with the IntSet based counting DomainSupport used
+// before, which keeps every vertex of every domain.
+
+using Pattern = std::pair<unsigned, unsigned>;
+using Edge    = std::pair<VertexId, VertexId>;
+using Support = std::map<Pattern, DomainSupport*>;
+
+constexpr unsigned numNodes  = 300;
+constexpr unsigned numBlocks = 4;
+
+struct Result {
+  //! add_vertex calls skipped because the pattern was already frequent
+  size_t skipped = 0;
+  //! domains that switched to the bitmap form
+  size_t bitmaps = 0;
+};
+
+Result check(const std::vector<Edge>& edges,
+             const std::vector<unsigned>& labels, unsigned minsup) {
+  std::map<Pattern, IntSets> reference;
+  for (auto& e : edges) {
+    auto& sets = reference[Pattern(labels[e.first], labels[e.second])];
+    sets.resize(2);
+    sets[0].insert(e.first);
+    sets[1].insert(e.second);
+  }
+
+  // one map per block of edges, standing in for the per-thread maps of the
+  // miner, so that supports are merged however many threads run
+  std::vector<Support> localmaps(numBlocks);
+  galois::GAccumulator<size_t> skipped;
+  galois::do_all(galois::iterate(0u, numBlocks), [&](unsigned block) {
+    auto& lmap = localmaps[block];
+    for (size_t j = block * edges.size() / numBlocks;
+         j < (block + 1) * edges.size() / numBlocks; j++) {
+      const Edge& e = edges[j];
+      auto& support = lmap[Pattern(labels[e.first], labels[e.second])];
+      if (!support) {
+        support = new DomainSupport(2);
+        support->set_threshold(minsup);
+      }
+      if (support->all_domains_reached_support()) {
+        skipped += 1;
+        continue;
+      }
+      support->add_vertex(0, e.first);
+      support->add_vertex(1, e.second);
+    }
+  });
+
+  Support merged;
+  for (auto& lmap : localmaps)
+    merged.insert(lmap.begin(), lmap.end());
+  galois::do_all(galois::iterate(merged), [&](Support::value_type& element) {
+    for (auto& lmap : localmaps) {
+      auto it = lmap.find(element.first);
+      if (it != lmap.end() && it->second != element.second)
+        element.second->merge(*it->second);
+    }
+  });
+
+  Result result;
+  result.skipped = skipped.reduce();
+  GALOIS_ASSERT(merged.size() == reference.size());
+  for (auto& element : merged) {
+    DomainSupport* support = element.second;
+    auto& sets             = reference.at(element.first);
+    bool frequent = sets[0].size() >= minsup && sets[1].size() >= minsup;
+    GALOIS_ASSERT(support->get_support() == frequent, "pattern (",
+                  element.first.first, ", ", element.first.second,
+                  ") with minimum support ", minsup);
+    for (int i = 0; i < 2; i++) {
+      if (support->has_domain_reached_support(i)) {
+        GALOIS_ASSERT(sets[i].size() >= minsup);
+      } else {
+        GALOIS_ASSERT(support->domain_sets[i].size() == sets[i].size());
+        result.bitmaps += support->domain_sets[i].is_bitmap();
+      }
+    }
+  }
+
+  for (auto& lmap : localmaps)
+    for (auto& element : lmap)
+      delete element.second;
+  return result;
+}
+
+int main() {
+  galois::SharedMemSys sys;
+  galois::setActiveThreads(4);
+  DomainSet::set_universe(numNodes);
+
+  // label 3 is rare, so the patterns with it have small domains
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<unsigned> node(0, numNodes - 1);
+  std::vector<unsigned> labels(numNodes);
+  for (unsigned n = 0; n < numNodes; n++)
+    labels[n] = n < 6 ? 3 : node(gen) % 3;
+  std::vector<Edge> edges;
+  for (unsigned i = 0; i < 20 * numNodes; i++)
+    edges.emplace_back(std::min(node(gen), node(gen)), node(gen));
+
+  for (unsigned minsup : {1u, 4u, 30u, 100u, numNodes + 1})
+    check(edges, labels, minsup);
+
+  // small thresholds stop the aggregation early
+  GALOIS_ASSERT(check(edges, labels, 4).skipped > 0);
+  // nothing is frequent, so every domain is counted exactly, in both forms
+  Result all = check(edges, labels, numNodes + 1);
+  GALOIS_ASSERT(all.skipped == 0 && all.bitmaps > 0);
+
+  return 0;
+}
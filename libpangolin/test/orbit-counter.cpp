@@ -0,0 +1,199 @@
+#include "galois/Galois.h"
+#include "pangolin/orbit_counter.h"
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+// Counts the graphlet orbits of every vertex of small random graphs by
+// listing all their connected induced subgraphs of up to 5 vertices, and
+// compares them with the orbits OrbitCounter derives from its equations.
+
+using Edges = std::vector<std::pair<unsigned, unsigned>>;
+
+struct Graphlet {
+  unsigned size;
+  Edges edges;
+  std::vector<unsigned> orbits; // orbit of each vertex
+};
+
+// Przulj's graphlets G0 to G29, in order
+const std::vector<Graphlet> graphlets = {
+    {2, {{0, 1}}, {0, 0}},
+    {3, {{0, 1}, {1, 2}}, {1, 2, 1}},
+    {3, {{0, 1}, {1, 2}, {0, 2}}, {3, 3, 3}},
+    {4, {{0, 1}, {1, 2}, {2, 3}}, {4, 5, 5, 4}},
+    {4, {{0, 1}, {0, 2}, {0, 3}}, {7, 6, 6, 6}},
+    {4, {{0, 1}, {1, 2}, {2, 3}, {3, 0}}, {8, 8, 8, 8}},
+    {4, {{0, 1}, {1, 2}, {0, 2}, {0, 3}}, {11, 10, 10, 9}},
+    {4, {{0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}}, {13, 13, 12, 12}},
+    {4, {{0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {2, 3}}, {14, 14, 14, 14}},
+    {5, {{0, 1}, {1, 2}, {2, 3}, {3, 4}}, {15, 16, 17, 16, 15}},
+    {5, {{0, 1}, {0, 2}, {0, 3}, {3, 4}}, {21, 19, 19, 20, 18}},
+    {5, {{0, 1}, {0, 2}, {0, 3}, {0, 4}}, {23, 22, 22, 22, 22}},
+    {5, {{0, 1}, {1, 2}, {0, 2}, {0, 3}, {0, 4}}, {26, 25, 25, 24, 24}},
+    {5, {{0, 1}, {1, 2}, {0, 2}, {0, 3}, {3, 4}}, {30, 29, 29, 28, 27}},
+    {5, {{0, 1}, {1, 2}, {0, 2}, {0, 3}, {1, 4}}, {33, 33, 32, 31, 31}},
+    {5, {{0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 0}}, {34, 34, 34, 34, 34}},
+    {5, {{0, 1}, {1, 2}, {2, 3}, {3, 0}, {0, 4}}, {38, 37, 36, 37, 35}},
+    {5, {{0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {0, 4}}, {42, 41, 40, 40, 39}},
+    {5, {{0, 1}, {0, 2}, {1, 2}, {0, 3}, {0, 4}, {3, 4}}, {44, 43, 43, 43, 43}},
+    {5, {{0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {2, 4}}, {48, 48, 47, 46, 45}},
+    {5, {{0, 2}, {0, 3}, {0, 4}, {1, 2}, {1, 3}, {1, 4}}, {50, 50, 49, 49, 49}},
+    {5, {{0, 1}, {0, 2}, {1, 2}, {1, 3}, {2, 4}, {3, 4}}, {52, 53, 53, 51, 51}},
+    {5,
+     {{0, 1}, {0, 2}, {0, 3}, {0, 4}, {1, 2}, {1, 3}, {1, 4}},
+     {55, 55, 54, 54, 54}},
+    {5,
+     {{0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {2, 3}, {0, 4}},
+     {58, 57, 57, 57, 56}},
+    {5,
+     {{0, 1}, {0, 2}, {0, 3}, {0, 4}, {1, 2}, {2, 3}, {3, 4}},
+     {61, 59, 60, 60, 59}},
+    {5,
+     {{0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {2, 4}, {3, 4}},
+     {64, 64, 63, 63, 62}},
+    {5,
+     {{0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {2, 3}, {0, 4}, {1, 4}},
+     {67, 67, 66, 66, 65}},
+    {5,
+     {{0, 1}, {0, 2}, {0, 3}, {0, 4}, {1, 2}, {2, 3}, {3, 4}, {4, 1}},
+     {69, 68, 68, 68, 68}},
+    {5,
+     {{0, 1}, {0, 2}, {0, 3}, {0, 4}, {1, 2}, {1, 3}, {1, 4}, {2, 3}, {2, 4}},
+     {71, 71, 71, 70, 70}},
+    {5,
+     {{0, 1}, {0, 2}, {0, 3}, {0, 4}, {1, 2}, {1, 3}, {1, 4}, {2, 3}, {2, 4},
+      {3, 4}},
+     {72, 72, 72, 72, 72}},
+};
+
+// smallest adjacency bitmask over the orderings of the vertices that put v
+// first, which identifies the orbit of v
+unsigned orbitKey(unsigned size, const bool adj[5][5], unsigned v) {
+  std::vector<unsigned> order;
+  for (unsigned i = 0; i < size; i++)
+    if (i != v)
+      order.push_back(i);
+  unsigned best = ~0u;
+  do {
+    std::vector<unsigned> p = {v};
+    p.insert(p.end(), order.begin(), order.end());
+    unsigned key = 0;
+    for (unsigned i = 0; i < size; i++)
+      for (unsigned j = i + 1; j < size; j++)
+        key |= unsigned(adj[p[i]][p[j]]) << (i * 5 + j);
+    best = std::min(best, key);
+  } while (std::next_permutation(order.begin(), order.end()));
+  return best;
+}
+
+void check(unsigned numNodes, double density, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::bernoulli_distribution coin(density);
+  std::vector<std::vector<bool>> adj(numNodes,
+                                     std::vector<bool>(numNodes, false));
+  size_t numEdges = 0;
+  for (unsigned i = 0; i < numNodes; i++)
+    for (unsigned j = i + 1; j < numNodes; j++)
+      if (coin(gen)) {
+        adj[i][j] = adj[j][i] = true;
+        numEdges += 2;
+      }
+
+  PangolinGraph graph;
+  graph.allocateFrom(numNodes, numEdges);
+  graph.constructNodes();
+  size_t e = 0;
+  for (unsigned i = 0; i < numNodes; i++) {
+    for (unsigned j = 0; j < numNodes; j++)
+      if (adj[i][j])
+        graph.constructEdge(e++, j);
+    graph.fixEndEdge(i, e);
+  }
+
+  std::map<std::pair<unsigned, unsigned>, unsigned> orbitOf;
+  for (auto& g : graphlets) {
+    bool gadj[5][5] = {};
+    for (auto& edge : g.edges)
+      gadj[edge.first][edge.second] = gadj[edge.second][edge.first] = true;
+    for (unsigned v = 0; v < g.size; v++)
+      orbitOf[{g.size, orbitKey(g.size, gadj, v)}] = g.orbits[v];
+  }
+
+  // every subset of 2 to 5 vertices, in lexicographic order
+  const unsigned numOrbits = OrbitCounter<PangolinGraph>::num_orbits5;
+  std::vector<std::vector<uint64_t>> expected(
+      numNodes, std::vector<uint64_t>(numOrbits));
+  std::vector<uint64_t> expectedMotifs(21);
+  std::vector<unsigned> subset = {0};
+  while (!subset.empty()) {
+    unsigned size = subset.size();
+    bool sadj[5][5] = {};
+    Edges edges;
+    for (unsigned i = 0; i < size; i++)
+      for (unsigned j = i + 1; j < size; j++)
+        if (adj[subset[i]][subset[j]]) {
+          sadj[i][j] = sadj[j][i] = true;
+          edges.emplace_back(i, j);
+        }
+    unsigned reached = 1;
+    for (unsigned round = 0; round < size; round++)
+      for (unsigned i = 0; i < size; i++)
+        for (unsigned j = 0; j < size; j++)
+          if ((reached >> i & 1) && sadj[i][j])
+            reached |= 1u << j;
+    if (size >= 2 && reached == (1u << size) - 1) {
+      for (unsigned i = 0; i < size; i++)
+        expected[subset[i]][orbitOf.at({size, orbitKey(size, sadj, i)})]++;
+      if (size == 5)
+        expectedMotifs[OrbitCounter<PangolinGraph>::graphlet_index(edges)]++;
+    }
+    if (size < 5 && subset.back() + 1 < numNodes) {
+      subset.push_back(subset.back() + 1);
+      continue;
+    }
+    while (!subset.empty() && subset.back() + 1 >= numNodes)
+      subset.pop_back();
+    if (!subset.empty())
+      subset.back()++;
+  }
+
+  OrbitCounter<PangolinGraph> counter(graph, 5);
+  counter.count();
+  GALOIS_ASSERT(counter.get_num_orbits() == expected[0].size());
+  for (unsigned v = 0; v < numNodes; v++)
+    for (unsigned o = 0; o < counter.get_num_orbits(); o++)
+      GALOIS_ASSERT(counter.get_orbits(v)[o] == expected[v][o], "orbit ", o,
+                    " of vertex ", v, " is ", counter.get_orbits(v)[o],
+                    " instead of ", expected[v][o], " at density ", density);
+  GALOIS_ASSERT(counter.motif_counts(5) == expectedMotifs);
+
+  // the 4-vertex counter agrees on the orbits they share
+  OrbitCounter<PangolinGraph> counter4(graph);
+  counter4.count();
+  for (unsigned v = 0; v < numNodes; v++)
+    GALOIS_ASSERT(std::equal(counter4.get_orbits(v),
+                             counter4.get_orbits(v) +
+                                 OrbitCounter<PangolinGraph>::num_orbits4,
+                             counter.get_orbits(v)));
+}
+
+int main() {
+  galois::SharedMemSys sys;
+  galois::setActiveThreads(4);
+
+  // the table above lists G9 to G29 in the order of motif_counts(5)
+  for (unsigned g = 9; g < graphlets.size(); g++)
+    GALOIS_ASSERT(OrbitCounter<PangolinGraph>::graphlet_index(
+                      graphlets[g].edges) == g - 9);
+
+  // sparse graphs have the paths and stars, dense ones the cliques
+  check(24, 0.15, 1);
+  check(18, 0.4, 2);
+  check(14, 0.8, 3);
+
+  return 0;
+}
@@ -18,19 +18,15 @@
  */
 
 #include "galois/Galois.h"
-#include "galois/gstl.h"
 #include "galois/Reduction.h"
 #include "galois/Timer.h"
 #include "galois/graphs/LCGraph.h"
-#include "galois/graphs/TypeTraits.h"
 #include "Lonestar/BoilerPlate.h"
-#include "Lonestar/BFS_SSSP.h"
+#include "Lonestar/Analytics/BFS.h"
 
 #include "llvm/Support/CommandLine.h"
 
 #include <iostream>
-#include <deque>
-#include <type_traits>
 
 namespace cll = llvm::cl;
 
@@ -59,9 +55,7 @@ static cll::opt<unsigned int>
 
 enum Exec { SERIAL, PARALLEL };
 
-enum Algo { AsyncTile = 0, Async, SyncTile, Sync };
-
-const char* const ALGO_NAMES[] = {"AsyncTile", "Async", "SyncTile", "Sync"};
+using lonestar::analytics::BFSPlan;
 
 static cll::opt<Exec> execution(
     "exec",
@@ -69,11 +63,13 @@ static cll::opt<Exec> execution(
     cll::values(clEnumVal(SERIAL, "SERIAL"), clEnumVal(PARALLEL, "PARALLEL")),
     cll::init(PARALLEL));
 
-static cll::opt<Algo> algo(
+static cll::opt<BFSPlan::Algorithm> algo(
     "algo", cll::desc("Choose an algorithm (default value SyncTile):"),
-    cll::values(clEnumVal(AsyncTile, "AsyncTile"), clEnumVal(Async, "Async"),
-                clEnumVal(SyncTile, "SyncTile"), clEnumVal(Sync, "Sync")),
-    cll::init(SyncTile));
+    cll::values(clEnumValN(BFSPlan::asyncTile, "AsyncTile", "AsyncTile"),
+                clEnumValN(BFSPlan::async, "Async", "Async"),
+                clEnumValN(BFSPlan::syncTile, "SyncTile", "SyncTile"),
+                clEnumValN(BFSPlan::sync, "Sync", "Sync")),
+    cll::init(BFSPlan::syncTile));
 
 using Graph =
     galois::graphs::LC_CSR_Graph<unsigned, void>::with_no_lockable<true>::type;
@@ -81,241 +77,7 @@ using Graph =
 
 using GNode = Graph::GraphNode;
 
-constexpr static const bool TRACK_WORK          = false;
-constexpr static const unsigned CHUNK_SIZE      = 256U;
-constexpr static const ptrdiff_t EDGE_TILE_SIZE = 256;
-
-using BFS = BFS_SSSP<Graph, unsigned int, false, EDGE_TILE_SIZE>;
-
-using UpdateRequest       = BFS::UpdateRequest;
-using Dist                = BFS::Dist;
-using SrcEdgeTile         = BFS::SrcEdgeTile;
-using SrcEdgeTileMaker    = BFS::SrcEdgeTileMaker;
-using SrcEdgeTilePushWrap = BFS::SrcEdgeTilePushWrap;
-using ReqPushWrap         = BFS::ReqPushWrap;
-using OutEdgeRangeFn      = BFS::OutEdgeRangeFn;
-using TileRangeFn         = BFS::TileRangeFn;
-
-struct EdgeTile {
-  Graph::edge_iterator beg;
-  Graph::edge_iterator end;
-};
-
-struct EdgeTileMaker {
-  EdgeTile operator()(Graph::edge_iterator beg,
-                      Graph::edge_iterator end) const {
-    return EdgeTile{beg, end};
-  }
-};
-
-struct NodePushWrap {
-
-  template <typename C>
-  void operator()(C& cont, const GNode& n, const char* const) const {
-    (*this)(cont, n);
-  }
-
-  template <typename C>
-  void operator()(C& cont, const GNode& n) const {
-    cont.push(n);
-  }
-};
-
-struct EdgeTilePushWrap {
-  Graph& graph;
-
-  template <typename C>
-  void operator()(C& cont, const GNode& n, const char* const) const {
-    BFS::pushEdgeTilesParallel(cont, graph, n, EdgeTileMaker{});
-  }
-
-  template <typename C>
-  void operator()(C& cont, const GNode& n) const {
-    BFS::pushEdgeTiles(cont, graph, n, EdgeTileMaker{});
-  }
-};
-
-struct OneTilePushWrap {
-  Graph& graph;
-
-  template <typename C>
-  void operator()(C& cont, const GNode& n, const char* const) const {
-    (*this)(cont, n);
-  }
-
-  template <typename C>
-  void operator()(C& cont, const GNode& n) const {
-    EdgeTile t{graph.edge_begin(n, galois::MethodFlag::UNPROTECTED),
-               graph.edge_end(n, galois::MethodFlag::UNPROTECTED)};
-
-    cont.push(t);
-  }
-};
-
-template <bool CONCURRENT, typename T, typename P, typename R>
-void asyncAlgo(Graph& graph, GNode source, const P& pushWrap,
-               const R& edgeRange) {
-
-  namespace gwl = galois::worklists;
-  // typedef PerSocketChunkFIFO<CHUNK_SIZE> dFIFO;
-  using FIFO = gwl::PerSocketChunkFIFO<CHUNK_SIZE>;
-  using BSWL = gwl::BulkSynchronous<gwl::PerSocketChunkLIFO<CHUNK_SIZE>>;
-  using WL   = FIFO;
-
-  using Loop =
-      typename std::conditional<CONCURRENT, galois::ForEach,
-                                galois::WhileQ<galois::SerFIFO<T>>>::type;
-
-  GALOIS_GCC7_IGNORE_UNUSED_BUT_SET
-  constexpr bool useCAS = CONCURRENT && !std::is_same<WL, BSWL>::value;
-  GALOIS_END_GCC7_IGNORE_UNUSED_BUT_SET
-
-  Loop loop;
-
-  galois::GAccumulator<size_t> BadWork;
-  galois::GAccumulator<size_t> WLEmptyWork;
-
-  graph.getData(source) = 0;
-  galois::InsertBag<T> initBag;
-
-  if (CONCURRENT) {
-    pushWrap(initBag, source, 1, "parallel");
-  } else {
-    pushWrap(initBag, source, 1);
-  }
-
-  loop(
-      galois::iterate(initBag),
-      [&](const T& item, auto& ctx) {
-        constexpr galois::MethodFlag flag = galois::MethodFlag::UNPROTECTED;
-
-        const auto& sdist = graph.getData(item.src, flag);
-
-        if (TRACK_WORK) {
-          if (item.dist != sdist) {
-            WLEmptyWork += 1;
-            return;
-          }
-        }
-
-        const auto newDist = item.dist;
-
-        for (auto ii : edgeRange(item)) {
-          GNode dst   = graph.getEdgeDst(ii);
-          auto& ddata = graph.getData(dst, flag);
-
-          while (true) {
-
-            Dist oldDist = ddata;
-
-            if (oldDist <= newDist) {
-              break;
-            }
-
-            if (!useCAS ||
-                __sync_bool_compare_and_swap(&ddata, oldDist, newDist)) {
-
-              if (!useCAS) {
-                ddata = newDist;
-              }
-
-              if (TRACK_WORK) {
-                if (oldDist != BFS::DIST_INFINITY) {
-                  BadWork += 1;
-                }
-              }
-
-              pushWrap(ctx, dst, newDist + 1);
-              break;
-            }
-          }
-        }
-      },
-      galois::wl<WL>(), galois::loopname("runBFS"),
-      galois::disable_conflict_detection());
-
-  if (TRACK_WORK) {
-    galois::runtime::reportStat_Single("BFS", "BadWork", BadWork.reduce());
-    galois::runtime::reportStat_Single("BFS", "EmptyWork",
-                                       WLEmptyWork.reduce());
-  }
-}
-
-template <bool CONCURRENT, typename T, typename P, typename R>
-void syncAlgo(Graph& graph, GNode source, const P& pushWrap,
-              const R& edgeRange) {
-
-  using Cont = typename std::conditional<CONCURRENT, galois::InsertBag<T>,
-                                         galois::SerStack<T>>::type;
-  using Loop = typename std::conditional<CONCURRENT, galois::DoAll,
-                                         galois::StdForEach>::type;
-
-  constexpr galois::MethodFlag flag = galois::MethodFlag::UNPROTECTED;
-
-  Loop loop;
-
-  auto curr = std::make_unique<Cont>();
-  auto next = std::make_unique<Cont>();
-
-  Dist nextLevel              = 0U;
-  graph.getData(source, flag) = 0U;
-
-  if (CONCURRENT) {
-    pushWrap(*next, source, "parallel");
-  } else {
-    pushWrap(*next, source);
-  }
-
-  assert(!next->empty());
-
-  while (!next->empty()) {
-
-    std::swap(curr, next);
-    next->clear();
-    ++nextLevel;
-
-    loop(
-        galois::iterate(*curr),
-        [&](const T& item) {
-          for (auto e : edgeRange(item)) {
-            auto dst      = graph.getEdgeDst(e);
-            auto& dstData = graph.getData(dst, flag);
-
-            if (dstData == BFS::DIST_INFINITY) {
-              dstData = nextLevel;
-              pushWrap(*next, dst);
-            }
-          }
-        },
-        galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
-        galois::loopname("Sync"));
-  }
-}
-
-template <bool CONCURRENT>
-void runAlgo(Graph& graph, const GNode& source) {
-
-  switch (algo) {
-  case AsyncTile:
-    asyncAlgo<CONCURRENT, SrcEdgeTile>(
-        graph, source, SrcEdgeTilePushWrap{graph}, TileRangeFn());
-    break;
-  case Async:
-    asyncAlgo<CONCURRENT, UpdateRequest>(graph, source, ReqPushWrap(),
-                                         OutEdgeRangeFn{graph});
-    break;
-  case SyncTile:
-    syncAlgo<CONCURRENT, EdgeTile>(graph, source, EdgeTilePushWrap{graph},
-                                   TileRangeFn());
-    break;
-  case Sync:
-    syncAlgo<CONCURRENT, GNode>(graph, source, NodePushWrap(),
-                                OutEdgeRangeFn{graph});
-    break;
-  default:
-    std::cerr << "ERROR: unkown algo type\n";
-  }
-}
+using BFS = BFS_SSSP<Graph, unsigned int, false>;
 
 int main(int argc, char** argv) {
   galois::SharedMemSys G;
@@ -352,24 +114,20 @@ int main(int argc, char** argv) {
 
   galois::reportPageAlloc("MeminfoPre");
 
-  galois::do_all(galois::iterate(graph),
-                 [&graph](GNode n) { graph.getData(n) = BFS::DIST_INFINITY; });
-  graph.getData(source) = 0;
-
-  std::cout << "Running " << ALGO_NAMES[algo] << " algorithm with "
+  std::cout << "Running " << lonestar::analytics::algorithmName(algo)
+            << " algorithm with "
             << (bool(execution) ? "PARALLEL" : "SERIAL") << " execution\n";
 
-  galois::StatTimer execTime("Timer_0");
-  execTime.start();
+  lonestar::analytics::initBFS(graph);
 
-  if (execution == SERIAL) {
-    runAlgo<false>(graph, source);
-  } else if (execution == PARALLEL) {
-    runAlgo<true>(graph, source);
-  } else {
-    std::cerr << "ERROR: unknown type of execution passed to -exec\n";
-  }
+  BFSPlan plan;
+  plan.algorithm  = algo;
+  plan.parallel   = execution == PARALLEL;
+  plan.initialize = false;
 
+  galois::StatTimer execTime("Timer_0");
+  execTime.start();
+  lonestar::analytics::bfs(graph, source, plan);
   execTime.stop();
 
   galois::reportPageAlloc("MeminfoPost");
@@ -18,28 +18,17 @@
  */
 
 #include "galois/Galois.h"
-#include "galois/AtomicHelpers.h"
-#include "galois/DynamicBitset.h"
-#include "galois/gstl.h"
-#include "galois/Reduction.h"
 #include "galois/Timer.h"
-#include "galois/graphs/LCGraph.h"
-#include "galois/graphs/TypeTraits.h"
 #include "galois/graphs/LC_CSR_CSC_Graph.h"
 #include "galois/runtime/Profile.h"
-#include "Lonestar/BFS_SSSP.h"
-#include "Lonestar/Utils.h"
 #include "Lonestar/BoilerPlate.h"
+#include "Lonestar/Analytics/BFS.h"
 
 #include "llvm/Support/CommandLine.h"
 
-#include <stdio.h>
-#include <sys/time.h>
-#include <sys/resource.h>
 #include <iostream>
-#include <deque>
-#include <type_traits>
 #include <cstdlib>
+#include <string>
 
 namespace cll = llvm::cl;
 
@@ -89,9 +78,7 @@ static cll::opt<unsigned int>
 
 enum Exec { SERIAL, PARALLEL };
 
-enum Algo { SyncDO = 0, Async, AutoAlgo };
-
-const char* const ALGO_NAMES[] = {"SyncDO", "Async", "Auto"};
+using lonestar::analytics::BFSDirectionOptPlan;
 
 static cll::opt<Exec> execution(
     "exec",
@@ -99,13 +86,14 @@ static cll::opt<Exec> execution(
     cll::values(clEnumVal(SERIAL, "SERIAL"), clEnumVal(PARALLEL, "PARALLEL")),
     cll::init(PARALLEL));
 
-static cll::opt<Algo>
-    algo("algo", cll::desc("Choose an algorithm (default value Auto):"),
-         cll::values(
-             clEnumVal(SyncDO, "SyncDO"), clEnumVal(Async, "Async"),
-             clEnumVal(AutoAlgo,
-                       "Auto: choose between SyncDO and Async automatically")),
-         cll::init(AutoAlgo));
+static cll::opt<BFSDirectionOptPlan::Algorithm> algo(
+    "algo", cll::desc("Choose an algorithm (default value Auto):"),
+    cll::values(
+        clEnumValN(BFSDirectionOptPlan::syncDO, "SyncDO", "SyncDO"),
+        clEnumValN(BFSDirectionOptPlan::async, "Async", "Async"),
+        clEnumValN(BFSDirectionOptPlan::automatic, "AutoAlgo",
+                   "Auto: choose between SyncDO and Async automatically")),
+    cll::init(BFSDirectionOptPlan::automatic));
 
 using Graph =
     // galois::graphs::LC_CSR_CSC_Graph<unsigned, void, false, true, true>;
@@ -114,298 +102,6 @@ using Graph =
 // void>::with_no_lockable<true>::type::with_numa_alloc<true>::type;
 using GNode = Graph::GraphNode;
 
-constexpr static const unsigned CHUNK_SIZE      = 256u;
-constexpr static const ptrdiff_t EDGE_TILE_SIZE = 256;
-
-using BFS            = BFS_SSSP<Graph, unsigned int, false, EDGE_TILE_SIZE>;
-using UpdateRequest  = BFS::UpdateRequest;
-using Dist           = BFS::Dist;
-using OutEdgeRangeFn = BFS::OutEdgeRangeFn;
-
-struct EdgeTile {
-  Graph::edge_iterator beg;
-  Graph::edge_iterator end;
-};
-
-struct EdgeTileMaker {
-  EdgeTile operator()(Graph::edge_iterator beg,
-                      Graph::edge_iterator end) const {
-    return EdgeTile{beg, end};
-  }
-};
-
-struct NodePushWrap {
-
-  template <typename C>
-  void operator()(C& cont, const GNode& n, const char* const) const {
-    (*this)(cont, n);
-  }
-
-  template <typename C>
-  void operator()(C& cont, const GNode& n) const {
-    cont.push(n);
-  }
-};
-
-struct EdgeTilePushWrap {
-  Graph& graph;
-
-  template <typename C>
-  void operator()(C& cont, const GNode& n, const char* const) const {
-    BFS::pushEdgeTilesParallel(cont, graph, n, EdgeTileMaker{});
-  }
-
-  template <typename C>
-  void operator()(C& cont, const GNode& n) const {
-    BFS::pushEdgeTiles(cont, graph, n, EdgeTileMaker{});
-  }
-};
-
-struct OneTilePushWrap {
-  Graph& graph;
-
-  template <typename C>
-  void operator()(C& cont, const GNode& n, const char* const) const {
-    (*this)(cont, n);
-  }
-
-  template <typename C>
-  void operator()(C& cont, const GNode& n) const {
-    EdgeTile t{graph.edge_begin(n, galois::MethodFlag::UNPROTECTED),
-               graph.edge_end(n, galois::MethodFlag::UNPROTECTED)};
-
-    cont.push(t);
-  }
-};
-
-template <typename WL>
-void WlToBitset(WL& wl, galois::DynamicBitSet& bitset) {
-  galois::do_all(
-      galois::iterate(wl), [&](const GNode& src) { bitset.set(src); },
-      galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
-      galois::loopname("WlToBitset"));
-}
-
-template <typename WL>
-void BitsetToWl(const Graph& graph, const galois::DynamicBitSet& bitset,
-                WL& wl) {
-  wl.clear();
-  galois::do_all(
-      galois::iterate(graph),
-      [&](const GNode& src) {
-        if (bitset.test(src))
-          // pushWrap(wl, src);
-          wl.push(src);
-      },
-      galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
-      galois::loopname("BitsetToWl"));
-}
-
-template <bool CONCURRENT, typename T, typename P, typename R>
-void syncDOAlgo(Graph& graph, GNode source, const P& pushWrap,
-                const R& GALOIS_UNUSED(edgeRange), const uint32_t runID) {
-
-  using Cont = typename std::conditional<CONCURRENT, galois::InsertBag<T>,
-                                         galois::SerStack<T>>::type;
-  using Loop = typename std::conditional<CONCURRENT, galois::DoAll,
-                                         galois::StdForEach>::type;
-
-  constexpr galois::MethodFlag flag = galois::MethodFlag::UNPROTECTED;
-  galois::GAccumulator<uint32_t> work_items;
-
-  Loop loop;
-
-  galois::DynamicBitSet front_bitset, next_bitset;
-  front_bitset.resize(graph.size());
-  next_bitset.resize(graph.size());
-
-  front_bitset.reset();
-  next_bitset.reset();
-
-  Cont* curr = new Cont();
-  Cont* next = new Cont();
-
-  Dist nextLevel              = 0u;
-  graph.getData(source, flag) = 0u;
-
-  if (CONCURRENT) {
-    pushWrap(*next, source, "parallel");
-  } else {
-    pushWrap(*next, source);
-  }
-  // adding source to the worklist
-  work_items += 1;
-  // next_bitset.set(source);
-
-  int64_t edges_to_check = graph.sizeEdges();
-  int64_t scout_count =
-      std::distance(graph.edge_begin(source), graph.edge_end(source));
-  galois::gPrint("source: ", source, " has OutDegree:", scout_count, "\n");
-  assert(!next->empty());
-
-  uint64_t old_workItemNum = 0;
-  uint64_t numNodes        = graph.size();
-  // uint32_t c_pull = 0, c_push = 0;
-  galois::GAccumulator<uint64_t> writes_pull, writes_push;
-  writes_push.reset();
-  writes_pull.reset();
-  // std::vector<uint32_t> pull_levels;
-  // pull_levels.reserve(10);
-
-  while (!next->empty()) {
-
-    std::swap(curr, next);
-    next->clear();
-    if (scout_count > edges_to_check / alpha) {
-
-      WlToBitset(*curr, front_bitset);
-      do {
-        // c_pull++;
-        // pull_levels.push_back(nextLevel);
-
-        ++nextLevel;
-        old_workItemNum = work_items.reduce();
-        work_items.reset();
-
-        // PULL from in-edges
-        loop(
-            galois::iterate(graph),
-            [&](const T& dst) {
-              auto& ddata = graph.getData(dst, flag);
-              if (ddata == BFS::DIST_INFINITY) {
-                for (auto e : graph.in_edges(dst)) {
-                  auto src = graph.getInEdgeDst(e);
-
-                  if (front_bitset.test(src)) {
-                    /*
-                     * Currently assigning parents on the bfs path.
-                     * Assign nextLevel (uncomment below)
-                     */
-                    // ddata = nextLevel;
-                    ddata = src;
-                    next_bitset.set(dst);
-                    work_items += 1;
-                    break;
-                  }
-                }
-              }
-            },
-            galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
-            galois::loopname(
-                (std::string("Sync-pull_") + std::to_string(runID)).c_str()));
-
-        std::swap(front_bitset, next_bitset);
-        next_bitset.reset();
-      } while (work_items.reduce() >= old_workItemNum ||
-               (work_items.reduce() > numNodes / beta));
-
-      BitsetToWl(graph, front_bitset, *next);
-      scout_count = 1;
-    } else {
-      // c_push++;
-      ++nextLevel;
-      edges_to_check -= scout_count;
-      work_items.reset();
-      // PUSH to out-edges
-      loop(
-          galois::iterate(*curr),
-          [&](const T& src) {
-            for (auto e : graph.edges(src)) {
-              auto dst    = graph.getEdgeDst(e);
-              auto& ddata = graph.getData(dst, flag);
-
-              if (ddata == BFS::DIST_INFINITY) {
-                Dist oldDist = ddata;
-                /*
-                 * Currently assigning parents on the bfs path.
-                 * Assign nextLevel (uncomment below)
-                 */
-                // if(__sync_bool_compare_and_swap(&ddata, oldDist, nextLevel))
-                // {
-                if (__sync_bool_compare_and_swap(&ddata, oldDist, src)) {
-                  next->push(dst);
-                  work_items += (graph.edge_end(dst) - graph.edge_begin(dst));
-                }
-              }
-            }
-          },
-          galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
-          galois::loopname(
-              (std::string("Sync-push_") + std::to_string(runID)).c_str()));
-
-      scout_count = work_items.reduce();
-    }
-  }
-
-  delete curr;
-  delete next;
-}
-
-template <bool CONCURRENT, typename T, typename P, typename R>
-void asyncAlgo(Graph& graph, GNode source, const P& pushWrap,
-               const R& GALOIS_UNUSED(edgeRange)) {
-
-  namespace gwl = galois::worklists;
-  // typedef PerSocketChunkFIFO<CHUNK_SIZE> dFIFO;
-  using FIFO = gwl::PerSocketChunkFIFO<CHUNK_SIZE>;
-  using WL   = FIFO;
-
-  using Loop =
-      typename std::conditional<CONCURRENT, galois::ForEach,
-                                galois::WhileQ<galois::SerFIFO<T>>>::type;
-
-  Loop loop;
-
-  galois::GAccumulator<size_t> BadWork;
-  galois::GAccumulator<size_t> WLEmptyWork;
-
-  graph.getData(source) = 0;
-  galois::InsertBag<T> initBag;
-
-  if (CONCURRENT) {
-    pushWrap(initBag, source, "parallel");
-  } else {
-    pushWrap(initBag, source);
-  }
-
-  loop(
-      galois::iterate(initBag),
-      [&](const GNode& src, auto& ctx) {
-        constexpr galois::MethodFlag flag = galois::MethodFlag::UNPROTECTED;
-
-        for (auto ii : graph.edges(src)) {
-          GNode dst   = graph.getEdgeDst(ii);
-          auto& ddata = graph.getData(dst, flag);
-
-          if (ddata == BFS::DIST_INFINITY) {
-            Dist oldDist = ddata;
-            if (__sync_bool_compare_and_swap(&ddata, oldDist, src)) {
-              ctx.push(dst);
-            }
-          }
-        }
-      },
-      galois::wl<WL>(), galois::loopname("runBFS"),
-      galois::disable_conflict_detection());
-}
-
-template <bool CONCURRENT>
-void runAlgo(Graph& graph, const GNode& source, const uint32_t runID) {
-  switch (algo) {
-  case SyncDO:
-    syncDOAlgo<CONCURRENT, GNode>(graph, source, NodePushWrap(),
-                                  OutEdgeRangeFn{graph}, runID);
-    break;
-  case Async:
-    asyncAlgo<CONCURRENT, GNode>(graph, source, NodePushWrap(),
-                                 OutEdgeRangeFn{graph});
-    break;
-
-  default:
-    std::cerr << "ERROR: unkown algo type\n";
-  }
-}
-
 int main(int argc, char** argv) {
   galois::SharedMemSys G;
   LonestarStart(argc, argv, name, desc, url, &inputFile);
@@ -442,18 +138,14 @@ int main(int argc, char** argv) {
   galois::gPrint("Fixed preAlloc done : ", preAlloc, "\n");
   galois::reportPageAlloc("MeminfoPre");
 
-  galois::do_all(galois::iterate(graph),
-                 [&graph](GNode n) { graph.getData(n) = BFS::DIST_INFINITY; });
-
-  graph.getData(source) = 0;
-
-  std::cout << "Running " << ALGO_NAMES[algo] << " algorithm with "
+  std::cout << "Running " << lonestar::analytics::algorithmName(algo)
+            << " algorithm with "
             << (bool(execution) ? "PARALLEL" : "SERIAL") << " execution\n";
 
   std::cout
       << "WARNING: This bfs version uses bi-directional CSR graph "
       << "and assigns parent instead of the shortest distance from source\n";
-  if (algo == Async) {
+  if (algo == BFSDirectionOptPlan::async) {
     std::cout << "WARNING: Async bfs does not use direction optimization. "
               << "It uses Galois for_each for asynchronous execution which is "
                  "advantageous "
@@ -462,45 +154,54 @@ int main(int argc, char** argv) {
 
   std::cout << " Execution started\n";
 
+  lonestar::analytics::initBFS(graph);
+
   galois::StatTimer autoAlgoTimer("AutoAlgo_0");
   galois::StatTimer execTime("Timer_0");
   execTime.start();
 
-  if (algo == AutoAlgo) {
+  if (algo == BFSDirectionOptPlan::automatic) {
     autoAlgoTimer.start();
-    if (isApproximateDegreeDistributionPowerLaw(graph)) {
-      algo = SyncDO;
-    } else {
-      algo = Async;
-    }
+    algo = lonestar::analytics::chooseBFSDirectionOptAlgorithm(graph);
     autoAlgoTimer.stop();
-    galois::gInfo("Choosing ", ALGO_NAMES[algo], " algorithm");
+    galois::gInfo("Choosing ", lonestar::analytics::algorithmName(algo),
+                  " algorithm");
   }
 
+  BFSDirectionOptPlan plan;
+  plan.algorithm  = algo;
+  plan.alpha      = alpha;
+  plan.beta       = beta;
+  plan.parallel   = execution == PARALLEL;
+  plan.initialize = false;
+
   for (unsigned int run = 0; run < numRuns; ++run) {
     galois::gPrint("BFS::go run ", run, " called\n");
     std::string timer_str("Timer_Run" + std::to_string(run));
     galois::StatTimer StatTimer_main(timer_str.c_str(), "BFS");
     StatTimer_main.start();
 
+    if (algo == BFSDirectionOptPlan::syncDO) {
+      galois::gPrint("source: ", source, " has OutDegree:",
+                     std::distance(graph.edge_begin(source),
+                                   graph.edge_end(source)),
+                     "\n");
+    }
+
     if (execution == SERIAL) {
-      runAlgo<false>(graph, source, run);
-    } else if (execution == PARALLEL) {
-      galois::runtime::profileVtune(
-          [&]() { runAlgo<true>(graph, source, run); }, "runAlgo");
+      lonestar::analytics::bfsDirectionOpt(graph, source, plan, run);
     } else {
-      std::cerr << "ERROR: unknown type of execution passed to -exec\n";
-      std::abort();
+      galois::runtime::profileVtune(
+          [&]() {
+            lonestar::analytics::bfsDirectionOpt(graph, source, plan, run);
+          },
+          "runAlgo");
     }
 
     StatTimer_main.stop();
 
     if ((run + 1) != numRuns) {
-      for (unsigned int i = 0; i < 1; ++i) {
-        galois::do_all(galois::iterate(graph), [&graph](GNode n) {
-          graph.getData(n) = BFS::DIST_INFINITY;
-        });
-      }
+      lonestar::analytics::initBFS(graph);
     }
   }
 
@@ -22,6 +22,7 @@
 #include "galois/Timer.h"
 #include "Lonestar/BoilerPlate.h"
 #include "galois/graphs/FileGraph.h"
+#include "galois/graphs/HypergraphIO.h"
 #include "galois/LargeArray.h"
 
 #include <vector>
@@ -94,6 +95,17 @@ static cll::opt<bool>
                 cll::desc("Specify that the input graph is a hMetis"),
                 cll::init(false));
 
+static cll::opt<galois::graphs::HypergraphFormat> inputFormat(
+    "inputFormat", cll::desc("Format of the input hypergraph:"),
+    cll::values(clEnumValN(galois::graphs::HypergraphFormat::hMetis, "hmetis",
+                           "hMetis text, with optional net and node weights "
+                           "(default)"),
+                clEnumValN(galois::graphs::HypergraphFormat::PaToH, "patoh",
+                           "PaToH text"),
+                clEnumValN(galois::graphs::HypergraphFormat::Binary, "binary",
+                           "binary hypergraph from graph-convert")),
+    cll::init(galois::graphs::HypergraphFormat::hMetis));
+
 static cll::opt<bool>
     output("output", cll::desc("Specify if partitions need to be written"),
            cll::init(false));
@@ -162,7 +174,7 @@ int computingCut(GGraph& g) {
           int part = g.getData(c).getPart();
           nump.insert(part);
         }
-        edgecut += (nump.size() - 1);
+        edgecut += (nump.size() - 1) * g.getData(n).getNetWeight();
       },
       galois::loopname("cutsize"));
   return edgecut.reduce();
@@ -226,7 +238,8 @@ int main(int argc, char** argv) {
   galois::StatTimer totalTime("TimerTotal");
   totalTime.start();
 
-  if (!hMetisGraph) {
+  if (inputFormat == galois::graphs::HypergraphFormat::hMetis &&
+      !hMetisGraph) {
     GALOIS_DIE("This application requires a hMetis graph input;"
                " please use the -hMetisGraph flag "
                " to indicate the input is a hMetisGraph graph.");
@@ -235,62 +248,35 @@ int main(int argc, char** argv) {
   // srand(-1);
   MetisGraph metisGraph;
   GGraph& graph = *metisGraph.getGraph();
-  std::ifstream f(inputFile.c_str());
-  // GGraph graph;// = *metisGraph.getGraph();
-  std::string line;
-  std::getline(f, line);
-  std::stringstream ss(line);
-  uint32_t i1;
-  uint64_t i2;
-  ss >> i1 >> i2;
-  const uint32_t hedges = i1;
-  const uint64_t nodes  = i2;
-  std::cout << "hedges: " << hedges << "\n";
-  std::cout << "nodes: " << nodes << "\n\n";
 
   galois::StatTimer T("buildingG");
   T.start();
-  // read rest of input and initialize hedges (build hgraph)
-  galois::gstl::Vector<galois::PODResizeableArray<uint32_t>> edges_id(hedges +
-                                                                      nodes);
-  std::vector<std::vector<EdgeTy>> edges_data(hedges + nodes);
-  std::vector<uint64_t> prefix_edges(nodes + hedges);
-  uint32_t cnt   = 0;
-  uint32_t edges = 0;
-  while (std::getline(f, line)) {
-    if (cnt >= hedges) {
-      printf("ERROR: too many lines in input file\n");
-      exit(-1);
-    }
-    std::stringstream ss(line);
-    int val;
-    while (ss >> val) {
-      if ((val < 1) || (val > static_cast<long>(nodes))) {
-        printf("ERROR: node value %d out of bounds\n", val);
-        exit(-1);
-      }
-      unsigned newval = hedges + (val - 1);
-      edges_id[cnt].push_back(newval);
-      edges++;
-    }
-    cnt++;
-  }
-  f.close();
+  galois::graphs::HypergraphCSR hg =
+      galois::graphs::readHypergraph(inputFile, inputFormat);
+  const uint32_t hedges = hg.numNets;
+  const uint64_t nodes  = hg.numNodes;
+  std::cout << "hedges: " << hedges << "\n";
+  std::cout << "nodes: " << nodes << "\n\n";
+  std::cout << "number of edges " << hg.numPins() << "\n";
+
+  // hedges come first and own all edges; nodes have none
+  uint32_t sizes = hedges + nodes;
+  graph.allocateFrom(sizes, hg.numPins());
+  graph.constructNodes();
   graph.hedges = hedges;
   graph.hnodes = nodes;
-  std::cout << "number of edges " << edges << "\n";
-  uint32_t sizes = hedges + nodes;
-  galois::do_all(galois::iterate(uint32_t{0}, sizes),
-                 [&](uint32_t c) { prefix_edges[c] = edges_id[c].size(); });
-
-  for (uint64_t c = 1; c < nodes + hedges; ++c) {
-    prefix_edges[c] += prefix_edges[c - 1];
-  }
-  // edges = #edges, hedgecount = how many edges each node has, edges_id: for
-  // each node, which ndoes it is connected to edges_data: data for each edge =
-  // 1
-  graph.constructFrom(nodes + hedges, edges, prefix_edges, edges_id,
-                      edges_data);
+  galois::do_all(
+      galois::iterate(uint32_t{0}, sizes),
+      [&](uint32_t n) {
+        graph.fixEndEdge(n, n < hedges ? hg.netEnd[n] : hg.numPins());
+        for (uint64_t e = n < hedges ? hg.netBegin(n) : 0,
+                      end = n < hedges ? hg.netEnd[n] : 0;
+             e < end; ++e) {
+          graph.constructEdge(e, hedges + hg.pins[e], 1);
+        }
+      },
+      galois::steal(), galois::loopname("BuildHypergraph"));
+  graph.initializeLocalRanges();
   galois::do_all(galois::iterate(graph), [&](GNode n) {
     if (n < hedges)
       graph.getData(n).netnum = n + 1;
@@ -299,6 +285,10 @@ int main(int argc, char** argv) {
     graph.getData(n).netrand = INT_MAX;
     graph.getData(n).netval  = INT_MAX;
     graph.getData(n).nodeid  = n + 1;
+    if (n < hedges && hg.hasNetWeights())
+      graph.getData(n).setNetWeight(hg.netWeights[n]);
+    else if (n >= hedges && hg.hasNodeWeights())
+      graph.getData(n).setWeight(hg.nodeWeights[n - hedges]);
   });
   T.stop();
   std::cout << "time to build a graph " << T.get() << "\n";
@@ -391,7 +381,7 @@ int main(int argc, char** argv) {
             galois::iterate(uint32_t{0}, totalnodes),
             [&](uint32_t c) {
               pre_edges[c] = edges_ids[c].size();
-              num_edges_acc += prefix_edges[c];
+              num_edges_acc += pre_edges[c];
             },
             galois::steal());
         edges = num_edges_acc.reduce();
@@ -410,6 +400,11 @@ int main(int argc, char** argv) {
           gr.getData(n).netval  = INT_MAX;
           gr.getData(n).nodeid  = n + 1;
         });
+        // carry the node weights into the sub-hypergraph; net weights are
+        // only read by the cut, which is measured on the input graph
+        for (auto n : nodesvec) {
+          gr.getData(nodemap[n]).setWeight(graph.getData(n).getWeight());
+        }
         Partition(&metisG, 25, kValue[i]);
         MetisGraph* mcg = &metisG;
 
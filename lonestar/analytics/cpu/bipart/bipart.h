@@ -114,6 +114,10 @@ public:
   int getWeight() const { return _weight; }
   void setWeight(int weight) { _weight = weight; }
 
+  //! input weight of a hyperedge; only the reported cut reads it
+  int getNetWeight() const { return _netWeight; }
+  void setNetWeight(int weight) { _netWeight = weight; }
+
   void setParent(GNode p) { data.cd.parent = p; }
   GNode getParent() const {
     assert(data.cd.parent);
@@ -152,6 +156,7 @@ private:
 
   std::vector<GNode> children;
   unsigned _weight;
+  unsigned _netWeight = 1;
 };
 
 // Structure to keep track of graph hirarchy
@@ -663,7 +663,7 @@ void printNodeClusterId(GraphTy& graph, std::string output_CID_filename) {
 }
 
 template <typename GraphTy, typename CommArrayTy>
-void checkModularity(GraphTy& graph, largeArray& clusters_orig) {
+double checkModularity(GraphTy& graph, largeArray& clusters_orig) {
   using GNode = typename GraphTy::GraphNode;
   galois::gPrint("checkModularity\n");
 
@@ -676,6 +676,7 @@ void checkModularity(GraphTy& graph, largeArray& clusters_orig) {
                  "\n");
   auto mod = calModularityFinal<GraphTy, CommArrayTy>(graph);
   galois::gPrint("FINAL MOD: ", mod, "\n");
+  return mod;
 }
 
 /***********************************************
@@ -0,0 +1,242 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#include "galois/Galois.h"
+#include "galois/graphs/LCGraph.h"
+#include "Lonestar/BoilerPlate.h"
+#include "Lonestar/Analytics/CommunityQuality.h"
+
+#include "llvm/Support/CommandLine.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+constexpr static const char* const REGION_NAME = "ClusteringQuality";
+constexpr static const char* const name        = "Clustering Quality";
+constexpr static const char* const desc =
+    "Evaluates a vertex-to-community assignment: modularity, coverage, "
+    "conductance, community sizes and agreement with a ground truth";
+
+/*******************************************************************************
+ * Declaration of command line arguments
+ ******************************************************************************/
+namespace cll = llvm::cl;
+
+using lonestar::analytics::CommunityAgreement;
+using lonestar::analytics::CommunityQuality;
+using lonestar::analytics::CommunityQualityPlan;
+
+static cll::opt<std::string>
+    inputFile(cll::Positional, cll::desc("<input file>"), cll::Required);
+static cll::opt<std::string>
+    communitiesFile("communities",
+                    cll::desc("Clustering to evaluate: \"node community\" "
+                              "or \"community\" per line"),
+                    cll::Required);
+static cll::opt<std::string>
+    groundTruthFile("groundTruth",
+                    cll::desc("[clustering to compare with, same format]"),
+                    cll::init(""));
+static cll::opt<double>
+    resolution("resolution",
+               cll::desc("Resolution of the modularity (default 1)"),
+               cll::init(1.0));
+
+/*******************************************************************************
+ * Graph structure declarations + other inits
+ ******************************************************************************/
+
+using Graph = galois::graphs::LC_CSR_Graph<void, void>::with_numa_alloc<
+    true>::type::with_no_lockable<true>::type;
+using GNode = Graph::GraphNode;
+
+/**
+ * Reads a clustering in the format the clustering apps write, "node
+ * community" per line, or one community per line in node order. Lines
+ * starting with '#' are skipped. Nodes that are not listed, and nodes the
+ * Louvain and Leiden apps leave unassigned, get a community of their own.
+ */
+std::vector<uint64_t> readCommunities(const std::string& filename,
+                                      size_t numNodes) {
+  std::ifstream in(filename);
+  if (!in)
+    GALOIS_DIE("cannot open ", filename);
+
+  // ids no file is expected to use, one per node
+  constexpr uint64_t UNLISTED = uint64_t(1) << 63;
+  std::vector<uint64_t> community(numNodes);
+  for (size_t n = 0; n < numNodes; ++n)
+    community[n] = UNLISTED + n;
+
+  std::string line, first, second;
+  size_t lineNo = 0, next = 0;
+  while (std::getline(in, line)) {
+    ++lineNo;
+    std::istringstream fields(line);
+    if (!(fields >> first) || first[0] == '#')
+      continue;
+    uint64_t node = next++;
+    uint64_t c = std::strtoull(first.c_str(), nullptr, 10);
+    if (fields >> second) {
+      node = c;
+      c    = std::strtoull(second.c_str(), nullptr, 10);
+    }
+    if (node >= numNodes)
+      GALOIS_DIE(filename, ":", lineNo, ": node ", node,
+                 " is not in the graph");
+    // UNASSIGNED, which the Louvain and Leiden apps write for isolated nodes
+    if (c != std::numeric_limits<uint64_t>::max())
+      community[node] = c;
+  }
+  return community;
+}
+
+void printQuality(const CommunityQuality& q) {
+  std::cout << "Communities: " << q.numCommunities << " (" << q.numSingletons
+            << " singletons)\n"
+            << "Modularity: " << q.modularity << "\n"
+            << "Coverage: " << q.coverage << "\n"
+            << "Conductance: mean " << q.meanConductance << ", max "
+            << q.maxConductance << "\n"
+            << "Community size: min " << q.smallestSize << ", median "
+            << q.medianSize << ", mean " << q.meanSize << ", max "
+            << q.largestSize << "\n"
+            << "Size histogram:\n";
+  for (size_t i = 0; i < q.sizeHistogram.size(); ++i)
+    if (q.sizeHistogram[i])
+      std::cout << "  [" << (uint64_t(1) << i) << ", "
+                << (uint64_t(1) << (i + 1)) << "): " << q.sizeHistogram[i]
+                << "\n";
+
+  galois::runtime::reportStat_Single(REGION_NAME, "NumCommunities",
+                                     q.numCommunities);
+  galois::runtime::reportStat_Single(REGION_NAME, "Modularity", q.modularity);
+  galois::runtime::reportStat_Single(REGION_NAME, "Coverage", q.coverage);
+  galois::runtime::reportStat_Single(REGION_NAME, "MeanConductance",
+                                     q.meanConductance);
+}
+
+//! Modularity and coverage recomputed serially from a map of communities
+bool verify(Graph& graph, const std::vector<uint64_t>& community,
+            const CommunityQuality& q) {
+  std::map<uint64_t, std::pair<double, double>> volumeInside;
+  double total = 0;
+  for (GNode n : graph) {
+    auto& vi = volumeInside[community[n]];
+    for (auto e : graph.edges(n)) {
+      vi.first += 1;
+      vi.second += community[graph.getEdgeDst(e)] == community[n];
+    }
+    total += std::distance(graph.edge_begin(n), graph.edge_end(n));
+  }
+  double modularity = 0, coverage = 0;
+  for (auto& c : volumeInside) {
+    if (!total)
+      break;
+    double vol = c.second.first / total;
+    modularity += c.second.second / total - resolution * vol * vol;
+    coverage += c.second.second / total;
+  }
+  if (volumeInside.size() != q.numCommunities ||
+      std::fabs(modularity - q.modularity) > 1e-9 ||
+      std::fabs(coverage - q.coverage) > 1e-9) {
+    std::cerr << "expected " << volumeInside.size() << " communities, "
+              << "modularity " << modularity << ", coverage " << coverage
+              << "\n";
+    return false;
+  }
+  CommunityAgreement self =
+      lonestar::analytics::compareCommunities(community, community);
+  if (std::fabs(self.nmi - 1) > 1e-9 || std::fabs(self.ari - 1) > 1e-9) {
+    std::cerr << "a clustering does not agree with itself: NMI " << self.nmi
+              << ", ARI " << self.ari << "\n";
+    return false;
+  }
+  return true;
+}
+
+/*******************************************************************************
+ * Main method for running
+ ******************************************************************************/
+
+int main(int argc, char** argv) {
+  galois::SharedMemSys G;
+  LonestarStart(argc, argv, name, desc, nullptr, &inputFile);
+
+  galois::StatTimer totalTime("TimerTotal");
+  totalTime.start();
+
+  if (!symmetricGraph) {
+    GALOIS_DIE("This application requires a symmetric graph input;"
+               " please use the -symmetricGraph flag "
+               " to indicate the input is a symmetric graph.");
+  }
+
+  galois::StatTimer graphReadingTimer("GraphConstructTime", REGION_NAME);
+  graphReadingTimer.start();
+  Graph graph;
+  galois::graphs::readGraph(graph, inputFile);
+  std::vector<uint64_t> community =
+      readCommunities(communitiesFile, graph.size());
+  std::vector<uint64_t> groundTruth;
+  if (groundTruthFile != "")
+    groundTruth = readCommunities(groundTruthFile, graph.size());
+  graphReadingTimer.stop();
+  std::cout << "Read " << graph.size() << " nodes, " << graph.sizeEdges()
+            << " edges\n";
+
+  CommunityQualityPlan plan;
+  plan.resolution = resolution;
+
+  galois::StatTimer execTime("Timer_0");
+  execTime.start();
+  CommunityQuality quality =
+      lonestar::analytics::communityQuality(graph, community, plan);
+  CommunityAgreement agreement;
+  if (groundTruthFile != "")
+    agreement = lonestar::analytics::compareCommunities(community, groundTruth);
+  execTime.stop();
+
+  printQuality(quality);
+  if (groundTruthFile != "") {
+    std::cout << "Against the ground truth: NMI " << agreement.nmi << ", ARI "
+              << agreement.ari << "\n";
+    galois::runtime::reportStat_Single(REGION_NAME, "NMI", agreement.nmi);
+    galois::runtime::reportStat_Single(REGION_NAME, "ARI", agreement.ari);
+  }
+
+  if (!skipVerify) {
+    if (verify(graph, community, quality)) {
+      std::cout << "Verification successful.\n";
+    } else {
+      GALOIS_DIE("verification failed");
+    }
+  }
+
+  totalTime.stop();
+
+  return 0;
+}
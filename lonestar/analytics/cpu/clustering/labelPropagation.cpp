@@ -0,0 +1,185 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#include "galois/Galois.h"
+#include "galois/Reduction.h"
+#include "galois/graphs/LCGraph.h"
+#include "Lonestar/BoilerPlate.h"
+#include "Lonestar/Analytics/CommunityQuality.h"
+#include "Lonestar/Analytics/LabelPropagation.h"
+
+#include "llvm/Support/CommandLine.h"
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+constexpr static const char* const REGION_NAME = "LabelPropagation";
+constexpr static const char* const name = "Label Propagation Clustering";
+constexpr static const char* const desc =
+    "Clusters the nodes of a graph by label propagation";
+
+/*******************************************************************************
+ * Declaration of command line arguments
+ ******************************************************************************/
+namespace cll = llvm::cl;
+
+using lonestar::analytics::LabelPropagationNode;
+using lonestar::analytics::LabelPropagationPlan;
+using lonestar::analytics::LabelPropagationStats;
+
+static cll::opt<std::string>
+    inputFile(cll::Positional, cll::desc("<input file>"), cll::Required);
+static cll::opt<uint32_t>
+    maxIterations("maxIterations",
+                  cll::desc("Maximum number of rounds (default 100)"),
+                  cll::init(100));
+static cll::opt<double>
+    tolerance("tolerance",
+              cll::desc("Stop once a round changes at most this fraction of "
+                        "the labels (default 1e-5)"),
+              cll::init(1e-5));
+static cll::opt<uint64_t>
+    seed("seed", cll::desc("Random seed for breaking ties (default 0)"),
+         cll::init(0));
+static cll::opt<std::string>
+    outputFile("outputFile",
+               cll::desc("[output file: node community per line]"),
+               cll::init(""));
+
+/*******************************************************************************
+ * Graph structure declarations + other inits
+ ******************************************************************************/
+
+using Graph = galois::graphs::LC_CSR_Graph<LabelPropagationNode, void>::
+    with_numa_alloc<true>::type::with_no_lockable<true>::type;
+using GNode = Graph::GraphNode;
+
+/**
+ * Labels must be node ids, and only nodes still queued when the run stopped
+ * may lack one of the most frequent labels among their neighbors.
+ */
+bool verify(Graph& graph, const LabelPropagationStats& stats) {
+  galois::GAccumulator<uint64_t> invalid, unstable;
+  galois::do_all(
+      galois::iterate(graph),
+      [&](GNode n) {
+        if (graph.getData(n).community >= graph.size()) {
+          invalid += 1;
+          return;
+        }
+        std::unordered_map<uint64_t, uint64_t> count;
+        uint64_t most = 0;
+        for (auto e : graph.edges(n)) {
+          GNode v = graph.getEdgeDst(e);
+          if (v != n)
+            most = std::max(most, ++count[graph.getData(v).community]);
+        }
+        if (most && count[graph.getData(n).community] != most)
+          unstable += 1;
+      },
+      galois::steal(), galois::no_stats());
+  if (invalid.reduce()) {
+    std::cerr << invalid.reduce() << " labels are not node ids\n";
+    return false;
+  }
+  if (unstable.reduce() > stats.unsettled) {
+    std::cerr << unstable.reduce() << " nodes could move, but only "
+              << stats.unsettled << " were left queued\n";
+    return false;
+  }
+  return true;
+}
+
+/*******************************************************************************
+ * Main method for running
+ ******************************************************************************/
+
+int main(int argc, char** argv) {
+  galois::SharedMemSys G;
+  LonestarStart(argc, argv, name, desc, nullptr, &inputFile);
+
+  galois::StatTimer totalTime("TimerTotal");
+  totalTime.start();
+
+  if (!symmetricGraph) {
+    GALOIS_DIE("This application requires a symmetric graph input;"
+               " please use the -symmetricGraph flag "
+               " to indicate the input is a symmetric graph.");
+  }
+
+  galois::StatTimer graphReadingTimer("GraphConstructTime", REGION_NAME);
+  graphReadingTimer.start();
+  Graph graph;
+  galois::graphs::readGraph(graph, inputFile);
+  graphReadingTimer.stop();
+  std::cout << "Read " << graph.size() << " nodes, " << graph.sizeEdges()
+            << " edges\n";
+
+  LabelPropagationPlan plan;
+  plan.maxIterations = maxIterations;
+  plan.tolerance     = tolerance;
+  plan.seed          = seed;
+
+  galois::StatTimer execTime("Timer_0");
+  execTime.start();
+  LabelPropagationStats stats =
+      lonestar::analytics::labelPropagation(graph, plan);
+  execTime.stop();
+
+  std::vector<uint64_t> community(graph.size());
+  galois::do_all(
+      galois::iterate(graph),
+      [&](GNode n) { community[n] = graph.getData(n).community; },
+      galois::no_stats());
+  auto quality = lonestar::analytics::communityQuality(graph, community);
+
+  std::cout << "Rounds: " << stats.rounds << ", unsettled nodes: "
+            << stats.unsettled << "\n"
+            << "Communities: " << quality.numCommunities << ", largest "
+            << quality.largestSize << "\n"
+            << "Modularity: " << quality.modularity << "\n";
+  galois::runtime::reportStat_Single(REGION_NAME, "Rounds", stats.rounds);
+  galois::runtime::reportStat_Single(REGION_NAME, "NumCommunities",
+                                     quality.numCommunities);
+  galois::runtime::reportStat_Single(REGION_NAME, "Modularity",
+                                     quality.modularity);
+
+  if (outputFile != "") {
+    std::ofstream out(outputFile);
+    if (!out)
+      GALOIS_DIE("cannot open ", outputFile);
+    for (GNode n : graph)
+      out << n << " " << community[n] << "\n";
+  }
+
+  if (!skipVerify) {
+    if (verify(graph, stats)) {
+      std::cout << "Verification successful.\n";
+    } else {
+      GALOIS_DIE("verification failed");
+    }
+  }
+
+  totalTime.stop();
+
+  return 0;
+}
@@ -27,11 +27,13 @@
 #include "galois/graphs/LCGraph.h"
 #include "galois/graphs/TypeTraits.h"
 #include "Lonestar/BoilerPlate.h"
+#include "Lonestar/Analytics/Louvain.h"
 
 #include "llvm/Support/CommandLine.h"
 
 #include <iostream>
 #include <fstream>
+#include <cmath>
 #include <deque>
 #include <type_traits>
 
@@ -41,7 +43,7 @@ static const char* desc = "Cluster nodes of the graph using Louvain Clustering";
 
 static const char* url = "louvain_clustering";
 
-enum Algo { coloring, foreach, delay, doall };
+enum Algo { coloring, foreach, delay, doall, deterministic };
 
 static cll::opt<std::string>
     inputFile(cll::Positional, cll::desc("<input file>"), cll::Required);
@@ -55,7 +57,10 @@ static cll::opt<Algo> algo(
                            "Using galois for_each for conflict mitigation but "
                            "delay the updation"),
                 clEnumValN(Algo::doall, "Doall",
-                           "Using galois for_each for conflict mitigation")),
+                           "Using galois for_each for conflict mitigation"),
+                clEnumValN(Algo::deterministic, "Deterministic",
+                           "Louvain of the analytics library; the clustering "
+                           "does not depend on the schedule")),
     cll::init(Algo::foreach));
 
 // Maintain community information
@@ -79,6 +84,11 @@ using Graph = galois::graphs::LC_CSR_Graph<Node, EdgeTy>::with_no_lockable<
     false>::type::with_numa_alloc<true>::type;
 using GNode = Graph::GraphNode;
 
+using LibraryGraph =
+    galois::graphs::LC_CSR_Graph<lonestar::analytics::LouvainNode, EdgeTy>::
+        with_no_lockable<true>::type::with_numa_alloc<true>::type;
+using LibraryGNode = LibraryGraph::GraphNode;
+
 double algoLouvainWithLocking(Graph& graph, double lower, double threshold,
                               uint32_t& iter) {
   galois::StatTimer TimerClusteringTotal("Timer_Clustering_Total");
@@ -788,6 +798,31 @@ void runMultiPhaseLouvainAlgorithm(Graph& graph, uint32_t min_graph_size,
   galois::gPrint("Iter : ", iter, "\n");
 }
 
+/**
+ * Runs the Louvain of the analytics library on its own copy of the input and
+ * records the communities in clusters_orig.
+ *
+ * @returns the modularity reported by the library
+ */
+double runLibraryLouvain(largeArray& clusters_orig) {
+  LibraryGraph graph;
+  galois::graphs::readGraph(graph, inputFile);
+
+  lonestar::analytics::LouvainPlan plan;
+  plan.maxIterations = max_iter;
+  plan.threshold     = c_threshold;
+
+  galois::StatTimer execTime("Timer_0");
+  execTime.start();
+  double modularity = lonestar::analytics::louvain(graph, plan);
+  execTime.stop();
+
+  galois::do_all(galois::iterate(graph), [&](LibraryGNode n) {
+    clusters_orig[n] = graph.getData(n).community;
+  });
+  return modularity;
+}
+
 int main(int argc, char** argv) {
   galois::SharedMemSys G;
   LonestarStart(argc, argv, name, desc, url, &inputFile);
@@ -824,7 +859,7 @@ int main(int argc, char** argv) {
   /*
    * Vertex following optimization
    */
-  if (enable_VF) {
+  if (enable_VF && algo != Algo::deterministic) {
     uint64_t num_nodes_to_fix =
         vertexFollowing(graph); // Find nodes that follow other nodes
     galois::gPrint("Isolated nodes : ", num_nodes_to_fix, "\n");
@@ -854,16 +889,28 @@ int main(int argc, char** argv) {
     printGraphCharateristics(*graph_curr);
   }
 
-  galois::StatTimer execTime("Timer_0");
-  execTime.start();
-  runMultiPhaseLouvainAlgorithm(*graph_curr, min_graph_size, c_threshold,
-                                clusters_orig);
-  execTime.stop();
+  double libraryModularity = 0;
+  if (algo == Algo::deterministic) {
+    libraryModularity = runLibraryLouvain(clusters_orig);
+  } else {
+    galois::StatTimer execTime("Timer_0");
+    execTime.start();
+    runMultiPhaseLouvainAlgorithm(*graph_curr, min_graph_size, c_threshold,
+                                  clusters_orig);
+    execTime.stop();
+  }
 
   /*
    * Sanity check: Check modularity at the end
    */
-  checkModularity<Graph, CommArray>(graph, clusters_orig);
+  double mod = checkModularity<Graph, CommArray>(graph, clusters_orig);
+  if (algo == Algo::deterministic && !skipVerify) {
+    if (std::abs(mod - libraryModularity) > 1e-4) {
+      GALOIS_DIE("verification failed: the library reports modularity ",
+                 libraryModularity, " but its communities have ", mod);
+    }
+    galois::gPrint("Verification successful\n");
+  }
   if (output_CID) {
     printNodeClusterId(graph, output_CID_filename);
   }
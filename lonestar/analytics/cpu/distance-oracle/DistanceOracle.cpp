@@ -0,0 +1,286 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#include "galois/Galois.h"
+#include "galois/Reduction.h"
+#include "galois/graphs/LCGraph.h"
+#include "Lonestar/BoilerPlate.h"
+#include "Lonestar/Analytics/BFS.h"
+#include "Lonestar/Analytics/DistanceOracle.h"
+#include "Lonestar/Analytics/SSSP.h"
+
+#include "llvm/Support/CommandLine.h"
+
+#include <atomic>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+constexpr static const char* const REGION_NAME = "DistanceOracle";
+constexpr static const char* const name        = "Landmark Distance Oracle";
+constexpr static const char* const desc =
+    "Builds a table of distances to a few landmarks and answers "
+    "point-to-point distance queries with lower and upper bounds";
+
+/*******************************************************************************
+ * Declaration of command line arguments
+ ******************************************************************************/
+namespace cll = llvm::cl;
+
+using lonestar::analytics::DistanceBounds;
+using lonestar::analytics::DistanceOracle;
+using lonestar::analytics::DistanceOraclePlan;
+
+static cll::opt<std::string>
+    inputFile(cll::Positional, cll::desc("<input file>"), cll::Required);
+
+static cll::opt<DistanceOraclePlan::Selection> selection(
+    "selection", cll::desc("Choose how landmarks are selected (default "
+                           "Degree):"),
+    cll::values(clEnumValN(DistanceOraclePlan::degree, "Degree",
+                           "The nodes with the most edges"),
+                clEnumValN(DistanceOraclePlan::coverage, "Coverage",
+                           "Each the farthest from the ones before"),
+                clEnumValN(DistanceOraclePlan::random, "Random",
+                           "Uniformly at random")),
+    cll::init(DistanceOraclePlan::degree));
+
+static cll::opt<unsigned>
+    numLandmarks("numLandmarks", cll::desc("Number of landmarks (default 16)"),
+                 cll::init(16));
+static cll::opt<unsigned>
+    batchSize("batchSize",
+              cll::desc("Landmarks searched together, at most 64 "
+                        "(default 16)"),
+              cll::init(16));
+static cll::opt<unsigned int>
+    stepShift("delta",
+              cll::desc("Shift value for the deltastep (default value 13)"),
+              cll::init(13));
+static cll::opt<uint64_t>
+    seed("seed",
+         cll::desc("Random seed for landmarks and queries (default 0)"),
+         cll::init(0));
+static cll::opt<bool>
+    unweighted("unweighted",
+               cll::desc("Ignore the edge weights and count hops"),
+               cll::init(false));
+static cll::opt<uint64_t>
+    numQueries("numQueries",
+               cll::desc("Random pairs timed for throughput (default 1M)"),
+               cll::init(1000000));
+static cll::opt<unsigned>
+    numExactSources("numExactSources",
+                    cll::desc("Sources whose distances to all nodes are "
+                              "computed exactly to measure the error of the "
+                              "bounds (default 8)"),
+                    cll::init(8));
+
+/*******************************************************************************
+ * Graph structure declarations + other inits
+ ******************************************************************************/
+
+//! Node data holds the exact distances from a source, by sssp() or bfs()
+using WeightedGraph =
+    galois::graphs::LC_CSR_Graph<std::atomic<uint32_t>, uint32_t>::
+        with_no_lockable<true>::type::with_numa_alloc<true>::type;
+using UnweightedGraph = galois::graphs::LC_CSR_Graph<uint32_t, void>::
+    with_no_lockable<true>::type::with_numa_alloc<true>::type;
+
+//! How far the bounds are from the exact distances of the sampled pairs
+struct BoundsError {
+  uint64_t pairs = 0;
+  uint64_t connected = 0;
+  //! pairs whose exact distance lies outside the bounds
+  uint64_t violations = 0;
+  //! connected pairs whose upper bound is the exact distance
+  uint64_t exactUpper = 0;
+  //! mean over connected pairs of (upper - exact) / exact
+  double upperError = 0;
+  //! mean over connected pairs of (exact - lower) / exact
+  double lowerGap = 0;
+};
+
+/**
+ * Compares the bounds between numExactSources random sources and all other
+ * nodes with their exact distances.
+ */
+template <typename Graph>
+BoundsError measureError(Graph& graph, const DistanceOracle& oracle) {
+  using GNode           = typename Graph::GraphNode;
+  constexpr bool IS_BFS = std::is_void<typename Graph::edge_data_type>::value;
+
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<uint32_t> node(0, graph.size() - 1);
+  BoundsError error;
+  for (unsigned i = 0; i < numExactSources && graph.size(); ++i) {
+    GNode source = node(gen);
+    uint32_t infinity;
+    if constexpr (IS_BFS) {
+      lonestar::analytics::bfs(graph, source);
+      infinity = lonestar::analytics::bfsInfinity<Graph>();
+    } else {
+      lonestar::analytics::SSSPPlan plan;
+      plan.deltaShift = stepShift;
+      lonestar::analytics::sssp(graph, source, plan);
+      infinity = lonestar::analytics::ssspInfinity<Graph>();
+    }
+
+    galois::GAccumulator<uint64_t> pairs, connected, violations, exactUpper;
+    galois::GAccumulator<double> upperError, lowerGap;
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          if (n == source)
+            return;
+          uint32_t exact = graph.getData(n);
+          if (exact == infinity)
+            exact = DistanceOracle::INFINITY_DIST;
+          DistanceBounds b = oracle.query(source, n);
+          pairs += 1;
+          if (exact < b.lower || exact > b.upper) {
+            violations += 1;
+            return;
+          }
+          if (exact == DistanceOracle::INFINITY_DIST || exact == 0)
+            return;
+          connected += 1;
+          exactUpper += b.upper == exact;
+          upperError += double(b.upper - exact) / exact;
+          lowerGap += double(exact - b.lower) / exact;
+        },
+        galois::steal(), galois::no_stats());
+    error.pairs += pairs.reduce();
+    error.connected += connected.reduce();
+    error.violations += violations.reduce();
+    error.exactUpper += exactUpper.reduce();
+    error.upperError += upperError.reduce();
+    error.lowerGap += lowerGap.reduce();
+  }
+  if (error.connected) {
+    error.upperError /= error.connected;
+    error.lowerGap /= error.connected;
+  }
+  return error;
+}
+
+template <typename Graph>
+void run() {
+  galois::StatTimer graphReadingTimer("GraphConstructTime", REGION_NAME);
+  graphReadingTimer.start();
+  Graph graph;
+  galois::graphs::readGraph(graph, inputFile);
+  graphReadingTimer.stop();
+  std::cout << "Read " << graph.size() << " nodes, " << graph.sizeEdges()
+            << " edges\n";
+
+  DistanceOraclePlan plan;
+  plan.selection    = selection;
+  plan.numLandmarks = numLandmarks;
+  plan.batchSize    = batchSize;
+  plan.deltaShift   = stepShift;
+  plan.seed         = seed;
+
+  std::cout << "Selecting " << numLandmarks << " landmarks by "
+            << algorithmName(plan.selection) << "\n";
+  galois::StatTimer execTime("Timer_0");
+  execTime.start();
+  DistanceOracle oracle =
+      lonestar::analytics::buildDistanceOracle(graph, plan);
+  execTime.stop();
+
+  uint64_t tableBytes = graph.size() * oracle.numLandmarks() * 4;
+  std::cout << "Table of " << oracle.numLandmarks() << " landmarks: "
+            << tableBytes << " bytes\n";
+  galois::runtime::reportStat_Single(REGION_NAME, "NumLandmarks",
+                                     oracle.numLandmarks());
+  galois::runtime::reportStat_Single(REGION_NAME, "TableBytes", tableBytes);
+
+  std::vector<std::pair<uint32_t, uint32_t>> queries(
+      graph.size() ? numQueries : 0);
+  std::mt19937 gen(seed + 1);
+  std::uniform_int_distribution<uint32_t> node(0, graph.size() - 1);
+  for (auto& q : queries) {
+    q.first  = node(gen);
+    q.second = node(gen);
+  }
+  std::vector<DistanceBounds> bounds;
+  galois::StatTimer queryTime("QueryTime", REGION_NAME);
+  queryTime.start();
+  oracle.query(queries, bounds);
+  queryTime.stop();
+  if (queryTime.get_usec())
+    std::cout << "Queries per second: "
+              << queries.size() * 1e6 / queryTime.get_usec() << "\n";
+
+  BoundsError error = measureError(graph, oracle);
+  std::cout << "Sampled pairs: " << error.pairs << ", connected "
+            << error.connected << "\n";
+  if (error.connected) {
+    std::cout << "Upper bound exact for "
+              << double(error.exactUpper) / error.connected
+              << " of the pairs, mean relative error " << error.upperError
+              << "\n"
+              << "Mean relative gap of the lower bound: " << error.lowerGap
+              << "\n";
+    galois::runtime::reportStat_Single(REGION_NAME, "UpperBoundError",
+                                       error.upperError);
+    galois::runtime::reportStat_Single(REGION_NAME, "LowerBoundGap",
+                                       error.lowerGap);
+  }
+
+  if (!skipVerify) {
+    if (!error.violations) {
+      std::cout << "Verification successful.\n";
+    } else {
+      std::cerr << error.violations << " exact distances out of bounds\n";
+      GALOIS_DIE("verification failed");
+    }
+  }
+}
+
+/*******************************************************************************
+ * Main method for running
+ ******************************************************************************/
+
+int main(int argc, char** argv) {
+  galois::SharedMemSys G;
+  LonestarStart(argc, argv, name, desc, nullptr, &inputFile);
+
+  galois::StatTimer totalTime("TimerTotal");
+  totalTime.start();
+
+  if (!symmetricGraph) {
+    GALOIS_DIE("This application requires a symmetric graph input;"
+               " please use the -symmetricGraph flag "
+               " to indicate the input is a symmetric graph.");
+  }
+
+  if (unweighted)
+    run<UnweightedGraph>();
+  else
+    run<WeightedGraph>();
+
+  totalTime.stop();
+
+  return 0;
+}
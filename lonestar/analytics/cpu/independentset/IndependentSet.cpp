@@ -27,6 +27,7 @@
 #include "llvm/Support/CommandLine.h"
 
 #include "Lonestar/BoilerPlate.h"
+#include "Lonestar/Analytics/IndependentSet.h"
 
 #include <utility>
 #include <vector>
@@ -41,7 +42,7 @@ const char* desc =
     "Computes a maximal independent set (not maximum) of nodes in a graph";
 const char* url = "independent_set";
 
-enum Algo { serial, pull, nondet, detBase, prio, edgetiledprio };
+enum Algo { serial, pull, nondet, detBase, prio, edgetiledprio, luby };
 
 namespace cll = llvm::cl;
 static cll::opt<std::string>
@@ -60,7 +61,10 @@ static cll::opt<Algo> algo(
             "prio algo based on Martin's GPU ECL-MIS algorithm (default)"),
         clEnumVal(
             edgetiledprio,
-            "edge-tiled prio algo based on Martin's GPU ECL-MIS algorithm")),
+            "edge-tiled prio algo based on Martin's GPU ECL-MIS algorithm"),
+        clEnumVal(luby, "Luby-style rounds of the analytics library with "
+                        "hashed priorities; the set does not depend on the "
+                        "schedule")),
     cll::init(prio));
 
 enum MatchFlag : char { UNMATCHED, OTHER_MATCHED, MATCHED };
@@ -578,31 +582,54 @@ struct EdgeTiledPrioAlgo {
   }
 };
 
+struct LubyAlgo {
+  using Graph = galois::graphs::LC_CSR_Graph<
+      lonestar::analytics::IndependentSetNode,
+      void>::with_numa_alloc<true>::type ::with_no_lockable<true>::type;
+  using GNode = Graph::GraphNode;
+
+  void operator()(Graph& graph) {
+    lonestar::analytics::maximalIndependentSet(graph);
+  }
+};
+
+//! Flag of a node in terms of Node, whatever node data the algorithm used
+MatchFlag matchFlag(const Node& data) { return data.flag; }
+//! prioNode flags are turned into MatchFlags by verify()
+MatchFlag matchFlag(const prioNode& data) { return MatchFlag(data.flag); }
+MatchFlag matchFlag(const lonestar::analytics::IndependentSetNode& data) {
+  switch (data.flag) {
+  case lonestar::analytics::IndependentSetNode::IN_SET:
+    return MATCHED;
+  case lonestar::analytics::IndependentSetNode::OUT_OF_SET:
+    return OTHER_MATCHED;
+  default:
+    return UNMATCHED;
+  }
+}
+
 template <typename Graph>
 struct is_bad {
   using GNode = typename Graph::GraphNode;
-  using Node  = typename Graph::node_data_type;
   Graph& graph;
 
   is_bad(Graph& g) : graph(g) {}
 
   bool operator()(GNode n) const {
-    Node& me = graph.getData(n);
-    if (me.flag == MATCHED) {
+    MatchFlag me = matchFlag(graph.getData(n));
+    if (me == MATCHED) {
       for (auto ii : graph.edges(n)) {
-        GNode dst  = graph.getEdgeDst(ii);
-        Node& data = graph.getData(dst);
-        if (dst != n && data.flag == MATCHED) {
+        GNode dst = graph.getEdgeDst(ii);
+        if (dst != n && matchFlag(graph.getData(dst)) == MATCHED) {
           std::cerr << "double match\n";
           return true;
         }
       }
-    } else if (me.flag == UNMATCHED) {
+    } else if (me == UNMATCHED) {
       bool ok = false;
       for (auto ii : graph.edges(n)) {
-        GNode dst  = graph.getEdgeDst(ii);
-        Node& data = graph.getData(dst);
-        if (data.flag != UNMATCHED) {
+        GNode dst = graph.getEdgeDst(ii);
+        if (matchFlag(graph.getData(dst)) != UNMATCHED) {
           ok = true;
         }
       }
@@ -623,7 +650,7 @@ struct is_matched {
   is_matched(Graph& g) : graph(g) {}
 
   bool operator()(const GNode& n) const {
-    return graph.getData(n).flag == MATCHED;
+    return matchFlag(graph.getData(n)) == MATCHED;
   }
 };
 
@@ -632,8 +659,8 @@ bool verify(Graph& graph, Algo&) {
   using GNode    = typename Graph::GraphNode;
   using prioNode = typename Graph::node_data_type;
 
-  if (std::is_same<Algo, PrioAlgo>::value ||
-      std::is_same<Algo, EdgeTiledPrioAlgo>::value) {
+  if constexpr (std::is_same<Algo, PrioAlgo>::value ||
+                std::is_same<Algo, EdgeTiledPrioAlgo>::value) {
     galois::do_all(
         galois::iterate(graph),
         [&](const GNode& src) {
@@ -733,6 +760,9 @@ int main(int argc, char** argv) {
   case edgetiledprio:
     run<EdgeTiledPrioAlgo>();
     break;
+  case luby:
+    run<LubyAlgo>();
+    break;
   default:
     std::cerr << "Unknown algorithm" << algo << "\n";
     abort();
@@ -18,11 +18,9 @@
  */
 
 #include "galois/Galois.h"
-#include "galois/gstl.h"
-#include "galois/AtomicHelpers.h"
-#include "galois/Reduction.h"
 #include "galois/graphs/LCGraph.h"
 #include "Lonestar/BoilerPlate.h"
+#include "Lonestar/Analytics/KCore.h"
 
 #include "llvm/Support/CommandLine.h"
 
@@ -38,17 +36,17 @@ constexpr static const char* const desc        = "Finds the k-core of a graph, "
  ******************************************************************************/
 namespace cll = llvm::cl;
 
-enum Algo { Async = 0, Sync };
+using lonestar::analytics::KCorePlan;
 
 static cll::opt<std::string>
     inputFile(cll::Positional, cll::desc("<input file>"), cll::Required);
 
 //! Choose algorithm: worklist vs. sync.
-static cll::opt<Algo> algo("algo",
-                           cll::desc("Choose an algorithm (default Sync):"),
-                           cll::values(clEnumVal(Async, "Asynchronous"),
-                                       clEnumVal(Sync, "Synchronous")),
-                           cll::init(Sync));
+static cll::opt<KCorePlan::Algorithm>
+    algo("algo", cll::desc("Choose an algorithm (default Sync):"),
+         cll::values(clEnumValN(KCorePlan::async, "Async", "Asynchronous"),
+                     clEnumValN(KCorePlan::sync, "Sync", "Synchronous")),
+         cll::init(KCorePlan::sync));
 
 //! Required k specification for k-core.
 static cll::opt<unsigned int> k_core_num("kcore", cll::desc("k-core value"),
@@ -58,163 +56,12 @@ static cll::opt<unsigned int> k_core_num("kcore", cll::desc("k-core value"),
  * Graph structure declarations + other inits
  ******************************************************************************/
 
-//! Node deadness can be derived from current degree and k value, so no field
-//! necessary.
-struct NodeData {
-  std::atomic<uint32_t> currentDegree;
-};
-
 //! Typedef for graph used, CSR graph (edge-type is void).
-using Graph =
-    galois::graphs::LC_CSR_Graph<NodeData, void>::with_no_lockable<true>::type;
-//! Typedef for node type in the CSR graph.
-using GNode = Graph::GraphNode;
-
-//! Chunksize for for_each worklist: best chunksize will depend on input.
-constexpr static const unsigned CHUNK_SIZE = 64u;
-
-/*******************************************************************************
- * Functions for running the algorithm
- ******************************************************************************/
-
-/**
- * Initialize degree fields in graph with current degree. Since symmetric,
- * out edge count is equivalent to in-edge count.
- *
- * @param graph Graph to initialize degrees in
- */
-void degreeCounting(Graph& graph) {
-  galois::do_all(
-      galois::iterate(graph.begin(), graph.end()),
-      [&](GNode curNode) {
-        NodeData& curData = graph.getData(curNode);
-        curData.currentDegree.store(
-            std::distance(graph.edge_begin(curNode), graph.edge_end(curNode)));
-      },
-      galois::loopname("DegreeCounting"), galois::no_stats());
-};
-
-/**
- * Setup initial worklist of dead nodes.
- *
- * @param graph Graph to operate on
- * @param initialWorklist Empty worklist to be filled with dead nodes.
- */
-void setupInitialWorklist(Graph& graph,
-                          galois::InsertBag<GNode>& initialWorklist) {
-  galois::do_all(
-      galois::iterate(graph.begin(), graph.end()),
-      [&](GNode curNode) {
-        NodeData& curData = graph.getData(curNode);
-        if (curData.currentDegree < k_core_num) {
-          //! Dead node, add to initialWorklist for processing later.
-          initialWorklist.emplace(curNode);
-        }
-      },
-      galois::loopname("InitialWorklistSetup"), galois::no_stats());
-}
-
-/**
- * Starting with initial dead nodes as current worklist; decrement degree;
- * add to next worklist; switch next with current and repeat until worklist
- * is empty (i.e. no more dead nodes).
- *
- * @param graph Graph to operate on
- */
-void syncCascadeKCore(Graph& graph) {
-  galois::InsertBag<GNode>* current = new galois::InsertBag<GNode>;
-  galois::InsertBag<GNode>* next    = new galois::InsertBag<GNode>;
-
-  //! Setup worklist.
-  setupInitialWorklist(graph, *next);
-
-  while (!next->empty()) {
-    //! Make "next" into current.
-    std::swap(current, next);
-    next->clear();
-
-    galois::do_all(
-        galois::iterate(*current),
-        [&](GNode deadNode) {
-          //! Decrement degree of all neighbors.
-          for (auto e : graph.edges(deadNode)) {
-            GNode dest         = graph.getEdgeDst(e);
-            NodeData& destData = graph.getData(dest);
-            uint32_t oldDegree =
-                galois::atomicSubtract(destData.currentDegree, 1u);
-
-            if (oldDegree == k_core_num) {
-              //! This thread was responsible for putting degree of destination
-              //! below threshold; add to worklist.
-              next->emplace(dest);
-            }
-          }
-        },
-        galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
-        galois::loopname("SyncCascadeDeadNodes"));
-  }
-
-  delete current;
-  delete next;
-}
-
-/**
- * Starting with initial dead nodes, decrement degree and add to worklist
- * as they drop below 'k' threshold until worklist is empty (i.e. no more dead
- * nodes).
- *
- * @param graph Graph to operate on
- * @param initialWorklist Worklist containing initial dead nodes
- */
-void asyncCascadeKCore(Graph& graph,
-                       galois::InsertBag<GNode>& initialWorklist) {
-  galois::for_each(
-      galois::iterate(initialWorklist),
-      [&](GNode deadNode, auto& ctx) {
-        //! Decrement degree of all neighbors.
-        for (auto e : graph.edges(deadNode)) {
-          GNode dest         = graph.getEdgeDst(e);
-          NodeData& destData = graph.getData(dest);
-          uint32_t oldDegree =
-              galois::atomicSubtract(destData.currentDegree, 1u);
+using Graph = galois::graphs::LC_CSR_Graph<lonestar::analytics::KCoreNode,
+                                           void>::with_no_lockable<true>::type;
 
-          if (oldDegree == k_core_num) {
-            //! This thread was responsible for putting degree of destination
-            //! below threshold: add to worklist.
-            ctx.push(dest);
-          }
-        }
-      },
-      galois::disable_conflict_detection(), galois::chunk_size<CHUNK_SIZE>(),
-      galois::loopname("AsyncCascadeDeadNodes"));
-}
-
-/*******************************************************************************
- * Sanity check operators
- ******************************************************************************/
-
-/**
- * Print number of nodes that are still alive.
- *
- * @param graph Graph to get alive count of
- */
-void kCoreSanity(Graph& graph) {
-  galois::GAccumulator<uint32_t> aliveNodes;
-  aliveNodes.reset();
-
-  galois::do_all(
-      galois::iterate(graph.begin(), graph.end()),
-      [&](GNode curNode) {
-        NodeData& curData = graph.getData(curNode);
-        if (curData.currentDegree >= k_core_num) {
-          aliveNodes += 1;
-        }
-      },
-      galois::loopname("KCoreSanityCheck"), galois::no_stats());
-
-  galois::gPrint("Number of nodes in the ", k_core_num, "-core is ",
-                 aliveNodes.reduce(), "\n");
-}
+constexpr static const unsigned CHUNK_SIZE =
+    lonestar::analytics::KCORE_CHUNK_SIZE;
 
 /*******************************************************************************
  * Main method for running
@@ -257,37 +104,29 @@ int main(int argc, char** argv) {
   galois::reportPageAlloc("MemAllocMid");
 
   //! Intialization of degrees.
-  degreeCounting(graph);
+  lonestar::analytics::initKCore(graph);
 
   //! Begins main computation.
   galois::StatTimer execTime("Timer_0");
 
-  execTime.start();
+  galois::gInfo("Running ",
+                algo == KCorePlan::async ? "asynchronous" : "synchronous",
+                " k-core with k-core number ", k_core_num);
 
-  if (algo == Async) {
-    galois::gInfo("Running asynchronous k-core with k-core number ",
-                  k_core_num);
-    //! Worklist setup of initial dead ndoes.
-    galois::InsertBag<GNode> initialWorklist;
-    setupInitialWorklist(graph, initialWorklist);
-    //! Actual work; propagate deadness by decrementing degrees and adding dead
-    //! nodes to worklist.
-    asyncCascadeKCore(graph, initialWorklist);
-  } else if (algo == Sync) {
-    galois::gInfo("Running synchronous k-core with k-core number ", k_core_num);
-    //! Synchronous k-core.
-    syncCascadeKCore(graph);
-  } else {
-    GALOIS_DIE("invalid specification of k-core algorithm");
-  }
+  KCorePlan plan;
+  plan.algorithm  = algo;
+  plan.initialize = false;
 
+  execTime.start();
+  lonestar::analytics::kCore(graph, k_core_num, plan);
   execTime.stop();
 
   galois::reportPageAlloc("MemAllocPost");
 
   //! Sanity check.
   if (!skipVerify) {
-    kCoreSanity(graph);
+    galois::gPrint("Number of nodes in the ", k_core_num, "-core is ",
+                   lonestar::analytics::kCoreSize(graph, k_core_num), "\n");
   }
 
   totalTime.stop();
@@ -25,6 +25,7 @@
 #include "galois/graphs/TypeTraits.h"
 #include "galois/runtime/Statistics.h"
 #include "Lonestar/BoilerPlate.h"
+#include "Lonestar/Analytics/KTruss.h"
 
 #include "llvm/Support/CommandLine.h"
 
@@ -33,6 +34,8 @@
 #include <algorithm>
 #include <fstream>
 #include <memory>
+#include <type_traits>
+#include <vector>
 
 enum Algo {
   bspJacobi,
@@ -65,7 +68,7 @@ static cll::opt<Algo> algo(
                    "Compute k-1 core and then k-truss")),
     cll::init(Algo::bsp));
 
-//! Set LSB of an edge weight to indicate the removal of the edge.
+//! Edge data is KTRUSS_ALIVE or KTRUSS_REMOVED, as in the analytics library.
 using Graph =
     galois::graphs::LC_CSR_Graph<void, uint32_t>::template with_numa_alloc<
         true>::type::template with_no_lockable<true>::type;
@@ -78,8 +81,8 @@ using NodeVec = galois::InsertBag<GNode>;
 template <typename T>
 using PerIterAlloc = typename galois::PerIterAllocTy::rebind<T>::other;
 
-static const uint32_t valid   = 0x0;
-static const uint32_t removed = 0x1;
+using lonestar::analytics::KTRUSS_ALIVE;
+using lonestar::analytics::KTRUSS_REMOVED;
 
 #if 0 ///< Deprecated codes.
 ///< TODO We can restore the asynchronous ktruss.
@@ -265,25 +268,27 @@ struct AsyncTrussTxAlgo {
 #endif
 
 /**
- * Initialize edge data to valid.
+ * Initialize edge data to alive, except for self loops, which are never in a
+ * truss.
  */
 template <typename Graph>
 void initialize(Graph& g) {
   g.sortAllEdgesByDst();
 
-  //! Initializa all edges to valid.
   galois::do_all(
       galois::iterate(g),
       [&g](typename Graph::GraphNode N) {
         for (auto e : g.edges(N, galois::MethodFlag::UNPROTECTED)) {
-          g.getEdgeData(e) = valid;
+          g.getEdgeData(e) =
+              g.getEdgeDst(e) == N ? KTRUSS_REMOVED : KTRUSS_ALIVE;
         }
       },
       galois::steal());
 }
 
 /**
- * Dump ktruss for each node to a file.
+ * Dump the edges of the ktruss to a file, as the edge list verify-k-truss
+ * reads.
  */
 template <typename Graph>
 void reportKTruss(Graph& g) {
@@ -300,8 +305,8 @@ void reportKTruss(Graph& g) {
   for (auto n : g) {
     for (auto e : g.edges(n, galois::MethodFlag::UNPROTECTED)) {
       auto dst = g.getEdgeDst(e);
-      if (n < dst && (g.getEdgeData(e) & 0x1) != removed) {
-        of << n << " " << dst << " " << g.getEdgeData(e) << "\n";
+      if (n < dst && g.getEdgeData(e) == KTRUSS_ALIVE) {
+        of << n << " " << dst << "\n";
       }
     }
   }
@@ -324,7 +329,7 @@ void reportKTruss(Graph& g) {
 bool isValidDegreeNoLessThanJ(Graph& g, GNode n, unsigned int j) {
   size_t numValid = 0;
   for (auto e : g.edges(n, galois::MethodFlag::UNPROTECTED)) {
-    if (!(g.getEdgeData(e) & removed)) {
+    if (g.getEdgeData(e) == KTRUSS_ALIVE) {
       numValid += 1;
       if (numValid >= j) {
         return true;
@@ -353,10 +358,10 @@ bool isSupportNoLessThanJ(Graph& g, GNode src, GNode dst, unsigned int j) {
 
   while (true) {
     //! Find the first valid edge.
-    while (srcI != srcE && (g.getEdgeData(srcI) & removed)) {
+    while (srcI != srcE && g.getEdgeData(srcI) == KTRUSS_REMOVED) {
       ++srcI;
     }
-    while (dstI != dstE && (g.getEdgeData(dstI) & removed)) {
+    while (dstI != dstE && g.getEdgeData(dstI) == KTRUSS_REMOVED) {
       ++dstI;
     }
 
@@ -384,77 +389,19 @@ bool isSupportNoLessThanJ(Graph& g, GNode src, GNode dst, unsigned int j) {
 }
 
 /**
- * BSPTrussJacobiAlgo:
- * 1. Scan for unsupported edges.
+ * BSPTrussJacobiAlgo: the bulk-synchronous peeling of the analytics library.
+ * 1. Scan for unsupported edges against the truss of the previous round.
  * 2. If no unsupported edges are found, done.
  * 3. Remove unsupported edges in a separated loop.
- *    TODO why would it be processed in a separted loop?
  * 4. Go back to 1.
  */
 struct BSPTrussJacobiAlgo {
-  std::string name() { return "bsp"; }
-
-  struct PickUnsupportedEdges {
-    Graph& g;
-    unsigned int j;
-    EdgeVec& r; ///< unsupported
-    EdgeVec& s; ///< next
-
-    PickUnsupportedEdges(Graph& g, unsigned int j, EdgeVec& r, EdgeVec& s)
-        : g(g), j(j), r(r), s(s) {}
-
-    void operator()(Edge e) {
-      EdgeVec& w = isSupportNoLessThanJ(g, e.first, e.second, j) ? s : r;
-      w.push_back(e);
-    }
-  };
+  std::string name() { return "bspJacobi"; }
 
   void operator()(Graph& g, unsigned int k) {
-    if (k - 2 == 0) {
-      return;
-    }
-
-    EdgeVec unsupported, work[2];
-    EdgeVec *cur = &work[0], *next = &work[1];
-
-    //! Symmetry breaking:
-    //! Consider only edges (i, j) where i < j.
-    galois::do_all(
-        galois::iterate(g),
-        [&](GNode n) {
-          for (auto e : g.edges(n, galois::MethodFlag::UNPROTECTED)) {
-            auto dst = g.getEdgeDst(e);
-            if (dst > n) {
-              cur->push_back(std::make_pair(n, dst));
-            }
-          }
-        },
-        galois::steal());
-
-    while (true) {
-      galois::do_all(galois::iterate(*cur),
-                     PickUnsupportedEdges{g, k - 2, unsupported, *next},
-                     galois::steal());
-
-      if (std::distance(unsupported.begin(), unsupported.end()) == 0) {
-        break;
-      }
-
-      //! Mark unsupported edges as removed.
-      galois::do_all(
-          galois::iterate(unsupported),
-          [&](Edge e) {
-            g.getEdgeData(g.findEdgeSortedByDst(e.first, e.second)) = removed;
-            g.getEdgeData(g.findEdgeSortedByDst(e.second, e.first)) = removed;
-          },
-          galois::steal());
-
-      unsupported.clear();
-      cur->clear();
-      std::swap(cur, next);
-    }
-  } ///< End operator()
-};  ///< End struct BSPTrussJacobiAlgo
+    lonestar::analytics::kTruss(g, k);
+  }
+};
 
 /**
  * BSPTrussAlgo:
@@ -477,8 +424,8 @@ struct BSPTrussAlgo {
       if (isSupportNoLessThanJ(g, e.first, e.second, j)) {
         s.push_back(e);
       } else {
-        g.getEdgeData(g.findEdgeSortedByDst(e.first, e.second)) = removed;
-        g.getEdgeData(g.findEdgeSortedByDst(e.second, e.first)) = removed;
+        g.getEdgeData(g.findEdgeSortedByDst(e.first, e.second)) = KTRUSS_REMOVED;
+        g.getEdgeData(g.findEdgeSortedByDst(e.second, e.first)) = KTRUSS_REMOVED;
       }
     }
   };
@@ -547,8 +494,8 @@ struct BSPCoreAlgo {
       } else {
         for (auto e : g.edges(n, galois::MethodFlag::UNPROTECTED)) {
           auto dst                                     = g.getEdgeDst(e);
-          g.getEdgeData(g.findEdgeSortedByDst(n, dst)) = removed;
-          g.getEdgeData(g.findEdgeSortedByDst(dst, n)) = removed;
+          g.getEdgeData(g.findEdgeSortedByDst(n, dst)) = KTRUSS_REMOVED;
+          g.getEdgeData(g.findEdgeSortedByDst(dst, n)) = KTRUSS_REMOVED;
         }
       }
     }
@@ -638,13 +585,37 @@ void run() {
   for (auto n : graph) {
     for (auto e : graph.edges(n, galois::MethodFlag::UNPROTECTED)) {
       auto dst = graph.getEdgeDst(e);
-      if (n < dst && (graph.getEdgeData(e) & 0x1) != removed) {
+      if (n < dst && graph.getEdgeData(e) == KTRUSS_ALIVE) {
         numEdges++;
       }
     }
   }
 
   galois::gInfo("Number of edges left in truss is ", numEdges);
+
+  // the k-truss is unique, so every algorithm must keep the edges the
+  // library keeps
+  if (!skipVerify && !std::is_same<Algo, BSPTrussJacobiAlgo>::value) {
+    std::vector<uint32_t> kept(graph.sizeEdges());
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          for (auto e : graph.edges(n, galois::MethodFlag::UNPROTECTED)) {
+            kept[*e] = graph.getEdgeData(e);
+          }
+        },
+        galois::no_stats());
+    lonestar::analytics::kTruss(graph, trussNum);
+    for (auto n : graph) {
+      for (auto e : graph.edges(n, galois::MethodFlag::UNPROTECTED)) {
+        if (kept[*e] != graph.getEdgeData(e)) {
+          GALOIS_DIE("verification failed: edge (", n, ", ",
+                     graph.getEdgeDst(e), ") differs from the library truss");
+        }
+      }
+    }
+    galois::gPrint("Verification successful\n");
+  }
 }
 
 int main(int argc, char** argv) {
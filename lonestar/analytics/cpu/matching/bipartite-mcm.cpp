@@ -28,6 +28,7 @@
 #include "galois/graphs/FileGraph.h"
 #include "llvm/Support/CommandLine.h"
 #include "Lonestar/BoilerPlate.h"
+#include "Lonestar/Analytics/Matching.h"
 
 #include <algorithm>
 #include <iostream>
@@ -1081,6 +1082,52 @@ void readInput(const std::string& filename, G& g) {
   galois::graphs::readGraph(g, filename);
 }
 
+typedef galois::graphs::LC_CSR_Graph<lonestar::analytics::MatchingNode,
+                                     void>::with_no_lockable<true>::type
+    LibraryGraph;
+
+/**
+ * Size of the maximal matching the analytics library finds on the input. A
+ * maximal matching has at least half the edges of a maximum one, so the
+ * size bounds the cardinality of the maximum matching from both sides.
+ */
+template <typename G>
+size_t libraryMatchingSize(G& g) {
+  size_t numEdges = 0;
+  for (auto n : g.A) {
+    numEdges += std::distance(g.edge_begin(n), g.edge_end(n));
+  }
+
+  galois::graphs::FileGraphWriter p;
+  p.setNumNodes(g.A.size() + g.B.size());
+  p.setNumEdges<void>(2 * numEdges);
+  for (int phase = 0; phase < 2; ++phase) {
+    if (phase == 0)
+      p.phase1();
+    else
+      p.phase2();
+
+    for (auto n : g.A) {
+      size_t src = g.getData(n).id;
+      for (auto edge : g.out_edges(n)) {
+        size_t dst = g.getData(g.getEdgeDst(edge)).id;
+        if (phase == 0) {
+          p.incrementDegree(src);
+          p.incrementDegree(dst);
+        } else {
+          p.addNeighbor(src, dst);
+          p.addNeighbor(dst, src);
+        }
+      }
+    }
+  }
+  p.finish<void>();
+
+  LibraryGraph libraryGraph;
+  galois::graphs::readGraph(libraryGraph, p);
+  return lonestar::analytics::maximalMatching(libraryGraph);
+}
+
 template <template <typename, bool> class Algo, typename G>
 size_t countMatching(G& g) {
   Exists<G, Algo> exists;
@@ -1141,6 +1188,8 @@ void start(int N, int numEdges, int numGroups) {
 
   std::cout << "numA: " << g.A.size() << " numB: " << g.B.size() << "\n";
 
+  size_t maximalSize = skipVerify ? 0 : libraryMatchingSize(g);
+
   std::cout << "Starting " << algo.name() << "\n";
 
   galois::StatTimer execTime("Timer_0");
@@ -1163,6 +1212,18 @@ void start(int N, int numEdges, int numGroups) {
     size_t matchingSize = countMatching<Algo>(g);
     std::cout << "Matching of cardinality: " << matchingSize << "\n";
 
+    if (maximalSize != 0) {
+      if (matchingSize < maximalSize || matchingSize > 2 * maximalSize) {
+        GALOIS_DIE("verification failed: the library finds a maximal "
+                   "matching of cardinality ",
+                   maximalSize);
+      }
+      std::cout << "Library maximal matching of cardinality: " << maximalSize
+                << "\n";
+      // later iterations run on the remaining edges only
+      maximalSize = 0;
+    }
+
     if (!runIteratively || matchingSize == 0)
       break;
 
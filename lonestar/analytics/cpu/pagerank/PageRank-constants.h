@@ -20,18 +20,18 @@
 #ifndef LONESTAR_PAGERANK_CONSTANTS_H
 #define LONESTAR_PAGERANK_CONSTANTS_H
 
+#include "Lonestar/Analytics/PageRank.h"
+
 #include <iostream>
+#include <map>
 
 #define DEBUG 0
 
 static const char* name = "Page Rank";
 static const char* url  = nullptr;
 
-//! All PageRank algorithm variants use the same constants for ease of
+//! All PageRank algorithm variants use the library's constants for ease of
 //! comparison.
-constexpr static const float ALPHA         = 0.85;
-constexpr static const float INIT_RESIDUAL = 1 - ALPHA;
-
 constexpr static const float TOLERANCE   = 1.0e-3;
 constexpr static const unsigned MAX_ITER = 1000;
 
@@ -49,7 +49,7 @@ static cll::opt<unsigned int> maxIterations(
     cll::init(MAX_ITER));
 
 //! Type definitions.
-typedef float PRTy;
+using lonestar::analytics::PRTy;
 
 template <typename GNode>
 struct TopPair {
@@ -67,14 +67,6 @@ struct TopPair {
 
 //! Helper functions.
 
-PRTy atomicAdd(std::atomic<PRTy>& v, PRTy delta) {
-  PRTy old;
-  do {
-    old = v;
-  } while (!v.compare_exchange_strong(old, old + delta));
-  return old;
-}
-
 template <typename Graph>
 void printTop(Graph& graph, unsigned topn = PRINT_TOP) {
 
@@ -0,0 +1,245 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#include "galois/Galois.h"
+#include "galois/graphs/LCGraph.h"
+#include "Lonestar/BoilerPlate.h"
+#include "Lonestar/Analytics/PersonalizedPageRank.h"
+
+#include "llvm/Support/CommandLine.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+constexpr static const char* const REGION_NAME = "PersonalizedPageRank";
+constexpr static const char* const name        = "Personalized Page Rank";
+constexpr static const char* const desc =
+    "Computes approximate personalized page ranks of a set of source nodes "
+    "by forward push, with Monte Carlo walks for hub sources";
+
+/*******************************************************************************
+ * Declaration of command line arguments
+ ******************************************************************************/
+namespace cll = llvm::cl;
+
+using lonestar::analytics::PersonalizedPageRankPlan;
+using lonestar::analytics::PersonalizedPageRankResult;
+
+static cll::opt<std::string>
+    inputFile(cll::Positional, cll::desc("<input file>"), cll::Required);
+static cll::opt<std::string>
+    sourcesFile("sourcesFile",
+                cll::desc("File with one source node id per line"),
+                cll::init(""));
+static cll::opt<unsigned>
+    numSources("numSources",
+               cll::desc("Without -sourcesFile, use this many sources spread "
+                         "evenly over the node ids (default 16)"),
+               cll::init(16));
+static cll::opt<float> alpha("alpha",
+                             cll::desc("Probability of following an edge "
+                                       "(default 0.85)"),
+                             cll::init(0.85));
+static cll::opt<float>
+    epsilon("epsilon",
+            cll::desc("Residual per out-edge left unpushed (default 1e-6)"),
+            cll::init(1.0e-6));
+static cll::opt<unsigned> topK("topK",
+                               cll::desc("Entries kept per source "
+                                         "(default 100)"),
+                               cll::init(100));
+static cll::opt<unsigned>
+    batchSize("batchSize",
+              cll::desc("Sources pushed together (default 16)"),
+              cll::init(16));
+static cll::opt<uint64_t>
+    hubDegree("hubDegree",
+              cll::desc("Use Monte Carlo for sources with more out-edges "
+                        "(default 0: never)"),
+              cll::init(0));
+static cll::opt<uint64_t>
+    walksPerHub("walksPerHub",
+                cll::desc("Monte Carlo walks per hub source (default 1e5)"),
+                cll::init(100000));
+static cll::opt<uint64_t> seed("seed", cll::desc("Random seed (default 0)"),
+                               cll::init(0));
+static cll::opt<std::string>
+    outputFile("outputFile",
+               cll::desc("[output file: source rank node estimate per line]"),
+               cll::init(""));
+
+/*******************************************************************************
+ * Graph structure declarations + other inits
+ ******************************************************************************/
+
+using Graph = galois::graphs::LC_CSR_Graph<void, void>::with_numa_alloc<
+    true>::type::with_no_lockable<true>::type;
+using GNode = Graph::GraphNode;
+
+/**
+ * Power iteration for one source with the same restart rule: mass at nodes
+ * without out-edges goes back to the source.
+ */
+std::vector<double> exactPPR(Graph& graph, GNode source) {
+  size_t numNodes = graph.size();
+  std::vector<double> pr(numNodes, 0.0), next(numNodes);
+  pr[source] = 1.0;
+  for (unsigned iter = 0; iter < 1000; ++iter) {
+    std::fill(next.begin(), next.end(), 0.0);
+    next[source] = 1 - alpha;
+    for (GNode n : graph) {
+      auto deg = std::distance(graph.edge_begin(n), graph.edge_end(n));
+      if (!deg) {
+        next[source] += alpha * pr[n];
+        continue;
+      }
+      for (auto e : graph.edges(n))
+        next[graph.getEdgeDst(e)] += alpha * pr[n] / deg;
+    }
+    double diff = 0;
+    for (size_t n = 0; n < numNodes; ++n)
+      diff += std::fabs(next[n] - pr[n]);
+    pr.swap(next);
+    if (diff < 1e-12)
+      break;
+  }
+  return pr;
+}
+
+//! Estimates must be within the reported bound of the exact vector
+bool verify(Graph& graph, const PersonalizedPageRankResult& result) {
+  auto exact = exactPPR(graph, result.source);
+  for (auto& entry : result.top) {
+    double error = entry.second - exact[entry.first];
+    // push only underestimates; allow float rounding
+    double slack = 1e-5 + 1e-4 * exact[entry.first];
+    bool bad = result.monteCarlo
+                   ? std::fabs(error) > result.errorBound + slack
+                   : error > slack || -error > result.errorBound + slack;
+    if (bad) {
+      std::cerr << "source " << result.source << " node " << entry.first
+                << ": estimate " << entry.second << ", exact "
+                << exact[entry.first] << ", bound " << result.errorBound
+                << "\n";
+      return false;
+    }
+  }
+  return true;
+}
+
+/*******************************************************************************
+ * Main method for running
+ ******************************************************************************/
+
+int main(int argc, char** argv) {
+  galois::SharedMemSys G;
+  LonestarStart(argc, argv, name, desc, nullptr, &inputFile);
+
+  galois::StatTimer totalTime("TimerTotal");
+  totalTime.start();
+
+  galois::StatTimer graphReadingTimer("GraphConstructTime", REGION_NAME);
+  graphReadingTimer.start();
+  Graph graph;
+  galois::graphs::readGraph(graph, inputFile);
+  graphReadingTimer.stop();
+  std::cout << "Read " << graph.size() << " nodes, " << graph.sizeEdges()
+            << " edges\n";
+  if (!graph.size())
+    GALOIS_DIE("the graph has no nodes");
+
+  std::vector<GNode> sources;
+  if (sourcesFile != "") {
+    std::ifstream in(sourcesFile);
+    if (!in)
+      GALOIS_DIE("cannot open ", sourcesFile);
+    uint64_t id;
+    while (in >> id) {
+      if (id >= graph.size())
+        GALOIS_DIE("source ", id, " is not a node of the graph");
+      sources.push_back(id);
+    }
+  } else {
+    for (unsigned i = 0; i < numSources; ++i)
+      sources.push_back(uint64_t(i) * graph.size() / numSources);
+  }
+  if (sources.empty())
+    GALOIS_DIE("no sources given");
+
+  PersonalizedPageRankPlan plan;
+  plan.alpha       = alpha;
+  plan.epsilon     = epsilon;
+  plan.topK        = topK;
+  plan.batchSize   = batchSize;
+  plan.hubDegree   = hubDegree;
+  plan.walksPerHub = walksPerHub;
+  plan.seed        = seed;
+
+  std::cout << "Running " << sources.size()
+            << " sources, epsilon:" << epsilon << ", batch:" << batchSize
+            << "\n";
+
+  galois::StatTimer execTime("Timer_0");
+  execTime.start();
+  auto results =
+      lonestar::analytics::personalizedPageRank(graph, sources, plan);
+  execTime.stop();
+
+  size_t numMonteCarlo = 0;
+  double maxBound      = 0;
+  for (auto& r : results) {
+    numMonteCarlo += r.monteCarlo;
+    if (!r.monteCarlo)
+      maxBound = std::max<double>(maxBound, r.errorBound);
+  }
+  std::cout << "Monte Carlo sources: " << numMonteCarlo
+            << ", largest push residual: " << maxBound << "\n";
+  galois::runtime::reportStat_Single(REGION_NAME, "MonteCarloSources",
+                                     numMonteCarlo);
+
+  if (outputFile != "") {
+    std::ofstream out(outputFile);
+    if (!out)
+      GALOIS_DIE("cannot open ", outputFile);
+    for (auto& r : results)
+      for (size_t i = 0; i < r.top.size(); ++i)
+        out << r.source << " " << i + 1 << " " << r.top[i].first << " "
+            << r.top[i].second << "\n";
+  }
+
+  if (!skipVerify) {
+    std::cout << "Source " << results[0].source << "\nRank PPR Id\n";
+    for (size_t i = 0; i < results[0].top.size() && i < 10; ++i)
+      std::cout << i + 1 << ": " << results[0].top[i].second << " "
+                << results[0].top[i].first << "\n";
+    if (verify(graph, results[0])) {
+      std::cout << "Verification successful.\n";
+    } else {
+      GALOIS_DIE("verification failed");
+    }
+  }
+
+  totalTime.stop();
+
+  return 0;
+}
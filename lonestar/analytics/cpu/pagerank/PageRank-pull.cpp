@@ -20,7 +20,6 @@
 #include "Lonestar/BoilerPlate.h"
 #include "PageRank-constants.h"
 #include "galois/Galois.h"
-#include "galois/LargeArray.h"
 #include "galois/Timer.h"
 #include "galois/graphs/LCGraph.h"
 #include "galois/graphs/TypeTraits.h"
@@ -29,12 +28,14 @@
 const char* desc =
     "Computes page ranks a la Page and Brin. This is a pull-style algorithm.";
 
-enum Algo { Topo = 0, Residual };
+using lonestar::analytics::PageRankPullPlan;
 
-static cll::opt<Algo> algo("algo", cll::desc("Choose an algorithm:"),
-                           cll::values(clEnumVal(Topo, "Topological"),
-                                       clEnumVal(Residual, "Residual")),
-                           cll::init(Residual));
+static cll::opt<PageRankPullPlan::Algorithm> algo(
+    "algo", cll::desc("Choose an algorithm:"),
+    cll::values(clEnumValN(PageRankPullPlan::topo, "Topo", "Topological"),
+                clEnumValN(PageRankPullPlan::residual, "Residual",
+                           "Residual")),
+    cll::init(PageRankPullPlan::residual));
 
 //! Flag that forces user to be aware that they should be passing in a
 //! transposed graph.
@@ -43,237 +44,9 @@ static cll::opt<bool>
                     cll::desc("Specify that the input graph is transposed"),
                     cll::init(false));
 
-constexpr static const unsigned CHUNK_SIZE = 32;
-
-struct LNode {
-  PRTy value;
-  uint32_t nout;
-};
-
-typedef galois::graphs::LC_CSR_Graph<LNode, void>::with_no_lockable<
-    true>::type ::with_numa_alloc<true>::type Graph;
-typedef typename Graph::GraphNode GNode;
-
-using DeltaArray    = galois::LargeArray<PRTy>;
-using ResidualArray = galois::LargeArray<PRTy>;
-
-//! Initialize nodes for the topological algorithm.
-void initNodeDataTopological(Graph& g) {
-  PRTy init_value = 1.0f / g.size();
-  galois::do_all(
-      galois::iterate(g),
-      [&](const GNode& n) {
-        auto& sdata = g.getData(n, galois::MethodFlag::UNPROTECTED);
-        sdata.value = init_value;
-        sdata.nout  = 0;
-      },
-      galois::no_stats(), galois::loopname("initNodeData"));
-}
-
-//! Initialize nodes for the residual algorithm.
-void initNodeDataResidual(Graph& g, DeltaArray& delta,
-                          ResidualArray& residual) {
-  galois::do_all(
-      galois::iterate(g),
-      [&](const GNode& n) {
-        auto& sdata = g.getData(n, galois::MethodFlag::UNPROTECTED);
-        sdata.value = 0;
-        sdata.nout  = 0;
-        delta[n]    = 0;
-        residual[n] = INIT_RESIDUAL;
-      },
-      galois::no_stats(), galois::loopname("initNodeData"));
-}
-
-//! Computing outdegrees in the tranpose graph is equivalent to computing the
-//! indegrees in the original graph.
-void computeOutDeg(Graph& graph) {
-  galois::StatTimer outDegreeTimer("computeOutDegFunc");
-  outDegreeTimer.start();
-
-  galois::LargeArray<std::atomic<size_t>> vec;
-  vec.allocateInterleaved(graph.size());
-
-  galois::do_all(
-      galois::iterate(graph),
-      [&](const GNode& src) { vec.constructAt(src, 0ul); }, galois::no_stats(),
-      galois::loopname("InitDegVec"));
-
-  galois::do_all(
-      galois::iterate(graph),
-      [&](const GNode& src) {
-        for (auto nbr : graph.edges(src)) {
-          GNode dst = graph.getEdgeDst(nbr);
-          vec[dst].fetch_add(1ul);
-        };
-      },
-      galois::steal(), galois::chunk_size<CHUNK_SIZE>(), galois::no_stats(),
-      galois::loopname("computeOutDeg"));
-
-  galois::do_all(
-      galois::iterate(graph),
-      [&](const GNode& src) {
-        auto& srcData = graph.getData(src, galois::MethodFlag::UNPROTECTED);
-        srcData.nout  = vec[src];
-      },
-      galois::no_stats(), galois::loopname("CopyDeg"));
-
-  outDegreeTimer.stop();
-}
-
-/**
- * It does not calculate the pagerank for each iteration,
- * but only calculate the residual to be added from the previous pagerank to
- * the current one.
- * If the residual is smaller than the tolerance, that is not reflected to
- * the next pagerank.
- */
-//! [scalarreduction]
-void computePRResidual(Graph& graph, DeltaArray& delta,
-                       ResidualArray& residual) {
-  unsigned int iterations = 0;
-  galois::GAccumulator<unsigned int> accum;
-
-  while (true) {
-    galois::do_all(
-        galois::iterate(graph),
-        [&](const GNode& src) {
-          auto& sdata = graph.getData(src);
-          delta[src]  = 0;
-
-          //! Only the residual higher than tolerance will be reflected
-          //! to the pagerank.
-          if (residual[src] > tolerance) {
-            PRTy oldResidual = residual[src];
-            residual[src]    = 0.0;
-            sdata.value += oldResidual;
-            if (sdata.nout > 0) {
-              delta[src] = oldResidual * ALPHA / sdata.nout;
-              accum += 1;
-            }
-          }
-        },
-        galois::no_stats(), galois::loopname("PageRank_delta"));
-
-    galois::do_all(
-        galois::iterate(graph),
-        [&](const GNode& src) {
-          float sum = 0;
-          for (auto nbr : graph.edges(src)) {
-            GNode dst = graph.getEdgeDst(nbr);
-            if (delta[dst] > 0) {
-              sum += delta[dst];
-            }
-          }
-          if (sum > 0) {
-            residual[src] = sum;
-          }
-        },
-        galois::steal(), galois::chunk_size<CHUNK_SIZE>(), galois::no_stats(),
-        galois::loopname("PageRank"));
-
-#if DEBUG
-    std::cout << "iteration: " << iterations << "\n";
-#endif
-    iterations++;
-    if (iterations >= maxIterations || !accum.reduce()) {
-      break;
-    }
-    accum.reset();
-  } ///< End while(true).
-    //! [scalarreduction]
-
-  if (iterations >= maxIterations) {
-    std::cerr << "ERROR: failed to converge in " << iterations
-              << " iterations\n";
-  }
-}
-
-/**
- * PageRank pull topological.
- * Always calculate the new pagerank for each iteration.
- */
-void computePRTopological(Graph& graph) {
-  unsigned int iteration = 0;
-  galois::GAccumulator<float> accum;
-
-  float base_score = (1.0f - ALPHA) / graph.size();
-  while (true) {
-    galois::do_all(
-        galois::iterate(graph),
-        [&](const GNode& src) {
-          constexpr const galois::MethodFlag flag =
-              galois::MethodFlag::UNPROTECTED;
-
-          LNode& sdata = graph.getData(src, flag);
-          float sum    = 0.0;
-
-          for (auto jj = graph.edge_begin(src, flag),
-                    ej = graph.edge_end(src, flag);
-               jj != ej; ++jj) {
-            GNode dst = graph.getEdgeDst(jj);
-
-            LNode& ddata = graph.getData(dst, flag);
-            sum += ddata.value / ddata.nout;
-          }
-
-          //! New value of pagerank after computing contributions from
-          //! incoming edges in the original graph.
-          float value = sum * ALPHA + base_score;
-          //! Find the delta in new and old pagerank values.
-          float diff = std::fabs(value - sdata.value);
-
-          //! Do not update pagerank before the diff is computed since
-          //! there is a data dependence on the pagerank value.
-          sdata.value = value;
-          accum += diff;
-        },
-        galois::no_stats(), galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
-        galois::loopname("PageRank"));
-
-#if DEBUG
-    std::cout << "iteration: " << iteration << " max delta: " << delta << "\n";
-#endif
-
-    iteration += 1;
-    if (accum.reduce() <= tolerance || iteration >= maxIterations) {
-      break;
-    }
-    accum.reset();
-
-  } ///< End while(true).
-
-  galois::runtime::reportStat_Single("PageRank", "Rounds", iteration);
-  if (iteration >= maxIterations) {
-    std::cerr << "ERROR: failed to converge in " << iteration
-              << " iterations\n";
-  }
-}
-
-void prTopological(Graph& graph) {
-  initNodeDataTopological(graph);
-  computeOutDeg(graph);
-
-  galois::StatTimer execTime("Timer_0");
-  execTime.start();
-  computePRTopological(graph);
-  execTime.stop();
-}
-
-void prResidual(Graph& graph) {
-  DeltaArray delta;
-  delta.allocateInterleaved(graph.size());
-  ResidualArray residual;
-  residual.allocateInterleaved(graph.size());
-
-  initNodeDataResidual(graph, delta, residual);
-  computeOutDeg(graph);
-
-  galois::StatTimer execTime("Timer_0");
-  execTime.start();
-  computePRResidual(graph, delta, residual);
-  execTime.stop();
-}
+typedef galois::graphs::LC_CSR_Graph<lonestar::analytics::PageRankPullNode,
+                                     void>::with_no_lockable<true>::type ::
+    with_numa_alloc<true>::type Graph;
 
 int main(int argc, char** argv) {
   galois::SharedMemSys G;
@@ -303,20 +76,23 @@ int main(int argc, char** argv) {
                                         galois::runtime::pagePoolSize());
   galois::reportPageAlloc("MeminfoPre");
 
-  switch (algo) {
-  case Topo:
-    std::cout << "Running Pull Topological version, tolerance:" << tolerance
-              << ", maxIterations:" << maxIterations << "\n";
-    prTopological(transposeGraph);
-    break;
-  case Residual:
-    std::cout << "Running Pull Residual version, tolerance:" << tolerance
-              << ", maxIterations:" << maxIterations << "\n";
-    prResidual(transposeGraph);
-    break;
-  default:
-    std::abort();
-  }
+  std::cout << "Running Pull "
+            << (algo == PageRankPullPlan::topo ? "Topological" : "Residual")
+            << " version, tolerance:" << tolerance
+            << ", maxIterations:" << maxIterations << "\n";
+
+  PageRankPullPlan plan;
+  plan.algorithm     = algo;
+  plan.tolerance     = tolerance;
+  plan.maxIterations = maxIterations;
+
+  lonestar::analytics::initPageRankPull(transposeGraph, plan);
+  plan.initialize = false;
+
+  galois::StatTimer execTime("Timer_0");
+  execTime.start();
+  lonestar::analytics::pageRankPull(transposeGraph, plan);
+  execTime.stop();
 
   galois::reportPageAlloc("MeminfoPost");
 
@@ -19,173 +19,25 @@
 
 #include "Lonestar/BoilerPlate.h"
 #include "PageRank-constants.h"
-#include "galois/Bag.h"
 #include "galois/Galois.h"
 #include "galois/Timer.h"
 #include "galois/graphs/LCGraph.h"
 #include "galois/graphs/TypeTraits.h"
 
-/**
- * These implementations are based on the Push-based PageRank computation
- * (Algorithm 4) as described in the PageRank Europar 2015 paper.
- *
- * WHANG, Joyce Jiyoung, et al. Scalable data-driven pagerank: Algorithms,
- * system issues, and lessons learned. In: European Conference on Parallel
- * Processing. Springer, Berlin, Heidelberg, 2015. p. 438-450.
- */
-
 const char* desc =
     "Computes page ranks a la Page and Brin. This is a push-style algorithm.";
 
-constexpr static const unsigned CHUNK_SIZE = 16;
+using lonestar::analytics::PageRankPushPlan;
 
-enum Algo { Async, Sync }; ///< Async has better asbolute performance.
+static cll::opt<PageRankPushPlan::Algorithm>
+    algo("algo", cll::desc("Choose an algorithm:"),
+         cll::values(clEnumValN(PageRankPushPlan::async, "Async", "Async"),
+                     clEnumValN(PageRankPushPlan::sync, "Sync", "Sync")),
+         cll::init(PageRankPushPlan::async));
 
-static cll::opt<Algo> algo("algo", cll::desc("Choose an algorithm:"),
-                           cll::values(clEnumVal(Async, "Async"),
-                                       clEnumVal(Sync, "Sync")),
-                           cll::init(Async));
-
-struct LNode {
-  PRTy value;
-  std::atomic<PRTy> residual;
-
-  void init() {
-    value    = 0.0;
-    residual = INIT_RESIDUAL;
-  }
-
-  friend std::ostream& operator<<(std::ostream& os, const LNode& n) {
-    os << "{PR " << n.value << ", residual " << n.residual << "}";
-    return os;
-  }
-};
-
-typedef galois::graphs::LC_CSR_Graph<LNode, void>::with_numa_alloc<
-    true>::type ::with_no_lockable<true>::type Graph;
-typedef typename Graph::GraphNode GNode;
-
-void asyncPageRank(Graph& graph) {
-  typedef galois::worklists::PerSocketChunkFIFO<CHUNK_SIZE> WL;
-  galois::for_each(
-      galois::iterate(graph),
-      [&](GNode src, auto& ctx) {
-        LNode& sdata = graph.getData(src);
-        constexpr const galois::MethodFlag flag =
-            galois::MethodFlag::UNPROTECTED;
-
-        if (sdata.residual > tolerance) {
-          PRTy oldResidual = sdata.residual.exchange(0.0);
-          sdata.value += oldResidual;
-          int src_nout = std::distance(graph.edge_begin(src, flag),
-                                       graph.edge_end(src, flag));
-          if (src_nout > 0) {
-            PRTy delta = oldResidual * ALPHA / src_nout;
-            //! For each out-going neighbors.
-            for (auto jj : graph.edges(src, flag)) {
-              GNode dst    = graph.getEdgeDst(jj);
-              LNode& ddata = graph.getData(dst, flag);
-              if (delta > 0) {
-                auto old = atomicAdd(ddata.residual, delta);
-                if ((old < tolerance) && (old + delta >= tolerance)) {
-                  ctx.push(dst);
-                }
-              }
-            }
-          }
-        }
-      },
-      galois::loopname("PushResidualAsync"),
-      galois::disable_conflict_detection(), galois::no_stats(),
-      galois::wl<WL>());
-}
-
-void syncPageRank(Graph& graph) {
-  struct Update {
-    PRTy delta;
-    Graph::edge_iterator beg;
-    Graph::edge_iterator end;
-  };
-
-  constexpr ptrdiff_t EDGE_TILE_SIZE = 128;
-
-  galois::InsertBag<Update> updates;
-  galois::InsertBag<GNode> activeNodes;
-
-  galois::do_all(
-      galois::iterate(graph), [&](const GNode& src) { activeNodes.push(src); },
-      galois::no_stats());
-
-  size_t iter = 0;
-  for (; !activeNodes.empty() && iter < maxIterations; ++iter) {
-    galois::do_all(
-        galois::iterate(activeNodes),
-        [&](const GNode& src) {
-          constexpr const galois::MethodFlag flag =
-              galois::MethodFlag::UNPROTECTED;
-          LNode& sdata = graph.getData(src, flag);
-
-          if (sdata.residual > tolerance) {
-            PRTy oldResidual = sdata.residual;
-            sdata.value += oldResidual;
-            sdata.residual = 0.0;
-
-            int src_nout = std::distance(graph.edge_begin(src, flag),
-                                         graph.edge_end(src, flag));
-            PRTy delta   = oldResidual * ALPHA / src_nout;
-
-            auto beg       = graph.edge_begin(src, flag);
-            const auto end = graph.edge_end(src, flag);
-
-            assert(beg <= end);
-
-            //! Edge tiling for large outdegree nodes.
-            if ((end - beg) > EDGE_TILE_SIZE) {
-              for (; beg + EDGE_TILE_SIZE < end;) {
-                auto ne = beg + EDGE_TILE_SIZE;
-                updates.push(Update{delta, beg, ne});
-                beg = ne;
-              }
-            }
-
-            if ((end - beg) > 0) {
-              updates.push(Update{delta, beg, end});
-            }
-          }
-        },
-        galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
-        galois::loopname("CreateEdgeTiles"), galois::no_stats());
-
-    activeNodes.clear();
-
-    galois::do_all(
-        galois::iterate(updates),
-        [&](const Update& up) {
-          constexpr const galois::MethodFlag flag =
-              galois::MethodFlag::UNPROTECTED;
-          //! For each out-going neighbors.
-          for (auto jj = up.beg; jj != up.end; ++jj) {
-            GNode dst    = graph.getEdgeDst(jj);
-            LNode& ddata = graph.getData(dst, flag);
-            auto old     = atomicAdd(ddata.residual, up.delta);
-            //! If fabs(old) is greater than tolerance, then it would
-            //! already have been processed in the previous do_all
-            //! loop.
-            if ((old <= tolerance) && (old + up.delta >= tolerance)) {
-              activeNodes.push(dst);
-            }
-          }
-        },
-        galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
-        galois::loopname("PushResidualSync"), galois::no_stats());
-
-    updates.clear();
-  }
-
-  if (iter >= maxIterations) {
-    std::cerr << "ERROR: failed to converge in " << iter << " iterations\n";
-  }
-}
+typedef galois::graphs::LC_CSR_Graph<lonestar::analytics::PageRankPushNode,
+                                     void>::with_numa_alloc<true>::type ::
+    with_no_lockable<true>::type Graph;
 
 int main(int argc, char** argv) {
   galois::SharedMemSys G;
@@ -207,28 +59,21 @@ int main(int argc, char** argv) {
   std::cout << "tolerance:" << tolerance << ", maxIterations:" << maxIterations
             << "\n";
 
-  galois::do_all(
-      galois::iterate(graph), [&graph](GNode n) { graph.getData(n).init(); },
-      galois::no_stats(), galois::loopname("Initialize"));
-
-  galois::StatTimer execTime("Timer_0");
-  execTime.start();
-
-  switch (algo) {
-  case Async:
-    std::cout << "Running Edge Async push version,";
-    asyncPageRank(graph);
-    break;
+  PageRankPushPlan plan;
+  plan.algorithm     = algo;
+  plan.tolerance     = tolerance;
+  plan.maxIterations = maxIterations;
 
-  case Sync:
-    std::cout << "Running Edge Sync push version,";
-    syncPageRank(graph);
-    break;
+  lonestar::analytics::initPageRankPush(graph, plan);
+  plan.initialize = false;
 
-  default:
-    std::abort();
-  }
+  std::cout << "Running Edge "
+            << (algo == PageRankPushPlan::async ? "Async" : "Sync")
+            << " push version,";
 
+  galois::StatTimer execTime("Timer_0");
+  execTime.start();
+  lonestar::analytics::pageRankPush(graph, plan);
   execTime.stop();
 
   galois::reportPageAlloc("MeminfoPost");
@@ -0,0 +1,249 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#include "galois/Galois.h"
+#include "galois/ParallelSTL.h"
+#include "galois/Reduction.h"
+#include "galois/graphs/LCGraph.h"
+#include "Lonestar/BoilerPlate.h"
+#include "Lonestar/Analytics/RandomWalk.h"
+
+#include "llvm/Support/CommandLine.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+constexpr static const char* const REGION_NAME = "RandomWalks";
+constexpr static const char* const name        = "Random Walks";
+constexpr static const char* const desc =
+    "Generates a corpus of random walks for DeepWalk and node2vec style "
+    "embeddings";
+
+/*******************************************************************************
+ * Declaration of command line arguments
+ ******************************************************************************/
+namespace cll = llvm::cl;
+
+using lonestar::analytics::RandomWalkPlan;
+using lonestar::analytics::WalkBatch;
+
+static cll::opt<std::string>
+    inputFile(cll::Positional, cll::desc("<input file>"), cll::Required);
+
+static cll::opt<RandomWalkPlan::Algorithm> algo(
+    "algo", cll::desc("Choose the transitions (default Uniform):"),
+    cll::values(
+        clEnumValN(RandomWalkPlan::uniform, "Uniform",
+                   "Every out-edge equally likely"),
+        clEnumValN(RandomWalkPlan::weighted, "Weighted",
+                   "Out-edges in proportion to their weight"),
+        clEnumValN(RandomWalkPlan::node2vec, "Node2vec",
+                   "Second order with -p and -q"),
+        clEnumValN(RandomWalkPlan::weightedNode2vec, "WeightedNode2vec",
+                   "Second order with -p and -q over weighted edges")),
+    cll::init(RandomWalkPlan::uniform));
+
+static cll::opt<uint32_t> walkLength("walkLength",
+                                     cll::desc("Nodes per walk (default 80)"),
+                                     cll::init(80));
+static cll::opt<uint32_t>
+    walksPerNode("walksPerNode",
+                 cll::desc("Walks started from every node (default 10)"),
+                 cll::init(10));
+static cll::opt<double>
+    returnParam("p", cll::desc("node2vec return parameter (default 1)"),
+                cll::init(1.0));
+static cll::opt<double>
+    inOutParam("q", cll::desc("node2vec in-out parameter (default 1)"),
+               cll::init(1.0));
+static cll::opt<uint64_t> seed("seed", cll::desc("Random seed (default 0)"),
+                               cll::init(0));
+static cll::opt<size_t>
+    batchSize("batchSize",
+              cll::desc("Walks held in memory at a time (default 2^20)"),
+              cll::init(size_t(1) << 20));
+static cll::opt<std::string>
+    outputFile("outputFile",
+               cll::desc("[output file: one walk per line, node ids "
+                         "separated by spaces]"),
+               cll::init(""));
+
+/*******************************************************************************
+ * Graph structure declarations + other inits
+ ******************************************************************************/
+
+using Graph =
+    galois::graphs::LC_CSR_Graph<void, uint32_t>::with_no_lockable<true>::type;
+using GNode = Graph::GraphNode;
+
+/**
+ * Formats a batch in parallel, one contiguous range of walks per thread, and
+ * writes the pieces in order so the file does not depend on the number of
+ * threads.
+ */
+class WalkWriter {
+  FILE* file;
+  galois::substrate::PerThreadStorage<std::string> buffers;
+
+public:
+  explicit WalkWriter(const std::string& filename)
+      : file(std::fopen(filename.c_str(), "w")) {
+    if (!file)
+      GALOIS_SYS_DIE("cannot open ", filename);
+  }
+  ~WalkWriter() { std::fclose(file); }
+
+  void write(const WalkBatch& batch) {
+    unsigned numBlocks = galois::getActiveThreads();
+    galois::on_each([&](unsigned tid, unsigned) {
+      auto r   = galois::ParallelSTL::internal::blockRange(batch.size(),
+                                                         numBlocks, tid);
+      auto& out = *buffers.getLocal();
+      out.clear();
+      for (size_t i = r.first; i < r.second; ++i) {
+        for (const uint32_t* n = batch.begin(i); n != batch.end(i); ++n) {
+          if (n != batch.begin(i))
+            out.push_back(' ');
+          out += std::to_string(*n);
+        }
+        out.push_back('\n');
+      }
+    });
+    for (unsigned t = 0; t < numBlocks; ++t) {
+      auto& out = *buffers.getRemote(t);
+      if (std::fwrite(out.data(), 1, out.size(), file) != out.size())
+        GALOIS_SYS_DIE("failed writing walks");
+    }
+  }
+};
+
+//! Every step follows an edge and walks only stop early at sinks
+bool verifyBatch(Graph& graph, const WalkBatch& batch) {
+  galois::GReduceLogicalAnd ok;
+  galois::do_all(
+      galois::iterate(size_t(0), batch.size()),
+      [&](size_t i) {
+        const uint32_t* walk = batch.begin(i);
+        uint32_t len         = batch.length(i);
+        ok.update(len >= 1 && walk[0] == (batch.firstWalk + i) % graph.size());
+        for (uint32_t k = 1; k < len; ++k) {
+          auto last = graph.edge_end(walk[k - 1]);
+          auto e    = std::lower_bound(
+              graph.edge_begin(walk[k - 1]), last, walk[k],
+              [&](Graph::edge_iterator e, GNode d) {
+                return graph.getEdgeDst(e) < d;
+              });
+          ok.update(e != last && graph.getEdgeDst(e) == walk[k]);
+        }
+        if (len < batch.walkLength)
+          ok.update(graph.edge_begin(walk[len - 1]) ==
+                    graph.edge_end(walk[len - 1]));
+      },
+      galois::no_stats());
+  return ok.reduce();
+}
+
+/*******************************************************************************
+ * Main method for running
+ ******************************************************************************/
+
+int main(int argc, char** argv) {
+  galois::SharedMemSys G;
+  LonestarStart(argc, argv, name, desc, nullptr, &inputFile);
+
+  galois::StatTimer totalTime("TimerTotal");
+  totalTime.start();
+
+  bool weighted = algo == RandomWalkPlan::weighted ||
+                  algo == RandomWalkPlan::weightedNode2vec;
+
+  galois::StatTimer graphReadingTimer("GraphConstructTime", REGION_NAME);
+  graphReadingTimer.start();
+  Graph graph;
+  galois::graphs::readGraph(graph, inputFile, !weighted);
+  // node2vec looks up edges by binary search
+  graph.sortAllEdgesByDst(galois::MethodFlag::UNPROTECTED);
+  graphReadingTimer.stop();
+  std::cout << "Read " << graph.size() << " nodes, " << graph.sizeEdges()
+            << " edges\n";
+
+  RandomWalkPlan plan;
+  plan.algorithm    = algo;
+  plan.walkLength   = walkLength;
+  plan.walksPerNode = walksPerNode;
+  plan.p            = returnParam;
+  plan.q            = inOutParam;
+  plan.seed         = seed;
+  plan.batchSize    = batchSize;
+
+  std::cout << "Running " << lonestar::analytics::algorithmName(algo)
+            << " walks of length " << walkLength << ", " << walksPerNode
+            << " per node\n";
+
+  std::unique_ptr<WalkWriter> writer;
+  if (outputFile != "")
+    writer = std::make_unique<WalkWriter>(outputFile);
+
+  galois::StatTimer execTime("Timer_0");
+  galois::StatTimer writeTime("WriteTime", REGION_NAME);
+  uint64_t numWalks = 0, numSteps = 0;
+  bool verified     = true;
+
+  execTime.start();
+  lonestar::analytics::randomWalks(graph, plan, [&](const WalkBatch& batch) {
+    execTime.stop();
+    numWalks += batch.size();
+    galois::GAccumulator<uint64_t> steps;
+    galois::do_all(
+        galois::iterate(size_t(0), batch.size()),
+        [&](size_t i) { steps += batch.length(i); }, galois::no_stats());
+    numSteps += steps.reduce();
+    if (!skipVerify)
+      verified = verifyBatch(graph, batch) && verified;
+    if (writer) {
+      writeTime.start();
+      writer->write(batch);
+      writeTime.stop();
+    }
+    execTime.start();
+  });
+  execTime.stop();
+  writer.reset();
+
+  std::cout << "Generated " << numWalks << " walks with " << numSteps
+            << " nodes\n";
+  galois::runtime::reportStat_Single(REGION_NAME, "NumWalks", numWalks);
+  galois::runtime::reportStat_Single(REGION_NAME, "NumWalkNodes", numSteps);
+
+  if (!skipVerify) {
+    if (verified) {
+      std::cout << "Verification successful.\n";
+    } else {
+      GALOIS_DIE("verification failed: a walk leaves the graph's edges");
+    }
+  }
+
+  totalTime.stop();
+
+  return 0;
+}
@@ -0,0 +1,241 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#include "galois/Galois.h"
+#include "galois/Reduction.h"
+#include "galois/graphs/GraphMetadata.h"
+#include "galois/graphs/LC_CSR_CSC_Graph.h"
+#include "Lonestar/BoilerPlate.h"
+#include "Lonestar/Analytics/SCC.h"
+
+#include "llvm/Support/CommandLine.h"
+
+#include <atomic>
+#include <deque>
+#include <iostream>
+#include <vector>
+
+constexpr static const char* const REGION_NAME = "SCC";
+constexpr static const char* const name = "Strongly Connected Components";
+constexpr static const char* const desc =
+    "Computes the strongly connected components of a directed graph";
+
+/*******************************************************************************
+ * Declaration of command line arguments
+ ******************************************************************************/
+namespace cll = llvm::cl;
+
+using lonestar::analytics::SCCPlan;
+
+static cll::opt<std::string>
+    inputFile(cll::Positional, cll::desc("<input file>"), cll::Required);
+
+static cll::opt<SCCPlan::Algorithm> algo(
+    "algo", cll::desc("Choose an algorithm (default FwBwColor):"),
+    cll::values(clEnumValN(SCCPlan::fwbwColor, "FwBwColor",
+                           "Forward-backward from a pivot, then coloring"),
+                clEnumValN(SCCPlan::color, "Color", "Coloring only")),
+    cll::init(SCCPlan::fwbwColor));
+
+static cll::opt<bool>
+    trim("trim",
+         cll::desc("Peel nodes without live in- or out-neighbors between "
+                   "phases (default true)"),
+         cll::init(true));
+
+static cll::opt<std::string> condensationFilename(
+    "outputCondensation",
+    cll::desc("[output file for the condensation DAG in .gr format]"),
+    cll::init(""));
+
+/*******************************************************************************
+ * Graph structure declarations + other inits
+ ******************************************************************************/
+
+using Graph = galois::graphs::LC_CSR_CSC_Graph<lonestar::analytics::SCCNode,
+                                               void, false, true>;
+using GNode = Graph::GraphNode;
+
+/**
+ * Every node must be reached from its representative, and reach it, without
+ * leaving its component. Both searches start from all representatives at
+ * once since components are disjoint.
+ */
+template <bool Forward>
+bool reachesWholeComponents(Graph& graph) {
+  std::vector<std::atomic<bool>> reached(graph.size());
+  galois::InsertBag<GNode> roots;
+  galois::do_all(
+      galois::iterate(graph),
+      [&](GNode n) {
+        bool isRoot = graph.getData(n).component == n;
+        reached[n]  = isRoot;
+        if (isRoot)
+          roots.push(n);
+      },
+      galois::no_stats());
+
+  auto visit = [&](GNode n, GNode next, auto& ctx) {
+    if (graph.getData(next).component == graph.getData(n).component &&
+        !reached[next] && !reached[next].exchange(true))
+      ctx.push(next);
+  };
+  galois::for_each(
+      galois::iterate(roots),
+      [&](GNode n, auto& ctx) {
+        if (Forward) {
+          for (auto e : graph.edges(n))
+            visit(n, graph.getEdgeDst(e), ctx);
+        } else {
+          for (auto e : graph.in_edges(n))
+            visit(n, graph.getInEdgeDst(e), ctx);
+        }
+      },
+      galois::disable_conflict_detection(), galois::no_stats());
+
+  galois::GReduceLogicalAnd all;
+  galois::do_all(
+      galois::iterate(graph), [&](GNode n) { all.update(reached[n]); },
+      galois::no_stats());
+  return all.reduce();
+}
+
+//! Kahn's algorithm: a DAG can be emptied by removing sources
+bool isAcyclic(galois::graphs::FileGraph& dag) {
+  std::vector<uint64_t> inDegree(dag.size(), 0);
+  for (auto n : dag)
+    for (auto e : dag.edges(n))
+      ++inDegree[dag.getEdgeDst(e)];
+
+  std::deque<uint32_t> sources;
+  for (uint32_t n = 0; n < dag.size(); ++n)
+    if (!inDegree[n])
+      sources.push_back(n);
+  size_t removed = 0;
+  while (!sources.empty()) {
+    uint32_t n = sources.front();
+    sources.pop_front();
+    ++removed;
+    for (auto e : dag.edges(n))
+      if (!--inDegree[dag.getEdgeDst(e)])
+        sources.push_back(dag.getEdgeDst(e));
+  }
+  return removed == dag.size();
+}
+
+bool verify(Graph& graph, galois::graphs::FileGraph& condensation) {
+  galois::GReduceLogicalAnd decided;
+  galois::do_all(
+      galois::iterate(graph),
+      [&](GNode n) {
+        uint32_t c = graph.getData(n).component;
+        decided.update(c < graph.size() && graph.getData(c).component == c);
+      },
+      galois::no_stats());
+  if (!decided.reduce()) {
+    std::cerr << "a node has no valid representative\n";
+    return false;
+  }
+  if (!reachesWholeComponents<true>(graph) ||
+      !reachesWholeComponents<false>(graph)) {
+    std::cerr << "a component is not strongly connected\n";
+    return false;
+  }
+  // strongly connected parts that are not maximal leave a cycle behind
+  if (!isAcyclic(condensation)) {
+    std::cerr << "the condensation has a cycle\n";
+    return false;
+  }
+  return true;
+}
+
+/*******************************************************************************
+ * Main method for running
+ ******************************************************************************/
+
+int main(int argc, char** argv) {
+  galois::SharedMemSys G;
+  LonestarStart(argc, argv, name, desc, nullptr, &inputFile);
+
+  galois::StatTimer totalTime("TimerTotal");
+  totalTime.start();
+
+  galois::StatTimer graphReadingTimer("GraphConstructTime", REGION_NAME);
+  graphReadingTimer.start();
+  Graph graph;
+  graph.readAndConstructBiGraphFromGRFile(inputFile);
+  graphReadingTimer.stop();
+  std::cout << "Read " << graph.size() << " nodes, " << graph.sizeEdges()
+            << " edges\n";
+
+  galois::preAlloc(
+      std::max(size_t{galois::getActiveThreads()} * (graph.size() / 1000000),
+               std::max(10U, galois::getActiveThreads()) * size_t{10}));
+  galois::reportPageAlloc("MemAllocPre");
+
+  SCCPlan plan;
+  plan.algorithm = algo;
+  plan.trim      = trim;
+
+  std::cout << "Running " << lonestar::analytics::algorithmName(algo)
+            << " algorithm" << (trim ? " with trimming" : "") << "\n";
+
+  galois::StatTimer execTime("Timer_0");
+  execTime.start();
+  lonestar::analytics::scc(graph, plan);
+  execTime.stop();
+
+  galois::reportPageAlloc("MemAllocPost");
+
+  size_t numComponents = lonestar::analytics::sccCount(graph);
+  std::cout << "Number of strongly connected components: " << numComponents
+            << "\n";
+  galois::runtime::reportStat_Single(REGION_NAME, "NumComponents",
+                                     numComponents);
+
+  if (!skipVerify || condensationFilename != "") {
+    galois::StatTimer condenseTime("CondensationTime", REGION_NAME);
+    condenseTime.start();
+    galois::graphs::FileGraphWriter condensation;
+    lonestar::analytics::sccCondensation(graph, condensation);
+    condenseTime.stop();
+    std::cout << "Condensation has " << condensation.size() << " nodes, "
+              << condensation.sizeEdges() << " edges\n";
+
+    if (!skipVerify) {
+      if (verify(graph, condensation)) {
+        std::cout << "Verification successful.\n";
+      } else {
+        GALOIS_DIE("verification failed");
+      }
+    }
+
+    if (condensationFilename != "") {
+      auto meta = condensation.computeMetadata(
+          galois::graphs::GraphMetadata::VOID_TYPE);
+      condensation.toFile(condensationFilename);
+      galois::graphs::writeGraphMetadata(condensationFilename, meta);
+      std::cout << "Wrote condensation to " << condensationFilename << "\n";
+    }
+  }
+
+  totalTime.stop();
+
+  return 0;
+}
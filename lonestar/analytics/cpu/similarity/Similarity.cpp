@@ -0,0 +1,284 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#include "galois/Galois.h"
+#include "galois/graphs/LCGraph.h"
+#include "Lonestar/BoilerPlate.h"
+#include "Lonestar/Analytics/Similarity.h"
+
+#include "llvm/Support/CommandLine.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+constexpr static const char* const REGION_NAME = "Similarity";
+constexpr static const char* const name        = "Neighborhood Similarity";
+constexpr static const char* const desc =
+    "Finds the most similar nodes of every node by their shared neighbors, "
+    "for link prediction and deduplication";
+
+/*******************************************************************************
+ * Declaration of command line arguments
+ ******************************************************************************/
+namespace cll = llvm::cl;
+
+using lonestar::analytics::SimilarityBatch;
+using lonestar::analytics::SimilarityPlan;
+
+static cll::opt<std::string>
+    inputFile(cll::Positional, cll::desc("<input file>"), cll::Required);
+
+static cll::opt<SimilarityPlan::Measure> measure(
+    "measure", cll::desc("Choose a similarity measure (default Jaccard):"),
+    cll::values(clEnumValN(SimilarityPlan::jaccard, "Jaccard",
+                           "Shared over all neighbors"),
+                clEnumValN(SimilarityPlan::cosine, "Cosine",
+                           "Shared over the geometric mean of the degrees"),
+                clEnumValN(SimilarityPlan::overlap, "Overlap",
+                           "Shared over the smaller degree"),
+                clEnumValN(SimilarityPlan::adamicAdar, "AdamicAdar",
+                           "Shared neighbors weighted by 1 / log degree")),
+    cll::init(SimilarityPlan::jaccard));
+
+static cll::opt<unsigned> topK("topK",
+                               cll::desc("Similar nodes kept per node "
+                                         "(default 10)"),
+                               cll::init(10));
+static cll::opt<double>
+    threshold("threshold",
+              cll::desc("Drop pairs less similar than this (default 0)"),
+              cll::init(0));
+static cll::opt<bool>
+    allPairs("allPairs",
+             cll::desc("Report every pair at least -threshold similar "
+                       "instead of the top-k of every node"),
+             cll::init(false));
+static cll::opt<bool>
+    excludeNeighbors("excludeNeighbors",
+                     cll::desc("Leave out pairs that are already neighbors"),
+                     cll::init(false));
+static cll::opt<uint64_t>
+    maxDegree("maxDegree",
+              cll::desc("Do not count common neighbors with more neighbors "
+                        "than this (default 0: count all)"),
+              cll::init(0));
+static cll::opt<size_t>
+    batchSize("batchSize",
+              cll::desc("Nodes whose results are held in memory at a time "
+                        "(default 2^16)"),
+              cll::init(size_t(1) << 16));
+static cll::opt<std::string>
+    outputFile("outputFile",
+               cll::desc("[output file: node similar-node score per line]"),
+               cll::init(""));
+
+/*******************************************************************************
+ * Graph structure declarations + other inits
+ ******************************************************************************/
+
+using Graph = galois::graphs::LC_CSR_Graph<void, void>::with_numa_alloc<
+    true>::type::with_no_lockable<true>::type;
+using GNode = Graph::GraphNode;
+
+//! Nodes checked against a direct computation
+constexpr static const size_t NUM_CHECKED = 64;
+
+/**
+ * Scores of all candidates of u computed directly from the plan's rules, to
+ * compare with the library's answer.
+ */
+std::map<GNode, double> directScores(Graph& graph, GNode u,
+                                     const SimilarityPlan& plan) {
+  auto degree = [&](GNode n) {
+    return std::distance(graph.edge_begin(n), graph.edge_end(n));
+  };
+  std::map<GNode, double> common;
+  for (auto e : graph.edges(u)) {
+    GNode w = graph.getEdgeDst(e);
+    if (w == u || (plan.maxDegree && uint64_t(degree(w)) > plan.maxDegree))
+      continue;
+    for (auto f : graph.edges(w)) {
+      GNode v = graph.getEdgeDst(f);
+      if (v == u || (plan.allPairs && v < u))
+        continue;
+      common[v] += plan.measure == SimilarityPlan::adamicAdar
+                       ? 1.0 / std::log(std::max<double>(degree(w), 2))
+                       : 1.0;
+    }
+  }
+  if (plan.excludeNeighbors)
+    for (auto e : graph.edges(u))
+      common.erase(graph.getEdgeDst(e));
+
+  std::map<GNode, double> scores;
+  double du = degree(u);
+  for (auto& c : common) {
+    double dv = degree(c.first), s = c.second;
+    switch (plan.measure) {
+    case SimilarityPlan::jaccard:
+      s = s / (du + dv - s);
+      break;
+    case SimilarityPlan::cosine:
+      s = s / std::sqrt(du * dv);
+      break;
+    case SimilarityPlan::overlap:
+      s = s / std::min(du, dv);
+      break;
+    default:
+      break;
+    }
+    if (s >= plan.threshold)
+      scores[c.first] = s;
+  }
+  return scores;
+}
+
+/**
+ * Every reported score must be right and, for top-k, nothing left out may be
+ * more similar than what was kept.
+ */
+bool verifyNode(Graph& graph, const SimilarityBatch& batch, size_t i,
+                const SimilarityPlan& plan) {
+  GNode u     = batch.firstNode + i;
+  auto scores = directScores(graph, u, plan);
+  size_t n    = batch.end(i) - batch.begin(i);
+  size_t want = plan.allPairs ? scores.size()
+                              : std::min<size_t>(plan.topK, scores.size());
+  if (n != want) {
+    std::cerr << "node " << u << ": " << n << " similar nodes, expected "
+              << want << "\n";
+    return false;
+  }
+  float lowest = std::numeric_limits<float>::max();
+  for (size_t k = 0; k < n; ++k) {
+    GNode v   = batch.begin(i)[k];
+    float got = batch.scores(i)[k];
+    auto it   = scores.find(v);
+    if (it == scores.end() || std::fabs(it->second - got) > 1e-5) {
+      std::cerr << "node " << u << ": wrong score " << got << " for " << v
+                << "\n";
+      return false;
+    }
+    lowest = std::min(lowest, got);
+    scores.erase(it);
+  }
+  for (auto& s : scores) {
+    if (s.second > lowest + 1e-5) {
+      std::cerr << "node " << u << ": left out " << s.first << " with score "
+                << s.second << "\n";
+      return false;
+    }
+  }
+  return true;
+}
+
+/*******************************************************************************
+ * Main method for running
+ ******************************************************************************/
+
+int main(int argc, char** argv) {
+  galois::SharedMemSys G;
+  LonestarStart(argc, argv, name, desc, nullptr, &inputFile);
+
+  galois::StatTimer totalTime("TimerTotal");
+  totalTime.start();
+
+  if (!symmetricGraph) {
+    GALOIS_DIE("This application requires a symmetric graph input;"
+               " please use the -symmetricGraph flag "
+               " to indicate the input is a symmetric graph.");
+  }
+
+  galois::StatTimer graphReadingTimer("GraphConstructTime", REGION_NAME);
+  graphReadingTimer.start();
+  Graph graph;
+  galois::graphs::readGraph(graph, inputFile);
+  graph.sortAllEdgesByDst(galois::MethodFlag::UNPROTECTED);
+  graphReadingTimer.stop();
+  std::cout << "Read " << graph.size() << " nodes, " << graph.sizeEdges()
+            << " edges\n";
+
+  SimilarityPlan plan;
+  plan.measure          = measure;
+  plan.topK             = topK;
+  plan.threshold        = threshold;
+  plan.allPairs         = allPairs;
+  plan.excludeNeighbors = excludeNeighbors;
+  plan.maxDegree        = maxDegree;
+  plan.batchSize        = batchSize;
+
+  std::cout << "Running " << lonestar::analytics::algorithmName(measure)
+            << " similarity, "
+            << (allPairs ? "all pairs" : "top " + std::to_string(topK))
+            << " above " << threshold << "\n";
+
+  std::ofstream out;
+  if (outputFile != "") {
+    out.open(outputFile);
+    if (!out)
+      GALOIS_DIE("cannot open ", outputFile);
+  }
+
+  galois::StatTimer execTime("Timer_0");
+  galois::StatTimer writeTime("WriteTime", REGION_NAME);
+  size_t stride = std::max<size_t>(graph.size() / NUM_CHECKED, 1);
+  uint64_t numPairs = 0;
+  bool verified     = true;
+
+  execTime.start();
+  lonestar::analytics::similarity(
+      graph, plan, [&](const SimilarityBatch& batch) {
+        execTime.stop();
+        numPairs += batch.numPairs();
+        if (!skipVerify)
+          for (size_t i = 0; i < batch.size(); ++i)
+            if ((batch.firstNode + i) % stride == 0)
+              verified = verifyNode(graph, batch, i, plan) && verified;
+        if (out.is_open()) {
+          writeTime.start();
+          for (size_t i = 0; i < batch.size(); ++i)
+            for (size_t k = 0; k < size_t(batch.end(i) - batch.begin(i)); ++k)
+              out << batch.firstNode + i << " " << batch.begin(i)[k] << " "
+                  << batch.scores(i)[k] << "\n";
+          writeTime.stop();
+        }
+        execTime.start();
+      });
+  execTime.stop();
+
+  std::cout << "Found " << numPairs << " similar pairs\n";
+  galois::runtime::reportStat_Single(REGION_NAME, "NumPairs", numPairs);
+
+  if (!skipVerify) {
+    if (verified) {
+      std::cout << "Verification successful.\n";
+    } else {
+      GALOIS_DIE("verification failed");
+    }
+  }
+
+  totalTime.stop();
+
+  return 0;
+}
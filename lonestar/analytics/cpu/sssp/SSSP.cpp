@@ -18,15 +18,12 @@
  */
 
 #include "galois/Galois.h"
-#include "galois/AtomicHelpers.h"
 #include "galois/Reduction.h"
-#include "galois/PriorityQueue.h"
 #include "galois/Timer.h"
 #include "galois/graphs/LCGraph.h"
 #include "galois/graphs/TypeTraits.h"
 #include "Lonestar/BoilerPlate.h"
-#include "Lonestar/BFS_SSSP.h"
-#include "Lonestar/Utils.h"
+#include "Lonestar/Analytics/SSSP.h"
 
 #include "llvm/Support/CommandLine.h"
 
@@ -55,37 +52,24 @@ static cll::opt<unsigned int>
               cll::desc("Shift value for the deltastep (default value 13)"),
               cll::init(13));
 
-enum Algo {
-  deltaTile = 0,
-  deltaStep,
-  deltaStepBarrier,
-  serDeltaTile,
-  serDelta,
-  dijkstraTile,
-  dijkstra,
-  topo,
-  topoTile,
-  AutoAlgo
-};
-
-const char* const ALGO_NAMES[] = {
-    "deltaTile", "deltaStep",    "deltaStepBarrier", "serDeltaTile",
-    "serDelta",  "dijkstraTile", "dijkstra",         "topo",
-    "topoTile",  "Auto"};
-
-static cll::opt<Algo> algo(
+using lonestar::analytics::SSSPPlan;
+
+static cll::opt<SSSPPlan::Algorithm> algo(
     "algo", cll::desc("Choose an algorithm (default value auto):"),
-    cll::values(clEnumVal(deltaTile, "deltaTile"),
-                clEnumVal(deltaStep, "deltaStep"),
-                clEnumVal(deltaStepBarrier, "deltaStepBarrier"),
-                clEnumVal(serDeltaTile, "serDeltaTile"),
-                clEnumVal(serDelta, "serDelta"),
-                clEnumVal(dijkstraTile, "dijkstraTile"),
-                clEnumVal(dijkstra, "dijkstra"), clEnumVal(topo, "topo"),
-                clEnumVal(topoTile, "topoTile"),
-                clEnumVal(AutoAlgo,
-                          "auto: choose among the algorithms automatically")),
-    cll::init(AutoAlgo));
+    cll::values(
+        clEnumValN(SSSPPlan::deltaTile, "deltaTile", "deltaTile"),
+        clEnumValN(SSSPPlan::deltaStep, "deltaStep", "deltaStep"),
+        clEnumValN(SSSPPlan::deltaStepBarrier, "deltaStepBarrier",
+                   "deltaStepBarrier"),
+        clEnumValN(SSSPPlan::serDeltaTile, "serDeltaTile", "serDeltaTile"),
+        clEnumValN(SSSPPlan::serDelta, "serDelta", "serDelta"),
+        clEnumValN(SSSPPlan::dijkstraTile, "dijkstraTile", "dijkstraTile"),
+        clEnumValN(SSSPPlan::dijkstra, "dijkstra", "dijkstra"),
+        clEnumValN(SSSPPlan::topo, "topo", "topo"),
+        clEnumValN(SSSPPlan::topoTile, "topoTile", "topoTile"),
+        clEnumValN(SSSPPlan::automatic, "AutoAlgo",
+                   "auto: choose among the algorithms automatically")),
+    cll::init(SSSPPlan::automatic));
 
 //! [withnumaalloc]
 using Graph = galois::graphs::LC_CSR_Graph<std::atomic<uint32_t>, uint32_t>::
@@ -93,264 +77,7 @@ using Graph = galois::graphs::LC_CSR_Graph<std::atomic<uint32_t>, uint32_t>::
 //! [withnumaalloc]
 typedef Graph::GraphNode GNode;
 
-constexpr static const bool TRACK_WORK          = false;
-constexpr static const unsigned CHUNK_SIZE      = 64U;
-constexpr static const ptrdiff_t EDGE_TILE_SIZE = 512;
-
-using SSSP                 = BFS_SSSP<Graph, uint32_t, true, EDGE_TILE_SIZE>;
-using Dist                 = SSSP::Dist;
-using UpdateRequest        = SSSP::UpdateRequest;
-using UpdateRequestIndexer = SSSP::UpdateRequestIndexer;
-using SrcEdgeTile          = SSSP::SrcEdgeTile;
-using SrcEdgeTileMaker     = SSSP::SrcEdgeTileMaker;
-using SrcEdgeTilePushWrap  = SSSP::SrcEdgeTilePushWrap;
-using ReqPushWrap          = SSSP::ReqPushWrap;
-using OutEdgeRangeFn       = SSSP::OutEdgeRangeFn;
-using TileRangeFn          = SSSP::TileRangeFn;
-
-namespace gwl = galois::worklists;
-using PSchunk = gwl::PerSocketChunkFIFO<CHUNK_SIZE>;
-using OBIM    = gwl::OrderedByIntegerMetric<UpdateRequestIndexer, PSchunk>;
-using OBIM_Barrier =
-    gwl::OrderedByIntegerMetric<UpdateRequestIndexer,
-                                PSchunk>::with_barrier<true>::type;
-
-template <typename T, typename OBIMTy = OBIM, typename P, typename R>
-void deltaStepAlgo(Graph& graph, GNode source, const P& pushWrap,
-                   const R& edgeRange) {
-
-  //! [reducible for self-defined stats]
-  galois::GAccumulator<size_t> BadWork;
-  //! [reducible for self-defined stats]
-  galois::GAccumulator<size_t> WLEmptyWork;
-
-  graph.getData(source) = 0;
-
-  galois::InsertBag<T> initBag;
-  pushWrap(initBag, source, 0, "parallel");
-
-  galois::for_each(
-      galois::iterate(initBag),
-      [&](const T& item, auto& ctx) {
-        constexpr galois::MethodFlag flag = galois::MethodFlag::UNPROTECTED;
-        const auto& sdata                 = graph.getData(item.src, flag);
-
-        if (sdata < item.dist) {
-          if (TRACK_WORK)
-            WLEmptyWork += 1;
-          return;
-        }
-
-        for (auto ii : edgeRange(item)) {
-
-          GNode dst          = graph.getEdgeDst(ii);
-          auto& ddist        = graph.getData(dst, flag);
-          Dist ew            = graph.getEdgeData(ii, flag);
-          const Dist newDist = sdata + ew;
-          Dist oldDist       = galois::atomicMin<uint32_t>(ddist, newDist);
-          if (newDist < oldDist) {
-            if (TRACK_WORK) {
-              //! [per-thread contribution of self-defined stats]
-              if (oldDist != SSSP::DIST_INFINITY) {
-                BadWork += 1;
-              }
-              //! [per-thread contribution of self-defined stats]
-            }
-            pushWrap(ctx, dst, newDist);
-          }
-        }
-      },
-      galois::wl<OBIMTy>(UpdateRequestIndexer{stepShift}),
-      galois::disable_conflict_detection(), galois::loopname("SSSP"));
-
-  if (TRACK_WORK) {
-    //! [report self-defined stats]
-    galois::runtime::reportStat_Single("SSSP", "BadWork", BadWork.reduce());
-    //! [report self-defined stats]
-    galois::runtime::reportStat_Single("SSSP", "WLEmptyWork",
-                                       WLEmptyWork.reduce());
-  }
-}
-
-template <typename T, typename P, typename R>
-void serDeltaAlgo(Graph& graph, const GNode& source, const P& pushWrap,
-                  const R& edgeRange) {
-
-  SerialBucketWL<T, UpdateRequestIndexer> wl(UpdateRequestIndexer{stepShift});
-  ;
-  graph.getData(source) = 0;
-
-  pushWrap(wl, source, 0);
-
-  size_t iter = 0UL;
-  while (!wl.empty()) {
-
-    auto& curr = wl.minBucket();
-
-    while (!curr.empty()) {
-      ++iter;
-      auto item = curr.front();
-      curr.pop_front();
-
-      if (graph.getData(item.src) < item.dist) {
-        // empty work
-        continue;
-      }
-
-      for (auto e : edgeRange(item)) {
-
-        GNode dst   = graph.getEdgeDst(e);
-        auto& ddata = graph.getData(dst);
-
-        const auto newDist = item.dist + graph.getEdgeData(e);
-
-        if (newDist < ddata) {
-          ddata = newDist;
-          pushWrap(wl, dst, newDist);
-        }
-      }
-    }
-
-    wl.goToNextBucket();
-  }
-
-  if (!wl.allEmpty()) {
-    std::abort();
-  }
-  galois::runtime::reportStat_Single("SSSP-Serial-Delta", "Iterations", iter);
-}
-
-template <typename T, typename P, typename R>
-void dijkstraAlgo(Graph& graph, const GNode& source, const P& pushWrap,
-                  const R& edgeRange) {
-
-  using WL = galois::MinHeap<T>;
-
-  graph.getData(source) = 0;
-
-  WL wl;
-  pushWrap(wl, source, 0);
-
-  size_t iter = 0;
-
-  while (!wl.empty()) {
-    ++iter;
-
-    T item = wl.pop();
-
-    if (graph.getData(item.src) < item.dist) {
-      // empty work
-      continue;
-    }
-
-    for (auto e : edgeRange(item)) {
-
-      GNode dst   = graph.getEdgeDst(e);
-      auto& ddata = graph.getData(dst);
-
-      const auto newDist = item.dist + graph.getEdgeData(e);
-
-      if (newDist < ddata) {
-        ddata = newDist;
-        pushWrap(wl, dst, newDist);
-      }
-    }
-  }
-
-  galois::runtime::reportStat_Single("SSSP-Dijkstra", "Iterations", iter);
-}
-
-void topoAlgo(Graph& graph, const GNode& source) {
-
-  galois::LargeArray<Dist> oldDist;
-  oldDist.allocateInterleaved(graph.size());
-
-  constexpr Dist INFTY = SSSP::DIST_INFINITY;
-  galois::do_all(
-      galois::iterate(size_t{0}, graph.size()),
-      [&](size_t i) { oldDist.constructAt(i, INFTY); }, galois::no_stats(),
-      galois::loopname("initDistArray"));
-
-  graph.getData(source) = 0;
-
-  galois::GReduceLogicalOr changed;
-  size_t rounds = 0;
-
-  do {
-
-    ++rounds;
-    changed.reset();
-
-    galois::do_all(
-        galois::iterate(graph),
-        [&](const GNode& n) {
-          const auto& sdata = graph.getData(n);
-
-          if (oldDist[n] > sdata) {
-
-            oldDist[n] = sdata;
-            changed.update(true);
-
-            for (auto e : graph.edges(n)) {
-              const auto newDist = sdata + graph.getEdgeData(e);
-              auto dst           = graph.getEdgeDst(e);
-              auto& ddata        = graph.getData(dst);
-              galois::atomicMin(ddata, newDist);
-            }
-          }
-        },
-        galois::steal(), galois::loopname("Update"));
-
-  } while (changed.reduce());
-
-  galois::runtime::reportStat_Single("SSSP-topo", "rounds", rounds);
-}
-
-void topoTileAlgo(Graph& graph, const GNode& source) {
-
-  galois::InsertBag<SrcEdgeTile> tiles;
-
-  graph.getData(source) = 0;
-
-  galois::do_all(
-      galois::iterate(graph),
-      [&](const GNode& n) {
-        SSSP::pushEdgeTiles(tiles, graph, n,
-                            SrcEdgeTileMaker{n, SSSP::DIST_INFINITY});
-      },
-      galois::steal(), galois::loopname("MakeTiles"));
-
-  galois::GReduceLogicalOr changed;
-  size_t rounds = 0;
-
-  do {
-    ++rounds;
-    changed.reset();
-
-    galois::do_all(
-        galois::iterate(tiles),
-        [&](SrcEdgeTile& t) {
-          const auto& sdata = graph.getData(t.src);
-
-          if (t.dist > sdata) {
-
-            t.dist = sdata;
-            changed.update(true);
-
-            for (auto e = t.beg; e != t.end; ++e) {
-              const auto newDist = sdata + graph.getEdgeData(e);
-              auto dst           = graph.getEdgeDst(e);
-              auto& ddata        = graph.getData(dst);
-              galois::atomicMin(ddata, newDist);
-            }
-          }
-        },
-        galois::steal(), galois::loopname("Update"));
-
-  } while (changed.reduce());
-
-  galois::runtime::reportStat_Single("SSSP-topo", "rounds", rounds);
-}
+using SSSP = BFS_SSSP<Graph, uint32_t, true>;
 
 int main(int argc, char** argv) {
   galois::SharedMemSys G;
@@ -387,8 +114,8 @@ int main(int argc, char** argv) {
                    approxNodeData / galois::runtime::pagePoolSize());
   galois::reportPageAlloc("MeminfoPre");
 
-  if (algo == deltaStep || algo == deltaTile || algo == serDelta ||
-      algo == serDeltaTile) {
+  if (algo == SSSPPlan::deltaStep || algo == SSSPPlan::deltaTile ||
+      algo == SSSPPlan::serDelta || algo == SSSPPlan::serDeltaTile) {
     std::cout << "INFO: Using delta-step of " << (1 << stepShift) << "\n";
     std::cout
         << "WARNING: Performance varies considerably due to delta parameter.\n";
@@ -396,68 +123,28 @@ int main(int argc, char** argv) {
         << "WARNING: Do not expect the default to be good for your graph.\n";
   }
 
-  galois::do_all(galois::iterate(graph),
-                 [&graph](GNode n) { graph.getData(n) = SSSP::DIST_INFINITY; });
+  lonestar::analytics::initSSSP(graph);
 
-  graph.getData(source) = 0;
-
-  std::cout << "Running " << ALGO_NAMES[algo] << " algorithm\n";
+  std::cout << "Running " << lonestar::analytics::algorithmName(algo)
+            << " algorithm\n";
 
   galois::StatTimer autoAlgoTimer("AutoAlgo_0");
   galois::StatTimer execTime("Timer_0");
   execTime.start();
 
-  if (algo == AutoAlgo) {
+  if (algo == SSSPPlan::automatic) {
     autoAlgoTimer.start();
-    if (isApproximateDegreeDistributionPowerLaw(graph)) {
-      algo = deltaStep;
-    } else {
-      algo = deltaStepBarrier;
-    }
+    algo = lonestar::analytics::chooseSSSPAlgorithm(graph);
     autoAlgoTimer.stop();
-    galois::gInfo("Choosing ", ALGO_NAMES[algo], " algorithm");
+    galois::gInfo("Choosing ", lonestar::analytics::algorithmName(algo),
+                  " algorithm");
   }
 
-  switch (algo) {
-  case deltaTile:
-    deltaStepAlgo<SrcEdgeTile>(graph, source, SrcEdgeTilePushWrap{graph},
-                               TileRangeFn());
-    break;
-  case deltaStep:
-    deltaStepAlgo<UpdateRequest>(graph, source, ReqPushWrap(),
-                                 OutEdgeRangeFn{graph});
-    break;
-  case serDeltaTile:
-    serDeltaAlgo<SrcEdgeTile>(graph, source, SrcEdgeTilePushWrap{graph},
-                              TileRangeFn());
-    break;
-  case serDelta:
-    serDeltaAlgo<UpdateRequest>(graph, source, ReqPushWrap(),
-                                OutEdgeRangeFn{graph});
-    break;
-  case dijkstraTile:
-    dijkstraAlgo<SrcEdgeTile>(graph, source, SrcEdgeTilePushWrap{graph},
-                              TileRangeFn());
-    break;
-  case dijkstra:
-    dijkstraAlgo<UpdateRequest>(graph, source, ReqPushWrap(),
-                                OutEdgeRangeFn{graph});
-    break;
-  case topo:
-    topoAlgo(graph, source);
-    break;
-  case topoTile:
-    topoTileAlgo(graph, source);
-    break;
-
-  case deltaStepBarrier:
-    deltaStepAlgo<UpdateRequest, OBIM_Barrier>(graph, source, ReqPushWrap(),
-                                               OutEdgeRangeFn{graph});
-    break;
-
-  default:
-    std::abort();
-  }
+  SSSPPlan plan;
+  plan.algorithm  = algo;
+  plan.deltaShift = stepShift;
+  plan.initialize = false;
+  lonestar::analytics::sssp(graph, source, plan);
 
   execTime.stop();
 
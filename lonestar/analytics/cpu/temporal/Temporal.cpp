@@ -0,0 +1,374 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#include "galois/Galois.h"
+#include "galois/IndexedUnionFind.h"
+#include "galois/Reduction.h"
+#include "galois/graphs/LC_CSR_Temporal_Graph.h"
+#include "Lonestar/BoilerPlate.h"
+#include "Lonestar/Analytics/Temporal.h"
+
+#include "llvm/Support/CommandLine.h"
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+constexpr static const char* const REGION_NAME = "Temporal";
+constexpr static const char* const name        = "Temporal Graph Analytics";
+constexpr static const char* const desc =
+    "Runs reachability over time-respecting paths, BFS, connected "
+    "components or PageRank on every window of a graph whose edge data are "
+    "times";
+
+/*******************************************************************************
+ * Declaration of command line arguments
+ ******************************************************************************/
+namespace cll = llvm::cl;
+
+using lonestar::analytics::TemporalNode;
+using lonestar::analytics::TemporalReachabilityPlan;
+using lonestar::analytics::WindowPageRankPlan;
+
+enum Analytic { reachability, bfs, components, pageRank };
+
+static cll::opt<std::string>
+    inputFile(cll::Positional, cll::desc("<input file>"), cll::Required);
+
+static cll::opt<Analytic> analytic(
+    "analytic", cll::desc("Choose an analytic (default Reachability):"),
+    cll::values(
+        clEnumValN(reachability, "Reachability",
+                   "Earliest arrival over time-respecting paths"),
+        clEnumValN(bfs, "BFS", "Breadth-first search over the window"),
+        clEnumValN(components, "CC",
+                   "Weakly connected components of the window"),
+        clEnumValN(pageRank, "PageRank", "PageRank of the window")),
+    cll::init(reachability));
+
+static cll::opt<unsigned int>
+    startNode("startNode",
+              cll::desc("Node to start search from (default value 0)"),
+              cll::init(0));
+static cll::opt<uint32_t>
+    windowSize("windowSize",
+               cll::desc("Length of the windows (default: the time span "
+                         "divided by -numWindows)"),
+               cll::init(0));
+static cll::opt<uint32_t>
+    windowStep("windowStep",
+               cll::desc("Distance between window starts (default: the "
+                         "window size)"),
+               cll::init(0));
+static cll::opt<uint32_t>
+    numWindows("numWindows",
+               cll::desc("Windows to split the time span into when "
+                         "-windowSize is not given (default 1)"),
+               cll::init(1));
+static cll::opt<bool>
+    strict("strict",
+           cll::desc("Time-respecting paths need strictly increasing times"),
+           cll::init(false));
+static cll::opt<float>
+    tolerance("tolerance", cll::desc("PageRank tolerance (default 1e-3)"),
+              cll::init(1.0e-3));
+static cll::opt<float> alpha("alpha",
+                             cll::desc("PageRank damping (default 0.85)"),
+                             cll::init(0.85));
+
+/*******************************************************************************
+ * Graph structure declarations + other inits
+ ******************************************************************************/
+
+using Graph =
+    galois::graphs::LC_CSR_Temporal_Graph<TemporalNode<uint32_t>, uint32_t>::
+        with_no_lockable<true>::type::with_numa_alloc<true>::type;
+using GNode  = Graph::GraphNode;
+using Window = Graph::window_type;
+
+constexpr static const galois::MethodFlag flag =
+    galois::MethodFlag::UNPROTECTED;
+
+//! Every reached node other than the source is reached by a usable edge at
+//! its arrival time, and no usable edge reaches a node earlier
+bool verifyReachability(Graph& graph, const Window& w) {
+  galois::GAccumulator<uint64_t> early, unexplained;
+  galois::LargeArray<std::atomic<bool>> explained;
+  explained.allocateInterleaved(graph.size());
+  galois::do_all(
+      galois::iterate(graph), [&](GNode n) { explained.constructAt(n, false); },
+      galois::no_stats());
+  explained[startNode] = true;
+  galois::do_all(
+      galois::iterate(graph),
+      [&](GNode n) {
+        uint32_t a = graph.getData(n, flag).arrival;
+        if (a == lonestar::analytics::temporalInfinity<Graph>())
+          return;
+        for (auto e : graph.edges(n, w, flag)) {
+          uint32_t t = graph.getEdgeTime(e);
+          if (t < a || (strict && n != startNode && t == a))
+            continue;
+          uint32_t b = graph.getData(graph.getEdgeDst(e), flag).arrival;
+          if (t < b)
+            early += 1;
+          else if (t == b)
+            explained[graph.getEdgeDst(e)] = true;
+        }
+      },
+      galois::steal(), galois::no_stats());
+  galois::do_all(
+      galois::iterate(graph),
+      [&](GNode n) {
+        if (graph.getData(n, flag).arrival !=
+                lonestar::analytics::temporalInfinity<Graph>() &&
+            !explained[n])
+          unexplained += 1;
+      },
+      galois::no_stats());
+  if (early.reduce() || unexplained.reduce()) {
+    std::cerr << early.reduce() << " edges reach a node earlier, "
+              << unexplained.reduce() << " arrivals have no edge\n";
+    return false;
+  }
+  return true;
+}
+
+//! Levels differ by at most one along edges of the window, and every
+//! reached node other than the source has a parent one level up
+bool verifyBFS(Graph& graph, const Window& w) {
+  constexpr uint32_t INF = lonestar::analytics::windowBFSInfinity();
+  galois::GAccumulator<uint64_t> wrong;
+  galois::LargeArray<std::atomic<bool>> parent;
+  parent.allocateInterleaved(graph.size());
+  galois::do_all(
+      galois::iterate(graph), [&](GNode n) { parent.constructAt(n, false); },
+      galois::no_stats());
+  parent[startNode] = graph.getData(startNode).level == 0;
+  galois::do_all(
+      galois::iterate(graph),
+      [&](GNode n) {
+        uint32_t l = graph.getData(n, flag).level;
+        for (auto e : graph.edges(n, w, flag)) {
+          GNode v    = graph.getEdgeDst(e);
+          uint32_t m = graph.getData(v, flag).level;
+          if (l != INF && m > l + 1)
+            wrong += 1;
+          else if (l != INF && m == l + 1)
+            parent[v] = true;
+        }
+      },
+      galois::steal(), galois::no_stats());
+  galois::do_all(
+      galois::iterate(graph),
+      [&](GNode n) {
+        if (graph.getData(n, flag).level != INF && !parent[n])
+          wrong += 1;
+      },
+      galois::no_stats());
+  if (wrong.reduce()) {
+    std::cerr << wrong.reduce() << " levels are wrong\n";
+    return false;
+  }
+  return true;
+}
+
+//! Components agree with a serial union-find over the window's edges
+bool verifyComponents(Graph& graph, const Window& w) {
+  std::vector<uint32_t> parent(graph.size());
+  for (GNode n : graph)
+    parent[n] = n;
+  auto find = [&](uint32_t n) {
+    while (parent[n] != n)
+      n = parent[n] = parent[parent[n]];
+    return n;
+  };
+  for (GNode n : graph) {
+    for (auto e : graph.edges(n, w, flag)) {
+      uint32_t a = find(n), b = find(graph.getEdgeDst(e));
+      if (a != b)
+        parent[std::max(a, b)] = std::min(a, b);
+    }
+  }
+  for (GNode n : graph) {
+    if (graph.getData(n, flag).component != find(n)) {
+      std::cerr << "node " << n << " is in component "
+                << graph.getData(n, flag).component << ", expected "
+                << find(n) << "\n";
+      return false;
+    }
+  }
+  return true;
+}
+
+//! Every residual left is below the tolerance
+bool verifyPageRank(Graph& graph) {
+  galois::GAccumulator<uint64_t> unconverged;
+  galois::do_all(
+      galois::iterate(graph),
+      [&](GNode n) {
+        if (graph.getData(n, flag).residual > tolerance)
+          unconverged += 1;
+      },
+      galois::no_stats());
+  if (unconverged.reduce()) {
+    std::cerr << unconverged.reduce() << " nodes have not converged\n";
+    return false;
+  }
+  return true;
+}
+
+bool verifyWindow(Graph& graph, const Window& w) {
+  switch (analytic) {
+  case reachability:
+    return verifyReachability(graph, w);
+  case bfs:
+    return verifyBFS(graph, w);
+  case components:
+    return verifyComponents(graph, w);
+  case pageRank:
+    return verifyPageRank(graph);
+  default:
+    return false;
+  }
+}
+
+//! Runs the analytic on window w and prints a line about it
+void runWindow(Graph& graph, const Window& w) {
+  galois::GAccumulator<uint64_t> windowEdges;
+  galois::do_all(
+      galois::iterate(graph),
+      [&](GNode n) { windowEdges += graph.degree(n, w, flag); },
+      galois::no_stats());
+  std::cout << "[" << w.begin << ", " << w.end << "): " << windowEdges.reduce()
+            << " edges, ";
+
+  switch (analytic) {
+  case reachability: {
+    TemporalReachabilityPlan plan;
+    plan.strict    = strict;
+    size_t reached = lonestar::analytics::temporalReachability(
+        graph, startNode, w, plan);
+    std::cout << reached << " nodes reachable from " << startNode << "\n";
+    break;
+  }
+  case bfs: {
+    size_t reached = lonestar::analytics::windowBFS(graph, startNode, w);
+    galois::GReduceMax<uint32_t> depth;
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          uint32_t l = graph.getData(n, flag).level;
+          if (l != lonestar::analytics::windowBFSInfinity())
+            depth.update(l);
+        },
+        galois::no_stats());
+    std::cout << reached << " nodes reached from " << startNode
+              << ", depth " << depth.reduce() << "\n";
+    break;
+  }
+  case components: {
+    size_t numComponents = lonestar::analytics::windowComponents(graph, w);
+    std::vector<uint32_t> sizes(graph.size(), 0);
+    for (GNode n : graph)
+      ++sizes[graph.getData(n, flag).component];
+    size_t nontrivial = std::count_if(sizes.begin(), sizes.end(),
+                                      [](uint32_t s) { return s > 1; });
+    std::cout << numComponents << " components, " << nontrivial
+              << " with edges, largest "
+              << *std::max_element(sizes.begin(), sizes.end()) << "\n";
+    break;
+  }
+  case pageRank: {
+    WindowPageRankPlan plan;
+    plan.alpha     = alpha;
+    plan.tolerance = tolerance;
+    lonestar::analytics::windowPageRank(graph, w, plan);
+    GNode top = 0;
+    for (GNode n : graph)
+      if (graph.getData(n, flag).rank > graph.getData(top, flag).rank)
+        top = n;
+    std::cout << "top node " << top << " with rank "
+              << graph.getData(top, flag).rank << "\n";
+    break;
+  }
+  default:
+    GALOIS_DIE("unknown analytic ", analytic);
+  }
+}
+
+/*******************************************************************************
+ * Main method for running
+ ******************************************************************************/
+
+int main(int argc, char** argv) {
+  galois::SharedMemSys G;
+  LonestarStart(argc, argv, name, desc, nullptr, &inputFile);
+
+  galois::StatTimer totalTime("TimerTotal");
+  totalTime.start();
+
+  galois::StatTimer graphReadingTimer("GraphConstructTime", REGION_NAME);
+  graphReadingTimer.start();
+  Graph graph;
+  galois::graphs::readGraph(graph, inputFile);
+  graphReadingTimer.stop();
+  auto span = graph.timeSpan();
+  std::cout << "Read " << graph.size() << " nodes, " << graph.sizeEdges()
+            << " edges at times [" << span.first << ", " << span.second
+            << "]\n";
+
+  if (startNode >= graph.size()) {
+    GALOIS_DIE("start node ", startNode, " is not in the graph");
+  }
+  if (!numWindows) {
+    GALOIS_DIE("need at least one window");
+  }
+
+  uint32_t size = windowSize;
+  if (!size)
+    size = (uint64_t(span.second) - span.first) / numWindows + 1;
+  uint32_t step = windowStep ? uint32_t(windowStep) : size;
+
+  galois::StatTimer execTime("Timer_0");
+  size_t windows = 0, failed = 0;
+  lonestar::analytics::forEachWindow(graph, size, step, [&](const Window& w) {
+    ++windows;
+    execTime.start();
+    runWindow(graph, w);
+    execTime.stop();
+    if (!skipVerify && !verifyWindow(graph, w))
+      ++failed;
+  });
+
+  galois::runtime::reportStat_Single(REGION_NAME, "NumWindows", windows);
+
+  if (!skipVerify) {
+    if (!failed) {
+      std::cout << "Verification successful.\n";
+    } else {
+      GALOIS_DIE("verification failed in ", failed, " windows");
+    }
+  }
+
+  totalTime.stop();
+
+  return 0;
+}
@@ -18,9 +18,7 @@
  */
 
 #include "galois/Galois.h"
-#include "galois/Bag.h"
 #include "galois/ParallelSTL.h"
-#include "galois/Reduction.h"
 #include "galois/Timer.h"
 #include "galois/graphs/LCGraph.h"
 #include "galois/graphs/BufferedGraph.h"
@@ -28,8 +26,7 @@
 #include "llvm/Support/CommandLine.h"
 #include "Lonestar/Utils.h"
 #include "Lonestar/BoilerPlate.h"
-
-#include <boost/iterator/transform_iterator.hpp>
+#include "Lonestar/Analytics/TriangleCount.h"
 
 #include <utility>
 #include <vector>
@@ -40,7 +37,6 @@
 const char* name = "Triangles";
 const char* desc = "Counts the triangles in a graph";
 
-constexpr static const unsigned CHUNK_SIZE = 64U;
 enum Algo { nodeiterator, edgeiterator, orderedCount };
 
 namespace cll = llvm::cl;
@@ -66,289 +62,46 @@ typedef galois::graphs::LC_CSR_Graph<void, void>::with_numa_alloc<
 
 typedef Graph::GraphNode GNode;
 
-/**
- * Like std::lower_bound but doesn't dereference iterators. Returns the first
- * element for which comp is not true.
- */
-template <typename Iterator, typename Compare>
-Iterator lowerBound(Iterator first, Iterator last, Compare comp) {
-  using difference_type =
-      typename std::iterator_traits<Iterator>::difference_type;
-
-  Iterator it;
-  difference_type count;
-  difference_type half;
-
-  count = std::distance(first, last);
-  while (count > 0) {
-    it   = first;
-    half = count / 2;
-    std::advance(it, half);
-    if (comp(it)) {
-      first = ++it;
-      count -= half + 1;
-    } else {
-      count = half;
-    }
-  }
-  return first;
-}
-
-/**
- * std::set_intersection over edge_iterators.
- */
-template <typename G>
-size_t countEqual(G& g, typename G::edge_iterator aa,
-                  typename G::edge_iterator ea, typename G::edge_iterator bb,
-                  typename G::edge_iterator eb) {
-  size_t retval = 0;
-  while (aa != ea && bb != eb) {
-    typename G::GraphNode a = g.getEdgeDst(aa);
-    typename G::GraphNode b = g.getEdgeDst(bb);
-    if (a < b) {
-      ++aa;
-    } else if (b < a) {
-      ++bb;
-    } else {
-      retval += 1;
-      ++aa;
-      ++bb;
-    }
-  }
-  return retval;
-}
+using lonestar::analytics::TriangleCountPlan;
 
-template <typename G>
-struct LessThan {
-  G& g;
-  typename G::GraphNode n;
-  LessThan(G& g, typename G::GraphNode n) : g(g), n(n) {}
-  bool operator()(typename G::edge_iterator it) { return g.getEdgeDst(it) < n; }
-};
-
-template <typename G>
-struct GreaterThanOrEqual {
-  G& g;
-  typename G::GraphNode n;
-  GreaterThanOrEqual(G& g, typename G::GraphNode n) : g(g), n(n) {}
-  bool operator()(typename G::edge_iterator it) {
-    return !(n < g.getEdgeDst(it));
-  }
-};
+//! Profiles two of the algorithms as the examples of docs/profiling.dox
+uint64_t countTriangles(Graph& graph) {
+  TriangleCountPlan plan;
+  uint64_t numTriangles = 0;
 
-template <typename G>
-struct DegreeLess {
-  typedef typename G::GraphNode N;
-  G* g;
-  DegreeLess(G& g) : g(&g) {}
+  switch (algo) {
+  case nodeiterator:
+    plan.algorithm = TriangleCountPlan::nodeIterator;
+    //! [profile w/ vtune]
+    galois::runtime::profileVtune(
+        [&]() {
+          numTriangles = lonestar::analytics::triangleCount(graph, plan);
+        },
+        "nodeIteratorAlgo");
+    //! [profile w/ vtune]
+    break;
 
-  bool operator()(const N& n1, const N& n2) const {
-    return std::distance(g->edge_begin(n1), g->edge_end(n1)) <
-           std::distance(g->edge_begin(n2), g->edge_end(n2));
-  }
-};
-template <typename G>
-struct DegreeGreater {
-  typedef typename G::GraphNode N;
-  G* g;
-  DegreeGreater(G& g) : g(&g) {}
-
-  bool operator()(const N& n1, const N& n2) const {
-    return std::distance(g->edge_begin(n1), g->edge_end(n1)) >
-           std::distance(g->edge_begin(n2), g->edge_end(n2));
-  }
-};
-template <typename G>
-struct GetDegree {
-  typedef typename G::GraphNode N;
-  G* g;
-  GetDegree(G& g) : g(&g) {}
-
-  ptrdiff_t operator()(const N& n) const {
-    return std::distance(g->edge_begin(n), g->edge_end(n));
-  }
-};
-
-template <typename GraphNode, typename EdgeTy>
-struct IdLess {
-  bool
-  operator()(const galois::graphs::EdgeSortValue<GraphNode, EdgeTy>& e1,
-             const galois::graphs::EdgeSortValue<GraphNode, EdgeTy>& e2) const {
-    return e1.dst < e2.dst;
-  }
-};
-
-/**
- * Node Iterator algorithm for counting triangles.
- * <code>
- * for (v in G)
- *   for (all pairs of neighbors (a, b) of v)
- *     if ((a,b) in G and a < v < b)
- *       triangle += 1
- * </code>
- *
- * Thomas Schank. Algorithmic Aspects of Triangle-Based Network Analysis. PhD
- * Thesis. Universitat Karlsruhe. 2007.
- */
-void nodeIteratingAlgo(Graph& graph) {
-
-  galois::GAccumulator<size_t> numTriangles;
-
-  //! [profile w/ vtune]
-  galois::runtime::profileVtune(
-      [&]() {
-        galois::do_all(
-            galois::iterate(graph),
-            [&](const GNode& n) {
-              // Partition neighbors
-              // [first, ea) [n] [bb, last)
-              Graph::edge_iterator first =
-                  graph.edge_begin(n, galois::MethodFlag::UNPROTECTED);
-              Graph::edge_iterator last =
-                  graph.edge_end(n, galois::MethodFlag::UNPROTECTED);
-              Graph::edge_iterator ea =
-                  lowerBound(first, last, LessThan<Graph>(graph, n));
-              Graph::edge_iterator bb =
-                  lowerBound(first, last, GreaterThanOrEqual<Graph>(graph, n));
-
-              for (; bb != last; ++bb) {
-                GNode B = graph.getEdgeDst(bb);
-                for (auto aa = first; aa != ea; ++aa) {
-                  GNode A = graph.getEdgeDst(aa);
-                  Graph::edge_iterator vv =
-                      graph.edge_begin(A, galois::MethodFlag::UNPROTECTED);
-                  Graph::edge_iterator ev =
-                      graph.edge_end(A, galois::MethodFlag::UNPROTECTED);
-                  Graph::edge_iterator it =
-                      lowerBound(vv, ev, LessThan<Graph>(graph, B));
-                  if (it != ev && graph.getEdgeDst(it) == B) {
-                    numTriangles += 1;
-                  }
-                }
-              }
-            },
-            galois::chunk_size<CHUNK_SIZE>(), galois::steal(),
-            galois::loopname("nodeIteratingAlgo"));
-      },
-      "nodeIteratorAlgo");
-  //! [profile w/ vtune]
+  case edgeiterator:
+    plan.algorithm = TriangleCountPlan::edgeIterator;
+    //! [profile w/ papi]
+    galois::runtime::profilePapi(
+        [&]() {
+          numTriangles = lonestar::analytics::triangleCount(graph, plan);
+        },
+        "edgeIteratorAlgo");
+    //! [profile w/ papi]
+    break;
 
-  std::cout << "Num Triangles: " << numTriangles.reduce() << "\n";
-}
+  case orderedCount:
+    plan.algorithm = TriangleCountPlan::orderedCount;
+    numTriangles   = lonestar::analytics::triangleCount(graph, plan);
+    break;
 
-/**
- * Lambda function to count triangles
- */
-void orderedCountFunc(Graph& graph, GNode n,
-                      galois::GAccumulator<size_t>& numTriangles) {
-  size_t numTriangles_local = 0;
-  for (auto it_v : graph.edges(n)) {
-    auto v = graph.getEdgeDst(it_v);
-    if (v > n)
-      break;
-    Graph::edge_iterator it_n =
-        graph.edge_begin(n, galois::MethodFlag::UNPROTECTED);
-
-    for (auto it_vv : graph.edges(v)) {
-      auto vv = graph.getEdgeDst(it_vv);
-      if (vv > v)
-        break;
-      while (graph.getEdgeDst(it_n) < vv)
-        it_n++;
-      if (vv == graph.getEdgeDst(it_n)) {
-        numTriangles_local += 1;
-      }
-    }
+  default:
+    GALOIS_DIE("unknown algo: ", algo);
   }
-  numTriangles += numTriangles_local;
-}
-
-/*
- * Simple counting loop, instead of binary searching.
- */
-void orderedCountAlgo(Graph& graph) {
-  galois::GAccumulator<size_t> numTriangles;
-  galois::do_all(
-      galois::iterate(graph),
-      [&](const GNode& n) { orderedCountFunc(graph, n, numTriangles); },
-      galois::chunk_size<CHUNK_SIZE>(), galois::steal(),
-      galois::loopname("orderedCountAlgo"));
-
-  galois::gPrint("Num Triangles: ", numTriangles.reduce(), "\n");
-}
-
-/**
- * Edge Iterator algorithm for counting triangles.
- * <code>
- * for ((a, b) in E)
- *   if (a < b)
- *     for (v in intersect(neighbors(a), neighbors(b)))
- *       if (a < v < b)
- *         triangle += 1
- * </code>
- *
- * Thomas Schank. Algorithmic Aspects of Triangle-Based Network Analysis. PhD
- * Thesis. Universitat Karlsruhe. 2007.
- */
-void edgeIteratingAlgo(Graph& graph) {
-
-  struct WorkItem {
-    GNode src;
-    GNode dst;
-    WorkItem(const GNode& a1, const GNode& a2) : src(a1), dst(a2) {}
-  };
-
-  galois::InsertBag<WorkItem> items;
-  galois::GAccumulator<size_t> numTriangles;
-
-  galois::do_all(
-      galois::iterate(graph),
-      [&](GNode n) {
-        for (Graph::edge_iterator edge :
-             graph.out_edges(n, galois::MethodFlag::UNPROTECTED)) {
-          GNode dst = graph.getEdgeDst(edge);
-          if (n < dst)
-            items.push(WorkItem(n, dst));
-        }
-      },
-      galois::loopname("Initialize"));
-
-  //  galois::runtime::profileVtune(
-  //! [profile w/ papi]
-  galois::runtime::profilePapi(
-      [&]() {
-        galois::do_all(
-            galois::iterate(items),
-            [&](const WorkItem& w) {
-              // Compute intersection of range (w.src, w.dst) in neighbors of
-              // w.src and w.dst
-              Graph::edge_iterator abegin =
-                  graph.edge_begin(w.src, galois::MethodFlag::UNPROTECTED);
-              Graph::edge_iterator aend =
-                  graph.edge_end(w.src, galois::MethodFlag::UNPROTECTED);
-              Graph::edge_iterator bbegin =
-                  graph.edge_begin(w.dst, galois::MethodFlag::UNPROTECTED);
-              Graph::edge_iterator bend =
-                  graph.edge_end(w.dst, galois::MethodFlag::UNPROTECTED);
-
-              Graph::edge_iterator aa = lowerBound(
-                  abegin, aend, GreaterThanOrEqual<Graph>(graph, w.src));
-              Graph::edge_iterator ea =
-                  lowerBound(abegin, aend, LessThan<Graph>(graph, w.dst));
-              Graph::edge_iterator bb = lowerBound(
-                  bbegin, bend, GreaterThanOrEqual<Graph>(graph, w.src));
-              Graph::edge_iterator eb =
-                  lowerBound(bbegin, bend, LessThan<Graph>(graph, w.dst));
-
-              numTriangles += countEqual(graph, aa, ea, bb, eb);
-            },
-            galois::loopname("edgeIteratingAlgo"),
-            galois::chunk_size<CHUNK_SIZE>(), galois::steal());
-      },
-      "edgeIteratorAlgo");
-  //! [profile w/ papi]
 
-  std::cout << "NumTriangles: " << numTriangles.reduce() << "\n";
+  return numTriangles;
 }
 
 //! Sorts read graph by degree (high degree nodes are reindexed to beginning)
@@ -505,25 +258,11 @@ int main(int argc, char** argv) {
 
   galois::StatTimer execTime("Timer_0");
   execTime.start();
-  // case by case preAlloc to avoid allocating unnecessarily
-  switch (algo) {
-  case nodeiterator:
-    nodeIteratingAlgo(graph);
-    break;
-
-  case edgeiterator:
-    edgeIteratingAlgo(graph);
-    break;
-
-  case orderedCount:
-    orderedCountAlgo(graph);
-    break;
-
-  default:
-    std::cerr << "Unknown algo: " << algo << "\n";
-  }
+  uint64_t numTriangles = countTriangles(graph);
   execTime.stop();
 
+  galois::gPrint("Num Triangles: ", numTriangles, "\n");
+
   galois::reportPageAlloc("MeminfoPost");
 
   totalTime.stop();
@@ -76,12 +76,15 @@ struct NodeData {
   uint32_t dist_old;
 };
 
-galois::DynamicBitSet bitset_dist_current;
+// per-host state, kept apart for every host when -simulateHosts is given
+galois::runtime::HostLocal<galois::DynamicBitSet> bitset_dist_current;
 
 typedef galois::graphs::DistGraph<NodeData, void> Graph;
 typedef typename Graph::GraphNode GNode;
 
-std::unique_ptr<galois::graphs::GluonSubstrate<Graph>> syncSubstrate;
+galois::runtime::HostLocal<
+    std::unique_ptr<galois::graphs::GluonSubstrate<Graph>>>
+    syncSubstrate;
 
 #include "bfs_push_sync.hh"
 
@@ -404,10 +407,7 @@ constexpr static const char* const name =
 constexpr static const char* const desc = "BFS on Distributed Galois.";
 constexpr static const char* const url  = nullptr;
 
-int main(int argc, char** argv) {
-  galois::DistMemSys G;
-  DistBenchStart(argc, argv, name, desc, url);
-
+void run() {
   const auto& net = galois::runtime::getSystemNetworkInterface();
   if (net.ID == 0) {
     galois::runtime::reportParam(REGION_NAME, "Max Iterations", maxIterations);
@@ -480,6 +480,11 @@ int main(int argc, char** argv) {
     writeOutput(outputLocation, "level", results.data(), results.size(),
                 globalIDs.data());
   }
+}
 
+int main(int argc, char** argv) {
+  galois::DistMemSys G;
+  DistBenchStart(argc, argv, name, desc, url);
+  DistBenchRun(run);
   return 0;
 }
@@ -19,9 +19,9 @@
 
 /* This is an implementation of Distributed multi-GPU triangle counting code.
  * The single GPU code which is executed on GPU is generated using the IrGL
- * compiler. Currently, it does not support distributed multi-CPU code.
- *
- * TODO implement CPU kernel
+ * compiler. The default algorithm replicates the neighborhoods of mirrors so
+ * that each host holds whole 2-hop neighborhoods; -algo=Oriented counts on
+ * CPUs without that replication (see tc_oriented.h).
  */
 
 #include "DistBench/MiningStart.h"
@@ -32,6 +32,7 @@
 #include "galois/graphs/GenericPartitioners.h"
 #include "galois/graphs/MiningPartitioner.h"
 #include "galois/runtime/Tracer.h"
+#include "tc_oriented.h"
 
 #include <iostream>
 #include <limits>
@@ -48,6 +49,23 @@ namespace cll = llvm::cl;
 
 constexpr static const char* const REGION_NAME = "TC";
 
+enum Algo { replicated, oriented };
+
+static cll::opt<Algo> algo(
+    "algo", cll::desc("Choose an algorithm:"),
+    cll::values(clEnumValN(Algo::replicated, "Replicated",
+                           "Replicate the neighborhoods of mirrors (default)"),
+                clEnumValN(Algo::oriented, "Oriented",
+                           "Degree-oriented edges; fetch remote adjacency in "
+                           "batches (CPU only)")),
+    cll::init(Algo::replicated));
+
+static cll::opt<uint64_t>
+    batchEdges("batchEdges",
+               cll::desc("Oriented: bound on the remote adjacency fetched "
+                         "per round (default 2^24 edges)"),
+               cll::init(1 << 24));
+
 /*******************************************************************************
  * Graph structure declarations + other initialization
  ******************************************************************************/
@@ -144,6 +162,28 @@ int main(int argc, char** argv) {
 
   galois::StatTimer StatTimer_total("TimerTotal", REGION_NAME);
 
+  if (algo == Algo::oriented) {
+    if (personality != CPU) {
+      GALOIS_DIE("the oriented algorithm runs on CPUs only");
+    }
+    StatTimer_total.start();
+    for (auto run = 0; run < numRuns; ++run) {
+      galois::gPrint("[", net.ID, "] TC::go run ", run, " called\n");
+      std::string timer_str("Timer_" + std::to_string(run));
+      galois::StatTimer StatTimer_main(timer_str.c_str(), REGION_NAME);
+
+      StatTimer_main.start();
+      uint64_t total_triangles = countTrianglesOriented(inputFile, batchEdges);
+      StatTimer_main.stop();
+
+      if (net.ID == 0) {
+        galois::gPrint("Total number of triangles ", total_triangles, "\n");
+      }
+    }
+    StatTimer_total.stop();
+    return 0;
+  }
+
   StatTimer_total.start();
   std::unique_ptr<Graph> hg;
 #ifdef GALOIS_ENABLE_GPU
@@ -0,0 +1,408 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#include "tc_oriented.h"
+
+#include "galois/DistGalois.h"
+#include "galois/DReducible.h"
+#include "galois/LargeArray.h"
+#include "galois/ParallelSTL.h"
+#include "galois/graphs/BufferedGraph.h"
+#include "galois/graphs/GraphHelpers.h"
+#include "galois/runtime/Network.h"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+namespace {
+
+constexpr static const char* const REGION_NAME = "TC";
+
+using RemoteEdge = std::pair<uint32_t, uint32_t>; // (remote v, local u)
+
+void nextPhase() {
+  ++galois::runtime::evilPhase;
+  // limit defined by MPI or LCI
+  if (galois::runtime::evilPhase >=
+      static_cast<uint32_t>(std::numeric_limits<int16_t>::max())) {
+    galois::runtime::evilPhase = 1;
+  }
+}
+
+//! size of the intersection of two sorted lists
+uint64_t intersect(const uint32_t* a, const uint32_t* ae, const uint32_t* b,
+                   const uint32_t* be) {
+  uint64_t count = 0;
+  while (a < ae && b < be) {
+    if (*a < *b) {
+      ++a;
+    } else if (*b < *a) {
+      ++b;
+    } else {
+      ++count;
+      ++a;
+      ++b;
+    }
+  }
+  return count;
+}
+
+class OrientedCounter {
+  uint32_t id;
+  uint32_t numHosts;
+  uint64_t numNodes;
+  uint64_t numEdges;
+  uint64_t batchEdges;
+
+  //! global out-index of the file; gives the degree of every node
+  galois::LargeArray<uint64_t> outIndex;
+  //! first node of every host, plus numNodes
+  std::vector<uint64_t> hostBegin;
+
+  //! oriented out-edges of the local nodes, sorted by destination
+  std::vector<uint64_t> outStart;
+  galois::LargeArray<uint32_t> outDst;
+
+  //! oriented edges u -> v with u local and v remote, sorted by v
+  galois::LargeArray<RemoteEdge> remote;
+  //! distinct remote endpoints and where their edges start in remote
+  std::vector<uint32_t> needed;
+  std::vector<uint64_t> neededStart;
+  //! batches of needed, as indices into it
+  std::vector<size_t> batchStart;
+
+  uint64_t edgeOffset(uint64_t n) const { return n ? outIndex[n - 1] : 0; }
+
+  uint64_t degree(uint64_t n) const { return edgeOffset(n + 1) - edgeOffset(n); }
+
+  bool lowerRank(uint64_t a, uint64_t b) const {
+    uint64_t da = degree(a), db = degree(b);
+    return da < db || (da == db && a < b);
+  }
+
+  const uint32_t* outBegin(uint64_t n) const {
+    return outDst.data() + outStart[n - hostBegin[id]];
+  }
+  const uint32_t* outEnd(uint64_t n) const {
+    return outDst.data() + outStart[n - hostBegin[id] + 1];
+  }
+
+  void readOutIndex(const std::string& filename) {
+    std::ifstream file(filename, std::ios_base::binary);
+    uint64_t header[4];
+    if (!file.read(reinterpret_cast<char*>(header), sizeof(header))) {
+      GALOIS_DIE("failed to read graph header of ", filename);
+    }
+    if (header[0] != 1) {
+      GALOIS_DIE("oriented triangle counting needs a version 1 graph "
+                 "(32-bit node ids)");
+    }
+    numNodes = header[2];
+    numEdges = header[3];
+
+    outIndex.allocateInterleaved(numNodes);
+    char* buffer = reinterpret_cast<char*>(outIndex.data());
+    size_t toRead = numNodes * sizeof(uint64_t);
+    while (toRead > 0 && file.read(buffer, toRead).gcount() > 0) {
+      buffer += file.gcount();
+      toRead -= file.gcount();
+    }
+    if (toRead) {
+      GALOIS_DIE("failed to read graph index of ", filename);
+    }
+  }
+
+  void partition() {
+    hostBegin.resize(numHosts + 1);
+    for (uint32_t h = 0; h < numHosts; ++h) {
+      auto range = galois::graphs::divideNodesBinarySearch(
+          numNodes, numEdges, 1, 1, h, numHosts, outIndex);
+      hostBegin[h] = *range.first.first;
+    }
+    hostBegin[numHosts] = numNodes;
+  }
+
+  //! loads the local block and keeps only its oriented out-edges
+  void orient(const std::string& filename) {
+    uint64_t nb = hostBegin[id], ne = hostBegin[id + 1];
+    galois::graphs::BufferedGraph<void> block;
+    block.loadPartialGraph(filename, nb, ne, edgeOffset(nb), edgeOffset(ne),
+                           numNodes, numEdges);
+
+    size_t numLocal = ne - nb;
+    std::vector<uint64_t> numRemote(numLocal + 1, 0);
+    outStart.assign(numLocal + 1, 0);
+    galois::do_all(
+        galois::iterate(nb, ne),
+        [&](uint64_t u) {
+          uint64_t out = 0, rem = 0;
+          for (auto e = block.edgeBegin(u); e != block.edgeEnd(u); ++e) {
+            uint64_t v = block.edgeDestination(*e);
+            if (lowerRank(u, v)) {
+              ++out;
+              rem += v < nb || v >= ne;
+            }
+          }
+          outStart[u - nb + 1] = out;
+          numRemote[u - nb + 1] = rem;
+        },
+        galois::steal(), galois::no_stats());
+    for (size_t i = 0; i < numLocal; ++i) {
+      outStart[i + 1] += outStart[i];
+      numRemote[i + 1] += numRemote[i];
+    }
+
+    outDst.allocateInterleaved(outStart[numLocal]);
+    remote.allocateInterleaved(numRemote[numLocal]);
+    galois::do_all(
+        galois::iterate(nb, ne),
+        [&](uint64_t u) {
+          uint64_t out = outStart[u - nb], rem = numRemote[u - nb];
+          for (auto e = block.edgeBegin(u); e != block.edgeEnd(u); ++e) {
+            uint64_t v = block.edgeDestination(*e);
+            if (lowerRank(u, v)) {
+              outDst[out++] = v;
+              if (v < nb || v >= ne) {
+                remote[rem++] = RemoteEdge(v, u);
+              }
+            }
+          }
+          std::sort(outDst.data() + outStart[u - nb], outDst.data() + out);
+        },
+        galois::steal(), galois::no_stats());
+    galois::ParallelSTL::sort(remote.begin(), remote.end());
+  }
+
+  //! groups the remote edges by endpoint and cuts the endpoints into batches
+  void planBatches() {
+    neededStart.clear();
+    for (size_t i = 0; i < remote.size(); ++i) {
+      if (i == 0 || remote[i].first != remote[i - 1].first) {
+        needed.push_back(remote[i].first);
+        neededStart.push_back(i);
+      }
+    }
+    neededStart.push_back(remote.size());
+
+    uint64_t current = 0;
+    for (size_t i = 0; i < needed.size(); ++i) {
+      uint64_t d = degree(needed[i]);
+      if (i == 0 || (current && current + d > batchEdges)) {
+        batchStart.push_back(i);
+        current = 0;
+      }
+      current += d;
+    }
+    batchStart.push_back(needed.size());
+  }
+
+  //! bytes held while counting, known before any adjacency is fetched
+  uint64_t predictPeakBytes() const {
+    uint64_t maxBatch = 0, maxBatchNodes = 0;
+    for (size_t b = 0; b + 1 < batchStart.size(); ++b) {
+      uint64_t edges = 0;
+      for (size_t i = batchStart[b]; i < batchStart[b + 1]; ++i) {
+        edges += degree(needed[i]);
+      }
+      maxBatch      = std::max(maxBatch, edges);
+      maxBatchNodes = std::max<uint64_t>(maxBatchNodes,
+                                         batchStart[b + 1] - batchStart[b]);
+    }
+    uint64_t numLocal = hostBegin[id + 1] - hostBegin[id];
+    uint64_t loading =
+        numLocal * sizeof(uint64_t) +
+        (edgeOffset(hostBegin[id + 1]) - edgeOffset(hostBegin[id])) *
+            sizeof(uint32_t);
+    uint64_t counting =
+        outDst.size() * sizeof(uint32_t) + remote.size() * sizeof(RemoteEdge) +
+        needed.size() * (sizeof(uint32_t) + sizeof(uint64_t)) +
+        maxBatch * sizeof(uint32_t) +
+        maxBatchNodes * (2 * sizeof(uint32_t) + sizeof(void*));
+    return numNodes * sizeof(uint64_t) + numLocal * sizeof(uint64_t) * 2 +
+           std::max(loading, counting);
+  }
+
+  //! answers one request: the oriented adjacency of each requested node
+  void serve(uint32_t host, galois::runtime::RecvBuffer& buf, uint32_t tag) {
+    auto& net = galois::runtime::getSystemNetworkInterface();
+    std::vector<uint32_t> request;
+    galois::runtime::gDeserialize(buf, request);
+
+    std::vector<uint32_t> lengths(request.size());
+    std::vector<uint32_t> dsts;
+    for (size_t i = 0; i < request.size(); ++i) {
+      lengths[i] = outEnd(request[i]) - outBegin(request[i]);
+      dsts.insert(dsts.end(), outBegin(request[i]), outEnd(request[i]));
+    }
+    galois::runtime::SendBuffer b;
+    galois::runtime::gSerialize(b, lengths, dsts);
+    net.sendTagged(host, tag, b);
+  }
+
+  auto waitFor(uint32_t tag) {
+    auto& net = galois::runtime::getSystemNetworkInterface();
+    decltype(net.recieveTagged(tag, nullptr)) p;
+    do {
+      p = net.recieveTagged(tag, nullptr);
+    } while (!p);
+    return p;
+  }
+
+  //! one round: fetch batch b (possibly empty), serve the other hosts and
+  //! count the triangles closed by the fetched adjacency
+  uint64_t round(size_t b, uint64_t& fetched) {
+    auto& net         = galois::runtime::getSystemNetworkInterface();
+    uint32_t reqTag   = galois::runtime::evilPhase;
+    nextPhase();
+    uint32_t replyTag = galois::runtime::evilPhase;
+    nextPhase();
+
+    size_t bb = b + 1 < batchStart.size() ? batchStart[b] : needed.size();
+    size_t be = b + 1 < batchStart.size() ? batchStart[b + 1] : needed.size();
+
+    // needed is sorted and hosts own contiguous ranges, so each owner's
+    // share of the batch is contiguous as well
+    std::vector<size_t> ownerBegin(numHosts + 1);
+    for (uint32_t h = 0; h <= numHosts; ++h) {
+      ownerBegin[h] =
+          h == numHosts
+              ? be
+              : std::lower_bound(needed.begin() + bb, needed.begin() + be,
+                                 hostBegin[h]) -
+                    needed.begin();
+    }
+    for (uint32_t h = 0; h < numHosts; ++h) {
+      if (h == id)
+        continue;
+      galois::runtime::SendBuffer sb;
+      std::vector<uint32_t> request(needed.begin() + ownerBegin[h],
+                                    needed.begin() + ownerBegin[h + 1]);
+      galois::runtime::gSerialize(sb, request);
+      net.sendTagged(h, reqTag, sb);
+    }
+    net.flush();
+
+    for (uint32_t i = 1; i < numHosts; ++i) {
+      auto p = waitFor(reqTag);
+      serve(p->first, p->second, replyTag);
+    }
+    net.flush();
+
+    std::vector<std::vector<uint32_t>> lengths(numHosts), dsts(numHosts);
+    for (uint32_t i = 1; i < numHosts; ++i) {
+      auto p = waitFor(replyTag);
+      galois::runtime::gDeserialize(p->second, lengths[p->first],
+                                    dsts[p->first]);
+      fetched += dsts[p->first].size();
+    }
+
+    // where the adjacency of each batch node landed
+    std::vector<const uint32_t*> adjBegin(be - bb), adjEnd(be - bb);
+    for (uint32_t h = 0; h < numHosts; ++h) {
+      const uint32_t* ptr = dsts[h].data();
+      for (size_t i = ownerBegin[h]; i < ownerBegin[h + 1]; ++i) {
+        adjBegin[i - bb] = ptr;
+        ptr += lengths[h][i - ownerBegin[h]];
+        adjEnd[i - bb] = ptr;
+      }
+    }
+
+    galois::GAccumulator<uint64_t> triangles;
+    galois::do_all(
+        galois::iterate(bb, be),
+        [&](size_t i) {
+          uint64_t count = 0;
+          for (size_t r = neededStart[i]; r < neededStart[i + 1]; ++r) {
+            uint32_t u = remote[r].second;
+            count += intersect(outBegin(u), outEnd(u), adjBegin[i - bb],
+                               adjEnd[i - bb]);
+          }
+          triangles += count;
+        },
+        galois::steal(), galois::no_stats());
+    return triangles.reduce();
+  }
+
+public:
+  OrientedCounter(uint64_t _batchEdges) : batchEdges(_batchEdges) {
+    auto& net = galois::runtime::getSystemNetworkInterface();
+    id        = net.ID;
+    numHosts  = net.Num;
+  }
+
+  uint64_t run(const std::string& filename) {
+    galois::StatTimer loadTime("OrientedLoad", REGION_NAME);
+    loadTime.start();
+    readOutIndex(filename);
+    partition();
+    orient(filename);
+    planBatches();
+    loadTime.stop();
+
+    galois::runtime::reportStat_Single(REGION_NAME, "OrientedEdges",
+                                       outDst.size());
+    galois::runtime::reportStat_Single(REGION_NAME, "RemoteEdges",
+                                       remote.size());
+    galois::runtime::reportStat_Single(REGION_NAME, "PredictedPeakBytes",
+                                       predictPeakBytes());
+
+    galois::StatTimer countTime("OrientedCount", REGION_NAME);
+    countTime.start();
+    uint64_t nb = hostBegin[id], ne = hostBegin[id + 1];
+    galois::DGAccumulator<uint64_t> triangles;
+    triangles.reset();
+    galois::do_all(
+        galois::iterate(nb, ne),
+        [&](uint64_t u) {
+          uint64_t count = 0;
+          for (auto v = outBegin(u); v != outEnd(u); ++v) {
+            if (*v >= nb && *v < ne) {
+              count += intersect(outBegin(u), outEnd(u), outBegin(*v),
+                                 outEnd(*v));
+            }
+          }
+          triangles += count;
+        },
+        galois::steal(), galois::loopname("TC-Oriented-Local"));
+
+    galois::DGReduceMax<uint64_t> maxRounds;
+    maxRounds.reset();
+    maxRounds.update(batchStart.size() - 1);
+    uint64_t numRounds = maxRounds.reduce();
+    uint64_t fetched   = 0;
+    for (uint64_t b = 0; b < numRounds; ++b) {
+      triangles += round(b, fetched);
+    }
+    countTime.stop();
+
+    galois::runtime::reportStat_Single(REGION_NAME, "Rounds", numRounds);
+    galois::runtime::reportStat_Single(REGION_NAME, "FetchedEdges", fetched);
+    return triangles.reduce();
+  }
+};
+
+} // namespace
+
+uint64_t countTrianglesOriented(const std::string& filename,
+                                uint64_t batchEdges) {
+  OrientedCounter counter(batchEdges);
+  return counter.run(filename);
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/**
+ * Distributed triangle counting without neighborhood replication.
+ *
+ * Nodes are split into contiguous, edge-balanced blocks, one per host, and
+ * every edge is oriented from its lower to its higher (degree, id) endpoint.
+ * A host keeps only the oriented out-edges of its own block. A triangle is
+ * counted once, at the edge (u, v) leaving its lowest vertex u, by
+ * intersecting out(u) with out(v). When v lives on another host, out(v) is
+ * fetched from its owner in rounds: every round a host requests a batch of
+ * remote vertices whose total degree is at most batchEdges, counts with the
+ * replies and discards them before the next round.
+ *
+ * Peak memory per host is therefore known from the partition alone: the
+ * global degree array, the local oriented edges, the list of remote edge
+ * endpoints and one batch. The prediction is reported as the
+ * PredictedPeakBytes statistic.
+ *
+ * @param filename symmetric, clean Galois .gr graph with 32-bit node ids
+ * @param batchEdges bound on the adjacency fetched in one round
+ * @returns the global number of triangles, on every host
+ */
+uint64_t countTrianglesOriented(const std::string& filename,
+                                uint64_t batchEdges);
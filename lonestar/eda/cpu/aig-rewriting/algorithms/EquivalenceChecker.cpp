@@ -0,0 +1,450 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#include "EquivalenceChecker.h"
+#include "galois/AtomicHelpers.h"
+#include "galois/SplitMix64.h"
+#include "galois/substrate/PerThreadStorage.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace algorithm {
+
+//! words of random patterns simulated together by one task
+constexpr static const unsigned BATCH_WORDS = 16;
+
+//! the truth tables of the first six variables of a cone
+constexpr static const uint64_t VAR_MASKS[6] = {
+    0xAAAAAAAAAAAAAAAAull, 0xCCCCCCCCCCCCCCCCull, 0xF0F0F0F0F0F0F0F0ull,
+    0xFF00FF00FF00FF00ull, 0xFFFF0000FFFF0000ull, 0xFFFFFFFF00000000ull};
+
+static uint64_t literalWord(const uint64_t* values, unsigned literal,
+                            unsigned stride, unsigned word) {
+  return values[(literal >> 1) * stride + word] ^ (0 - uint64_t(literal & 1));
+}
+
+/**
+ * Simulates stride words of patterns through the netlist; values holds
+ * numNodes * stride words, with the input words already in place.
+ */
+static void simulate(const SimNetlist& net, uint64_t* values,
+                     unsigned stride) {
+  std::fill(values, values + stride, 0);
+  unsigned node = 1 + net.numInputs;
+  for (auto& fanins : net.ands) {
+    uint64_t* out = values + node * stride;
+    for (unsigned w = 0; w < stride; w++) {
+      out[w] = literalWord(values, fanins.first, stride, w) &
+               literalWord(values, fanins.second, stride, w);
+    }
+    node++;
+  }
+}
+
+EquivalenceChecker::EquivalenceChecker(aig::Aig& golden,
+                                       uint64_t numRandomWords,
+                                       unsigned exhaustiveLimit, uint64_t seed)
+    : golden(makeNetlist(golden)), numRandomWords(numRandomWords),
+      exhaustiveLimit(std::min(exhaustiveLimit, MAX_EXHAUSTIVE_INPUTS)),
+      seed(seed) {}
+
+EquivalenceChecker::~EquivalenceChecker() {}
+
+SimNetlist EquivalenceChecker::makeNetlist(aig::Aig& aig) {
+
+  aig::Graph& graph = aig.getGraph();
+  SimNetlist net;
+  std::unordered_map<aig::GNode, unsigned> index;
+
+  index[aig.getConstZero()] = 0;
+  unsigned nextNode         = 1;
+  for (aig::GNode pi : aig.getInputNodes()) {
+    index[pi] = nextNode++;
+  }
+  for (aig::GNode latch : aig.getLatchNodes()) {
+    index[latch] = nextNode++;
+  }
+  net.numInputs = nextNode - 1;
+
+  auto faninLiteral = [&](auto inEdge) {
+    aig::GNode fanin = graph.getEdgeDst(inEdge);
+    bool polarity = graph.getEdgeData(inEdge, galois::MethodFlag::UNPROTECTED);
+    return 2 * index.at(fanin) + (polarity ? 0 : 1);
+  };
+
+  // post-order DFS over the fanin cones, so ANDs are numbered after their
+  // fanins
+  std::vector<std::pair<aig::GNode, bool>> stack;
+  auto visit = [&](aig::GNode root) {
+    stack.emplace_back(root, false);
+    while (!stack.empty()) {
+      auto [node, expanded] = stack.back();
+      stack.pop_back();
+      if (index.count(node)) {
+        continue;
+      }
+      auto begin = graph.in_edge_begin(node, galois::MethodFlag::UNPROTECTED);
+      auto end   = graph.in_edge_end(node, galois::MethodFlag::UNPROTECTED);
+      if (std::distance(begin, end) != 2) {
+        GALOIS_DIE("unexpected AIG node of type ",
+                   graph.getData(node, galois::MethodFlag::UNPROTECTED).type,
+                   " with ", std::distance(begin, end), " fanins");
+      }
+      if (expanded) {
+        unsigned lhs = faninLiteral(begin);
+        unsigned rhs = faninLiteral(++begin);
+        net.ands.emplace_back(lhs, rhs);
+        index[node] = nextNode++;
+        continue;
+      }
+      stack.emplace_back(node, true);
+      for (auto ii = begin; ii != end; ++ii) {
+        stack.emplace_back(graph.getEdgeDst(ii), false);
+      }
+    }
+  };
+
+  auto addOutput = [&](aig::GNode driven, std::string name) {
+    auto inEdge = graph.in_edge_begin(driven, galois::MethodFlag::UNPROTECTED);
+    visit(graph.getEdgeDst(inEdge));
+    net.outputs.push_back(faninLiteral(inEdge));
+    net.outputNames.push_back(std::move(name));
+  };
+
+  std::vector<std::string>& outputNames = aig.getOutputNames();
+  std::vector<aig::GNode>& outputNodes  = aig.getOutputNodes();
+  for (size_t i = 0; i < outputNodes.size(); i++) {
+    addOutput(outputNodes[i], i < outputNames.size()
+                                  ? outputNames[i]
+                                  : "o" + std::to_string(i));
+  }
+  std::vector<std::string>& latchNames = aig.getLatchNames();
+  std::vector<aig::GNode>& latchNodes  = aig.getLatchNodes();
+  for (size_t i = 0; i < latchNodes.size(); i++) {
+    addOutput(latchNodes[i], (i < latchNames.size() ? latchNames[i]
+                                                    : "l" + std::to_string(i)) +
+                                 "_next");
+  }
+
+  return net;
+}
+
+uint64_t EquivalenceChecker::numStructuralPatterns() const {
+  // all zeros, all ones, then one-hot and one-cold for every input
+  return 2 + 2 * uint64_t(golden.numInputs);
+}
+
+uint64_t EquivalenceChecker::numStructuralWords() const {
+  return (numStructuralPatterns() + 63) / 64;
+}
+
+uint64_t EquivalenceChecker::inputWord(unsigned input, uint64_t word) const {
+  uint64_t random = galois::splitMix64(
+      seed ^ galois::splitMix64(word * golden.numInputs + input));
+  if (word >= numStructuralWords()) {
+    return random;
+  }
+
+  uint64_t value = 0;
+  for (unsigned bit = 0; bit < 64; bit++) {
+    uint64_t pattern = word * 64 + bit;
+    bool set;
+    if (pattern >= numStructuralPatterns()) {
+      set = (random >> bit) & 1;
+    } else if (pattern < 2) {
+      set = pattern == 1;
+    } else {
+      bool oneHot = (pattern - 2) % 2 == 0;
+      set         = ((pattern - 2) / 2 == input) == oneHot;
+    }
+    value |= uint64_t(set) << bit;
+  }
+  return value;
+}
+
+std::vector<bool> EquivalenceChecker::patternInputs(uint64_t pattern) const {
+  std::vector<bool> inputs(golden.numInputs);
+  for (unsigned i = 0; i < golden.numInputs; i++) {
+    inputs[i] = (inputWord(i, pattern / 64) >> (pattern % 64)) & 1;
+  }
+  return inputs;
+}
+
+void EquivalenceChecker::simulateRandom(const SimNetlist& revised,
+                                        EquivalenceResult& result) {
+
+  struct Scratch {
+    std::vector<uint64_t> golden;
+    std::vector<uint64_t> revised;
+  };
+  galois::substrate::PerThreadStorage<Scratch> scratch;
+
+  const unsigned numOutputs = golden.outputs.size();
+  const uint64_t numWords   = numStructuralWords() + numRandomWords;
+  const uint64_t numBatches = (numWords + BATCH_WORDS - 1) / BATCH_WORDS;
+
+  std::vector<std::atomic<uint64_t>> firstFailure(numOutputs);
+  for (auto& failure : firstFailure) {
+    failure = std::numeric_limits<uint64_t>::max();
+  }
+
+  galois::do_all(
+      galois::iterate(uint64_t{0}, numBatches),
+      [&](uint64_t batch) {
+        Scratch& s          = *scratch.getLocal();
+        const uint64_t base = batch * BATCH_WORDS;
+        const unsigned stride =
+            std::min<uint64_t>(BATCH_WORDS, numWords - base);
+        s.golden.resize(golden.numNodes() * stride);
+        s.revised.resize(revised.numNodes() * stride);
+
+        for (unsigned i = 0; i < golden.numInputs; i++) {
+          for (unsigned w = 0; w < stride; w++) {
+            uint64_t word = inputWord(i, base + w);
+            s.golden[(1 + i) * stride + w]  = word;
+            s.revised[(1 + i) * stride + w] = word;
+          }
+        }
+        simulate(golden, s.golden.data(), stride);
+        simulate(revised, s.revised.data(), stride);
+
+        for (unsigned o = 0; o < numOutputs; o++) {
+          for (unsigned w = 0; w < stride; w++) {
+            uint64_t diff =
+                literalWord(s.golden.data(), golden.outputs[o], stride, w) ^
+                literalWord(s.revised.data(), revised.outputs[o], stride, w);
+            if (diff) {
+              galois::atomicMin(firstFailure[o],
+                                (base + w) * 64 + __builtin_ctzll(diff));
+              break;
+            }
+          }
+        }
+      },
+      galois::steal(), galois::loopname("SimulateRandom"));
+
+  result.numPatterns = numWords * 64;
+  for (unsigned o = 0; o < numOutputs; o++) {
+    if (firstFailure[o] != std::numeric_limits<uint64_t>::max()) {
+      result.mismatches.push_back(EquivalenceMismatch{
+          o, golden.outputNames[o], patternInputs(firstFailure[o]), false});
+    }
+  }
+}
+
+//! Inputs in the transitive fanin of a literal
+static void collectSupport(const SimNetlist& net, unsigned literal,
+                           std::vector<unsigned>& support) {
+  std::unordered_set<unsigned> visited;
+  std::vector<unsigned> stack{literal >> 1};
+  while (!stack.empty()) {
+    unsigned node = stack.back();
+    stack.pop_back();
+    if (!visited.insert(node).second) {
+      continue;
+    }
+    if (node > net.numInputs) {
+      auto& fanins = net.ands[node - 1 - net.numInputs];
+      stack.push_back(fanins.first >> 1);
+      stack.push_back(fanins.second >> 1);
+    } else if (node > 0) {
+      support.push_back(node);
+    }
+  }
+}
+
+/**
+ * Renumbers the cone of a literal so that node 0 is constant zero, nodes
+ * 1..support.size() are the support inputs and the cone's ANDs follow.
+ */
+static unsigned compileCone(const SimNetlist& net, unsigned literal,
+                            const std::vector<unsigned>& support,
+                            SimNetlist& cone) {
+  std::vector<unsigned> nodes;
+  std::unordered_set<unsigned> visited;
+  std::vector<unsigned> stack{literal >> 1};
+  while (!stack.empty()) {
+    unsigned node = stack.back();
+    stack.pop_back();
+    if (node <= net.numInputs || !visited.insert(node).second) {
+      continue;
+    }
+    nodes.push_back(node);
+    auto& fanins = net.ands[node - 1 - net.numInputs];
+    stack.push_back(fanins.first >> 1);
+    stack.push_back(fanins.second >> 1);
+  }
+  // ANDs are numbered in topological order
+  std::sort(nodes.begin(), nodes.end());
+
+  std::unordered_map<unsigned, unsigned> local{{0, 0}};
+  for (size_t k = 0; k < support.size(); k++) {
+    local[support[k]] = 1 + k;
+  }
+  cone.numInputs = support.size();
+  cone.ands.clear();
+  auto toLocal = [&](unsigned lit) {
+    return 2 * local.at(lit >> 1) + (lit & 1);
+  };
+  for (unsigned node : nodes) {
+    auto& fanins = net.ands[node - 1 - net.numInputs];
+    cone.ands.emplace_back(toLocal(fanins.first), toLocal(fanins.second));
+    local[node] = cone.numNodes() - 1;
+  }
+  return toLocal(literal);
+}
+
+void EquivalenceChecker::simulateExhaustive(const SimNetlist& revised,
+                                            EquivalenceResult& result) {
+
+  const unsigned numOutputs = golden.outputs.size();
+  std::vector<char> proved(numOutputs, false);
+  std::vector<uint64_t> failure(numOutputs,
+                                std::numeric_limits<uint64_t>::max());
+  std::vector<std::vector<unsigned>> supports(numOutputs);
+
+  galois::do_all(
+      galois::iterate(0u, numOutputs),
+      [&](unsigned o) {
+        std::vector<unsigned>& support = supports[o];
+        collectSupport(golden, golden.outputs[o], support);
+        collectSupport(revised, revised.outputs[o], support);
+        std::sort(support.begin(), support.end());
+        support.erase(std::unique(support.begin(), support.end()),
+                      support.end());
+        if (support.size() > exhaustiveLimit) {
+          return;
+        }
+
+        SimNetlist goldenCone, revisedCone;
+        unsigned goldenOut = compileCone(golden, golden.outputs[o], support,
+                                         goldenCone);
+        unsigned revisedOut =
+            compileCone(revised, revised.outputs[o], support, revisedCone);
+
+        const unsigned numVars = support.size();
+        const uint64_t numWords =
+            numVars <= 6 ? 1 : uint64_t{1} << (numVars - 6);
+        const uint64_t validMask =
+            numVars >= 6 ? ~uint64_t{0}
+                         : (uint64_t{1} << (uint64_t{1} << numVars)) - 1;
+        std::vector<uint64_t> goldenValues(goldenCone.numNodes());
+        std::vector<uint64_t> revisedValues(revisedCone.numNodes());
+
+        for (uint64_t w = 0; w < numWords; w++) {
+          for (unsigned k = 0; k < numVars; k++) {
+            uint64_t word = k < 6 ? VAR_MASKS[k]
+                                  : (0 - ((w >> (k - 6)) & 1));
+            goldenValues[1 + k]  = word;
+            revisedValues[1 + k] = word;
+          }
+          simulate(goldenCone, goldenValues.data(), 1);
+          simulate(revisedCone, revisedValues.data(), 1);
+          uint64_t diff =
+              (literalWord(goldenValues.data(), goldenOut, 1, 0) ^
+               literalWord(revisedValues.data(), revisedOut, 1, 0)) &
+              validMask;
+          if (diff) {
+            failure[o] = w * 64 + __builtin_ctzll(diff);
+            return;
+          }
+        }
+        proved[o] = true;
+      },
+      galois::steal(), galois::loopname("SimulateExhaustive"));
+
+  result.numProvedOutputs = std::count(proved.begin(), proved.end(), true);
+
+  std::vector<char> reported(numOutputs, false);
+  for (auto& mismatch : result.mismatches) {
+    reported[mismatch.output] = true;
+  }
+  for (unsigned o = 0; o < numOutputs; o++) {
+    if (reported[o] || failure[o] == std::numeric_limits<uint64_t>::max()) {
+      continue;
+    }
+    // inputs outside the cone do not matter; leave them at zero
+    std::vector<bool> inputs(golden.numInputs, false);
+    for (size_t k = 0; k < supports[o].size(); k++) {
+      inputs[supports[o][k] - 1] = (failure[o] >> k) & 1;
+    }
+    result.mismatches.push_back(
+        EquivalenceMismatch{o, golden.outputNames[o], inputs, true});
+  }
+  std::sort(result.mismatches.begin(), result.mismatches.end(),
+            [](const EquivalenceMismatch& a, const EquivalenceMismatch& b) {
+              return a.output < b.output;
+            });
+}
+
+EquivalenceResult EquivalenceChecker::check(aig::Aig& aig) {
+
+  EquivalenceResult result{false, "", 0, 0, {}};
+  SimNetlist revised = makeNetlist(aig);
+
+  if (revised.numInputs != golden.numInputs) {
+    result.error = "number of inputs changed from " +
+                   std::to_string(golden.numInputs) + " to " +
+                   std::to_string(revised.numInputs);
+    return result;
+  }
+  if (revised.outputs.size() != golden.outputs.size()) {
+    result.error = "number of outputs changed from " +
+                   std::to_string(golden.outputs.size()) + " to " +
+                   std::to_string(revised.outputs.size());
+    return result;
+  }
+
+  simulateRandom(revised, result);
+  simulateExhaustive(revised, result);
+  result.equivalent = result.mismatches.empty();
+  return result;
+}
+
+void EquivalenceChecker::printReport(const EquivalenceResult& result,
+                                     std::ostream& out) const {
+
+  if (!result.error.empty()) {
+    out << "Equivalence check failed: " << result.error << std::endl;
+    return;
+  }
+
+  out << "Equivalence check: " << result.numPatterns << " patterns, "
+      << result.numProvedOutputs << " of " << golden.outputs.size()
+      << " outputs proved exhaustively, " << result.mismatches.size()
+      << " mismatching outputs" << std::endl;
+
+  for (auto& mismatch : result.mismatches) {
+    out << "Output " << mismatch.output << " (" << mismatch.outputName
+        << ") differs"
+        << (mismatch.exhaustive ? " in exhaustive simulation" : "")
+        << "; counterexample inputs: ";
+    for (bool value : mismatch.counterexample) {
+      out << (value ? '1' : '0');
+    }
+    out << std::endl;
+  }
+}
+
+} /* namespace algorithm */
@@ -0,0 +1,116 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef EQUIVALENCECHECKER_H_
+#define EQUIVALENCECHECKER_H_
+
+#include "Aig.h"
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace algorithm {
+
+/**
+ * Flat copy of the combinational part of an AIG: node 0 is constant zero,
+ * nodes 1..numInputs are the primary inputs followed by the latch outputs and
+ * the remaining nodes are the ANDs in topological order. Signals are literals
+ * (2 * node + complemented). Outputs are the primary outputs followed by the
+ * latch inputs.
+ */
+struct SimNetlist {
+  unsigned numInputs;
+  std::vector<std::pair<unsigned, unsigned>> ands;
+  std::vector<unsigned> outputs;
+  std::vector<std::string> outputNames;
+
+  unsigned numNodes() const { return 1 + numInputs + ands.size(); }
+};
+
+struct EquivalenceMismatch {
+  unsigned output;
+  std::string outputName;
+  //! value of every input (in SimNetlist order) that tells the AIGs apart
+  std::vector<bool> counterexample;
+  //! found while enumerating all assignments of a small output cone
+  bool exhaustive;
+};
+
+struct EquivalenceResult {
+  bool equivalent;
+  //! set when the interfaces differ and nothing could be simulated
+  std::string error;
+  uint64_t numPatterns;
+  //! outputs whose cone was small enough to be proved by enumeration
+  unsigned numProvedOutputs;
+  std::vector<EquivalenceMismatch> mismatches;
+};
+
+/**
+ * Checks that an AIG still computes the function of a golden copy taken
+ * earlier, by bit-parallel simulation of both on 64 patterns per word.
+ *
+ * The patterns start with structural ones (all zeros, all ones, one-hot and
+ * one-cold over the inputs) followed by seeded random words; the words are
+ * simulated in parallel in batches. Outputs whose combined support in both
+ * AIGs has at most exhaustiveLimit inputs are in addition checked on every
+ * assignment of that support, which proves them equivalent; exhaustiveLimit
+ * is clamped to MAX_EXHAUSTIVE_INPUTS. Inputs and
+ * outputs are matched by position; latches are cut into pseudo inputs and
+ * outputs.
+ */
+class EquivalenceChecker {
+
+private:
+  SimNetlist golden;
+  uint64_t numRandomWords;
+  unsigned exhaustiveLimit;
+  uint64_t seed;
+
+  uint64_t numStructuralPatterns() const;
+  uint64_t numStructuralWords() const;
+  uint64_t inputWord(unsigned input, uint64_t word) const;
+  std::vector<bool> patternInputs(uint64_t pattern) const;
+
+  void simulateRandom(const SimNetlist& revised, EquivalenceResult& result);
+  void simulateExhaustive(const SimNetlist& revised,
+                          EquivalenceResult& result);
+
+public:
+  //! 2^26 words per output; the word index must also fit in 64 bits
+  static constexpr unsigned MAX_EXHAUSTIVE_INPUTS = 32;
+
+  EquivalenceChecker(aig::Aig& golden, uint64_t numRandomWords = 1024,
+                     unsigned exhaustiveLimit = 16, uint64_t seed = 1);
+
+  virtual ~EquivalenceChecker();
+
+  static SimNetlist makeNetlist(aig::Aig& aig);
+
+  EquivalenceResult check(aig::Aig& revised);
+
+  void printReport(const EquivalenceResult& result, std::ostream& out) const;
+};
+
+} /* namespace algorithm */
+
+#endif /* EQUIVALENCECHECKER_H_ */
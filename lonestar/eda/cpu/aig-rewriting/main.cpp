@@ -28,10 +28,12 @@
 #include "algorithms/PreCompGraphManager.h"
 #include "algorithms/ChoiceManager.h"
 #include "algorithms/ReconvDrivenCut.h"
+#include "algorithms/EquivalenceChecker.h"
 #include "galois/Galois.h"
 #include "Lonestar/BoilerPlate.h"
 #include <chrono>
 #include <iostream>
+#include <memory>
 #include <sstream>
 
 static const char* name = "AIG Rewriting";
@@ -56,6 +58,18 @@ static cll::opt<bool> AIG(
     cll::desc("Specify that the input graph is a AND-Inverter Graph format"),
     cll::init(false));
 
+static cll::opt<unsigned>
+    simWords("simWords",
+             cll::desc("Number of 64-pattern words of random simulation used "
+                       "to verify the rewritten AIG (default 1024)"),
+             cll::init(1024));
+
+static cll::opt<unsigned> exhaustiveInputs(
+    "exhaustiveInputs",
+    cll::desc("Outputs whose cones have at most this many inputs are verified "
+              "by exhaustive simulation (default 16, at most 32)"),
+    cll::init(16));
+
 using namespace std::chrono;
 
 void aigRewriting(aig::Aig& aig, std::string& fileName, int nThreads,
@@ -127,6 +141,13 @@ void aigRewriting(aig::Aig& aig, std::string& fileName, int nThreads,
     std::cout << "nThreads: " << numThreads << std::endl;
   }
 
+  // choices must leave the function of every output unchanged
+  std::unique_ptr<algorithm::EquivalenceChecker> checker;
+  if (!skipVerify) {
+    checker = std::make_unique<algorithm::EquivalenceChecker>(
+        aig, simWords, exhaustiveInputs);
+  }
+
   high_resolution_clock::time_point t1 = high_resolution_clock::now();
 
   // CutMan
@@ -160,6 +181,16 @@ void aigRewriting(aig::Aig& aig, std::string& fileName, int nThreads,
               << numThreads << ";" << rewriteTime << std::endl;
   }
 
+  if (checker) {
+    algorithm::EquivalenceResult result = checker->check(aig);
+    if (verbose || !result.equivalent) {
+      checker->printReport(result, std::cout);
+    }
+    if (!result.equivalent) {
+      GALOIS_DIE("rewritten AIG is not equivalent to the input");
+    }
+  }
+
   // WRITE AIG //
   AigWriter aigWriter(fileName + "_rewritten.aig");
   aigWriter.writeAig(aig);
@@ -250,6 +281,13 @@ void addChoices(aig::Aig& aig, std::string& GALOIS_UNUSED(fileName),
     std::cout << "nThreads: " << numThreads << std::endl;
   }
 
+  // the netlist is captured before rewriting changes the graph
+  std::unique_ptr<algorithm::EquivalenceChecker> checker;
+  if (!skipVerify) {
+    checker = std::make_unique<algorithm::EquivalenceChecker>(
+        aig, simWords, exhaustiveInputs);
+  }
+
   high_resolution_clock::time_point t1 = high_resolution_clock::now();
 
   // CutMan
@@ -273,6 +311,16 @@ void addChoices(aig::Aig& aig, std::string& GALOIS_UNUSED(fileName),
   high_resolution_clock::time_point t2 = high_resolution_clock::now();
   long double runtime = duration_cast<microseconds>(t2 - t1).count();
 
+  if (checker) {
+    algorithm::EquivalenceResult result = checker->check(aig);
+    if (verbose || !result.equivalent) {
+      checker->printReport(result, std::cout);
+    }
+    if (!result.equivalent) {
+      GALOIS_DIE("AIG with choices is not equivalent to the input");
+    }
+  }
+
   // WRITE DOT //
   // aig.writeDot( fileName + "_choices.dot", aig.toDot() );
 
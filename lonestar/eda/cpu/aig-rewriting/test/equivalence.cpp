@@ -0,0 +1,135 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+// Checks the equivalence checker on a 3-input AIG computing a AND b, a OR c
+// and a XOR b: a restructured copy must pass, and copies with one edge
+// polarity flipped or one fanin rewired must fail with counterexamples that
+// really tell the AIGs apart, both when the outputs are proved exhaustively
+// and when only random simulation is used.
+
+#include "galois/Galois.h"
+#include "Aig.h"
+#include "AigParser.h"
+#include "EquivalenceChecker.h"
+
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+using algorithm::EquivalenceChecker;
+using algorithm::EquivalenceResult;
+using algorithm::SimNetlist;
+
+std::string inputDir;
+
+void parse(const std::string& name, aig::Aig& aig) {
+  AigParser parser(inputDir + "/" + name, aig);
+  parser.parseAag();
+}
+
+//! values of the outputs of net for one assignment of its inputs
+std::vector<bool> evaluate(const SimNetlist& net,
+                           const std::vector<bool>& inputs) {
+  std::vector<bool> value(net.numNodes());
+  for (unsigned i = 0; i < net.numInputs; ++i)
+    value[1 + i] = inputs[i];
+  auto literal = [&](unsigned lit) { return value[lit / 2] != (lit & 1); };
+  for (size_t a = 0; a < net.ands.size(); ++a)
+    value[1 + net.numInputs + a] =
+        literal(net.ands[a].first) && literal(net.ands[a].second);
+  std::vector<bool> outputs;
+  for (unsigned lit : net.outputs)
+    outputs.push_back(literal(lit));
+  return outputs;
+}
+
+void expectEquivalent(aig::Aig& revised, unsigned exhaustiveLimit) {
+  aig::Aig golden;
+  parse("golden.aag", golden);
+  EquivalenceChecker checker(golden, 16, exhaustiveLimit);
+  EquivalenceResult result = checker.check(revised);
+  checker.printReport(result, std::cout);
+  GALOIS_ASSERT(result.error.empty() && result.equivalent);
+  GALOIS_ASSERT(result.mismatches.empty());
+  GALOIS_ASSERT(result.numProvedOutputs == (exhaustiveLimit ? 3 : 0));
+}
+
+void expectMismatch(aig::Aig& revised, unsigned exhaustiveLimit,
+                    const std::set<unsigned>& differing) {
+  aig::Aig golden;
+  parse("golden.aag", golden);
+  SimNetlist goldenNet  = EquivalenceChecker::makeNetlist(golden);
+  SimNetlist revisedNet = EquivalenceChecker::makeNetlist(revised);
+
+  EquivalenceChecker checker(golden, 16, exhaustiveLimit);
+  EquivalenceResult result = checker.check(revised);
+  checker.printReport(result, std::cout);
+  GALOIS_ASSERT(result.error.empty() && !result.equivalent);
+
+  std::set<unsigned> reported;
+  for (auto& mismatch : result.mismatches) {
+    reported.insert(mismatch.output);
+    GALOIS_ASSERT(exhaustiveLimit || !mismatch.exhaustive);
+    GALOIS_ASSERT(mismatch.outputName ==
+                  goldenNet.outputNames[mismatch.output]);
+    GALOIS_ASSERT(mismatch.counterexample.size() == goldenNet.numInputs);
+    std::vector<bool> expected = evaluate(goldenNet, mismatch.counterexample);
+    std::vector<bool> actual   = evaluate(revisedNet, mismatch.counterexample);
+    GALOIS_ASSERT(expected[mismatch.output] != actual[mismatch.output],
+                  "counterexample does not tell output ", mismatch.output,
+                  " apart");
+  }
+  GALOIS_ASSERT(reported == differing);
+}
+
+int main(int argc, char** argv) {
+  galois::SharedMemSys sys;
+  galois::setActiveThreads(2);
+  GALOIS_ASSERT(argc == 2, "usage: ", argv[0], " <test-inputs directory>");
+  inputDir = argv[1];
+
+  for (unsigned exhaustiveLimit : {16u, 0u}) {
+    aig::Aig same;
+    parse("golden.aag", same);
+    expectEquivalent(same, exhaustiveLimit);
+
+    // shares a AND b between the outputs and builds the XOR from an OR
+    aig::Aig restructured;
+    parse("equivalent.aag", restructured);
+    expectEquivalent(restructured, exhaustiveLimit);
+
+    // complement one fanin of the AND driving output 0, which also feeds
+    // output 1
+    aig::Aig flipped;
+    parse("golden.aag", flipped);
+    aig::Graph& graph = flipped.getGraph();
+    auto outEdge      = graph.in_edge_begin(flipped.getOutputNodes()[0]);
+    auto andEdge      = graph.in_edge_begin(graph.getEdgeDst(outEdge));
+    graph.getEdgeData(andEdge) = !graph.getEdgeData(andEdge);
+    expectMismatch(flipped, exhaustiveLimit, {0, 1});
+
+    // one fanin of the XOR reads c instead of b
+    aig::Aig rewired;
+    parse("rewired.aag", rewired);
+    expectMismatch(rewired, exhaustiveLimit, {2});
+  }
+
+  return 0;
+}
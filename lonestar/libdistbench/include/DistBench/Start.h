@@ -27,6 +27,8 @@
 #include "galois/Version.h"
 #include "llvm/Support/CommandLine.h"
 
+#include <functional>
+
 #ifdef GALOIS_ENABLE_GPU
 #include "galois/cuda/HostDecls.h"
 #else
@@ -48,6 +50,8 @@ extern cll::opt<DataCommMode> commMetadata;
 //! Where to write output if output is set
 extern cll::opt<std::string> outputLocation;
 extern cll::opt<bool> output;
+//! Number of hosts to simulate inside this process, 0 to use the real network
+extern cll::opt<unsigned> simulatedHosts;
 
 #ifdef GALOIS_ENABLE_GPU
 enum Personality { CPU, GPU_CUDA };
@@ -75,6 +79,19 @@ extern cll::opt<std::string> personality_set;
 void DistBenchStart(int argc, char** argv, const char* app,
                     const char* desc = nullptr, const char* url = nullptr);
 
+/**
+ * Runs the body of a benchmark (everything after DistBenchStart) on this
+ * host, or on every host of a simulated network inside this process if
+ * -simulateHosts is given; see galois::runtime::simulateHosts. Globals that
+ * hold per-host state, such as the sync substrate and the bitsets of the
+ * sync structures, must then be galois::runtime::HostLocal. Partitioning
+ * policies that wait for edges inside parallel loops, such as the Cartesian
+ * vertex cuts, cannot be simulated.
+ *
+ * @param body benchmark to run
+ */
+void DistBenchRun(const std::function<void()>& body);
+
 template <typename NodeData, typename EdgeData>
 using DistGraphPtr =
     std::unique_ptr<galois::graphs::DistGraph<NodeData, EdgeData>>;
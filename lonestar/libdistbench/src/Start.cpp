@@ -61,6 +61,12 @@ cll::opt<std::string> outputLocation(
 cll::opt<bool> output("output", cll::desc("Write result (default false)"),
                       cll::init(false));
 
+cll::opt<unsigned> simulatedHosts(
+    "simulateHosts",
+    cll::desc("Run this many hosts inside this process on a simulated "
+              "network (for testing; see GALOIS_SIM_* for its parameters)"),
+    cll::init(0), cll::Hidden);
+
 #ifdef GALOIS_ENABLE_GPU
 std::string personality_str(Personality p) {
   switch (p) {
@@ -146,7 +152,8 @@ void DistBenchStart(int argc, char** argv, const char* app, const char* desc,
 
     galois::runtime::reportParam("DistBench", "CommandLine", cmdout.str());
     galois::runtime::reportParam("DistBench", "Threads", numThreads);
-    galois::runtime::reportParam("DistBench", "Hosts", net.Num);
+    galois::runtime::reportParam("DistBench", "Hosts",
+                                 simulatedHosts ? simulatedHosts : net.Num);
     galois::runtime::reportParam("DistBench", "Runs", numRuns);
     galois::runtime::reportParam("DistBench", "Run_UUID",
                                  galois::runtime::getRandUUID());
@@ -160,6 +167,19 @@ void DistBenchStart(int argc, char** argv, const char* app, const char* desc,
   galois::runtime::reportParam("DistBench", "Hostname", name);
 }
 
+void DistBenchRun(const std::function<void()>& body) {
+  if (!simulatedHosts) {
+    body();
+    return;
+  }
+  if (galois::runtime::getSystemNetworkInterface().Num != 1) {
+    GALOIS_DIE("-simulateHosts runs all hosts in one process; start a "
+               "single process");
+  }
+  galois::runtime::simulateHosts(simulatedHosts,
+                                 [&](uint32_t) { body(); });
+}
+
 #ifdef GALOIS_ENABLE_GPU
 /**
  * Processes/setups the specified heterogeneous configuration (the pset
@@ -0,0 +1,55 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_ANALYTICS_H
+#define LONESTAR_ANALYTICS_H
+
+/**
+ * The Lonestar analytics library: the kernels of the Lonestar applications,
+ * callable from other programs.
+ *
+ * Each algorithm family takes a graph whose node data receives the result
+ * and a plan struct that selects the variant and its tuning knobs. The
+ * library initializes the node data itself; the Lonestar applications are
+ * thin drivers over these calls that add input handling, reporting and
+ * verification.
+ */
+
+#include "Lonestar/Analytics/Version.h"
+#include "Lonestar/Analytics/BetweennessCentrality.h"
+#include "Lonestar/Analytics/BFS.h"
+#include "Lonestar/Analytics/CommunityQuality.h"
+#include "Lonestar/Analytics/ConnectedComponents.h"
+#include "Lonestar/Analytics/DistanceOracle.h"
+#include "Lonestar/Analytics/IndependentSet.h"
+#include "Lonestar/Analytics/KCore.h"
+#include "Lonestar/Analytics/KTruss.h"
+#include "Lonestar/Analytics/LabelPropagation.h"
+#include "Lonestar/Analytics/Louvain.h"
+#include "Lonestar/Analytics/Matching.h"
+#include "Lonestar/Analytics/PageRank.h"
+#include "Lonestar/Analytics/PersonalizedPageRank.h"
+#include "Lonestar/Analytics/RandomWalk.h"
+#include "Lonestar/Analytics/SCC.h"
+#include "Lonestar/Analytics/Similarity.h"
+#include "Lonestar/Analytics/SSSP.h"
+#include "Lonestar/Analytics/Temporal.h"
+#include "Lonestar/Analytics/TriangleCount.h"
+
+#endif
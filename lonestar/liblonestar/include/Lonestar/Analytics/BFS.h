@@ -0,0 +1,588 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_ANALYTICS_BFS_H
+#define LONESTAR_ANALYTICS_BFS_H
+
+#include "galois/Galois.h"
+#include "galois/DynamicBitset.h"
+#include "galois/Reduction.h"
+#include "galois/gIO.h"
+#include "galois/gstl.h"
+#include "Lonestar/Analytics/Version.h"
+#include "Lonestar/BFS_SSSP.h"
+#include "Lonestar/Utils.h"
+
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace lonestar {
+namespace analytics {
+inline namespace LONESTAR_ANALYTICS_ABI {
+
+//! Algorithm and tuning options of bfs()
+struct BFSPlan {
+  enum Algorithm { asyncTile = 0, async, syncTile, sync };
+
+  Algorithm algorithm = syncTile;
+  //! false runs the same algorithm on serial worklists
+  bool parallel = true;
+  //! false skips initBFS(), which the caller has run, e.g. outside its timer
+  bool initialize = true;
+};
+
+inline const char* algorithmName(BFSPlan::Algorithm algo) {
+  static const char* const names[] = {"AsyncTile", "Async", "SyncTile",
+                                      "Sync"};
+  return names[algo];
+}
+
+//! Algorithm and tuning options of bfsDirectionOpt()
+struct BFSDirectionOptPlan {
+  enum Algorithm { syncDO = 0, async, automatic };
+
+  Algorithm algorithm = automatic;
+  //! switch from push to pull once the frontier's out-edges exceed the
+  //! unexplored edges divided by alpha
+  int alpha = 15;
+  //! switch back to push once the frontier shrinks below the nodes divided
+  //! by beta
+  int beta = 18;
+  bool parallel = true;
+  //! false skips initBFS(), which the caller has run, e.g. outside its timer
+  bool initialize = true;
+};
+
+inline const char* algorithmName(BFSDirectionOptPlan::Algorithm algo) {
+  static const char* const names[] = {"SyncDO", "Async", "Auto"};
+  return names[algo];
+}
+
+/**
+ * The variant bfsDirectionOpt() runs for BFSDirectionOptPlan::automatic:
+ * direction optimization pays off on graphs with a power-law degree
+ * distribution; large-diameter graphs such as road networks do better with
+ * the asynchronous variant.
+ */
+template <typename Graph>
+BFSDirectionOptPlan::Algorithm chooseBFSDirectionOptAlgorithm(const Graph& g) {
+  return isApproximateDegreeDistributionPowerLaw(g)
+             ? BFSDirectionOptPlan::syncDO
+             : BFSDirectionOptPlan::async;
+}
+
+namespace internal {
+
+template <typename Graph, ptrdiff_t EDGE_TILE_SIZE>
+struct BFSImpl {
+  using GNode = typename Graph::GraphNode;
+  using Base  = BFS_SSSP<Graph, typename Graph::node_data_type, false,
+                        EDGE_TILE_SIZE>;
+  using Dist  = typename Base::Dist;
+
+  using UpdateRequest       = typename Base::UpdateRequest;
+  using SrcEdgeTile         = typename Base::SrcEdgeTile;
+  using SrcEdgeTilePushWrap = typename Base::SrcEdgeTilePushWrap;
+  using ReqPushWrap         = typename Base::ReqPushWrap;
+  using OutEdgeRangeFn      = typename Base::OutEdgeRangeFn;
+  using TileRangeFn         = typename Base::TileRangeFn;
+
+  constexpr static const bool TRACK_WORK     = false;
+  constexpr static const unsigned CHUNK_SIZE = 256U;
+
+  struct EdgeTile {
+    typename Graph::edge_iterator beg;
+    typename Graph::edge_iterator end;
+  };
+
+  struct EdgeTileMaker {
+    EdgeTile operator()(typename Graph::edge_iterator beg,
+                        typename Graph::edge_iterator end) const {
+      return EdgeTile{beg, end};
+    }
+  };
+
+  struct NodePushWrap {
+
+    template <typename C>
+    void operator()(C& cont, const GNode& n, const char* const) const {
+      (*this)(cont, n);
+    }
+
+    template <typename C>
+    void operator()(C& cont, const GNode& n) const {
+      cont.push(n);
+    }
+  };
+
+  struct EdgeTilePushWrap {
+    Graph& graph;
+
+    template <typename C>
+    void operator()(C& cont, const GNode& n, const char* const) const {
+      Base::pushEdgeTilesParallel(cont, graph, n, EdgeTileMaker{});
+    }
+
+    template <typename C>
+    void operator()(C& cont, const GNode& n) const {
+      Base::pushEdgeTiles(cont, graph, n, EdgeTileMaker{});
+    }
+  };
+
+  Graph& graph;
+
+  template <bool CONCURRENT, typename T, typename P, typename R>
+  void asyncAlgo(GNode source, const P& pushWrap, const R& edgeRange) {
+
+    namespace gwl = galois::worklists;
+    using FIFO    = gwl::PerSocketChunkFIFO<CHUNK_SIZE>;
+    using BSWL    = gwl::BulkSynchronous<gwl::PerSocketChunkLIFO<CHUNK_SIZE>>;
+    using WL      = FIFO;
+
+    using Loop =
+        typename std::conditional<CONCURRENT, galois::ForEach,
+                                  galois::WhileQ<galois::SerFIFO<T>>>::type;
+
+    GALOIS_GCC7_IGNORE_UNUSED_BUT_SET
+    constexpr bool useCAS = CONCURRENT && !std::is_same<WL, BSWL>::value;
+    GALOIS_END_GCC7_IGNORE_UNUSED_BUT_SET
+
+    Loop loop;
+
+    galois::GAccumulator<size_t> BadWork;
+    galois::GAccumulator<size_t> WLEmptyWork;
+
+    graph.getData(source) = 0;
+    galois::InsertBag<T> initBag;
+
+    if (CONCURRENT) {
+      pushWrap(initBag, source, 1, "parallel");
+    } else {
+      pushWrap(initBag, source, 1);
+    }
+
+    loop(
+        galois::iterate(initBag),
+        [&](const T& item, auto& ctx) {
+          constexpr galois::MethodFlag flag = galois::MethodFlag::UNPROTECTED;
+
+          const auto& sdist = graph.getData(item.src, flag);
+
+          if (TRACK_WORK) {
+            if (item.dist != sdist) {
+              WLEmptyWork += 1;
+              return;
+            }
+          }
+
+          const auto newDist = item.dist;
+
+          for (auto ii : edgeRange(item)) {
+            GNode dst   = graph.getEdgeDst(ii);
+            auto& ddata = graph.getData(dst, flag);
+
+            while (true) {
+
+              Dist oldDist = ddata;
+
+              if (oldDist <= newDist) {
+                break;
+              }
+
+              if (!useCAS ||
+                  __sync_bool_compare_and_swap(&ddata, oldDist, newDist)) {
+
+                if (!useCAS) {
+                  ddata = newDist;
+                }
+
+                if (TRACK_WORK) {
+                  if (oldDist != Base::DIST_INFINITY) {
+                    BadWork += 1;
+                  }
+                }
+
+                pushWrap(ctx, dst, newDist + 1);
+                break;
+              }
+            }
+          }
+        },
+        galois::wl<WL>(), galois::loopname("runBFS"),
+        galois::disable_conflict_detection());
+
+    if (TRACK_WORK) {
+      galois::runtime::reportStat_Single("BFS", "BadWork", BadWork.reduce());
+      galois::runtime::reportStat_Single("BFS", "EmptyWork",
+                                         WLEmptyWork.reduce());
+    }
+  }
+
+  template <bool CONCURRENT, typename T, typename P, typename R>
+  void syncAlgo(GNode source, const P& pushWrap, const R& edgeRange) {
+
+    using Cont = typename std::conditional<CONCURRENT, galois::InsertBag<T>,
+                                           galois::SerStack<T>>::type;
+    using Loop = typename std::conditional<CONCURRENT, galois::DoAll,
+                                           galois::StdForEach>::type;
+
+    constexpr galois::MethodFlag flag = galois::MethodFlag::UNPROTECTED;
+
+    Loop loop;
+
+    auto curr = std::make_unique<Cont>();
+    auto next = std::make_unique<Cont>();
+
+    Dist nextLevel              = 0U;
+    graph.getData(source, flag) = 0U;
+
+    if (CONCURRENT) {
+      pushWrap(*next, source, "parallel");
+    } else {
+      pushWrap(*next, source);
+    }
+
+    assert(!next->empty());
+
+    while (!next->empty()) {
+
+      std::swap(curr, next);
+      next->clear();
+      ++nextLevel;
+
+      loop(
+          galois::iterate(*curr),
+          [&](const T& item) {
+            for (auto e : edgeRange(item)) {
+              auto dst      = graph.getEdgeDst(e);
+              auto& dstData = graph.getData(dst, flag);
+
+              if (dstData == Base::DIST_INFINITY) {
+                dstData = nextLevel;
+                pushWrap(*next, dst);
+              }
+            }
+          },
+          galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
+          galois::loopname("Sync"));
+    }
+  }
+
+  template <bool CONCURRENT>
+  void run(GNode source, BFSPlan::Algorithm algo) {
+    switch (algo) {
+    case BFSPlan::asyncTile:
+      asyncAlgo<CONCURRENT, SrcEdgeTile>(source, SrcEdgeTilePushWrap{graph},
+                                         TileRangeFn());
+      break;
+    case BFSPlan::async:
+      asyncAlgo<CONCURRENT, UpdateRequest>(source, ReqPushWrap(),
+                                           OutEdgeRangeFn{graph});
+      break;
+    case BFSPlan::syncTile:
+      syncAlgo<CONCURRENT, EdgeTile>(source, EdgeTilePushWrap{graph},
+                                     TileRangeFn());
+      break;
+    case BFSPlan::sync:
+      syncAlgo<CONCURRENT, GNode>(source, NodePushWrap(),
+                                  OutEdgeRangeFn{graph});
+      break;
+    default:
+      GALOIS_DIE("unknown BFS algorithm ", algo);
+    }
+  }
+};
+
+template <typename Graph>
+struct BFSDirectionOptImpl {
+  using GNode = typename Graph::GraphNode;
+  using Base  = BFS_SSSP<Graph, typename Graph::node_data_type, false>;
+  using Dist  = typename Base::Dist;
+
+  constexpr static const unsigned CHUNK_SIZE = 256U;
+
+  Graph& graph;
+  const BFSDirectionOptPlan& plan;
+
+  template <typename WL>
+  void wlToBitset(WL& wl, galois::DynamicBitSet& bitset) {
+    galois::do_all(
+        galois::iterate(wl), [&](const GNode& src) { bitset.set(src); },
+        galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
+        galois::loopname("WlToBitset"));
+  }
+
+  template <typename WL>
+  void bitsetToWl(const galois::DynamicBitSet& bitset, WL& wl) {
+    wl.clear();
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& src) {
+          if (bitset.test(src))
+            wl.push(src);
+        },
+        galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
+        galois::loopname("BitsetToWl"));
+  }
+
+  template <bool CONCURRENT>
+  void syncDOAlgo(GNode source, unsigned runID) {
+
+    using Cont = typename std::conditional<CONCURRENT, galois::InsertBag<GNode>,
+                                           galois::SerStack<GNode>>::type;
+    using Loop = typename std::conditional<CONCURRENT, galois::DoAll,
+                                           galois::StdForEach>::type;
+
+    constexpr galois::MethodFlag flag = galois::MethodFlag::UNPROTECTED;
+    galois::GAccumulator<uint32_t> work_items;
+
+    Loop loop;
+
+    galois::DynamicBitSet front_bitset, next_bitset;
+    front_bitset.resize(graph.size());
+    next_bitset.resize(graph.size());
+
+    front_bitset.reset();
+    next_bitset.reset();
+
+    auto curr = std::make_unique<Cont>();
+    auto next = std::make_unique<Cont>();
+
+    Dist nextLevel              = 0u;
+    graph.getData(source, flag) = 0u;
+
+    next->push(source);
+    // adding source to the worklist
+    work_items += 1;
+
+    int64_t edges_to_check = graph.sizeEdges();
+    int64_t scout_count =
+        std::distance(graph.edge_begin(source), graph.edge_end(source));
+    assert(!next->empty());
+
+    uint64_t old_workItemNum = 0;
+    uint64_t numNodes        = graph.size();
+
+    while (!next->empty()) {
+
+      std::swap(curr, next);
+      next->clear();
+      if (scout_count > edges_to_check / plan.alpha) {
+
+        wlToBitset(*curr, front_bitset);
+        do {
+          ++nextLevel;
+          old_workItemNum = work_items.reduce();
+          work_items.reset();
+
+          // PULL from in-edges
+          loop(
+              galois::iterate(graph),
+              [&](const GNode& dst) {
+                auto& ddata = graph.getData(dst, flag);
+                if (ddata == Base::DIST_INFINITY) {
+                  for (auto e : graph.in_edges(dst)) {
+                    auto src = graph.getInEdgeDst(e);
+
+                    if (front_bitset.test(src)) {
+                      // records the parent on the bfs path rather than the
+                      // level
+                      ddata = src;
+                      next_bitset.set(dst);
+                      work_items += 1;
+                      break;
+                    }
+                  }
+                }
+              },
+              galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
+              galois::loopname(
+                  (std::string("Sync-pull_") + std::to_string(runID))
+                      .c_str()));
+
+          std::swap(front_bitset, next_bitset);
+          next_bitset.reset();
+        } while (work_items.reduce() >= old_workItemNum ||
+                 (work_items.reduce() > numNodes / plan.beta));
+
+        bitsetToWl(front_bitset, *next);
+        scout_count = 1;
+      } else {
+        ++nextLevel;
+        edges_to_check -= scout_count;
+        work_items.reset();
+        // PUSH to out-edges
+        loop(
+            galois::iterate(*curr),
+            [&](const GNode& src) {
+              for (auto e : graph.edges(src)) {
+                auto dst    = graph.getEdgeDst(e);
+                auto& ddata = graph.getData(dst, flag);
+
+                if (ddata == Base::DIST_INFINITY) {
+                  Dist oldDist = ddata;
+                  if (__sync_bool_compare_and_swap(&ddata, oldDist, src)) {
+                    next->push(dst);
+                    work_items += (graph.edge_end(dst) - graph.edge_begin(dst));
+                  }
+                }
+              }
+            },
+            galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
+            galois::loopname(
+                (std::string("Sync-push_") + std::to_string(runID)).c_str()));
+
+        scout_count = work_items.reduce();
+      }
+    }
+  }
+
+  template <bool CONCURRENT>
+  void asyncAlgo(GNode source) {
+
+    namespace gwl = galois::worklists;
+    using WL      = gwl::PerSocketChunkFIFO<CHUNK_SIZE>;
+
+    using Loop =
+        typename std::conditional<CONCURRENT, galois::ForEach,
+                                  galois::WhileQ<galois::SerFIFO<GNode>>>::type;
+
+    Loop loop;
+
+    graph.getData(source) = 0;
+    galois::InsertBag<GNode> initBag;
+    initBag.push(source);
+
+    loop(
+        galois::iterate(initBag),
+        [&](const GNode& src, auto& ctx) {
+          constexpr galois::MethodFlag flag = galois::MethodFlag::UNPROTECTED;
+
+          for (auto ii : graph.edges(src)) {
+            GNode dst   = graph.getEdgeDst(ii);
+            auto& ddata = graph.getData(dst, flag);
+
+            if (ddata == Base::DIST_INFINITY) {
+              Dist oldDist = ddata;
+              if (__sync_bool_compare_and_swap(&ddata, oldDist, src)) {
+                ctx.push(dst);
+              }
+            }
+          }
+        },
+        galois::wl<WL>(), galois::loopname("runBFS"),
+        galois::disable_conflict_detection());
+  }
+
+  template <bool CONCURRENT>
+  void run(GNode source, BFSDirectionOptPlan::Algorithm algo, unsigned runID) {
+    switch (algo) {
+    case BFSDirectionOptPlan::syncDO:
+      syncDOAlgo<CONCURRENT>(source, runID);
+      break;
+    case BFSDirectionOptPlan::async:
+      asyncAlgo<CONCURRENT>(source);
+      break;
+    default:
+      GALOIS_DIE("unknown BFS algorithm ", algo);
+    }
+  }
+};
+
+} // namespace internal
+
+//! Value bfs() and bfsDirectionOpt() leave on unreached nodes
+template <typename Graph>
+constexpr typename Graph::node_data_type bfsInfinity() {
+  return BFS_SSSP<Graph, typename Graph::node_data_type, false>::DIST_INFINITY;
+}
+
+/**
+ * Marks all nodes unreached. bfs() and bfsDirectionOpt() start with this
+ * unless their plan says the caller already did.
+ */
+template <typename Graph>
+void initBFS(Graph& graph) {
+  galois::do_all(
+      galois::iterate(graph),
+      [&](typename Graph::GraphNode n) {
+        graph.getData(n) = bfsInfinity<Graph>();
+      },
+      galois::no_stats());
+}
+
+/**
+ * Breadth-first search from source. Graph is an LC_CSR_Graph (or
+ * compatible) whose node data is an unsigned integer, which receives the
+ * level of each node (bfsInfinity<Graph>() if unreachable).
+ *
+ * @tparam EDGE_TILE_SIZE number of edges per work item of the tiled variants
+ */
+template <typename Graph, ptrdiff_t EDGE_TILE_SIZE = 256>
+void bfs(Graph& graph, typename Graph::GraphNode source,
+         const BFSPlan& plan = BFSPlan()) {
+  using Impl = internal::BFSImpl<Graph, EDGE_TILE_SIZE>;
+
+  if (plan.initialize)
+    initBFS(graph);
+
+  if (plan.parallel)
+    Impl{graph}.template run<true>(source, plan.algorithm);
+  else
+    Impl{graph}.template run<false>(source, plan.algorithm);
+}
+
+/**
+ * Direction-optimizing breadth-first search from source, switching between
+ * pushing along out-edges and pulling along in-edges as the frontier grows
+ * and shrinks (Beamer et al., SC'12).
+ *
+ * Graph is an LC_CSR_CSC_Graph (or compatible, providing in_edges) whose
+ * node data is an unsigned integer, which receives the parent of each node
+ * on the search tree (0 for the source, bfsInfinity<Graph>() if
+ * unreachable).
+ *
+ * @param runID appended to the loop names so repeated runs report separate
+ * statistics
+ */
+template <typename Graph>
+void bfsDirectionOpt(Graph& graph, typename Graph::GraphNode source,
+                     const BFSDirectionOptPlan& plan = BFSDirectionOptPlan(),
+                     unsigned runID = 0) {
+  using Impl = internal::BFSDirectionOptImpl<Graph>;
+
+  if (plan.initialize)
+    initBFS(graph);
+
+  BFSDirectionOptPlan::Algorithm algo = plan.algorithm;
+  if (algo == BFSDirectionOptPlan::automatic)
+    algo = chooseBFSDirectionOptAlgorithm(graph);
+
+  if (plan.parallel)
+    Impl{graph, plan}.template run<true>(source, algo, runID);
+  else
+    Impl{graph, plan}.template run<false>(source, algo, runID);
+}
+
+} // namespace LONESTAR_ANALYTICS_ABI
+} // namespace analytics
+} // namespace lonestar
+
+#endif
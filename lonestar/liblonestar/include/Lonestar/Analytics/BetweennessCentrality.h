@@ -0,0 +1,174 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_ANALYTICS_BETWEENNESSCENTRALITY_H
+#define LONESTAR_ANALYTICS_BETWEENNESSCENTRALITY_H
+
+#include "galois/Galois.h"
+#include "galois/substrate/PerThreadStorage.h"
+#include "Lonestar/Analytics/Version.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace lonestar {
+namespace analytics {
+inline namespace LONESTAR_ANALYTICS_ABI {
+
+//! Node data for betweennessCentrality()
+struct BetweennessNode {
+  float centrality;
+};
+
+//! Tuning options of betweennessCentrality()
+struct BetweennessPlan {
+  //! first source of the Brandes accumulation
+  uint32_t startSource = 0;
+  //! number of consecutive sources to use; 0 means every node
+  uint32_t numSources = 0;
+};
+
+namespace internal {
+
+template <typename Graph>
+struct BetweennessImpl {
+  using GNode = typename Graph::GraphNode;
+
+  constexpr static const uint32_t INFINITY_DIST =
+      std::numeric_limits<uint32_t>::max();
+
+  //! Per-thread state of one Brandes pass; reset only where it was touched
+  struct Scratch {
+    std::vector<uint32_t> dist;
+    std::vector<double> sigma;
+    std::vector<double> delta;
+    std::vector<double> centrality;
+    std::vector<GNode> order;
+  };
+
+  Graph& graph;
+
+  /**
+   * BFS from source recording the number of shortest paths, then dependency
+   * accumulation in reverse BFS order. Only out-edges are used: for a node w
+   * the successors on shortest paths are its out-neighbors one level deeper.
+   */
+  void accumulate(GNode source, Scratch& s) {
+    s.order.clear();
+    s.dist[source]  = 0;
+    s.sigma[source] = 1;
+    s.order.push_back(source);
+
+    for (size_t head = 0; head < s.order.size(); head++) {
+      GNode v = s.order[head];
+      for (auto e : graph.edges(v, galois::MethodFlag::UNPROTECTED)) {
+        GNode w = graph.getEdgeDst(e);
+        if (s.dist[w] == INFINITY_DIST) {
+          s.dist[w] = s.dist[v] + 1;
+          s.order.push_back(w);
+        }
+        if (s.dist[w] == s.dist[v] + 1) {
+          s.sigma[w] += s.sigma[v];
+        }
+      }
+    }
+
+    for (size_t i = s.order.size(); i-- > 0;) {
+      GNode w = s.order[i];
+      for (auto e : graph.edges(w, galois::MethodFlag::UNPROTECTED)) {
+        GNode x = graph.getEdgeDst(e);
+        if (s.dist[x] == s.dist[w] + 1) {
+          s.delta[w] += s.sigma[w] / s.sigma[x] * (1 + s.delta[x]);
+        }
+      }
+      if (w != source) {
+        s.centrality[w] += s.delta[w];
+      }
+    }
+
+    for (GNode w : s.order) {
+      s.dist[w]  = INFINITY_DIST;
+      s.sigma[w] = 0;
+      s.delta[w] = 0;
+    }
+  }
+
+  void run(const BetweennessPlan& plan) {
+    const size_t numNodes = graph.size();
+    uint32_t begin        = std::min<size_t>(plan.startSource, numNodes);
+    uint32_t end          = plan.numSources == 0
+                       ? numNodes
+                       : std::min<size_t>(numNodes,
+                                          size_t(begin) + plan.numSources);
+
+    galois::substrate::PerThreadStorage<Scratch> scratch;
+    galois::on_each([&](unsigned, unsigned) {
+      Scratch& s = *scratch.getLocal();
+      s.dist.assign(numNodes, INFINITY_DIST);
+      s.sigma.assign(numNodes, 0);
+      s.delta.assign(numNodes, 0);
+      s.centrality.assign(numNodes, 0);
+    });
+
+    // sources are independent: each thread runs whole Brandes passes
+    galois::do_all(
+        galois::iterate(begin, end),
+        [&](uint32_t source) { accumulate(source, *scratch.getLocal()); },
+        galois::steal(), galois::chunk_size<1>(),
+        galois::loopname("BetweennessOuter"));
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          double sum = 0;
+          for (unsigned t = 0; t < scratch.size(); t++) {
+            Scratch& s = *scratch.getRemote(t);
+            if (!s.centrality.empty()) {
+              sum += s.centrality[n];
+            }
+          }
+          graph.getData(n).centrality = sum;
+        },
+        galois::loopname("BetweennessReduce"), galois::no_stats());
+  }
+};
+
+} // namespace internal
+
+/**
+ * Brandes betweenness centrality of an unweighted graph, parallelized over
+ * sources. Each thread keeps O(|V|) scratch state, so memory grows with the
+ * number of threads rather than with the number of sources.
+ *
+ * Graph has BetweennessNode (or compatible) node data and node ids in
+ * [0, size()). Scores are not normalized; for a symmetric graph every path is
+ * counted in both directions.
+ */
+template <typename Graph>
+void betweennessCentrality(Graph& graph,
+                           const BetweennessPlan& plan = BetweennessPlan()) {
+  internal::BetweennessImpl<Graph>{graph}.run(plan);
+}
+
+} // namespace LONESTAR_ANALYTICS_ABI
+} // namespace analytics
+} // namespace lonestar
+
+#endif
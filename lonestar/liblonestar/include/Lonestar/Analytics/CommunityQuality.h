@@ -0,0 +1,298 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_ANALYTICS_COMMUNITYQUALITY_H
+#define LONESTAR_ANALYTICS_COMMUNITYQUALITY_H
+
+#include "galois/Galois.h"
+#include "galois/AtomicHelpers.h"
+#include "galois/ParallelSTL.h"
+#include "galois/Reduction.h"
+#include "Lonestar/Analytics/Version.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lonestar {
+namespace analytics {
+inline namespace LONESTAR_ANALYTICS_ABI {
+
+//! Options of communityQuality()
+struct CommunityQualityPlan {
+  //! resolution parameter of the modularity
+  double resolution = 1.0;
+};
+
+//! How well a clustering fits the graph, from communityQuality()
+struct CommunityQuality {
+  uint64_t numCommunities = 0;
+  double modularity       = 0;
+  //! Fraction of the edge weight inside communities
+  double coverage = 0;
+  //! Over communities with edges: cut weight over the smaller of the
+  //! community's volume and the rest of the graph's
+  double meanConductance = 0;
+  double maxConductance  = 0;
+
+  uint64_t numSingletons = 0;
+  uint64_t smallestSize  = 0;
+  uint64_t largestSize   = 0;
+  uint64_t medianSize    = 0;
+  double meanSize        = 0;
+  //! sizeHistogram[i] communities have [2^i, 2^(i+1)) nodes
+  std::vector<uint64_t> sizeHistogram;
+};
+
+//! Agreement of two clusterings of the same nodes, from compareCommunities()
+struct CommunityAgreement {
+  //! Normalized mutual information, 2 I(A; B) / (H(A) + H(B))
+  double nmi = 0;
+  //! Adjusted Rand index
+  double ari = 0;
+};
+
+namespace internal {
+
+/**
+ * Renumbers arbitrary community ids to [0, number of communities) in order
+ * of the ids and returns the number of communities.
+ */
+inline uint32_t denseCommunities(const std::vector<uint64_t>& community,
+                                 std::vector<uint32_t>& dense) {
+  size_t n = community.size();
+  std::vector<std::pair<uint64_t, uint32_t>> byId(n);
+  galois::do_all(
+      galois::iterate(size_t(0), n),
+      [&](size_t i) { byId[i] = std::make_pair(community[i], uint32_t(i)); },
+      galois::no_stats());
+  galois::ParallelSTL::sort(byId.begin(), byId.end());
+
+  dense.resize(n);
+  uint32_t next = 0;
+  for (size_t i = 0; i < n; ++i) {
+    if (i && byId[i].first != byId[i - 1].first)
+      ++next;
+    dense[byId[i].second] = next;
+  }
+  return n ? next + 1 : 0;
+}
+
+//! Number of nodes in each community
+inline std::vector<uint64_t> communitySizes(const std::vector<uint32_t>& c,
+                                            uint32_t numCommunities) {
+  std::vector<std::atomic<uint64_t>> sizes(numCommunities);
+  galois::do_all(
+      galois::iterate(uint32_t(0), numCommunities),
+      [&](uint32_t i) { sizes[i] = 0; }, galois::no_stats());
+  galois::do_all(
+      galois::iterate(size_t(0), c.size()),
+      [&](size_t i) { sizes[c[i]].fetch_add(1, std::memory_order_relaxed); },
+      galois::no_stats());
+  return std::vector<uint64_t>(sizes.begin(), sizes.end());
+}
+
+template <typename Graph>
+double edgeWeight(Graph& graph, typename Graph::edge_iterator e) {
+  if constexpr (std::is_void<typename Graph::edge_data_type>::value) {
+    return 1.0;
+  } else {
+    return graph.getEdgeData(e, galois::MethodFlag::UNPROTECTED);
+  }
+}
+
+//! n choose 2
+inline double pairs(double n) { return n * (n - 1) / 2; }
+
+} // namespace internal
+
+/**
+ * Modularity, coverage, conductance and community sizes of the clustering
+ * that puts node n in community[n]. Community ids are arbitrary; nodes with
+ * the same id form a community.
+ *
+ * Graph is an LC_CSR_Graph (or compatible) holding a symmetric graph; edge
+ * data, if any, is the edge weight, and node data is not used.
+ */
+template <typename Graph>
+CommunityQuality
+communityQuality(Graph& graph, const std::vector<uint64_t>& community,
+                 const CommunityQualityPlan& plan = CommunityQualityPlan()) {
+  using GNode = typename Graph::GraphNode;
+  if (community.size() != graph.size())
+    GALOIS_DIE("need one community per node");
+
+  std::vector<uint32_t> c;
+  uint32_t k = internal::denseCommunities(community, c);
+
+  // weight of the edges of each community and of those inside it
+  std::vector<std::atomic<double>> volume(k), inside(k);
+  galois::do_all(
+      galois::iterate(uint32_t(0), k),
+      [&](uint32_t i) {
+        volume[i] = 0;
+        inside[i] = 0;
+      },
+      galois::no_stats());
+  galois::do_all(
+      galois::iterate(graph),
+      [&](GNode n) {
+        double all = 0, in = 0;
+        for (auto e : graph.edges(n, galois::MethodFlag::UNPROTECTED)) {
+          double w = internal::edgeWeight(graph, e);
+          all += w;
+          if (c[graph.getEdgeDst(e)] == c[n])
+            in += w;
+        }
+        if (all != 0)
+          galois::atomicAdd(volume[c[n]], all);
+        if (in != 0)
+          galois::atomicAdd(inside[c[n]], in);
+      },
+      galois::steal(), galois::loopname("CommunityQuality"));
+
+  galois::GAccumulator<double> totalAccum;
+  galois::do_all(
+      galois::iterate(uint32_t(0), k),
+      [&](uint32_t i) { totalAccum += volume[i].load(); }, galois::no_stats());
+  double total = totalAccum.reduce();
+
+  galois::GAccumulator<double> modularity, coverage, conductance;
+  galois::GAccumulator<uint64_t> numWithEdges;
+  galois::GReduceMax<double> maxConductance;
+  galois::do_all(
+      galois::iterate(uint32_t(0), k),
+      [&](uint32_t i) {
+        double vol = volume[i], in = inside[i];
+        if (total == 0)
+          return;
+        modularity +=
+            in / total - plan.resolution * (vol / total) * (vol / total);
+        coverage += in / total;
+        double denom = std::min(vol, total - vol);
+        if (denom > 0) {
+          double phi = (vol - in) / denom;
+          conductance += phi;
+          maxConductance.update(phi);
+          numWithEdges += 1;
+        }
+      },
+      galois::no_stats());
+
+  CommunityQuality q;
+  q.numCommunities = k;
+  q.modularity     = modularity.reduce();
+  q.coverage       = coverage.reduce();
+  if (uint64_t m = numWithEdges.reduce()) {
+    q.meanConductance = conductance.reduce() / m;
+    q.maxConductance  = maxConductance.reduce();
+  }
+
+  std::vector<uint64_t> sizes = internal::communitySizes(c, k);
+  galois::ParallelSTL::sort(sizes.begin(), sizes.end());
+  if (k) {
+    q.smallestSize = sizes.front();
+    q.largestSize  = sizes.back();
+    q.medianSize   = sizes[k / 2];
+    q.meanSize     = double(graph.size()) / k;
+  }
+  for (uint64_t s : sizes) {
+    unsigned bucket = 0;
+    while (s >> (bucket + 1))
+      ++bucket;
+    if (q.sizeHistogram.size() <= bucket)
+      q.sizeHistogram.resize(bucket + 1, 0);
+    ++q.sizeHistogram[bucket];
+    q.numSingletons += s == 1;
+  }
+  return q;
+}
+
+/**
+ * NMI and ARI between the clusterings that put node n in a[n] and b[n], for
+ * instance a detected clustering and the ground truth.
+ */
+inline CommunityAgreement compareCommunities(const std::vector<uint64_t>& a,
+                                             const std::vector<uint64_t>& b) {
+  if (a.size() != b.size())
+    GALOIS_DIE("clusterings of different numbers of nodes");
+  size_t n = a.size();
+  CommunityAgreement agreement;
+  if (n == 0)
+    return agreement;
+
+  std::vector<uint32_t> ca, cb;
+  uint32_t ka = internal::denseCommunities(a, ca);
+  uint32_t kb = internal::denseCommunities(b, cb);
+
+  // nonzero cells of the contingency table as runs of equal keys
+  std::vector<uint64_t> cells(n);
+  galois::do_all(
+      galois::iterate(size_t(0), n),
+      [&](size_t i) { cells[i] = uint64_t(ca[i]) * kb + cb[i]; },
+      galois::no_stats());
+  galois::ParallelSTL::sort(cells.begin(), cells.end());
+
+  double N = n;
+  double mutual = 0, pairsBoth = 0;
+  for (size_t i = 0; i < n;) {
+    size_t j = i;
+    while (j < n && cells[j] == cells[i])
+      ++j;
+    double nij = j - i;
+    pairsBoth += internal::pairs(nij);
+    mutual += nij / N * std::log(nij * N);
+    i = j;
+  }
+
+  std::vector<uint64_t> sa = internal::communitySizes(ca, ka);
+  std::vector<uint64_t> sb = internal::communitySizes(cb, kb);
+  double entropyA = 0, entropyB = 0, pairsA = 0, pairsB = 0;
+  // I(A; B) = sum nij/N log(nij N / (ai bj)); the log ai and log bj terms
+  // sum to the marginals
+  for (uint64_t s : sa) {
+    entropyA -= s / N * std::log(s / N);
+    mutual -= s / N * std::log(double(s));
+    pairsA += internal::pairs(s);
+  }
+  for (uint64_t s : sb) {
+    entropyB -= s / N * std::log(s / N);
+    mutual -= s / N * std::log(double(s));
+    pairsB += internal::pairs(s);
+  }
+
+  agreement.nmi = entropyA + entropyB > 0
+                      ? 2 * mutual / (entropyA + entropyB)
+                      : 1.0;
+  double expected = n > 1 ? pairsA * pairsB / internal::pairs(N) : 0;
+  double maximum  = (pairsA + pairsB) / 2;
+  agreement.ari   = maximum != expected
+                        ? (pairsBoth - expected) / (maximum - expected)
+                        : 1.0;
+  return agreement;
+}
+
+} // namespace LONESTAR_ANALYTICS_ABI
+} // namespace analytics
+} // namespace lonestar
+
+#endif
@@ -0,0 +1,811 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_ANALYTICS_CONNECTEDCOMPONENTS_H
+#define LONESTAR_ANALYTICS_CONNECTEDCOMPONENTS_H
+
+#include "galois/Galois.h"
+#include "galois/AtomicHelpers.h"
+#include "galois/Bag.h"
+#include "galois/Reduction.h"
+#include "galois/Timer.h"
+#include "galois/UnionFind.h"
+#include "galois/gIO.h"
+#include "galois/gstl.h"
+#include "Lonestar/Analytics/Version.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+namespace lonestar {
+namespace analytics {
+inline namespace LONESTAR_ANALYTICS_ABI {
+
+/**
+ * Node data for the union-find variants of connectedComponents(). After the
+ * run, component() is the same pointer for all nodes of a component.
+ */
+struct ComponentNode : public galois::UnionFindNode<ComponentNode> {
+  using component_type = ComponentNode*;
+
+  ComponentNode()
+      : galois::UnionFindNode<ComponentNode>(const_cast<ComponentNode*>(this)) {
+  }
+  ComponentNode(const ComponentNode& o)
+      : galois::UnionFindNode<ComponentNode>(o.m_component) {}
+
+  ComponentNode& operator=(const ComponentNode& o) {
+    m_component.store(o.m_component.load(std::memory_order_relaxed),
+                      std::memory_order_relaxed);
+    return *this;
+  }
+
+  component_type component() { return this->get(); }
+  bool isRepComp(unsigned int) { return false; }
+
+  //! makes the node a singleton component again
+  void reset() { m_component.store(this, std::memory_order_relaxed); }
+
+  //! Afforest's link: hooks the larger root under the smaller one
+  void link(ComponentNode* b) {
+    ComponentNode* a = m_component.load(std::memory_order_relaxed);
+    b                = b->m_component.load(std::memory_order_relaxed);
+    while (a != b) {
+      if (a < b)
+        std::swap(a, b);
+      // Now a > b
+      ComponentNode* ac = a->m_component.load(std::memory_order_relaxed);
+      if ((ac == a && a->m_component.compare_exchange_strong(a, b)) ||
+          (b == ac))
+        break;
+      a = (a->m_component.load(std::memory_order_relaxed))
+              ->m_component.load(std::memory_order_relaxed);
+      b = b->m_component.load(std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * Like link(), but returns the root that was hooked if it was hooked under
+   * c, and null otherwise.
+   */
+  ComponentNode* hook_min(ComponentNode* b, ComponentNode* c = 0) {
+    ComponentNode* a = m_component.load(std::memory_order_relaxed);
+    b                = b->m_component.load(std::memory_order_relaxed);
+    while (a != b) {
+      if (a < b)
+        std::swap(a, b);
+      // Now a > b
+      ComponentNode* ac = a->m_component.load(std::memory_order_relaxed);
+      if (ac == a && a->m_component.compare_exchange_strong(a, b)) {
+        if (b == c)
+          return a; //! return victim
+        return 0;
+      }
+      if (b == ac) {
+        return 0;
+      }
+      a = (a->m_component.load(std::memory_order_relaxed))
+              ->m_component.load(std::memory_order_relaxed);
+      b = b->m_component.load(std::memory_order_relaxed);
+    }
+    return 0;
+  }
+};
+
+/**
+ * Node data for the label propagation variant of connectedComponents().
+ * After the run, component() is the smallest node id of the component.
+ */
+struct LabelComponentNode {
+  using component_type = unsigned int;
+  std::atomic<unsigned int> comp_current;
+  unsigned int comp_old;
+
+  component_type component() { return comp_current; }
+  bool isRep() { return false; }
+  bool isRepComp(unsigned int x) { return x == comp_current; }
+};
+
+//! Algorithm and tuning options of connectedComponents()
+struct CCPlan {
+  enum Algorithm {
+    serial,
+    labelProp,
+    synchronous,
+    async,
+    edgeAsync,
+    blockedAsync,
+    edgeTiledAsync,
+    afforest,
+    edgeAfforest,
+    edgeTiledAfforest,
+  };
+
+  Algorithm algorithm = edgeTiledAsync;
+  //! edges per work item of the edge-tiled variants
+  uint32_t edgeTileSize = 512;
+  //! Afforest: edges per node linked up front to expose most of the
+  //! connectivity
+  uint32_t neighborSamples = 2;
+  //! Afforest: nodes sampled to guess the largest intermediate component,
+  //! whose nodes then skip their remaining edges
+  uint32_t componentSamples = 1024;
+  //! false skips initConnectedComponents(), which the caller has run, e.g.
+  //! outside its timer
+  bool initialize = true;
+};
+
+inline const char* algorithmName(CCPlan::Algorithm algo) {
+  static const char* const names[] = {
+      "Serial",         "LabelProp",    "Sync",
+      "Async",          "EdgeAsync",    "BlockedAsync",
+      "EdgetiledAsync", "Afforest",     "EdgeAfforest",
+      "EdgetiledAfforest"};
+  return names[algo];
+}
+
+namespace internal {
+
+template <typename Graph>
+struct CCImpl {
+  using GNode          = typename Graph::GraphNode;
+  using NodeData       = ComponentNode;
+  using component_type = NodeData::component_type;
+
+  constexpr static const int CHUNK_SIZE = 1;
+
+  Graph& graph;
+  const CCPlan& plan;
+
+  NodeData& data(GNode n) {
+    return graph.getData(n, galois::MethodFlag::UNPROTECTED);
+  }
+
+  void compress(const char* loopname) {
+    galois::do_all(
+        galois::iterate(graph), [&](const GNode& src) { data(src).compress(); },
+        galois::steal(), galois::loopname(loopname));
+  }
+
+  /**
+   * Serial connected components algorithm. Just use union-find.
+   */
+  void serialAlgo() {
+    for (const GNode& src : graph) {
+      NodeData& sdata = data(src);
+      for (auto ii : graph.edges(src, galois::MethodFlag::UNPROTECTED)) {
+        GNode dst = graph.getEdgeDst(ii);
+        sdata.merge(&data(dst));
+      }
+    }
+
+    for (const GNode& src : graph) {
+      data(src).compress();
+    }
+  }
+
+  struct Edge {
+    GNode src;
+    NodeData* ddata;
+    int count;
+    Edge(GNode src, NodeData* ddata, int count)
+        : src(src), ddata(ddata), count(count) {}
+  };
+
+  /**
+   * Synchronous connected components algorithm.  Initially all nodes are in
+   * their own component. Then, we merge endpoints of edges to form the
+   * spanning tree. Merging is done in two phases to simplify concurrent
+   * updates: (1) find components and (2) union components.  Since the merge
+   * phase does not do any finds, we only process a fraction of edges at a
+   * time; otherwise, the union phase may unnecessarily merge two endpoints in
+   * the same component.
+   */
+  void synchronousAlgo() {
+    size_t rounds = 0;
+    galois::GAccumulator<size_t> emptyMerges;
+
+    galois::InsertBag<Edge> wls[2];
+    galois::InsertBag<Edge>* next;
+    galois::InsertBag<Edge>* cur;
+
+    cur  = &wls[0];
+    next = &wls[1];
+
+    galois::do_all(galois::iterate(graph), [&](const GNode& src) {
+      for (auto ii : graph.edges(src, galois::MethodFlag::UNPROTECTED)) {
+        GNode dst = graph.getEdgeDst(ii);
+        if (src >= dst)
+          continue;
+        cur->push(Edge(src, &data(dst), 0));
+        break;
+      }
+    });
+
+    while (!cur->empty()) {
+      galois::do_all(
+          galois::iterate(*cur),
+          [&](const Edge& edge) {
+            if (!data(edge.src).merge(edge.ddata))
+              emptyMerges += 1;
+          },
+          galois::loopname("Merge"));
+
+      galois::do_all(
+          galois::iterate(*cur),
+          [&](const Edge& edge) {
+            GNode src                  = edge.src;
+            NodeData* scomponent       = data(src).findAndCompress();
+            typename Graph::edge_iterator ii =
+                graph.edge_begin(src, galois::MethodFlag::UNPROTECTED);
+            typename Graph::edge_iterator ei =
+                graph.edge_end(src, galois::MethodFlag::UNPROTECTED);
+            int count = edge.count + 1;
+            std::advance(ii, count);
+            for (; ii != ei; ++ii, ++count) {
+              GNode dst = graph.getEdgeDst(ii);
+              if (src >= dst)
+                continue;
+              NodeData* dcomponent = data(dst).findAndCompress();
+              if (scomponent != dcomponent) {
+                next->push(Edge(src, dcomponent, count));
+                break;
+              }
+            }
+          },
+          galois::loopname("Find"));
+
+      cur->clear();
+      std::swap(cur, next);
+      rounds += 1;
+    }
+
+    compress("Compress");
+
+    galois::runtime::reportStat_Single("CC-Sync", "rounds", rounds);
+    galois::runtime::reportStat_Single("CC-Sync", "emptyMerges",
+                                       emptyMerges.reduce());
+  }
+
+  /**
+   * Like synchronous algorithm, but if we restrict path compression (as done
+   * is @link{UnionFindNode}), we can perform unions and finds concurrently.
+   */
+  void asyncAlgo() {
+    galois::GAccumulator<size_t> emptyMerges;
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& src) {
+          NodeData& sdata = data(src);
+
+          for (auto ii : graph.edges(src, galois::MethodFlag::UNPROTECTED)) {
+            GNode dst = graph.getEdgeDst(ii);
+
+            if (src >= dst)
+              continue;
+
+            if (!sdata.merge(&data(dst)))
+              emptyMerges += 1;
+          }
+        },
+        galois::loopname("CC-Async"));
+
+    compress("CC-Async-Compress");
+
+    galois::runtime::reportStat_Single("CC-Async", "emptyMerges",
+                                       emptyMerges.reduce());
+  }
+
+  void edgeAsyncAlgo() {
+    using EdgeWork = std::pair<GNode, typename Graph::edge_iterator>;
+    galois::GAccumulator<size_t> emptyMerges;
+
+    galois::InsertBag<EdgeWork> works;
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& src) {
+          for (auto ii : graph.edges(src, galois::MethodFlag::UNPROTECTED)) {
+            if (src < graph.getEdgeDst(ii)) {
+              works.push_back(std::make_pair(src, ii));
+            }
+          }
+        },
+        galois::loopname("CC-EdgeAsyncInit"), galois::steal());
+
+    galois::do_all(
+        galois::iterate(works),
+        [&](EdgeWork& e) {
+          GNode dst = graph.getEdgeDst(e.second);
+          if (e.first <= dst && !data(e.first).merge(&data(dst))) {
+            emptyMerges += 1;
+          }
+        },
+        galois::loopname("CC-EdgeAsync"), galois::steal());
+
+    compress("CC-Async-Compress");
+
+    galois::runtime::reportStat_Single("CC-Async", "emptyMerges",
+                                       emptyMerges.reduce());
+  }
+
+  struct WorkItem {
+    GNode src;
+    typename Graph::edge_iterator start;
+  };
+
+  //! Add the next edge between components to the worklist
+  template <bool MakeContinuation, int Limit, typename Pusher>
+  void process(const GNode& src, const typename Graph::edge_iterator& start,
+               Pusher& pusher) {
+
+    NodeData& sdata = data(src);
+    int count       = 1;
+    for (typename Graph::edge_iterator
+             ii = start,
+             ei = graph.edge_end(src, galois::MethodFlag::UNPROTECTED);
+         ii != ei; ++ii, ++count) {
+      GNode dst = graph.getEdgeDst(ii);
+
+      if (src >= dst)
+        continue;
+
+      if (sdata.merge(&data(dst))) {
+        if (Limit == 0 || count != Limit)
+          continue;
+      }
+
+      if (MakeContinuation || (Limit != 0 && count == Limit)) {
+        WorkItem item = {src, ii + 1};
+        pusher.push(item);
+        break;
+      }
+    }
+  }
+
+  /**
+   * Improve performance of async algorithm by following machine topology.
+   */
+  void blockedAsyncAlgo() {
+    galois::InsertBag<WorkItem> items;
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& src) {
+          typename Graph::edge_iterator start =
+              graph.edge_begin(src, galois::MethodFlag::UNPROTECTED);
+          if (galois::substrate::ThreadPool::getSocket() == 0) {
+            process<true, 0>(src, start, items);
+          } else {
+            process<true, 1>(src, start, items);
+          }
+        },
+        galois::loopname("Initialize"));
+
+    galois::for_each(
+        galois::iterate(items),
+        [&](const WorkItem& item, auto& ctx) {
+          process<true, 0>(item.src, item.start, ctx);
+        },
+        galois::loopname("Merge"),
+        galois::wl<galois::worklists::PerSocketChunkFIFO<128>>());
+
+    compress("CC-Async-Compress");
+  }
+
+  struct EdgeTile {
+    GNode src;
+    typename Graph::edge_iterator beg;
+    typename Graph::edge_iterator end;
+  };
+
+  //! tiles of the edges of src from its skip-th edge on
+  template <typename Bag>
+  void pushTiles(Bag& works, GNode src, uint32_t skip) {
+    const ptrdiff_t tileSize = plan.edgeTileSize;
+    auto beg       = graph.edge_begin(src, galois::MethodFlag::UNPROTECTED);
+    const auto end = graph.edge_end(src, galois::MethodFlag::UNPROTECTED);
+    std::advance(beg, std::min<ptrdiff_t>(skip, end - beg));
+
+    for (; beg + tileSize < end;) {
+      auto ne = beg + tileSize;
+      works.push_back(EdgeTile{src, beg, ne});
+      beg = ne;
+    }
+
+    if ((end - beg) > 0) {
+      works.push_back(EdgeTile{src, beg, end});
+    }
+  }
+
+  void edgeTiledAsyncAlgo() {
+    galois::GAccumulator<size_t> emptyMerges;
+
+    galois::InsertBag<EdgeTile> works;
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& src) { pushTiles(works, src, 0); },
+        galois::loopname("CC-EdgeTiledAsyncInit"), galois::steal());
+
+    galois::do_all(
+        galois::iterate(works),
+        [&](const EdgeTile& tile) {
+          GNode src       = tile.src;
+          NodeData& sdata = data(src);
+
+          for (auto ii = tile.beg; ii != tile.end; ++ii) {
+            GNode dst = graph.getEdgeDst(ii);
+            if (src >= dst)
+              continue;
+
+            if (!sdata.merge(&data(dst)))
+              emptyMerges += 1;
+          }
+        },
+        galois::loopname("CC-edgetiledAsync"), galois::steal(),
+        galois::chunk_size<CHUNK_SIZE>() // 16 -> 1
+    );
+
+    compress("CC-Async-Compress");
+
+    galois::runtime::reportStat_Single("CC-edgeTiledAsync", "emptyMerges",
+                                       emptyMerges.reduce());
+  }
+
+  component_type approxLargestComponent() {
+    using map_type = std::unordered_map<
+        component_type, int, std::hash<component_type>,
+        std::equal_to<component_type>,
+        galois::gstl::Pow2Alloc<std::pair<const component_type, int>>>;
+    using pair_type = std::pair<component_type, int>;
+
+    map_type comp_freq(plan.componentSamples);
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    std::uniform_int_distribution<uint32_t> dist(0, graph.size() - 1);
+    for (uint32_t i = 0; i < plan.componentSamples; i++) {
+      comp_freq[data(dist(rng)).component()]++;
+    }
+
+    assert(!comp_freq.empty());
+    auto most_frequent =
+        std::max_element(comp_freq.begin(), comp_freq.end(),
+                         [](const pair_type& a, const pair_type& b) {
+                           return a.second < b.second;
+                         });
+
+    galois::gDebug("Approximate largest intermediate component: ",
+                   most_frequent->first, " (hit rate ",
+                   100.0 * (most_frequent->second) / plan.componentSamples,
+                   "%)");
+
+    return most_frequent->first;
+  }
+
+  /**
+   * CC w/ Afforest sampling.
+   *
+   * [1] M. Sutton, T. Ben-Nun and A. Barak, "Optimizing Parallel Graph
+   * Connectivity Computation via Subgraph Sampling," 2018 IEEE International
+   * Parallel and Distributed Processing Symposium (IPDPS), Vancouver, BC,
+   * 2018, pp. 12-21.
+   */
+  void afforestAlgo() {
+    // (bozhi) should NOT go through single direction in sampling step: nodes
+    // with edges less than NEIGHBOR_SAMPLES will fail
+    for (uint32_t r = 0; r < plan.neighborSamples; ++r) {
+      galois::do_all(
+          galois::iterate(graph),
+          [&](const GNode& src) {
+            typename Graph::edge_iterator ii =
+                graph.edge_begin(src, galois::MethodFlag::UNPROTECTED);
+            typename Graph::edge_iterator ei =
+                graph.edge_end(src, galois::MethodFlag::UNPROTECTED);
+            for (std::advance(ii, r); ii < ei; ii++) {
+              GNode dst = graph.getEdgeDst(ii);
+              data(src).link(&data(dst));
+              break;
+            }
+          },
+          galois::steal(), galois::loopname("Afforest-VNS-Link"));
+
+      compress("Afforest-VNS-Compress");
+    }
+
+    galois::StatTimer StatTimer_Sampling("Afforest-LCS-Sampling");
+    StatTimer_Sampling.start();
+    const component_type c = approxLargestComponent();
+    StatTimer_Sampling.stop();
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& src) {
+          NodeData& sdata = data(src);
+          if (sdata.component() == c)
+            return;
+          typename Graph::edge_iterator ii =
+              graph.edge_begin(src, galois::MethodFlag::UNPROTECTED);
+          typename Graph::edge_iterator ei =
+              graph.edge_end(src, galois::MethodFlag::UNPROTECTED);
+          for (std::advance(ii, plan.neighborSamples); ii < ei; ++ii) {
+            GNode dst = graph.getEdgeDst(ii);
+            sdata.link(&data(dst));
+          }
+        },
+        galois::steal(), galois::loopname("Afforest-LCS-Link"));
+
+    compress("Afforest-LCS-Compress");
+  }
+
+  /**
+   * Edge CC w/ Afforest sampling
+   */
+  void edgeAfforestAlgo() {
+    using EdgeWork = std::pair<GNode, GNode>;
+
+    // (bozhi) should NOT go through single direction in sampling step: nodes
+    // with edges less than NEIGHBOR_SAMPLES will fail
+    for (uint32_t r = 0; r < plan.neighborSamples; ++r) {
+      galois::do_all(
+          galois::iterate(graph),
+          [&](const GNode& src) {
+            typename Graph::edge_iterator ii =
+                graph.edge_begin(src, galois::MethodFlag::UNPROTECTED);
+            typename Graph::edge_iterator ei =
+                graph.edge_end(src, galois::MethodFlag::UNPROTECTED);
+            std::advance(ii, r);
+            if (ii < ei) {
+              GNode dst = graph.getEdgeDst(ii);
+              data(src).hook_min(&data(dst));
+            }
+          },
+          galois::steal(), galois::loopname("EdgeAfforest-VNS-Link"));
+    }
+    compress("EdgeAfforest-VNS-Compress");
+
+    galois::StatTimer StatTimer_Sampling("EdgeAfforest-LCS-Sampling");
+    StatTimer_Sampling.start();
+    const component_type c = approxLargestComponent();
+    StatTimer_Sampling.stop();
+    // node data is laid out in node order, which maps a root back to its node
+    const component_type c0 = &data(0);
+
+    galois::InsertBag<EdgeWork> works;
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& src) {
+          NodeData& sdata = data(src);
+          if (sdata.component() == c)
+            return;
+          auto beg = graph.edge_begin(src, galois::MethodFlag::UNPROTECTED);
+          const auto end = graph.edge_end(src, galois::MethodFlag::UNPROTECTED);
+
+          for (std::advance(beg, plan.neighborSamples); beg < end; beg++) {
+            GNode dst = graph.getEdgeDst(beg);
+            if (src < dst || c == data(dst).component()) {
+              works.push_back(std::make_pair(src, dst));
+            }
+          }
+        },
+        galois::loopname("EdgeAfforest-LCS-Assembling"), galois::steal());
+
+    galois::for_each(
+        galois::iterate(works),
+        [&](const EdgeWork& e, auto& ctx) {
+          NodeData& sdata = data(e.first);
+          if (sdata.component() == c)
+            return;
+          component_type victim = sdata.hook_min(&data(e.second), c);
+          if (victim) {
+            GNode src = victim - c0;
+            for (auto ii : graph.edges(src, galois::MethodFlag::UNPROTECTED)) {
+              GNode dst = graph.getEdgeDst(ii);
+              ctx.push_back(std::make_pair(dst, src));
+            }
+          }
+        },
+        galois::disable_conflict_detection(),
+        galois::loopname("EdgeAfforest-LCS-Link"));
+
+    compress("EdgeAfforest-LCS-Compress");
+  }
+
+  /**
+   * Edgetiled CC w/ Afforest sampling
+   */
+  void edgeTiledAfforestAlgo() {
+    // (bozhi) should NOT go through single direction in sampling step: nodes
+    // with edges less than NEIGHBOR_SAMPLES will fail
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& src) {
+          auto ii = graph.edge_begin(src, galois::MethodFlag::UNPROTECTED);
+          const auto end = graph.edge_end(src, galois::MethodFlag::UNPROTECTED);
+          for (uint32_t r = 0; r < plan.neighborSamples && ii < end;
+               ++r, ++ii) {
+            GNode dst = graph.getEdgeDst(ii);
+            data(src).link(&data(dst));
+          }
+        },
+        galois::steal(), galois::loopname("EdgetiledAfforest-VNS-Link"));
+
+    compress("EdgetiledAfforest-VNS-Compress");
+
+    galois::StatTimer StatTimer_Sampling("EdgetiledAfforest-LCS-Sampling");
+    StatTimer_Sampling.start();
+    const component_type c = approxLargestComponent();
+    StatTimer_Sampling.stop();
+
+    galois::InsertBag<EdgeTile> works;
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& src) {
+          if (data(src).component() == c)
+            return;
+          pushTiles(works, src, plan.neighborSamples);
+        },
+        galois::loopname("EdgetiledAfforest-LCS-Tiling"), galois::steal());
+
+    galois::do_all(
+        galois::iterate(works),
+        [&](const EdgeTile& tile) {
+          NodeData& sdata = data(tile.src);
+          if (sdata.component() == c)
+            return;
+          for (auto ii = tile.beg; ii < tile.end; ++ii) {
+            GNode dst = graph.getEdgeDst(ii);
+            sdata.link(&data(dst));
+          }
+        },
+        galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
+        galois::loopname("EdgetiledAfforest-LCS-Link"));
+
+    compress("EdgetiledAfforest-LCS-Compress");
+  }
+
+  void run() {
+    switch (plan.algorithm) {
+    case CCPlan::serial:
+      serialAlgo();
+      break;
+    case CCPlan::synchronous:
+      synchronousAlgo();
+      break;
+    case CCPlan::async:
+      asyncAlgo();
+      break;
+    case CCPlan::edgeAsync:
+      edgeAsyncAlgo();
+      break;
+    case CCPlan::blockedAsync:
+      blockedAsyncAlgo();
+      break;
+    case CCPlan::edgeTiledAsync:
+      edgeTiledAsyncAlgo();
+      break;
+    case CCPlan::afforest:
+      afforestAlgo();
+      break;
+    case CCPlan::edgeAfforest:
+      edgeAfforestAlgo();
+      break;
+    case CCPlan::edgeTiledAfforest:
+      edgeTiledAfforestAlgo();
+      break;
+    case CCPlan::labelProp:
+      GALOIS_DIE("label propagation needs LabelComponentNode node data");
+      break;
+    default:
+      GALOIS_DIE("unknown connected components algorithm ", plan.algorithm);
+    }
+  }
+};
+
+template <typename Graph>
+void labelPropComponents(Graph& graph) {
+  using GNode = typename Graph::GraphNode;
+
+  galois::GReduceLogicalOr changed;
+  do {
+    changed.reset();
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& src) {
+          auto& sdata = graph.getData(src, galois::MethodFlag::UNPROTECTED);
+          if (sdata.comp_old > sdata.comp_current) {
+            sdata.comp_old = sdata.comp_current;
+
+            changed.update(true);
+
+            for (auto e : graph.edges(src, galois::MethodFlag::UNPROTECTED)) {
+              GNode dst              = graph.getEdgeDst(e);
+              auto& ddata            = graph.getData(dst);
+              unsigned int label_new = sdata.comp_current;
+              galois::atomicMin(ddata.comp_current, label_new);
+            }
+          }
+        },
+        galois::disable_conflict_detection(), galois::steal(),
+        galois::loopname("LabelPropAlgo"));
+  } while (changed.reduce());
+}
+
+} // namespace internal
+
+/**
+ * Makes every node its own component; connectedComponents() starts with this
+ * unless its plan says the caller already did.
+ */
+template <typename Graph>
+void initConnectedComponents(Graph& graph) {
+  using GNode    = typename Graph::GraphNode;
+  using NodeData = typename Graph::node_data_type;
+  galois::do_all(
+      galois::iterate(graph),
+      [&](const GNode& n) {
+        auto& data = graph.getData(n, galois::MethodFlag::UNPROTECTED);
+        if constexpr (std::is_same<NodeData, LabelComponentNode>::value) {
+          data.comp_current = n;
+          data.comp_old     = std::numeric_limits<unsigned int>::max();
+        } else {
+          data.reset();
+        }
+      },
+      galois::no_stats());
+}
+
+/**
+ * Connected components of a symmetric graph.
+ *
+ * Graph is an LC_CSR_Graph (or compatible) with ComponentNode node data for
+ * the union-find variants, or LabelComponentNode node data for
+ * CCPlan::labelProp. The components are left in the node data; see
+ * ComponentNode::component().
+ */
+template <typename Graph>
+void connectedComponents(Graph& graph, const CCPlan& plan = CCPlan()) {
+  using NodeData = typename Graph::node_data_type;
+  if (plan.initialize)
+    initConnectedComponents(graph);
+  if constexpr (std::is_same<NodeData, LabelComponentNode>::value) {
+    if (plan.algorithm != CCPlan::labelProp)
+      GALOIS_DIE("LabelComponentNode node data only supports label "
+                 "propagation");
+    internal::labelPropComponents(graph);
+  } else {
+    static_assert(std::is_same<NodeData, ComponentNode>::value,
+                  "connectedComponents needs ComponentNode or "
+                  "LabelComponentNode node data");
+    internal::CCImpl<Graph>{graph, plan}.run();
+  }
+}
+
+} // namespace LONESTAR_ANALYTICS_ABI
+} // namespace analytics
+} // namespace lonestar
+
+#endif
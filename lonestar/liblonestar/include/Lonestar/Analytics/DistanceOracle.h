@@ -0,0 +1,395 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_ANALYTICS_DISTANCEORACLE_H
+#define LONESTAR_ANALYTICS_DISTANCEORACLE_H
+
+#include "galois/Galois.h"
+#include "galois/AtomicHelpers.h"
+#include "galois/Bag.h"
+#include "galois/LargeArray.h"
+#include "galois/Reduction.h"
+#include "Lonestar/Analytics/RandomWalk.h"
+#include "Lonestar/Analytics/Version.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Landmark distance estimation as described in
+ *
+ * POTAMIAS, Michalis, et al. Fast shortest path distance estimation in large
+ * networks. In: Proceedings of the 18th ACM Conference on Information and
+ * Knowledge Management (CIKM'09). 2009. p. 867-876.
+ */
+
+namespace lonestar {
+namespace analytics {
+inline namespace LONESTAR_ANALYTICS_ABI {
+
+//! Algorithm and tuning options of buildDistanceOracle()
+struct DistanceOraclePlan {
+  enum Selection {
+    //! the nodes with the most out-edges
+    degree,
+    //! each landmark is the node farthest from those chosen before it, so
+    //! the landmarks spread over the graph and all its components
+    coverage,
+    //! uniformly at random
+    random,
+  };
+
+  Selection selection = degree;
+  unsigned numLandmarks = 16;
+  //! Landmarks searched together, at most 64; every node keeps one bit per
+  //! landmark of the batch that still has to be relaxed
+  unsigned batchSize = 16;
+  //! log2 of the bucket width of the searches over weighted edges
+  unsigned deltaShift = 13;
+  //! Seed of the random selection
+  uint64_t seed = 0;
+};
+
+inline const char* algorithmName(DistanceOraclePlan::Selection selection) {
+  static const char* const names[] = {"Degree", "Coverage", "Random"};
+  return names[selection];
+}
+
+//! Range the distance of a pair is known to lie in
+struct DistanceBounds {
+  uint32_t lower;
+  uint32_t upper;
+};
+
+namespace internal {
+template <typename Graph>
+struct DistanceOracleImpl;
+} // namespace internal
+
+/**
+ * Distances from a set of landmarks to every node, from
+ * buildDistanceOracle(). Row n of the table holds the distances of node n to
+ * all landmarks, so a query reads two contiguous rows.
+ */
+class DistanceOracle {
+  template <typename Graph>
+  friend struct internal::DistanceOracleImpl;
+
+  std::vector<uint32_t> landmarkNodes;
+  galois::LargeArray<std::atomic<uint32_t>> table;
+
+public:
+  //! Distance of nodes a landmark does not reach
+  constexpr static const uint32_t INFINITY_DIST =
+      std::numeric_limits<uint32_t>::max();
+
+  size_t numLandmarks() const { return landmarkNodes.size(); }
+  const std::vector<uint32_t>& landmarks() const { return landmarkNodes; }
+
+  uint32_t distance(size_t node, size_t landmark) const {
+    return table[node * numLandmarks() + landmark].load(
+        std::memory_order_relaxed);
+  }
+
+  /**
+   * By the triangle inequality, |d(L, s) - d(L, t)| <= d(s, t) <= d(L, s) +
+   * d(L, t) for every landmark L. Nodes that a landmark reaches only one of
+   * are in different components; INFINITY_DIST is then both bounds. If no
+   * landmark reaches either node, the bounds are 0 and INFINITY_DIST.
+   */
+  DistanceBounds query(uint32_t s, uint32_t t) const {
+    if (s == t)
+      return DistanceBounds{0, 0};
+    size_t k         = numLandmarks();
+    const auto* rowS = &table[s * k];
+    const auto* rowT = &table[t * k];
+    uint64_t lower = 0, upper = INFINITY_DIST;
+    for (size_t l = 0; l < k; ++l) {
+      uint64_t ds = rowS[l].load(std::memory_order_relaxed);
+      uint64_t dt = rowT[l].load(std::memory_order_relaxed);
+      if ((ds == INFINITY_DIST) != (dt == INFINITY_DIST))
+        return DistanceBounds{INFINITY_DIST, INFINITY_DIST};
+      if (ds == INFINITY_DIST)
+        continue;
+      lower = std::max(lower, ds > dt ? ds - dt : dt - ds);
+      upper = std::min(upper, ds + dt);
+    }
+    return DistanceBounds{uint32_t(lower), uint32_t(upper)};
+  }
+
+  //! Answers the queries in parallel
+  void query(const std::vector<std::pair<uint32_t, uint32_t>>& pairs,
+             std::vector<DistanceBounds>& bounds) const {
+    bounds.resize(pairs.size());
+    galois::do_all(
+        galois::iterate(size_t(0), pairs.size()),
+        [&](size_t i) { bounds[i] = query(pairs[i].first, pairs[i].second); },
+        galois::no_stats(), galois::loopname("DistanceOracleQuery"));
+  }
+};
+
+namespace internal {
+
+template <typename Graph>
+struct DistanceOracleImpl {
+  using GNode = typename Graph::GraphNode;
+
+  constexpr static const unsigned CHUNK_SIZE = 64U;
+  constexpr static const uint32_t INF        = DistanceOracle::INFINITY_DIST;
+  constexpr static const galois::MethodFlag flag =
+      galois::MethodFlag::UNPROTECTED;
+
+  //! node has slots that improved, the best of them to dist
+  struct Request {
+    GNode node;
+    uint32_t dist;
+  };
+
+  struct RequestIndexer {
+    unsigned shift;
+    unsigned int operator()(const Request& r) const { return r.dist >> shift; }
+  };
+
+  using PSchunk = galois::worklists::PerSocketChunkFIFO<CHUNK_SIZE>;
+  using OBIM = galois::worklists::OrderedByIntegerMetric<RequestIndexer,
+                                                         PSchunk>;
+
+  Graph& graph;
+  const DistanceOraclePlan& plan;
+  DistanceOracle& oracle;
+  size_t k;
+  //! bit i: slot first + i of the node improved since it was last relaxed
+  galois::LargeArray<std::atomic<uint64_t>> pending;
+
+  DistanceOracleImpl(Graph& g, const DistanceOraclePlan& p, DistanceOracle& o)
+      : graph(g), plan(p), oracle(o), k(0) {}
+
+  static uint64_t weight(Graph& graph, typename Graph::edge_iterator e) {
+    if constexpr (std::is_void<typename Graph::edge_data_type>::value) {
+      return 1;
+    } else {
+      return graph.getEdgeData(e, flag);
+    }
+  }
+
+  uint64_t degree(GNode n) {
+    return std::distance(graph.edge_begin(n, flag), graph.edge_end(n, flag));
+  }
+
+  std::atomic<uint32_t>& dist(GNode n, size_t slot) {
+    return oracle.table[n * k + slot];
+  }
+
+  /**
+   * Delta-stepping from the landmarks of slots [first, first + width) at
+   * once. A work item relaxes the out-edges of a node for all of its slots
+   * that improved, so the landmarks share one pass over the edges of the
+   * nodes they reach at similar distances.
+   */
+  void search(size_t first, size_t width) {
+    galois::InsertBag<Request> init;
+    for (size_t i = 0; i < width; ++i) {
+      GNode l = oracle.landmarkNodes[first + i];
+      dist(l, first + i) = 0;
+      pending[l] |= uint64_t(1) << i;
+      init.push(Request{l, 0});
+    }
+
+    unsigned shift = std::is_void<typename Graph::edge_data_type>::value
+                         ? 0
+                         : plan.deltaShift;
+    galois::for_each(
+        galois::iterate(init),
+        [&](const Request& r, auto& ctx) {
+          uint64_t mask = pending[r.node].exchange(0);
+          if (!mask)
+            return;
+          uint32_t slots[64], from[64];
+          unsigned num = 0;
+          for (; mask; mask &= mask - 1) {
+            unsigned i = __builtin_ctzll(mask);
+            slots[num] = i;
+            from[num++] =
+                dist(r.node, first + i).load(std::memory_order_relaxed);
+          }
+          for (auto e : graph.edges(r.node, flag)) {
+            GNode v       = graph.getEdgeDst(e);
+            uint64_t w    = weight(graph, e);
+            uint64_t bits = 0;
+            uint32_t best = INF;
+            for (unsigned j = 0; j < num; ++j) {
+              uint64_t nd = from[j] + w;
+              if (nd >= INF)
+                continue;
+              uint32_t old = galois::atomicMin<uint32_t>(
+                  dist(v, first + slots[j]), nd);
+              if (nd < old) {
+                bits |= uint64_t(1) << slots[j];
+                best = std::min<uint32_t>(best, nd);
+              }
+            }
+            if (bits) {
+              pending[v].fetch_or(bits);
+              ctx.push(Request{v, best});
+            }
+          }
+        },
+        galois::wl<OBIM>(RequestIndexer{shift}),
+        galois::disable_conflict_detection(),
+        galois::loopname("DistanceOracleSearch"));
+  }
+
+  void selectByDegree() {
+    std::vector<std::pair<uint64_t, GNode>> byDegree(graph.size());
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) { byDegree[n] = std::make_pair(degree(n), n); },
+        galois::no_stats());
+    std::partial_sort(byDegree.begin(), byDegree.begin() + k, byDegree.end(),
+                      [](const auto& a, const auto& b) {
+                        return a.first != b.first ? a.first > b.first
+                                                  : a.second < b.second;
+                      });
+    for (size_t i = 0; i < k; ++i)
+      oracle.landmarkNodes.push_back(byDegree[i].second);
+  }
+
+  void selectRandom() {
+    WalkRandom rng(plan.seed, 0);
+    std::vector<bool> chosen(graph.size(), false);
+    while (oracle.landmarkNodes.size() < k) {
+      GNode n = rng.below(graph.size());
+      if (!chosen[n]) {
+        chosen[n] = true;
+        oracle.landmarkNodes.push_back(n);
+      }
+    }
+  }
+
+  /**
+   * Farthest-first: searches one landmark at a time and picks the next one
+   * among the nodes farthest from all landmarks so far, unreached nodes
+   * first, so it costs numLandmarks separate searches.
+   */
+  void selectByCoverage() {
+    // start from the node with the most out-edges
+    GNode first = 0;
+    for (GNode n : graph)
+      if (degree(n) > degree(first))
+        first = n;
+    std::vector<bool> chosen(graph.size(), false);
+    chosen[first] = true;
+    oracle.landmarkNodes.push_back(first);
+    search(0, 1);
+
+    for (size_t l = 1; l < k; ++l) {
+      // distance to the nearest landmark above the node id, so that the
+      // maximum is the farthest node with the smallest id; unreached nodes
+      // are the farthest
+      galois::GReduceMax<uint64_t> farthest;
+      galois::do_all(
+          galois::iterate(graph),
+          [&](GNode n) {
+            if (chosen[n])
+              return;
+            uint64_t nearest = INF;
+            for (size_t i = 0; i < l; ++i)
+              nearest = std::min<uint64_t>(nearest, dist(n, i).load());
+            farthest.update(nearest << 32 | (INF - n));
+          },
+          galois::no_stats());
+      GNode next = INF - uint32_t(farthest.reduce());
+      chosen[next] = true;
+      oracle.landmarkNodes.push_back(next);
+      search(l, 1);
+    }
+  }
+
+  void run() {
+    if (!plan.numLandmarks)
+      GALOIS_DIE("need at least one landmark");
+    if (!plan.batchSize || plan.batchSize > 64)
+      GALOIS_DIE("the batch size must be in [1, 64]");
+
+    size_t numNodes = graph.size();
+    k               = std::min<size_t>(plan.numLandmarks, numNodes);
+    oracle.landmarkNodes.clear();
+    oracle.table.allocateInterleaved(numNodes * k);
+    pending.allocateInterleaved(numNodes);
+    galois::do_all(
+        galois::iterate(size_t(0), numNodes),
+        [&](size_t n) {
+          for (size_t i = 0; i < k; ++i)
+            oracle.table.constructAt(n * k + i, INF);
+          pending.constructAt(n, uint64_t(0));
+        },
+        galois::no_stats());
+    if (!k)
+      return;
+
+    switch (plan.selection) {
+    case DistanceOraclePlan::degree:
+      selectByDegree();
+      break;
+    case DistanceOraclePlan::random:
+      selectRandom();
+      break;
+    case DistanceOraclePlan::coverage:
+      selectByCoverage();
+      return;
+    default:
+      GALOIS_DIE("unknown landmark selection ", plan.selection);
+    }
+
+    for (size_t first = 0; first < k; first += plan.batchSize)
+      search(first, std::min<size_t>(plan.batchSize, k - first));
+  }
+};
+
+} // namespace internal
+
+/**
+ * Chooses plan.numLandmarks landmarks (all nodes if there are fewer) and
+ * computes the shortest-path distance from each of them to every node, for
+ * estimating point-to-point distances with DistanceOracle::query().
+ *
+ * Graph is an LC_CSR_Graph (or compatible) holding a symmetric graph, since
+ * the bounds need the distance from a node to a landmark to equal the
+ * distance back. Edge data, if any, is a non-negative integer weight;
+ * without it every edge has length 1 and the searches are breadth-first.
+ * The table takes 4 * numLandmarks bytes per node.
+ */
+template <typename Graph>
+DistanceOracle
+buildDistanceOracle(Graph& graph,
+                    const DistanceOraclePlan& plan = DistanceOraclePlan()) {
+  DistanceOracle oracle;
+  internal::DistanceOracleImpl<Graph>(graph, plan, oracle).run();
+  return oracle;
+}
+
+} // namespace LONESTAR_ANALYTICS_ABI
+} // namespace analytics
+} // namespace lonestar
+
+#endif
@@ -0,0 +1,156 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_ANALYTICS_INDEPENDENTSET_H
+#define LONESTAR_ANALYTICS_INDEPENDENTSET_H
+
+#include "galois/Galois.h"
+#include "galois/Bag.h"
+#include "galois/Reduction.h"
+#include "galois/SplitMix64.h"
+#include "Lonestar/Analytics/Version.h"
+
+#include <utility>
+
+namespace lonestar {
+namespace analytics {
+inline namespace LONESTAR_ANALYTICS_ABI {
+
+//! Node data for maximalIndependentSet()
+struct IndependentSetNode {
+  enum Flag : uint8_t { UNDECIDED, IN_SET, OUT_OF_SET };
+
+  Flag flag;
+};
+
+//! Tuning options of maximalIndependentSet()
+struct IndependentSetPlan {
+  //! seeds the node priorities; each seed gives a different deterministic set
+  uint64_t seed = 0;
+};
+
+namespace internal {
+
+template <typename Graph>
+struct IndependentSetImpl {
+  using GNode = typename Graph::GraphNode;
+  using Flag  = IndependentSetNode::Flag;
+
+  Graph& graph;
+  const IndependentSetPlan& plan;
+
+  std::pair<uint64_t, GNode> priority(GNode n) {
+    return std::make_pair(galois::splitMix64(n + plan.seed), n);
+  }
+
+  /**
+   * Luby-style rounds with fixed random priorities: an undecided node whose
+   * priority beats all of its undecided neighbors joins the set, then the
+   * neighbors of new members leave. The result does not depend on the
+   * schedule.
+   */
+  uint64_t run() {
+    galois::InsertBag<GNode> bags[2];
+    galois::InsertBag<GNode>* current = &bags[0];
+    galois::InsertBag<GNode>* next    = &bags[1];
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          graph.getData(n).flag = IndependentSetNode::UNDECIDED;
+          next->push(n);
+        },
+        galois::loopname("IndependentSetInit"), galois::no_stats());
+
+    while (!next->empty()) {
+      std::swap(current, next);
+      next->clear();
+
+      galois::do_all(
+          galois::iterate(*current),
+          [&](GNode n) {
+            auto mine = priority(n);
+            for (auto e : graph.edges(n, galois::MethodFlag::UNPROTECTED)) {
+              GNode dst = graph.getEdgeDst(e);
+              // a neighbor seen IN_SET joined in this round, so it was
+              // undecided when the round started
+              if (dst != n &&
+                  graph.getData(dst, galois::MethodFlag::UNPROTECTED).flag !=
+                      IndependentSetNode::OUT_OF_SET &&
+                  mine < priority(dst)) {
+                return;
+              }
+            }
+            graph.getData(n, galois::MethodFlag::UNPROTECTED).flag =
+                IndependentSetNode::IN_SET;
+          },
+          galois::steal(), galois::loopname("IndependentSetSelect"));
+
+      galois::do_all(
+          galois::iterate(*current),
+          [&](GNode n) {
+            auto& data = graph.getData(n, galois::MethodFlag::UNPROTECTED);
+            if (data.flag != IndependentSetNode::UNDECIDED) {
+              return;
+            }
+            for (auto e : graph.edges(n, galois::MethodFlag::UNPROTECTED)) {
+              if (graph.getData(graph.getEdgeDst(e),
+                                galois::MethodFlag::UNPROTECTED)
+                      .flag == IndependentSetNode::IN_SET) {
+                data.flag = IndependentSetNode::OUT_OF_SET;
+                return;
+              }
+            }
+            next->push(n);
+          },
+          galois::steal(), galois::loopname("IndependentSetExclude"));
+    }
+
+    galois::GAccumulator<uint64_t> size;
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          if (graph.getData(n).flag == IndependentSetNode::IN_SET) {
+            size += 1;
+          }
+        },
+        galois::loopname("IndependentSetSize"), galois::no_stats());
+    return size.reduce();
+  }
+};
+
+} // namespace internal
+
+/**
+ * Computes a maximal independent set of a symmetric graph. Graph has
+ * IndependentSetNode (or compatible) node data; members end up IN_SET and
+ * every other node OUT_OF_SET. Returns the size of the set.
+ */
+template <typename Graph>
+uint64_t
+maximalIndependentSet(Graph& graph,
+                      const IndependentSetPlan& plan = IndependentSetPlan()) {
+  return internal::IndependentSetImpl<Graph>{graph, plan}.run();
+}
+
+} // namespace LONESTAR_ANALYTICS_ABI
+} // namespace analytics
+} // namespace lonestar
+
+#endif
@@ -0,0 +1,217 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_ANALYTICS_KCORE_H
+#define LONESTAR_ANALYTICS_KCORE_H
+
+#include "galois/Galois.h"
+#include "galois/AtomicHelpers.h"
+#include "galois/Bag.h"
+#include "galois/Reduction.h"
+#include "Lonestar/Analytics/Version.h"
+
+#include <atomic>
+#include <iterator>
+#include <utility>
+
+namespace lonestar {
+namespace analytics {
+inline namespace LONESTAR_ANALYTICS_ABI {
+
+//! Node data for kCore(). Deadness can be derived from current degree and k
+//! value, so no field is necessary for it.
+struct KCoreNode {
+  std::atomic<uint32_t> currentDegree;
+};
+
+//! Chunksize for the for_each worklist: best chunksize will depend on input.
+constexpr static const unsigned KCORE_CHUNK_SIZE = 64u;
+
+//! Algorithm and tuning options of kCore()
+struct KCorePlan {
+  enum Algorithm { async, sync };
+
+  Algorithm algorithm = sync;
+  //! false skips initKCore(), which the caller has run, e.g. outside its
+  //! timer
+  bool initialize = true;
+};
+
+inline const char* algorithmName(KCorePlan::Algorithm algo) {
+  static const char* const names[] = {"Async", "Sync"};
+  return names[algo];
+}
+
+namespace internal {
+
+template <typename Graph>
+struct KCoreImpl {
+  using GNode = typename Graph::GraphNode;
+
+  constexpr static const unsigned CHUNK_SIZE = KCORE_CHUNK_SIZE;
+
+  Graph& graph;
+  const unsigned int k;
+
+  //! Setup initial worklist of dead nodes.
+  void setupInitialWorklist(galois::InsertBag<GNode>& initialWorklist) {
+    galois::do_all(
+        galois::iterate(graph.begin(), graph.end()),
+        [&](GNode curNode) {
+          auto& curData = graph.getData(curNode);
+          if (curData.currentDegree < k) {
+            //! Dead node, add to initialWorklist for processing later.
+            initialWorklist.emplace(curNode);
+          }
+        },
+        galois::loopname("InitialWorklistSetup"), galois::no_stats());
+  }
+
+  /**
+   * Decrement the degree of all neighbors of deadNode and push those that
+   * this call took below the threshold.
+   */
+  template <typename Pusher>
+  void killNode(GNode deadNode, Pusher& pusher) {
+    for (auto e : graph.edges(deadNode)) {
+      GNode dest     = graph.getEdgeDst(e);
+      auto& destData = graph.getData(dest);
+      uint32_t oldDegree = galois::atomicSubtract(destData.currentDegree, 1u);
+
+      if (oldDegree == k) {
+        //! This thread was responsible for putting degree of destination
+        //! below threshold; add to worklist.
+        pusher.push(dest);
+      }
+    }
+  }
+
+  /**
+   * Starting with initial dead nodes as current worklist; decrement degree;
+   * add to next worklist; switch next with current and repeat until worklist
+   * is empty (i.e. no more dead nodes).
+   */
+  void syncCascade() {
+    galois::InsertBag<GNode> bags[2];
+    galois::InsertBag<GNode>* current = &bags[0];
+    galois::InsertBag<GNode>* next    = &bags[1];
+
+    //! Setup worklist.
+    setupInitialWorklist(*next);
+
+    while (!next->empty()) {
+      //! Make "next" into current.
+      std::swap(current, next);
+      next->clear();
+
+      galois::do_all(
+          galois::iterate(*current),
+          [&](GNode deadNode) { killNode(deadNode, *next); }, galois::steal(),
+          galois::chunk_size<CHUNK_SIZE>(),
+          galois::loopname("SyncCascadeDeadNodes"));
+    }
+  }
+
+  /**
+   * Starting with initial dead nodes, decrement degree and add to worklist
+   * as they drop below 'k' threshold until worklist is empty (i.e. no more
+   * dead nodes).
+   */
+  void asyncCascade() {
+    galois::InsertBag<GNode> initialWorklist;
+    setupInitialWorklist(initialWorklist);
+
+    galois::for_each(
+        galois::iterate(initialWorklist),
+        [&](GNode deadNode, auto& ctx) { killNode(deadNode, ctx); },
+        galois::disable_conflict_detection(), galois::chunk_size<CHUNK_SIZE>(),
+        galois::loopname("AsyncCascadeDeadNodes"));
+  }
+
+  void run(KCorePlan::Algorithm algorithm) {
+    switch (algorithm) {
+    case KCorePlan::async:
+      asyncCascade();
+      break;
+    case KCorePlan::sync:
+      syncCascade();
+      break;
+    default:
+      GALOIS_DIE("invalid specification of k-core algorithm");
+    }
+  }
+};
+
+} // namespace internal
+
+/**
+ * Initialize degree fields in graph with current degree. Since symmetric,
+ * out edge count is equivalent to in-edge count. kCore() starts with this
+ * unless its plan says the caller already did.
+ */
+template <typename Graph>
+void initKCore(Graph& graph) {
+  using GNode = typename Graph::GraphNode;
+  galois::do_all(
+      galois::iterate(graph.begin(), graph.end()),
+      [&](GNode curNode) {
+        auto& curData = graph.getData(curNode);
+        curData.currentDegree.store(std::distance(graph.edge_begin(curNode),
+                                                  graph.edge_end(curNode)));
+      },
+      galois::loopname("DegreeCounting"), galois::no_stats());
+}
+
+/**
+ * Computes the k-core of a symmetric graph: the subgraph where all vertices
+ * have degree at least k.
+ *
+ * Graph has KCoreNode (or compatible) node data. A node is in the k-core iff
+ * its currentDegree is at least k afterwards; see kCoreSize().
+ */
+template <typename Graph>
+void kCore(Graph& graph, unsigned int k, const KCorePlan& plan = KCorePlan()) {
+  if (plan.initialize)
+    initKCore(graph);
+  internal::KCoreImpl<Graph>{graph, k}.run(plan.algorithm);
+}
+
+//! Number of nodes left in the k-core by kCore()
+template <typename Graph>
+size_t kCoreSize(Graph& graph, unsigned int k) {
+  using GNode = typename Graph::GraphNode;
+  galois::GAccumulator<size_t> aliveNodes;
+
+  galois::do_all(
+      galois::iterate(graph.begin(), graph.end()),
+      [&](GNode curNode) {
+        if (graph.getData(curNode).currentDegree >= k) {
+          aliveNodes += 1;
+        }
+      },
+      galois::loopname("KCoreSanityCheck"), galois::no_stats());
+
+  return aliveNodes.reduce();
+}
+
+} // namespace LONESTAR_ANALYTICS_ABI
+} // namespace analytics
+} // namespace lonestar
+
+#endif
@@ -0,0 +1,157 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_ANALYTICS_KTRUSS_H
+#define LONESTAR_ANALYTICS_KTRUSS_H
+
+#include "galois/Galois.h"
+#include "galois/Bag.h"
+#include "galois/Reduction.h"
+#include "Lonestar/Analytics/Version.h"
+
+#include <utility>
+
+namespace lonestar {
+namespace analytics {
+inline namespace LONESTAR_ANALYTICS_ABI {
+
+//! Edge data flags of kTruss()
+enum KTrussEdge : uint32_t { KTRUSS_REMOVED = 0, KTRUSS_ALIVE = 1 };
+
+namespace internal {
+
+template <typename Graph>
+struct KTrussImpl {
+  using GNode        = typename Graph::GraphNode;
+  using EdgeIterator = typename Graph::edge_iterator;
+
+  Graph& graph;
+  const unsigned int k;
+
+  bool isAlive(EdgeIterator e) {
+    return graph.getEdgeData(e, galois::MethodFlag::UNPROTECTED) ==
+           KTRUSS_ALIVE;
+  }
+
+  //! Number of alive triangles through the alive edge (src, dst), stopping
+  //! as soon as k - 2 are found
+  unsigned support(GNode src, GNode dst) {
+    EdgeIterator aa = graph.edge_begin(src, galois::MethodFlag::UNPROTECTED);
+    EdgeIterator ea = graph.edge_end(src, galois::MethodFlag::UNPROTECTED);
+    EdgeIterator bb = graph.edge_begin(dst, galois::MethodFlag::UNPROTECTED);
+    EdgeIterator eb = graph.edge_end(dst, galois::MethodFlag::UNPROTECTED);
+
+    unsigned found = 0;
+    while (aa != ea && bb != eb && found < k - 2) {
+      GNode a = graph.getEdgeDst(aa);
+      GNode b = graph.getEdgeDst(bb);
+      if (a < b) {
+        ++aa;
+      } else if (b < a) {
+        ++bb;
+      } else {
+        if (isAlive(aa) && isAlive(bb)) {
+          found += 1;
+        }
+        ++aa;
+        ++bb;
+      }
+    }
+    return found;
+  }
+
+  /**
+   * Peels edges in synchronous rounds: every round evaluates the support of
+   * all alive edges on the graph of the previous round, then removes the ones
+   * below k - 2. Support is symmetric, so both directions of an edge are
+   * removed in the same round.
+   */
+  uint64_t run() {
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          for (auto e : graph.edges(n, galois::MethodFlag::UNPROTECTED)) {
+            graph.getEdgeData(e) =
+                graph.getEdgeDst(e) == n ? KTRUSS_REMOVED : KTRUSS_ALIVE;
+          }
+        },
+        galois::loopname("KTrussInit"), galois::no_stats());
+
+    if (k > 2) {
+      galois::InsertBag<std::pair<GNode, EdgeIterator>> doomed;
+      while (true) {
+        doomed.clear();
+        galois::do_all(
+            galois::iterate(graph),
+            [&](GNode n) {
+              for (auto e : graph.edges(n, galois::MethodFlag::UNPROTECTED)) {
+                if (isAlive(e) && support(n, graph.getEdgeDst(e)) < k - 2) {
+                  doomed.push(std::make_pair(n, e));
+                }
+              }
+            },
+            galois::steal(), galois::loopname("KTrussSupport"));
+        if (doomed.empty()) {
+          break;
+        }
+        galois::do_all(
+            galois::iterate(doomed),
+            [&](const std::pair<GNode, EdgeIterator>& item) {
+              graph.getEdgeData(item.second) = KTRUSS_REMOVED;
+            },
+            galois::loopname("KTrussRemove"), galois::no_stats());
+      }
+    }
+
+    galois::GAccumulator<uint64_t> aliveEdges;
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          for (auto e : graph.edges(n, galois::MethodFlag::UNPROTECTED)) {
+            if (isAlive(e) && n < graph.getEdgeDst(e)) {
+              aliveEdges += 1;
+            }
+          }
+        },
+        galois::loopname("KTrussCount"), galois::no_stats());
+    return aliveEdges.reduce();
+  }
+};
+
+} // namespace internal
+
+/**
+ * Computes the k-truss of a symmetric graph: the largest subgraph in which
+ * every edge lies in at least k - 2 triangles. Edges of every node must be
+ * sorted by destination.
+ *
+ * Graph has integral edge data that receives KTRUSS_ALIVE for edges in the
+ * truss and KTRUSS_REMOVED otherwise (self loops are never in it). Returns
+ * the number of undirected edges in the truss.
+ */
+template <typename Graph>
+uint64_t kTruss(Graph& graph, unsigned int k) {
+  return internal::KTrussImpl<Graph>{graph, k}.run();
+}
+
+} // namespace LONESTAR_ANALYTICS_ABI
+} // namespace analytics
+} // namespace lonestar
+
+#endif
@@ -0,0 +1,223 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_ANALYTICS_LABELPROPAGATION_H
+#define LONESTAR_ANALYTICS_LABELPROPAGATION_H
+
+#include "galois/Galois.h"
+#include "galois/Bag.h"
+#include "galois/LargeArray.h"
+#include "galois/Reduction.h"
+#include "galois/substrate/PerThreadStorage.h"
+#include "Lonestar/Analytics/CommunityQuality.h"
+#include "Lonestar/Analytics/RandomWalk.h"
+#include "Lonestar/Analytics/Version.h"
+
+#include <atomic>
+#include <vector>
+
+/**
+ * Label propagation as described in
+ *
+ * RAGHAVAN, Usha Nandini; ALBERT, Reka; KUMARA, Soundar. Near linear time
+ * algorithm to detect community structures in large-scale networks.
+ * Physical Review E, 2007, 76.3: 036106.
+ */
+
+namespace lonestar {
+namespace analytics {
+inline namespace LONESTAR_ANALYTICS_ABI {
+
+//! Node data for labelPropagation()
+struct LabelPropagationNode {
+  uint64_t community;
+};
+
+//! Tuning options of labelPropagation()
+struct LabelPropagationPlan {
+  //! Rounds over the active nodes
+  uint32_t maxIterations = 100;
+  //! Stop once a round changes the label of at most this fraction of nodes
+  double tolerance = 1e-5;
+  //! Ties between equally frequent labels are broken at random
+  uint64_t seed = 0;
+};
+
+//! What labelPropagation() did
+struct LabelPropagationStats {
+  uint32_t rounds = 0;
+  //! Nodes whose neighbors changed label after their last update; every
+  //! other node has one of the most frequent labels around it
+  uint64_t unsettled = 0;
+};
+
+namespace internal {
+
+template <typename Graph>
+struct LabelPropagationImpl {
+  using GNode = typename Graph::GraphNode;
+
+  constexpr static const unsigned CHUNK_SIZE = 64;
+  constexpr static const galois::MethodFlag flag =
+      galois::MethodFlag::UNPROTECTED;
+
+  //! Per-thread map from label to the weight of edges into it
+  struct Scratch {
+    std::vector<double> weight;
+    std::vector<uint32_t> touched;
+  };
+
+  Graph& graph;
+  const LabelPropagationPlan& plan;
+  galois::LargeArray<std::atomic<uint32_t>> label;
+  galois::LargeArray<std::atomic<bool>> active;
+  galois::substrate::PerThreadStorage<Scratch> scratch;
+
+  LabelPropagationImpl(Graph& g, const LabelPropagationPlan& p)
+      : graph(g), plan(p) {}
+
+  /**
+   * Moves u to a label of largest weight among its neighbors, keeping its
+   * own if that is one of them. Returns whether it moved.
+   */
+  bool update(GNode u, uint32_t round, Scratch& s) {
+    for (auto e : graph.edges(u, flag)) {
+      GNode v = graph.getEdgeDst(e);
+      if (v == u)
+        continue;
+      uint32_t l = label[v].load(std::memory_order_relaxed);
+      if (s.weight[l] == 0)
+        s.touched.push_back(l);
+      s.weight[l] += edgeWeight(graph, e);
+    }
+
+    uint32_t own  = label[u].load(std::memory_order_relaxed);
+    uint32_t best = own;
+    double most   = 0;
+    uint64_t ties = 0;
+    WalkRandom rng(plan.seed + round, u);
+    for (uint32_t l : s.touched) {
+      double w = s.weight[l];
+      if (w > most) {
+        most = w;
+        best = l;
+        ties = 1;
+      } else if (w == most && rng.below(++ties) == 0) {
+        best = l;
+      }
+    }
+    if (most > 0 && s.weight[own] == most)
+      best = own;
+
+    for (uint32_t l : s.touched)
+      s.weight[l] = 0;
+    s.touched.clear();
+
+    if (best == own)
+      return false;
+    label[u].store(best, std::memory_order_relaxed);
+    return true;
+  }
+
+  LabelPropagationStats run() {
+    size_t numNodes = graph.size();
+    label.allocateInterleaved(numNodes);
+    active.allocateInterleaved(numNodes);
+    galois::do_all(
+        galois::iterate(size_t(0), numNodes),
+        [&](size_t n) {
+          label.constructAt(n, uint32_t(n));
+          active.constructAt(n, true);
+        },
+        galois::no_stats());
+    galois::on_each([&](unsigned, unsigned) {
+      scratch.getLocal()->weight.assign(numNodes, 0);
+    });
+
+    galois::InsertBag<GNode> frontier, next;
+    galois::do_all(
+        galois::iterate(graph), [&](GNode n) { frontier.push(n); },
+        galois::no_stats());
+
+    LabelPropagationStats stats;
+    galois::GAccumulator<uint64_t> changed;
+    while (!frontier.empty() && stats.rounds < plan.maxIterations) {
+      changed.reset();
+      galois::do_all(
+          galois::iterate(frontier),
+          [&](GNode u) {
+            active[u] = false;
+            if (!update(u, stats.rounds, *scratch.getLocal()))
+              return;
+            changed += 1;
+            for (auto e : graph.edges(u, flag)) {
+              GNode v = graph.getEdgeDst(e);
+              if (!active[v].load(std::memory_order_relaxed) &&
+                  !active[v].exchange(true))
+                next.push(v);
+            }
+          },
+          galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
+          galois::loopname("LabelPropagation"));
+      ++stats.rounds;
+      frontier.clear();
+      std::swap(frontier, next);
+      if (changed.reduce() <= plan.tolerance * numNodes)
+        break;
+    }
+
+    galois::GAccumulator<uint64_t> unsettled;
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          graph.getData(n, flag).community = label[n];
+          if (active[n])
+            unsettled += 1;
+        },
+        galois::no_stats());
+    stats.unsettled = unsettled.reduce();
+    return stats;
+  }
+};
+
+} // namespace internal
+
+/**
+ * Label propagation: every node starts in its own community and repeatedly
+ * joins the community most of its neighbors are in, ties broken at random.
+ * Updates are asynchronous and only nodes whose neighbors changed are
+ * visited again. The community of node n is stored in
+ * graph.getData(n).community and is the id of some node.
+ *
+ * Graph is an LC_CSR_Graph (or compatible) holding a symmetric graph; edge
+ * data, if any, is the edge weight. Node data needs a community field, e.g.
+ * LabelPropagationNode.
+ */
+template <typename Graph>
+LabelPropagationStats
+labelPropagation(Graph& graph,
+                 const LabelPropagationPlan& plan = LabelPropagationPlan()) {
+  return internal::LabelPropagationImpl<Graph>(graph, plan).run();
+}
+
+} // namespace LONESTAR_ANALYTICS_ABI
+} // namespace analytics
+} // namespace lonestar
+
+#endif
@@ -0,0 +1,423 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_ANALYTICS_LOUVAIN_H
+#define LONESTAR_ANALYTICS_LOUVAIN_H
+
+#include "galois/Galois.h"
+#include "galois/AtomicHelpers.h"
+#include "galois/Reduction.h"
+#include "galois/substrate/PerThreadStorage.h"
+#include "Lonestar/Analytics/Version.h"
+
+#include <atomic>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lonestar {
+namespace analytics {
+inline namespace LONESTAR_ANALYTICS_ABI {
+
+//! Node data for louvain()
+struct LouvainNode {
+  uint64_t community;
+};
+
+//! Tuning options of louvain()
+struct LouvainPlan {
+  //! rounds of node moves per level
+  uint32_t maxIterations = 10;
+  //! coarsening levels
+  uint32_t maxLevels = 10;
+  //! a level (and the run) ends when modularity improves by less than this
+  double threshold = 1e-6;
+  //! resolution parameter of the modularity
+  double resolution = 1.0;
+};
+
+namespace internal {
+
+template <typename Graph>
+struct LouvainImpl {
+  using GNode = typename Graph::GraphNode;
+
+  constexpr static const uint32_t UNASSIGNED =
+      std::numeric_limits<uint32_t>::max();
+
+  //! Weighted CSR graph of one level; coarse levels have self loops
+  struct LevelGraph {
+    std::vector<uint64_t> offsets;
+    std::vector<uint32_t> dst;
+    std::vector<double> weight;
+    //! weighted degree, self loops included
+    std::vector<double> degree;
+
+    uint32_t size() const { return degree.size(); }
+  };
+
+  //! Per-thread map from community to the weight of edges into it
+  struct Scratch {
+    std::vector<double> weight;
+    std::vector<uint32_t> touched;
+
+    void add(uint32_t c, double w) {
+      if (weight[c] == 0) {
+        touched.push_back(c);
+      }
+      weight[c] += w;
+    }
+
+    void clear() {
+      for (uint32_t c : touched) {
+        weight[c] = 0;
+      }
+      touched.clear();
+    }
+  };
+
+  Graph& graph;
+  const LouvainPlan& plan;
+  double totalWeight = 0;
+
+  static double edgeWeight(Graph& graph, typename Graph::edge_iterator e) {
+    if constexpr (std::is_void<typename Graph::edge_data_type>::value) {
+      return 1.0;
+    } else {
+      return graph.getEdgeData(e, galois::MethodFlag::UNPROTECTED);
+    }
+  }
+
+  void fromGraph(LevelGraph& level) {
+    const uint32_t n = graph.size();
+    level.offsets.resize(n + 1);
+    level.dst.resize(graph.sizeEdges());
+    level.weight.resize(graph.sizeEdges());
+    level.degree.resize(n);
+    level.offsets[0] = 0;
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          uint64_t e    = *graph.edge_begin(n, galois::MethodFlag::UNPROTECTED);
+          double degree = 0;
+          for (auto ii : graph.edges(n, galois::MethodFlag::UNPROTECTED)) {
+            level.dst[e]    = graph.getEdgeDst(ii);
+            level.weight[e] = edgeWeight(graph, ii);
+            degree += level.weight[e];
+            e++;
+          }
+          level.offsets[n + 1] = e;
+          level.degree[n]      = degree;
+        },
+        galois::loopname("LouvainLevelInit"), galois::no_stats());
+  }
+
+  double modularity(const LevelGraph& g, const std::vector<uint32_t>& comm,
+                    const std::vector<std::atomic<double>>& total) {
+    galois::GAccumulator<double> internalWeight;
+    galois::GAccumulator<double> totalSquares;
+
+    galois::do_all(
+        galois::iterate(0u, g.size()),
+        [&](uint32_t n) {
+          double w = 0;
+          for (uint64_t e = g.offsets[n]; e < g.offsets[n + 1]; e++) {
+            if (comm[g.dst[e]] == comm[n]) {
+              w += g.weight[e];
+            }
+          }
+          internalWeight += w;
+          totalSquares += total[n] * total[n];
+        },
+        galois::loopname("LouvainModularity"), galois::no_stats());
+
+    return internalWeight.reduce() / totalWeight -
+           plan.resolution * totalSquares.reduce() /
+               (totalWeight * totalWeight);
+  }
+
+  void sumCommunities(const LevelGraph& g, const std::vector<uint32_t>& comm,
+                      std::vector<std::atomic<double>>& total,
+                      std::vector<std::atomic<uint32_t>>& size) {
+    galois::do_all(
+        galois::iterate(0u, g.size()),
+        [&](uint32_t n) {
+          total[n] = 0;
+          size[n]  = 0;
+        },
+        galois::no_stats());
+    galois::do_all(
+        galois::iterate(0u, g.size()),
+        [&](uint32_t n) {
+          galois::atomicAdd(total[comm[n]], g.degree[n]);
+          size[comm[n]] += 1;
+        },
+        galois::loopname("LouvainSumCommunities"), galois::no_stats());
+  }
+
+  /**
+   * Moves nodes between communities of one level. Every round picks the best
+   * move of each node against the assignment of the previous round and then
+   * applies all of them; two singletons never swap into each other. A round
+   * that does not raise modularity by the threshold is undone and ends the
+   * level. Returns the modularity reached.
+   */
+  double moveNodes(const LevelGraph& g, std::vector<uint32_t>& comm,
+                   double currentModularity) {
+    const uint32_t n = g.size();
+    std::vector<std::atomic<double>> total(n);
+    std::vector<std::atomic<uint32_t>> size(n);
+    std::vector<uint32_t> next(n);
+
+    galois::substrate::PerThreadStorage<Scratch> scratch;
+    galois::on_each([&](unsigned, unsigned) {
+      scratch.getLocal()->weight.assign(n, 0);
+    });
+
+    for (uint32_t round = 0; round < plan.maxIterations; round++) {
+      sumCommunities(g, comm, total, size);
+      galois::GAccumulator<uint32_t> moved;
+
+      galois::do_all(
+          galois::iterate(0u, n),
+          [&](uint32_t v) {
+            Scratch& s   = *scratch.getLocal();
+            uint32_t own = comm[v];
+            for (uint64_t e = g.offsets[v]; e < g.offsets[v + 1]; e++) {
+              if (g.dst[e] != v) {
+                s.add(comm[g.dst[e]], g.weight[e]);
+              }
+            }
+
+            double scale  = plan.resolution * g.degree[v] / totalWeight;
+            uint32_t best = own;
+            double bestGain =
+                s.weight[own] - scale * (total[own] - g.degree[v]);
+            for (uint32_t c : s.touched) {
+              double gain = s.weight[c] - scale * total[c];
+              if (gain > bestGain || (gain == bestGain && c < best)) {
+                best     = c;
+                bestGain = gain;
+              }
+            }
+            if (best != own && size[own] == 1 && size[best] == 1 &&
+                best > own) {
+              best = own;
+            }
+            s.clear();
+
+            next[v] = best;
+            if (best != own) {
+              moved += 1;
+            }
+          },
+          galois::steal(), galois::loopname("LouvainMoveNodes"));
+
+      if (moved.reduce() == 0) {
+        break;
+      }
+      std::swap(comm, next);
+      sumCommunities(g, comm, total, size);
+      double newModularity = modularity(g, comm, total);
+      if (newModularity < currentModularity + plan.threshold) {
+        if (newModularity < currentModularity) {
+          std::swap(comm, next);
+        } else {
+          currentModularity = newModularity;
+        }
+        break;
+      }
+      currentModularity = newModularity;
+    }
+    return currentModularity;
+  }
+
+  /**
+   * Renumbers the communities in comm to [0, k) and builds the level whose
+   * nodes are those communities. Returns k.
+   */
+  uint32_t coarsen(const LevelGraph& g, std::vector<uint32_t>& comm,
+                   LevelGraph& coarse) {
+    const uint32_t n = g.size();
+    std::vector<uint32_t> renumber(n, UNASSIGNED);
+    uint32_t k = 0;
+    for (uint32_t v = 0; v < n; v++) {
+      if (renumber[comm[v]] == UNASSIGNED) {
+        renumber[comm[v]] = k++;
+      }
+    }
+    for (uint32_t v = 0; v < n; v++) {
+      comm[v] = renumber[comm[v]];
+    }
+    if (k == n) {
+      return k;
+    }
+
+    // group the members of each community
+    std::vector<uint64_t> memberOffsets(k + 1, 0);
+    std::vector<uint32_t> members(n);
+    for (uint32_t v = 0; v < n; v++) {
+      memberOffsets[comm[v] + 1]++;
+    }
+    for (uint32_t c = 0; c < k; c++) {
+      memberOffsets[c + 1] += memberOffsets[c];
+    }
+    {
+      std::vector<uint64_t> cursor(memberOffsets.begin(),
+                                   memberOffsets.end() - 1);
+      for (uint32_t v = 0; v < n; v++) {
+        members[cursor[comm[v]]++] = v;
+      }
+    }
+
+    std::vector<std::vector<std::pair<uint32_t, double>>> edges(k);
+    coarse.degree.assign(k, 0);
+    galois::substrate::PerThreadStorage<Scratch> scratch;
+    galois::on_each([&](unsigned, unsigned) {
+      scratch.getLocal()->weight.assign(k, 0);
+    });
+
+    galois::do_all(
+        galois::iterate(0u, k),
+        [&](uint32_t c) {
+          Scratch& s    = *scratch.getLocal();
+          double degree = 0;
+          for (uint64_t m = memberOffsets[c]; m < memberOffsets[c + 1]; m++) {
+            uint32_t v = members[m];
+            degree += g.degree[v];
+            for (uint64_t e = g.offsets[v]; e < g.offsets[v + 1]; e++) {
+              s.add(comm[g.dst[e]], g.weight[e]);
+            }
+          }
+          for (uint32_t d : s.touched) {
+            edges[c].emplace_back(d, s.weight[d]);
+          }
+          s.clear();
+          coarse.degree[c] = degree;
+        },
+        galois::steal(), galois::loopname("LouvainCoarsen"));
+
+    coarse.offsets.assign(k + 1, 0);
+    for (uint32_t c = 0; c < k; c++) {
+      coarse.offsets[c + 1] = coarse.offsets[c] + edges[c].size();
+    }
+    coarse.dst.resize(coarse.offsets[k]);
+    coarse.weight.resize(coarse.offsets[k]);
+    galois::do_all(
+        galois::iterate(0u, k),
+        [&](uint32_t c) {
+          uint64_t e = coarse.offsets[c];
+          for (auto& edge : edges[c]) {
+            coarse.dst[e]    = edge.first;
+            coarse.weight[e] = edge.second;
+            e++;
+          }
+        },
+        galois::no_stats());
+    return k;
+  }
+
+  double run() {
+    LevelGraph level;
+    fromGraph(level);
+    const uint32_t numNodes = level.size();
+
+    totalWeight = 0;
+    for (double d : level.degree) {
+      totalWeight += d;
+    }
+
+    // community of every original node in terms of the current level
+    std::vector<uint32_t> assignment(numNodes);
+    for (uint32_t v = 0; v < numNodes; v++) {
+      assignment[v] = v;
+    }
+    if (totalWeight == 0) {
+      for (uint32_t v = 0; v < numNodes; v++) {
+        graph.getData(v).community = v;
+      }
+      return 0;
+    }
+
+    std::vector<uint32_t> comm(numNodes);
+    for (uint32_t v = 0; v < numNodes; v++) {
+      comm[v] = v;
+    }
+    double currentModularity;
+    {
+      std::vector<std::atomic<double>> total(numNodes);
+      std::vector<std::atomic<uint32_t>> size(numNodes);
+      sumCommunities(level, comm, total, size);
+      currentModularity = modularity(level, comm, total);
+    }
+
+    for (uint32_t l = 0; l < plan.maxLevels; l++) {
+      double levelStart = currentModularity;
+      currentModularity = moveNodes(level, comm, currentModularity);
+
+      LevelGraph coarse;
+      uint32_t k = coarsen(level, comm, coarse);
+      galois::do_all(
+          galois::iterate(0u, numNodes),
+          [&](uint32_t v) { assignment[v] = comm[assignment[v]]; },
+          galois::no_stats());
+      if (k == level.size() ||
+          currentModularity < levelStart + plan.threshold) {
+        break;
+      }
+
+      level = std::move(coarse);
+      comm.resize(k);
+      for (uint32_t v = 0; v < k; v++) {
+        comm[v] = v;
+      }
+    }
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) { graph.getData(n).community = assignment[n]; },
+        galois::no_stats());
+    return currentModularity;
+  }
+};
+
+} // namespace internal
+
+/**
+ * Louvain community detection on a symmetric graph: local node moves
+ * alternate with contracting every community into one node until the
+ * modularity stops improving.
+ *
+ * Graph has LouvainNode (or compatible) node data; arithmetic edge data is
+ * used as edge weight and void edge data counts every edge as 1. Afterwards
+ * the community fields are numbered [0, number of communities). Returns the
+ * modularity of the final assignment.
+ */
+template <typename Graph>
+double louvain(Graph& graph, const LouvainPlan& plan = LouvainPlan()) {
+  return internal::LouvainImpl<Graph>{graph, plan}.run();
+}
+
+} // namespace LONESTAR_ANALYTICS_ABI
+} // namespace analytics
+} // namespace lonestar
+
+#endif
@@ -0,0 +1,170 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_ANALYTICS_MATCHING_H
+#define LONESTAR_ANALYTICS_MATCHING_H
+
+#include "galois/Galois.h"
+#include "galois/Bag.h"
+#include "galois/Reduction.h"
+#include "galois/SplitMix64.h"
+#include "Lonestar/Analytics/Version.h"
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+#include <utility>
+
+namespace lonestar {
+namespace analytics {
+inline namespace LONESTAR_ANALYTICS_ABI {
+
+//! Node data for maximalMatching()
+struct MatchingNode {
+  //! matched neighbor, or MATCHING_UNMATCHED
+  uint32_t mate;
+  //! neighbor proposed to in the current round
+  uint32_t proposal;
+};
+
+constexpr static const uint32_t MATCHING_UNMATCHED =
+    std::numeric_limits<uint32_t>::max();
+
+//! Tuning options of maximalMatching()
+struct MatchingPlan {
+  //! seeds the edge priorities; each seed gives a different deterministic
+  //! matching
+  uint64_t seed = 0;
+};
+
+namespace internal {
+
+template <typename Graph>
+struct MatchingImpl {
+  using GNode = typename Graph::GraphNode;
+
+  Graph& graph;
+  const MatchingPlan& plan;
+
+  //! Same for both directions of an edge, and distinct for distinct edges
+  std::tuple<uint64_t, GNode, GNode> priority(GNode a, GNode b) {
+    GNode lo = std::min(a, b);
+    GNode hi = std::max(a, b);
+    uint64_t hash = galois::splitMix64(
+        (galois::splitMix64(lo + plan.seed) ^ hi) + plan.seed);
+    return std::make_tuple(hash, lo, hi);
+  }
+
+  /**
+   * Every unmatched node proposes along its highest priority edge to an
+   * unmatched neighbor; mutual proposals are matched. The highest priority
+   * edge left between unmatched nodes is always mutual, so each round
+   * makes progress, and the result does not depend on the schedule.
+   */
+  uint64_t run() {
+    galois::InsertBag<GNode> bags[2];
+    galois::InsertBag<GNode>* current = &bags[0];
+    galois::InsertBag<GNode>* next    = &bags[1];
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          auto& data    = graph.getData(n);
+          data.mate     = MATCHING_UNMATCHED;
+          data.proposal = MATCHING_UNMATCHED;
+          next->push(n);
+        },
+        galois::loopname("MatchingInit"), galois::no_stats());
+
+    while (!next->empty()) {
+      std::swap(current, next);
+      next->clear();
+
+      galois::do_all(
+          galois::iterate(*current),
+          [&](GNode n) {
+            uint32_t best = MATCHING_UNMATCHED;
+            std::tuple<uint64_t, GNode, GNode> bestPriority;
+            for (auto e : graph.edges(n, galois::MethodFlag::UNPROTECTED)) {
+              GNode dst = graph.getEdgeDst(e);
+              if (dst == n ||
+                  graph.getData(dst, galois::MethodFlag::UNPROTECTED).mate !=
+                      MATCHING_UNMATCHED) {
+                continue;
+              }
+              auto p = priority(n, dst);
+              if (best == MATCHING_UNMATCHED || bestPriority < p) {
+                best         = dst;
+                bestPriority = p;
+              }
+            }
+            graph.getData(n, galois::MethodFlag::UNPROTECTED).proposal = best;
+          },
+          galois::steal(), galois::loopname("MatchingPropose"));
+
+      galois::do_all(
+          galois::iterate(*current),
+          [&](GNode n) {
+            auto& data = graph.getData(n, galois::MethodFlag::UNPROTECTED);
+            if (data.proposal == MATCHING_UNMATCHED) {
+              // no unmatched neighbor is left
+              return;
+            }
+            if (graph.getData(data.proposal, galois::MethodFlag::UNPROTECTED)
+                    .proposal == n) {
+              data.mate = data.proposal;
+            } else {
+              next->push(n);
+            }
+          },
+          galois::steal(), galois::loopname("MatchingAccept"));
+    }
+
+    galois::GAccumulator<uint64_t> matched;
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          if (graph.getData(n).mate != MATCHING_UNMATCHED) {
+            matched += 1;
+          }
+        },
+        galois::loopname("MatchingSize"), galois::no_stats());
+    return matched.reduce() / 2;
+  }
+};
+
+} // namespace internal
+
+/**
+ * Computes a maximal matching of a symmetric graph. Graph has MatchingNode
+ * (or compatible) node data and 32-bit node ids; afterwards mate holds the
+ * matched neighbor of every matched node. Returns the number of matched
+ * edges.
+ */
+template <typename Graph>
+uint64_t maximalMatching(Graph& graph,
+                         const MatchingPlan& plan = MatchingPlan()) {
+  return internal::MatchingImpl<Graph>{graph, plan}.run();
+}
+
+} // namespace LONESTAR_ANALYTICS_ABI
+} // namespace analytics
+} // namespace lonestar
+
+#endif
@@ -0,0 +1,522 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_ANALYTICS_PAGERANK_H
+#define LONESTAR_ANALYTICS_PAGERANK_H
+
+#include "galois/Galois.h"
+#include "galois/AtomicHelpers.h"
+#include "galois/Bag.h"
+#include "galois/LargeArray.h"
+#include "galois/Reduction.h"
+#include "galois/Timer.h"
+#include "Lonestar/Analytics/Version.h"
+
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <iterator>
+
+/**
+ * The push-style implementations are based on the Push-based PageRank
+ * computation (Algorithm 4) as described in the PageRank Europar 2015 paper.
+ *
+ * WHANG, Joyce Jiyoung, et al. Scalable data-driven pagerank: Algorithms,
+ * system issues, and lessons learned. In: European Conference on Parallel
+ * Processing. Springer, Berlin, Heidelberg, 2015. p. 438-450.
+ */
+
+namespace lonestar {
+namespace analytics {
+inline namespace LONESTAR_ANALYTICS_ABI {
+
+typedef float PRTy;
+
+//! Node data for pageRankPull()
+struct PageRankPullNode {
+  PRTy value;
+  uint32_t nout;
+};
+
+//! Node data for pageRankPush()
+struct PageRankPushNode {
+  PRTy value;
+  std::atomic<PRTy> residual;
+};
+
+//! Algorithm and tuning options of pageRankPull(). All variants use the same
+//! constants by default for ease of comparison.
+struct PageRankPullPlan {
+  enum Algorithm { topo, residual };
+
+  Algorithm algorithm    = residual;
+  PRTy alpha             = 0.85;
+  PRTy tolerance         = 1.0e-3;
+  unsigned maxIterations = 1000;
+  //! false skips initPageRankPull(), which the caller has run with the same
+  //! plan, e.g. outside its timer
+  bool initialize = true;
+};
+
+//! Algorithm and tuning options of pageRankPush(). Async has better absolute
+//! performance.
+struct PageRankPushPlan {
+  enum Algorithm { async, sync };
+
+  Algorithm algorithm    = async;
+  PRTy alpha             = 0.85;
+  PRTy tolerance         = 1.0e-3;
+  //! applies to the round-based sync variant only
+  unsigned maxIterations = 1000;
+  //! false skips initPageRankPush(), which the caller has run with the same
+  //! plan, e.g. outside its timer
+  bool initialize = true;
+};
+
+inline const char* algorithmName(PageRankPullPlan::Algorithm algo) {
+  static const char* const names[] = {"Topo", "Residual"};
+  return names[algo];
+}
+
+inline const char* algorithmName(PageRankPushPlan::Algorithm algo) {
+  static const char* const names[] = {"Async", "Sync"};
+  return names[algo];
+}
+
+namespace internal {
+
+template <typename Graph>
+struct PageRankPullImpl {
+  using GNode         = typename Graph::GraphNode;
+  using DeltaArray    = galois::LargeArray<PRTy>;
+  using ResidualArray = galois::LargeArray<PRTy>;
+
+  constexpr static const unsigned CHUNK_SIZE = 32;
+
+  Graph& graph;
+  const PageRankPullPlan& plan;
+
+  //! Computing outdegrees in the tranpose graph is equivalent to computing
+  //! the indegrees in the original graph.
+  void computeOutDeg() {
+    galois::StatTimer outDegreeTimer("computeOutDegFunc");
+    outDegreeTimer.start();
+
+    galois::LargeArray<std::atomic<size_t>> vec;
+    vec.allocateInterleaved(graph.size());
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& src) { vec.constructAt(src, 0ul); },
+        galois::no_stats(), galois::loopname("InitDegVec"));
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& src) {
+          for (auto nbr : graph.edges(src)) {
+            GNode dst = graph.getEdgeDst(nbr);
+            vec[dst].fetch_add(1ul);
+          };
+        },
+        galois::steal(), galois::chunk_size<CHUNK_SIZE>(), galois::no_stats(),
+        galois::loopname("computeOutDeg"));
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& src) {
+          auto& srcData = graph.getData(src, galois::MethodFlag::UNPROTECTED);
+          srcData.nout  = vec[src];
+        },
+        galois::no_stats(), galois::loopname("CopyDeg"));
+
+    outDegreeTimer.stop();
+  }
+
+  /**
+   * It does not calculate the pagerank for each iteration,
+   * but only calculate the residual to be added from the previous pagerank to
+   * the current one.
+   * If the residual is smaller than the tolerance, that is not reflected to
+   * the next pagerank.
+   */
+  void residualAlgo() {
+    DeltaArray delta;
+    delta.allocateInterleaved(graph.size());
+    ResidualArray residual;
+    residual.allocateInterleaved(graph.size());
+
+    const PRTy initResidual = 1 - plan.alpha;
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& n) {
+          delta[n]    = 0;
+          residual[n] = initResidual;
+        },
+        galois::no_stats(), galois::loopname("initResidual"));
+
+    unsigned int iterations = 0;
+    galois::GAccumulator<unsigned int> accum;
+
+    while (true) {
+      galois::do_all(
+          galois::iterate(graph),
+          [&](const GNode& src) {
+            auto& sdata = graph.getData(src);
+            delta[src]  = 0;
+
+            //! Only the residual higher than tolerance will be reflected
+            //! to the pagerank.
+            if (residual[src] > plan.tolerance) {
+              PRTy oldResidual = residual[src];
+              residual[src]    = 0.0;
+              sdata.value += oldResidual;
+              if (sdata.nout > 0) {
+                delta[src] = oldResidual * plan.alpha / sdata.nout;
+                accum += 1;
+              }
+            }
+          },
+          galois::no_stats(), galois::loopname("PageRank_delta"));
+
+      galois::do_all(
+          galois::iterate(graph),
+          [&](const GNode& src) {
+            float sum = 0;
+            for (auto nbr : graph.edges(src)) {
+              GNode dst = graph.getEdgeDst(nbr);
+              if (delta[dst] > 0) {
+                sum += delta[dst];
+              }
+            }
+            if (sum > 0) {
+              residual[src] = sum;
+            }
+          },
+          galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
+          galois::no_stats(), galois::loopname("PageRank"));
+
+      iterations++;
+      if (iterations >= plan.maxIterations || !accum.reduce()) {
+        break;
+      }
+      accum.reset();
+    } ///< End while(true).
+
+    if (iterations >= plan.maxIterations) {
+      std::cerr << "ERROR: failed to converge in " << iterations
+                << " iterations\n";
+    }
+  }
+
+  /**
+   * PageRank pull topological.
+   * Always calculate the new pagerank for each iteration.
+   */
+  void topoAlgo() {
+    unsigned int iteration = 0;
+    galois::GAccumulator<float> accum;
+
+    float base_score = (1.0f - plan.alpha) / graph.size();
+    while (true) {
+      galois::do_all(
+          galois::iterate(graph),
+          [&](const GNode& src) {
+            constexpr const galois::MethodFlag flag =
+                galois::MethodFlag::UNPROTECTED;
+
+            auto& sdata = graph.getData(src, flag);
+            float sum   = 0.0;
+
+            for (auto jj = graph.edge_begin(src, flag),
+                      ej = graph.edge_end(src, flag);
+                 jj != ej; ++jj) {
+              GNode dst = graph.getEdgeDst(jj);
+
+              auto& ddata = graph.getData(dst, flag);
+              sum += ddata.value / ddata.nout;
+            }
+
+            //! New value of pagerank after computing contributions from
+            //! incoming edges in the original graph.
+            float value = sum * plan.alpha + base_score;
+            //! Find the delta in new and old pagerank values.
+            float diff = std::fabs(value - sdata.value);
+
+            //! Do not update pagerank before the diff is computed since
+            //! there is a data dependence on the pagerank value.
+            sdata.value = value;
+            accum += diff;
+          },
+          galois::no_stats(), galois::steal(),
+          galois::chunk_size<CHUNK_SIZE>(), galois::loopname("PageRank"));
+
+      iteration += 1;
+      if (accum.reduce() <= plan.tolerance ||
+          iteration >= plan.maxIterations) {
+        break;
+      }
+      accum.reset();
+
+    } ///< End while(true).
+
+    galois::runtime::reportStat_Single("PageRank", "Rounds", iteration);
+    if (iteration >= plan.maxIterations) {
+      std::cerr << "ERROR: failed to converge in " << iteration
+                << " iterations\n";
+    }
+  }
+
+  //! starting ranks of the chosen variant and the out-degrees
+  void init() {
+    const PRTy initValue =
+        plan.algorithm == PageRankPullPlan::topo ? 1.0f / graph.size() : 0;
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& n) {
+          graph.getData(n, galois::MethodFlag::UNPROTECTED).value = initValue;
+        },
+        galois::no_stats(), galois::loopname("initNodeData"));
+    computeOutDeg();
+  }
+
+  void run() {
+    switch (plan.algorithm) {
+    case PageRankPullPlan::topo:
+      topoAlgo();
+      break;
+    case PageRankPullPlan::residual:
+      residualAlgo();
+      break;
+    default:
+      GALOIS_DIE("unknown pull PageRank algorithm ", plan.algorithm);
+    }
+  }
+};
+
+template <typename Graph>
+struct PageRankPushImpl {
+  using GNode = typename Graph::GraphNode;
+
+  constexpr static const unsigned CHUNK_SIZE      = 16;
+  constexpr static const ptrdiff_t EDGE_TILE_SIZE = 128;
+  constexpr static const galois::MethodFlag flag =
+      galois::MethodFlag::UNPROTECTED;
+
+  Graph& graph;
+  const PageRankPushPlan& plan;
+
+  void asyncAlgo() {
+    typedef galois::worklists::PerSocketChunkFIFO<CHUNK_SIZE> WL;
+    galois::for_each(
+        galois::iterate(graph),
+        [&](GNode src, auto& ctx) {
+          auto& sdata = graph.getData(src);
+
+          if (sdata.residual > plan.tolerance) {
+            PRTy oldResidual = sdata.residual.exchange(0.0);
+            sdata.value += oldResidual;
+            int src_nout = std::distance(graph.edge_begin(src, flag),
+                                         graph.edge_end(src, flag));
+            if (src_nout > 0) {
+              PRTy delta = oldResidual * plan.alpha / src_nout;
+              //! For each out-going neighbors.
+              for (auto jj : graph.edges(src, flag)) {
+                GNode dst   = graph.getEdgeDst(jj);
+                auto& ddata = graph.getData(dst, flag);
+                if (delta > 0) {
+                  auto old = galois::atomicAdd(ddata.residual, delta);
+                  if ((old < plan.tolerance) &&
+                      (old + delta >= plan.tolerance)) {
+                    ctx.push(dst);
+                  }
+                }
+              }
+            }
+          }
+        },
+        galois::loopname("PushResidualAsync"),
+        galois::disable_conflict_detection(), galois::no_stats(),
+        galois::wl<WL>());
+  }
+
+  void syncAlgo() {
+    struct Update {
+      PRTy delta;
+      typename Graph::edge_iterator beg;
+      typename Graph::edge_iterator end;
+    };
+
+    galois::InsertBag<Update> updates;
+    galois::InsertBag<GNode> activeNodes;
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& src) { activeNodes.push(src); }, galois::no_stats());
+
+    size_t iter = 0;
+    for (; !activeNodes.empty() && iter < plan.maxIterations; ++iter) {
+      galois::do_all(
+          galois::iterate(activeNodes),
+          [&](const GNode& src) {
+            auto& sdata = graph.getData(src, flag);
+
+            if (sdata.residual > plan.tolerance) {
+              PRTy oldResidual = sdata.residual;
+              sdata.value += oldResidual;
+              sdata.residual = 0.0;
+
+              int src_nout = std::distance(graph.edge_begin(src, flag),
+                                           graph.edge_end(src, flag));
+              PRTy delta   = oldResidual * plan.alpha / src_nout;
+
+              auto beg       = graph.edge_begin(src, flag);
+              const auto end = graph.edge_end(src, flag);
+
+              assert(beg <= end);
+
+              //! Edge tiling for large outdegree nodes.
+              if ((end - beg) > EDGE_TILE_SIZE) {
+                for (; beg + EDGE_TILE_SIZE < end;) {
+                  auto ne = beg + EDGE_TILE_SIZE;
+                  updates.push(Update{delta, beg, ne});
+                  beg = ne;
+                }
+              }
+
+              if ((end - beg) > 0) {
+                updates.push(Update{delta, beg, end});
+              }
+            }
+          },
+          galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
+          galois::loopname("CreateEdgeTiles"), galois::no_stats());
+
+      activeNodes.clear();
+
+      galois::do_all(
+          galois::iterate(updates),
+          [&](const Update& up) {
+            //! For each out-going neighbors.
+            for (auto jj = up.beg; jj != up.end; ++jj) {
+              GNode dst   = graph.getEdgeDst(jj);
+              auto& ddata = graph.getData(dst, flag);
+              auto old    = galois::atomicAdd(ddata.residual, up.delta);
+              //! If fabs(old) is greater than tolerance, then it would
+              //! already have been processed in the previous do_all
+              //! loop.
+              if ((old <= plan.tolerance) &&
+                  (old + up.delta >= plan.tolerance)) {
+                activeNodes.push(dst);
+              }
+            }
+          },
+          galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
+          galois::loopname("PushResidualSync"), galois::no_stats());
+
+      updates.clear();
+    }
+
+    if (iter >= plan.maxIterations) {
+      std::cerr << "ERROR: failed to converge in " << iter << " iterations\n";
+    }
+  }
+
+  void init() {
+    const PRTy initResidual = 1 - plan.alpha;
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          auto& data    = graph.getData(n);
+          data.value    = 0.0;
+          data.residual = initResidual;
+        },
+        galois::no_stats(), galois::loopname("Initialize"));
+  }
+
+  void run() {
+    switch (plan.algorithm) {
+    case PageRankPushPlan::async:
+      asyncAlgo();
+      break;
+    case PageRankPushPlan::sync:
+      syncAlgo();
+      break;
+    default:
+      GALOIS_DIE("unknown push PageRank algorithm ", plan.algorithm);
+    }
+  }
+};
+
+} // namespace internal
+
+/**
+ * Sets the starting ranks and the out-degrees that pageRankPull() with the
+ * same plan reads. pageRankPull() starts with this unless the plan says the
+ * caller already did.
+ */
+template <typename Graph>
+void initPageRankPull(Graph& transposeGraph,
+                      const PageRankPullPlan& plan = PageRankPullPlan()) {
+  internal::PageRankPullImpl<Graph>{transposeGraph, plan}.init();
+}
+
+//! Sets the starting ranks and residuals pageRankPush() with the same plan
+//! reads. pageRankPush() starts with this unless the plan says otherwise.
+template <typename Graph>
+void initPageRankPush(Graph& graph,
+                      const PageRankPushPlan& plan = PageRankPushPlan()) {
+  internal::PageRankPushImpl<Graph>{graph, plan}.init();
+}
+
+/**
+ * Pull-style PageRank a la Page and Brin.
+ *
+ * transposeGraph is the transpose of the graph to rank, with
+ * PageRankPullNode (or compatible) node data; the ranks are left in the
+ * value fields.
+ */
+template <typename Graph>
+void pageRankPull(Graph& transposeGraph,
+                  const PageRankPullPlan& plan = PageRankPullPlan()) {
+  internal::PageRankPullImpl<Graph> impl{transposeGraph, plan};
+  if (plan.initialize)
+    impl.init();
+  impl.run();
+}
+
+/**
+ * Push-style PageRank a la Page and Brin.
+ *
+ * Graph has PageRankPushNode (or compatible) node data; the ranks are left in
+ * the value fields.
+ */
+template <typename Graph>
+void pageRankPush(Graph& graph,
+                  const PageRankPushPlan& plan = PageRankPushPlan()) {
+  internal::PageRankPushImpl<Graph> impl{graph, plan};
+  if (plan.initialize)
+    impl.init();
+  impl.run();
+}
+
+} // namespace LONESTAR_ANALYTICS_ABI
+} // namespace analytics
+} // namespace lonestar
+
+#endif
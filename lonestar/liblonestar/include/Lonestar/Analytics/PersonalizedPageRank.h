@@ -0,0 +1,397 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_ANALYTICS_PERSONALIZEDPAGERANK_H
+#define LONESTAR_ANALYTICS_PERSONALIZEDPAGERANK_H
+
+#include "galois/Galois.h"
+#include "galois/AtomicHelpers.h"
+#include "galois/Bag.h"
+#include "galois/LargeArray.h"
+#include "galois/ParallelSTL.h"
+#include "galois/Reduction.h"
+#include "galois/substrate/PerThreadStorage.h"
+#include "Lonestar/Analytics/PageRank.h"
+#include "Lonestar/Analytics/RandomWalk.h"
+#include "Lonestar/Analytics/Version.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+/**
+ * Personalized PageRank by forward push (local push) as described in
+ *
+ * ANDERSEN, Reid; CHUNG, Fan; LANG, Kevin. Local graph partitioning using
+ * PageRank vectors. In: 47th Annual IEEE Symposium on Foundations of Computer
+ * Science (FOCS'06). IEEE, 2006. p. 475-486.
+ */
+
+namespace lonestar {
+namespace analytics {
+inline namespace LONESTAR_ANALYTICS_ABI {
+
+//! Algorithm and tuning options of personalizedPageRank()
+struct PersonalizedPageRankPlan {
+  //! Probability of following an out-edge; the walk restarts at the source
+  //! otherwise, and always at nodes without out-edges
+  PRTy alpha = 0.85;
+  //! Push until every node's residual is below epsilon times its out-degree
+  PRTy epsilon = 1.0e-6;
+  //! Entries kept per source
+  unsigned topK = 100;
+  //! Sources pushed together; the residuals take numNodes * batchSize
+  //! floats, and twice that with the estimates
+  unsigned batchSize = 16;
+  //! Sources with more out-edges than this use Monte Carlo walks instead of
+  //! push; 0 disables them
+  uint64_t hubDegree = 0;
+  //! Walks per Monte Carlo source
+  uint64_t walksPerHub = 100000;
+  //! Monte Carlo walks are reproducible for a given seed
+  uint64_t seed = 0;
+};
+
+//! Approximate personalized PageRank of one source
+struct PersonalizedPageRankResult {
+  uint32_t source = 0;
+  bool monteCarlo = false;
+  /**
+   * For push, the residual mass left, which bounds the L1 distance between
+   * the estimates and the true vector; estimates are never too large. For
+   * Monte Carlo, the additive error of each estimate at 99% confidence.
+   */
+  PRTy errorBound = 0;
+  //! (node, estimate) by decreasing estimate, then increasing node
+  std::vector<std::pair<uint32_t, PRTy>> top;
+};
+
+namespace internal {
+
+template <typename Graph>
+struct PersonalizedPageRankImpl {
+  using GNode  = typename Graph::GraphNode;
+  using Result = PersonalizedPageRankResult;
+
+  constexpr static const unsigned CHUNK_SIZE = 16;
+  constexpr static const galois::MethodFlag flag =
+      galois::MethodFlag::UNPROTECTED;
+
+  //! A nonzero estimate of slot's source
+  struct Entry {
+    uint32_t slot;
+    uint32_t node;
+    PRTy value;
+
+    bool operator<(const Entry& o) const {
+      if (slot != o.slot)
+        return slot < o.slot;
+      if (value != o.value)
+        return value > o.value;
+      return node < o.node;
+    }
+  };
+
+  Graph& graph;
+  const PersonalizedPageRankPlan& plan;
+  const unsigned width;
+
+  //! Row n holds node n's residual and estimate for every slot of a batch
+  galois::LargeArray<std::atomic<PRTy>> residual;
+  galois::LargeArray<PRTy> estimate;
+  galois::LargeArray<std::atomic<bool>> queued;
+  galois::LargeArray<std::atomic<bool>> touched;
+
+  PersonalizedPageRankImpl(Graph& g, const PersonalizedPageRankPlan& p)
+      : graph(g), plan(p), width(std::max(p.batchSize, 1u)) {}
+
+  uint64_t degree(GNode n) {
+    return std::distance(graph.edge_begin(n, flag), graph.edge_end(n, flag));
+  }
+
+  PRTy threshold(GNode n) {
+    return plan.epsilon * std::max<uint64_t>(degree(n), 1);
+  }
+
+  void allocate() {
+    size_t numNodes = graph.size();
+    residual.allocateInterleaved(numNodes * width);
+    estimate.allocateInterleaved(numNodes * width);
+    queued.allocateInterleaved(numNodes);
+    touched.allocateInterleaved(numNodes);
+    galois::do_all(
+        galois::iterate(size_t(0), numNodes),
+        [&](size_t n) {
+          for (unsigned i = 0; i < width; ++i) {
+            residual.constructAt(n * width + i, PRTy(0));
+            estimate[n * width + i] = 0;
+          }
+          queued.constructAt(n, false);
+          touched.constructAt(n, false);
+        },
+        galois::no_stats());
+  }
+
+  template <typename Bag>
+  void touch(GNode n, Bag& touchedNodes) {
+    if (!touched[n].load(std::memory_order_relaxed) &&
+        !touched[n].exchange(true))
+      touchedNodes.push(n);
+  }
+
+  /**
+   * Synchronous rounds over the nodes with a residual above threshold in any
+   * slot. A node's out-edges are scanned once per round for all of its slots
+   * that need pushing, so sources close to each other share the traversal.
+   */
+  void push(const std::vector<GNode>& sources, std::vector<Result>& results) {
+    unsigned numSlots = sources.size();
+    galois::InsertBag<GNode> frontier, next, touchedNodes;
+
+    for (unsigned i = 0; i < numSlots; ++i) {
+      GNode s                 = sources[i];
+      residual[s * width + i] = 1;
+      touch(s, touchedNodes);
+      if (!queued[s].exchange(true))
+        frontier.push(s);
+    }
+
+    while (!frontier.empty()) {
+      galois::do_all(
+          galois::iterate(frontier),
+          [&](GNode u) {
+            queued[u] = false;
+            uint64_t deg = degree(u);
+            PRTy thr     = threshold(u);
+            PRTy* est    = &estimate[u * width];
+            // what each slot sends along every out-edge; 0 if not pushed
+            PRTy share[64];
+            bool any = false;
+            for (unsigned base = 0; base < numSlots; base += 64) {
+              unsigned end = std::min(numSlots, base + 64);
+              for (unsigned i = base; i < end; ++i) {
+                share[i - base] = 0;
+                auto& r         = residual[u * width + i];
+                if (r.load(std::memory_order_relaxed) < thr)
+                  continue;
+                PRTy mass = r.exchange(0);
+                est[i] += (1 - plan.alpha) * mass;
+                if (deg) {
+                  share[i - base] = plan.alpha * mass / deg;
+                  any             = true;
+                } else {
+                  // nowhere to go: the walk restarts at the source
+                  GNode s = sources[i];
+                  galois::atomicAdd(residual[s * width + i],
+                                    plan.alpha * mass);
+                  if (!queued[s].exchange(true))
+                    next.push(s);
+                }
+              }
+              if (!any)
+                continue;
+              for (auto e : graph.edges(u, flag)) {
+                GNode v    = graph.getEdgeDst(e);
+                PRTy vThr  = threshold(v);
+                bool above = false;
+                for (unsigned i = base; i < end; ++i) {
+                  if (share[i - base] == 0)
+                    continue;
+                  PRTy old = galois::atomicAdd(residual[v * width + i],
+                                               share[i - base]);
+                  above |= old + share[i - base] >= vThr;
+                }
+                touch(v, touchedNodes);
+                if (above && !queued[v].load(std::memory_order_relaxed) &&
+                    !queued[v].exchange(true))
+                  next.push(v);
+              }
+              any = false;
+            }
+          },
+          galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
+          galois::loopname("PPRPush"));
+      frontier.clear();
+      std::swap(frontier, next);
+    }
+
+    collect(sources, results, touchedNodes);
+  }
+
+  //! Top-k of every slot, the residual mass left, and a clean slate
+  template <typename Bag>
+  void collect(const std::vector<GNode>& sources, std::vector<Result>& results,
+               Bag& touchedNodes) {
+    unsigned numSlots = sources.size();
+    galois::substrate::PerThreadStorage<std::vector<double>> massPT;
+    galois::on_each([&](unsigned, unsigned) {
+      massPT.getLocal()->assign(numSlots, 0.0);
+    });
+    galois::InsertBag<Entry> entries;
+    galois::do_all(
+        galois::iterate(touchedNodes),
+        [&](GNode n) {
+          auto& mass = *massPT.getLocal();
+          for (unsigned i = 0; i < numSlots; ++i) {
+            PRTy& est = estimate[n * width + i];
+            if (est > 0)
+              entries.push(Entry{i, n, est});
+            mass[i] += residual[n * width + i].load();
+            residual[n * width + i] = 0;
+            est                     = 0;
+          }
+          touched[n] = false;
+        },
+        galois::steal(), galois::no_stats());
+
+    std::vector<Entry> sorted(entries.begin(), entries.end());
+    galois::ParallelSTL::sort(sorted.begin(), sorted.end());
+
+    for (unsigned i = 0; i < numSlots; ++i) {
+      double mass = 0;
+      for (unsigned t = 0; t < galois::getActiveThreads(); ++t)
+        mass += (*massPT.getRemote(t))[i];
+      Result r;
+      r.source     = sources[i];
+      r.errorBound = mass;
+      results.push_back(std::move(r));
+    }
+    Result* first = &results[results.size() - numSlots];
+    for (auto ii = sorted.begin(), ei = sorted.end(); ii != ei; ++ii) {
+      auto& top = first[ii->slot].top;
+      if (top.size() < plan.topK)
+        top.emplace_back(ii->node, ii->value);
+    }
+  }
+
+  /**
+   * Monte Carlo: the endpoints of walks that stop with probability 1 - alpha
+   * at every step sample the personalized PageRank of the source.
+   */
+  Result monteCarlo(GNode source) {
+    using Endpoints = std::vector<uint32_t>;
+    galois::substrate::PerThreadStorage<Endpoints> endsPT;
+    galois::on_each(
+        [&](unsigned, unsigned) { endsPT.getLocal()->clear(); });
+
+    uint64_t numWalks = std::max<uint64_t>(plan.walksPerHub, 1);
+    galois::do_all(
+        galois::iterate(uint64_t(0), numWalks),
+        [&](uint64_t w) {
+          internal::WalkRandom rng(plan.seed + source * 0x9e3779b97f4a7c15ULL,
+                                   w);
+          GNode cur = source;
+          while (rng.real() < plan.alpha) {
+            uint64_t deg = degree(cur);
+            cur = deg ? graph.getEdgeDst(graph.edge_begin(cur, flag) +
+                                         rng.below(deg))
+                      : source;
+          }
+          endsPT.getLocal()->push_back(cur);
+        },
+        galois::steal(), galois::loopname("PPRMonteCarlo"));
+
+    std::vector<uint32_t> ends;
+    for (unsigned t = 0; t < galois::getActiveThreads(); ++t) {
+      auto& local = *endsPT.getRemote(t);
+      ends.insert(ends.end(), local.begin(), local.end());
+    }
+    galois::ParallelSTL::sort(ends.begin(), ends.end());
+
+    std::vector<Entry> counts;
+    for (auto ii = ends.begin(), ei = ends.end(); ii != ei;) {
+      auto next = std::upper_bound(ii, ei, *ii);
+      counts.push_back(
+          Entry{0, *ii, PRTy(double(next - ii) / double(numWalks))});
+      ii = next;
+    }
+    std::sort(counts.begin(), counts.end());
+
+    Result r;
+    r.source     = source;
+    r.monteCarlo = true;
+    // Hoeffding: P(|estimate - ppr| >= t) <= 2 exp(-2 W t^2) = 0.01
+    r.errorBound = std::sqrt(std::log(200.0) / (2.0 * numWalks));
+    for (size_t i = 0; i < counts.size() && i < plan.topK; ++i)
+      r.top.emplace_back(counts[i].node, counts[i].value);
+    return r;
+  }
+
+  std::vector<Result> run(const std::vector<GNode>& sources) {
+    if (!(plan.alpha >= 0 && plan.alpha < 1))
+      GALOIS_DIE("alpha must be in [0, 1)");
+    if (!(plan.epsilon > 0))
+      GALOIS_DIE("epsilon must be positive");
+    for (GNode s : sources)
+      if (s >= graph.size())
+        GALOIS_DIE("source ", s, " is not a node of the graph");
+
+    std::vector<GNode> pushSources;
+    std::vector<size_t> pushIndex;
+    std::vector<Result> results(sources.size());
+    for (size_t i = 0; i < sources.size(); ++i) {
+      if (plan.hubDegree && degree(sources[i]) > plan.hubDegree) {
+        results[i] = monteCarlo(sources[i]);
+      } else {
+        pushSources.push_back(sources[i]);
+        pushIndex.push_back(i);
+      }
+    }
+
+    if (!pushSources.empty()) {
+      allocate();
+      std::vector<Result> pushed;
+      for (size_t b = 0; b < pushSources.size(); b += width) {
+        std::vector<GNode> batch(
+            pushSources.begin() + b,
+            pushSources.begin() + std::min(pushSources.size(), b + width));
+        push(batch, pushed);
+      }
+      for (size_t i = 0; i < pushed.size(); ++i)
+        results[pushIndex[i]] = std::move(pushed[i]);
+    }
+    return results;
+  }
+};
+
+} // namespace internal
+
+/**
+ * Approximate personalized PageRank of each of sources, in the same order.
+ *
+ * Graph is an LC_CSR_Graph (or compatible); node data is not used. Sources
+ * are pushed plan.batchSize at a time with per-node rows of residuals, so
+ * each out-edge scan serves every source of the batch whose mass reaches the
+ * node. Sources with more than plan.hubDegree out-edges use Monte Carlo walks
+ * instead, which cost the same however large their neighborhood is.
+ */
+template <typename Graph>
+std::vector<PersonalizedPageRankResult> personalizedPageRank(
+    Graph& graph, const std::vector<typename Graph::GraphNode>& sources,
+    const PersonalizedPageRankPlan& plan = PersonalizedPageRankPlan()) {
+  return internal::PersonalizedPageRankImpl<Graph>(graph, plan).run(sources);
+}
+
+} // namespace LONESTAR_ANALYTICS_ABI
+} // namespace analytics
+} // namespace lonestar
+
+#endif
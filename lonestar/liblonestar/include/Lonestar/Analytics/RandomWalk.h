@@ -0,0 +1,314 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_ANALYTICS_RANDOMWALK_H
+#define LONESTAR_ANALYTICS_RANDOMWALK_H
+
+#include "galois/Galois.h"
+#include "galois/LargeArray.h"
+#include "galois/Reduction.h"
+#include "galois/SplitMix64.h"
+#include "galois/substrate/PerThreadStorage.h"
+#include "Lonestar/Analytics/Version.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace lonestar {
+namespace analytics {
+inline namespace LONESTAR_ANALYTICS_ABI {
+
+//! Algorithm and tuning options of randomWalks()
+struct RandomWalkPlan {
+  enum Algorithm {
+    //! every out-edge equally likely (DeepWalk)
+    uniform,
+    //! out-edges in proportion to their edge data
+    weighted,
+    //! second order with return parameter p and in-out parameter q
+    node2vec,
+    //! node2vec on top of weighted transitions
+    weightedNode2vec,
+  };
+
+  Algorithm algorithm = uniform;
+  //! Nodes per walk, including the start; walks stop early at sinks
+  uint32_t walkLength = 80;
+  //! Walks started from every node
+  uint32_t walksPerNode = 10;
+  //! node2vec: returning to the previous node is weighted 1/p
+  double p = 1.0;
+  //! node2vec: moving away from the previous node is weighted 1/q
+  double q = 1.0;
+  //! Walk w draws from a stream seeded by (seed, w) alone, so the walks do
+  //! not depend on the number of threads or the batch size
+  uint64_t seed = 0;
+  //! Walks generated before they are handed to the sink
+  size_t batchSize = size_t(1) << 20;
+};
+
+inline const char* algorithmName(RandomWalkPlan::Algorithm algo) {
+  static const char* const names[] = {"Uniform", "Weighted", "Node2vec",
+                                      "WeightedNode2vec"};
+  return names[algo];
+}
+
+/**
+ * A batch of walks from randomWalks(). Walk i of the batch is walk
+ * firstWalk + i overall; it started from node (firstWalk + i) % graph.size()
+ * and has length(i) nodes starting at begin(i).
+ */
+struct WalkBatch {
+  uint64_t firstWalk  = 0;
+  uint32_t walkLength = 0;
+  size_t numWalks     = 0;
+  galois::LargeArray<uint32_t> nodes;
+  galois::LargeArray<uint32_t> lengths;
+
+  size_t size() const { return numWalks; }
+  const uint32_t* begin(size_t i) const {
+    return nodes.data() + i * walkLength;
+  }
+  const uint32_t* end(size_t i) const { return begin(i) + lengths[i]; }
+  uint32_t length(size_t i) const { return lengths[i]; }
+};
+
+namespace internal {
+
+//! splitmix64 seeded by (seed, walk)
+class WalkRandom : public galois::SplitMix64 {
+public:
+  WalkRandom(uint64_t seed, uint64_t walk)
+      : SplitMix64(galois::splitMix64(galois::splitMix64(seed) + walk)) {}
+};
+
+template <typename Graph>
+struct RandomWalkImpl {
+  using GNode         = typename Graph::GraphNode;
+  using edge_iterator = typename Graph::edge_iterator;
+
+  constexpr static const galois::MethodFlag UNPROTECTED =
+      galois::MethodFlag::UNPROTECTED;
+  constexpr static const uint32_t NO_ALIAS =
+      std::numeric_limits<uint32_t>::max();
+
+  Graph& graph;
+  const RandomWalkPlan& plan;
+  bool weighted;
+  bool secondOrder;
+  double maxBias;
+
+  //! Alias tables, one entry per edge: keep offset k of a node with
+  //! probability prob[k], else take alias[k]
+  galois::LargeArray<float> prob;
+  galois::LargeArray<uint32_t> alias;
+
+  RandomWalkImpl(Graph& g, const RandomWalkPlan& p)
+      : graph(g), plan(p),
+        weighted(p.algorithm == RandomWalkPlan::weighted ||
+                 p.algorithm == RandomWalkPlan::weightedNode2vec),
+        secondOrder(p.algorithm == RandomWalkPlan::node2vec ||
+                    p.algorithm == RandomWalkPlan::weightedNode2vec),
+        maxBias(std::max({1.0, 1.0 / p.p, 1.0 / p.q})) {}
+
+  /**
+   * Vose's method: split the scaled weights into those below and above the
+   * mean and pair every small entry with a large one that fills it up.
+   */
+  void buildAliasTables() {
+    prob.allocateBlocked(graph.sizeEdges());
+    alias.allocateBlocked(graph.sizeEdges());
+
+    galois::substrate::PerThreadStorage<std::vector<uint32_t>> smallPT,
+        largePT;
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          auto edges   = graph.edge_begin(n, UNPROTECTED);
+          size_t first = *edges;
+          uint32_t deg = *graph.edge_end(n, UNPROTECTED) - first;
+          auto weight  = [&](uint32_t k) -> double {
+            return graph.getEdgeData(edges + k, UNPROTECTED);
+          };
+          double total = 0;
+          for (uint32_t k = 0; k < deg; ++k)
+            total += weight(k);
+          if (!(total > 0)) {
+            for (uint32_t k = 0; k < deg; ++k) {
+              prob[first + k]  = 1.0f;
+              alias[first + k] = NO_ALIAS;
+            }
+            return;
+          }
+
+          auto& small = *smallPT.getLocal();
+          auto& large = *largePT.getLocal();
+          small.clear();
+          large.clear();
+          // scaled weights live in prob until they are final
+          for (uint32_t k = 0; k < deg; ++k) {
+            prob[first + k]  = weight(k) * deg / total;
+            alias[first + k] = NO_ALIAS;
+            (prob[first + k] < 1.0f ? small : large).push_back(k);
+          }
+          while (!small.empty() && !large.empty()) {
+            uint32_t s = small.back(), l = large.back();
+            small.pop_back();
+            alias[first + s] = l;
+            prob[first + l] -= 1.0f - prob[first + s];
+            if (prob[first + l] < 1.0f) {
+              large.pop_back();
+              small.push_back(l);
+            }
+          }
+          // what is left is 1 up to rounding
+          for (uint32_t k : small)
+            prob[first + k] = 1.0f;
+          for (uint32_t k : large)
+            prob[first + k] = 1.0f;
+        },
+        galois::steal(), galois::loopname("RandomWalkAliasTables"));
+  }
+
+  //! A first-order step from n, which has deg > 0 out-edges
+  GNode sampleEdge(GNode n, uint32_t deg, WalkRandom& rng) {
+    auto first = graph.edge_begin(n, UNPROTECTED);
+    uint32_t k = rng.below(deg);
+    if (weighted && alias[*first + k] != NO_ALIAS &&
+        !(rng.real() < prob[*first + k]))
+      k = alias[*first + k];
+    return graph.getEdgeDst(first + k);
+  }
+
+  bool isNeighbor(GNode n, GNode dst) {
+    auto last = graph.edge_end(n, UNPROTECTED);
+    auto e    = std::lower_bound(
+        graph.edge_begin(n, UNPROTECTED), last, dst,
+        [&](edge_iterator e, GNode d) { return graph.getEdgeDst(e) < d; });
+    return e != last && graph.getEdgeDst(e) == dst;
+  }
+
+  /**
+   * node2vec by rejection: draw a first-order candidate and keep it with
+   * probability bias / maxBias, so no per-(prev, cur) tables are needed.
+   */
+  GNode sampleSecondOrder(GNode prev, GNode cur, uint32_t deg,
+                          WalkRandom& rng, uint64_t& rejected) {
+    while (true) {
+      GNode next  = sampleEdge(cur, deg, rng);
+      double bias = next == prev              ? 1.0 / plan.p
+                    : isNeighbor(prev, next) ? 1.0
+                                             : 1.0 / plan.q;
+      if (rng.real() * maxBias < bias)
+        return next;
+      ++rejected;
+    }
+  }
+
+  template <typename Sink>
+  void run(Sink& sink) {
+    if (plan.walkLength == 0)
+      GALOIS_DIE("walks need at least one node");
+    if (secondOrder && !(plan.p > 0 && plan.q > 0))
+      GALOIS_DIE("node2vec needs positive p and q");
+    if (weighted) {
+      if constexpr (std::is_void<typename Graph::edge_data_type>::value)
+        GALOIS_DIE("weighted walks need edge data");
+      else
+        buildAliasTables();
+    }
+
+    uint64_t numNodes = graph.size();
+    uint64_t numWalks = numNodes * plan.walksPerNode;
+    size_t batchSize  = std::max<size_t>(plan.batchSize, 1);
+    galois::GAccumulator<uint64_t> rejections;
+
+    WalkBatch batch;
+    batch.walkLength = plan.walkLength;
+    batch.nodes.allocateBlocked(std::min<uint64_t>(batchSize, numWalks) *
+                                plan.walkLength);
+    batch.lengths.allocateBlocked(std::min<uint64_t>(batchSize, numWalks));
+
+    for (uint64_t start = 0; start < numWalks; start += batchSize) {
+      batch.firstWalk = start;
+      batch.numWalks  = std::min<uint64_t>(batchSize, numWalks - start);
+
+      galois::do_all(
+          galois::iterate(size_t(0), batch.numWalks),
+          [&](size_t i) {
+            uint64_t w = start + i;
+            WalkRandom rng(plan.seed, w);
+            uint32_t* out  = batch.nodes.data() + i * plan.walkLength;
+            uint32_t len   = 1;
+            uint64_t nrej  = 0;
+            GNode cur      = w % numNodes;
+            out[0]         = cur;
+            for (; len < plan.walkLength; ++len) {
+              uint32_t deg = std::distance(graph.edge_begin(cur, UNPROTECTED),
+                                           graph.edge_end(cur, UNPROTECTED));
+              if (!deg)
+                break;
+              GNode next = secondOrder && len > 1
+                               ? sampleSecondOrder(out[len - 2], cur, deg,
+                                                   rng, nrej)
+                               : sampleEdge(cur, deg, rng);
+              out[len] = next;
+              cur      = next;
+            }
+            batch.lengths[i] = len;
+            if (nrej)
+              rejections += nrej;
+          },
+          galois::steal(), galois::loopname("RandomWalks"));
+
+      sink(static_cast<const WalkBatch&>(batch));
+    }
+
+    if (secondOrder)
+      galois::runtime::reportStat_Single("RandomWalks", "Rejections",
+                                         rejections.reduce());
+  }
+};
+
+} // namespace internal
+
+/**
+ * Generates plan.walksPerNode random walks from every node of graph and
+ * hands them to sink in batches of up to plan.batchSize walks, in order of
+ * their walk number. sink is called as sink(const WalkBatch&) outside of
+ * parallel loops, so it may use them; the batch is reused afterwards.
+ *
+ * Graph is an LC_CSR_Graph (or compatible). Weighted algorithms read the
+ * edge data as non-negative weights; nodes whose weights are all zero are
+ * left uniformly. node2vec needs the neighbors of every node sorted by
+ * destination, e.g. by sortAllEdgesByDst().
+ */
+template <typename Graph, typename Sink>
+void randomWalks(Graph& graph, const RandomWalkPlan& plan, Sink&& sink) {
+  internal::RandomWalkImpl<Graph>(graph, plan).run(sink);
+}
+
+} // namespace LONESTAR_ANALYTICS_ABI
+} // namespace analytics
+} // namespace lonestar
+
+#endif
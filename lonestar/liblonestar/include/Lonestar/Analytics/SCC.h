@@ -0,0 +1,384 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_ANALYTICS_SCC_H
+#define LONESTAR_ANALYTICS_SCC_H
+
+#include "galois/Galois.h"
+#include "galois/AtomicHelpers.h"
+#include "galois/Bag.h"
+#include "galois/ParallelSTL.h"
+#include "galois/Reduction.h"
+#include "galois/graphs/FileGraph.h"
+#include "galois/graphs/WriteGraph.h"
+#include "Lonestar/Analytics/Version.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace lonestar {
+namespace analytics {
+inline namespace LONESTAR_ANALYTICS_ABI {
+
+//! Node data for scc()
+struct SCCNode {
+  //! Representative node of the component; SCC_NONE while undecided
+  std::atomic<uint32_t> component;
+  //! Scratch label of the reachability and coloring phases
+  std::atomic<uint32_t> color;
+};
+
+constexpr static const uint32_t SCC_NONE =
+    std::numeric_limits<uint32_t>::max();
+
+//! Chunksize for the for_each worklists: best chunksize will depend on input.
+constexpr static const unsigned SCC_CHUNK_SIZE = 64u;
+
+//! Algorithm and tuning options of scc()
+struct SCCPlan {
+  enum Algorithm {
+    //! one forward-backward step from a pivot, then coloring
+    fwbwColor,
+    //! coloring only
+    color,
+  };
+
+  Algorithm algorithm = fwbwColor;
+  //! Peel nodes without live in- or out-neighbors between phases
+  bool trim = true;
+};
+
+inline const char* algorithmName(SCCPlan::Algorithm algo) {
+  static const char* const names[] = {"FwBwColor", "Color"};
+  return names[algo];
+}
+
+namespace internal {
+
+template <typename Graph>
+struct SCCImpl {
+  using GNode = typename Graph::GraphNode;
+
+  constexpr static const unsigned CHUNK_SIZE = SCC_CHUNK_SIZE;
+  constexpr static const galois::MethodFlag UNPROTECTED =
+      galois::MethodFlag::UNPROTECTED;
+
+  Graph& graph;
+  const SCCPlan& plan;
+  //! Nodes whose component may still be undecided
+  galois::InsertBag<GNode> live;
+
+  SCCImpl(Graph& g, const SCCPlan& p) : graph(g), plan(p) {}
+
+  SCCNode& data(GNode n) { return graph.getData(n, UNPROTECTED); }
+  bool alive(GNode n) { return data(n).component.load() == SCC_NONE; }
+
+  bool hasLiveOut(GNode n) {
+    for (auto e : graph.edges(n, UNPROTECTED))
+      if (alive(graph.getEdgeDst(e)))
+        return true;
+    return false;
+  }
+
+  bool hasLiveIn(GNode n) {
+    for (auto e : graph.in_edges(n, UNPROTECTED))
+      if (alive(graph.getInEdgeDst(e)))
+        return true;
+    return false;
+  }
+
+  //! Drops decided nodes from live
+  void compact() {
+    galois::InsertBag<GNode> next;
+    galois::do_all(
+        galois::iterate(live),
+        [&](GNode n) {
+          if (alive(n))
+            next.push(n);
+        },
+        galois::no_stats());
+    live.clear();
+    galois::do_all(
+        galois::iterate(next), [&](GNode n) { live.push(n); },
+        galois::no_stats());
+  }
+
+  /**
+   * A node without live in- or out-neighbors cannot share a cycle with any
+   * live node, so it is a component by itself. Repeat until nothing changes.
+   */
+  void trim() {
+    bool changed = true;
+    while (changed) {
+      galois::GReduceLogicalOr trimmed;
+      galois::do_all(
+          galois::iterate(live),
+          [&](GNode n) {
+            if (alive(n) && (!hasLiveOut(n) || !hasLiveIn(n))) {
+              data(n).component = n;
+              trimmed.update(true);
+            }
+          },
+          galois::steal(), galois::loopname("SCCTrim"));
+      changed = trimmed.reduce();
+      compact();
+    }
+  }
+
+  /**
+   * Every live node that reaches a root along in-edges of nodes with the
+   * root's color joins the root's component.
+   */
+  void backward(galois::InsertBag<GNode>& roots) {
+    galois::do_all(
+        galois::iterate(roots), [&](GNode n) { data(n).component = n; },
+        galois::no_stats());
+
+    galois::for_each(
+        galois::iterate(roots),
+        [&](GNode n, auto& ctx) {
+          uint32_t c = data(n).color.load();
+          for (auto e : graph.in_edges(n, UNPROTECTED)) {
+            GNode src         = graph.getInEdgeDst(e);
+            auto& srcData     = data(src);
+            uint32_t expected = SCC_NONE;
+            if (srcData.color.load() == c &&
+                srcData.component.compare_exchange_strong(expected, c))
+              ctx.push(src);
+          }
+        },
+        galois::disable_conflict_detection(),
+        galois::chunk_size<CHUNK_SIZE>(), galois::loopname("SCCBackward"));
+  }
+
+  /**
+   * Forward-backward step: the nodes both reachable from and reaching the
+   * live node with the largest in * out degree, which on most real graphs is
+   * in the giant component, form its component.
+   */
+  void fwbw() {
+    galois::GReduceMax<std::pair<uint64_t, uint32_t>> pivotReduce;
+    galois::do_all(
+        galois::iterate(live),
+        [&](GNode n) {
+          uint64_t out = std::distance(graph.edge_begin(n, UNPROTECTED),
+                                       graph.edge_end(n, UNPROTECTED));
+          uint64_t in  = std::distance(graph.in_edge_begin(n, UNPROTECTED),
+                                      graph.in_edge_end(n, UNPROTECTED));
+          pivotReduce.update(std::make_pair(out * in, uint32_t(n)));
+        },
+        galois::no_stats());
+    auto pivot = pivotReduce.reduce();
+    if (!pivot.first)
+      return;
+
+    GNode p       = pivot.second;
+    data(p).color = p;
+    galois::InsertBag<GNode> fw;
+    fw.push(p);
+    galois::for_each(
+        galois::iterate(fw),
+        [&](GNode n, auto& ctx) {
+          for (auto e : graph.edges(n, UNPROTECTED)) {
+            GNode dst = graph.getEdgeDst(e);
+            if (alive(dst) && data(dst).color.load() != p &&
+                data(dst).color.exchange(p) != p)
+              ctx.push(dst);
+          }
+        },
+        galois::disable_conflict_detection(),
+        galois::chunk_size<CHUNK_SIZE>(), galois::loopname("SCCForward"));
+    backward(fw);
+    compact();
+  }
+
+  /**
+   * Every live node takes the largest node id that reaches it. A node that
+   * keeps its own id is the root of the nodes with its color that reach it
+   * back. Each round decides at least the component of the largest live id.
+   */
+  void color() {
+    while (!live.empty()) {
+      galois::do_all(
+          galois::iterate(live), [&](GNode n) { data(n).color = n; },
+          galois::no_stats());
+
+      galois::for_each(
+          galois::iterate(live),
+          [&](GNode n, auto& ctx) {
+            uint32_t c = data(n).color.load();
+            for (auto e : graph.edges(n, UNPROTECTED)) {
+              GNode dst  = graph.getEdgeDst(e);
+              auto& ddst = data(dst);
+              if (alive(dst) && ddst.color.load() < c &&
+                  galois::atomicMax(ddst.color, c) < c)
+                ctx.push(dst);
+            }
+          },
+          galois::disable_conflict_detection(),
+          galois::chunk_size<CHUNK_SIZE>(), galois::loopname("SCCColor"));
+
+      galois::InsertBag<GNode> roots;
+      galois::do_all(
+          galois::iterate(live),
+          [&](GNode n) {
+            if (data(n).color.load() == n)
+              roots.push(n);
+          },
+          galois::no_stats());
+      backward(roots);
+      compact();
+
+      if (plan.trim)
+        trim();
+    }
+  }
+
+  void run() {
+    if (graph.size() >= SCC_NONE)
+      GALOIS_DIE("scc needs fewer than 2^32 - 1 nodes");
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          data(n).component = SCC_NONE;
+          data(n).color     = SCC_NONE;
+          live.push(n);
+        },
+        galois::no_stats());
+
+    if (plan.trim)
+      trim();
+
+    switch (plan.algorithm) {
+    case SCCPlan::fwbwColor:
+      fwbw();
+      if (plan.trim)
+        trim();
+      color();
+      break;
+    case SCCPlan::color:
+      color();
+      break;
+    default:
+      GALOIS_DIE("unknown strongly connected components algorithm ",
+                 plan.algorithm);
+    }
+  }
+};
+
+} // namespace internal
+
+/**
+ * Strongly connected components of a directed graph.
+ *
+ * Graph is an LC_CSR_CSC_Graph or LC_InOut_Graph (or compatible, providing
+ * in_edges) with SCCNode node data. Afterwards every node's component is the
+ * id of a representative node of its component, which is its own component.
+ */
+template <typename Graph>
+void scc(Graph& graph, const SCCPlan& plan = SCCPlan()) {
+  internal::SCCImpl<Graph>(graph, plan).run();
+}
+
+//! Number of components found by scc()
+template <typename Graph>
+size_t sccCount(Graph& graph) {
+  using GNode = typename Graph::GraphNode;
+  galois::GAccumulator<size_t> roots;
+
+  galois::do_all(
+      galois::iterate(graph),
+      [&](GNode n) {
+        if (graph.getData(n, galois::MethodFlag::UNPROTECTED).component == n)
+          roots += 1;
+      },
+      galois::no_stats());
+
+  return roots.reduce();
+}
+
+/**
+ * Condensation of a graph after scc(): component i is node i, in the order
+ * of the representatives, and there is one edge (a, b) if any edge leads
+ * from component a to component b. The result is acyclic, sorted and free
+ * of duplicates and self loops.
+ *
+ * @param out receives the condensation with void edge data
+ * @param componentOf if given, receives the condensation node of every node
+ */
+template <typename Graph>
+void sccCondensation(Graph& graph, galois::graphs::FileGraphWriter& out,
+                     std::vector<uint32_t>* componentOf = nullptr) {
+  using GNode     = typename Graph::GraphNode;
+  using Edge      = std::pair<uint32_t, uint32_t>;
+  size_t numNodes = graph.size();
+  auto comp       = [&](GNode n) -> uint32_t {
+    return graph.getData(n, galois::MethodFlag::UNPROTECTED).component;
+  };
+
+  // rank[r] is the condensation node of representative r
+  std::vector<uint32_t> rank(numNodes + 1, 0);
+  galois::do_all(
+      galois::iterate(graph), [&](GNode n) { rank[n + 1] = comp(n) == n; },
+      galois::no_stats());
+  galois::ParallelSTL::partial_sum(rank.begin(), rank.end(), rank.begin());
+  size_t numComponents = rank[numNodes];
+
+  if (componentOf) {
+    componentOf->resize(numNodes);
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) { (*componentOf)[n] = rank[comp(n)]; },
+        galois::no_stats());
+  }
+
+  galois::InsertBag<Edge> bag;
+  galois::do_all(
+      galois::iterate(graph),
+      [&](GNode n) {
+        uint32_t a = rank[comp(n)];
+        for (auto e : graph.edges(n, galois::MethodFlag::UNPROTECTED)) {
+          uint32_t b = rank[comp(graph.getEdgeDst(e))];
+          if (a != b)
+            bag.push(Edge(a, b));
+        }
+      },
+      galois::steal(), galois::loopname("SCCCondensationEdges"));
+  std::vector<Edge> edges(bag.begin(), bag.end());
+  galois::ParallelSTL::sort(edges.begin(), edges.end());
+  edges.erase(galois::ParallelSTL::unique(edges.begin(), edges.end()),
+              edges.end());
+
+  galois::graphs::writeSortedEdges<void>(
+      out, numComponents, edges.begin(), edges.end(),
+      [](const Edge& e) { return e.first; },
+      [](galois::graphs::FileGraphWriter& w, size_t c, const Edge& e) {
+        w.addNeighbor(c, e.second);
+      });
+}
+
+} // namespace LONESTAR_ANALYTICS_ABI
+} // namespace analytics
+} // namespace lonestar
+
+#endif
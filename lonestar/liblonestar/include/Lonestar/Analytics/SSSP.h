@@ -0,0 +1,437 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_ANALYTICS_SSSP_H
+#define LONESTAR_ANALYTICS_SSSP_H
+
+#include "galois/Galois.h"
+#include "galois/AtomicHelpers.h"
+#include "galois/LargeArray.h"
+#include "galois/PriorityQueue.h"
+#include "galois/Reduction.h"
+#include "galois/gIO.h"
+#include "Lonestar/Analytics/Version.h"
+#include "Lonestar/BFS_SSSP.h"
+#include "Lonestar/Utils.h"
+
+#include <atomic>
+#include <cstdlib>
+
+namespace lonestar {
+namespace analytics {
+inline namespace LONESTAR_ANALYTICS_ABI {
+
+//! Algorithm and tuning options of sssp()
+struct SSSPPlan {
+  enum Algorithm {
+    deltaTile = 0,
+    deltaStep,
+    deltaStepBarrier,
+    serDeltaTile,
+    serDelta,
+    dijkstraTile,
+    dijkstra,
+    topo,
+    topoTile,
+    automatic
+  };
+
+  Algorithm algorithm = automatic;
+  //! log2 of the bucket width of the delta-stepping variants
+  unsigned deltaShift = 13;
+  //! false skips initSSSP(), which the caller has run, e.g. outside its
+  //! timer
+  bool initialize = true;
+};
+
+inline const char* algorithmName(SSSPPlan::Algorithm algo) {
+  static const char* const names[] = {
+      "deltaTile", "deltaStep",    "deltaStepBarrier", "serDeltaTile",
+      "serDelta",  "dijkstraTile", "dijkstra",         "topo",
+      "topoTile",  "Auto"};
+  return names[algo];
+}
+
+/**
+ * The variant sssp() runs for SSSPPlan::automatic: delta-stepping for graphs
+ * with a power-law degree distribution and its bulk-synchronous form for the
+ * rest.
+ */
+template <typename Graph>
+SSSPPlan::Algorithm chooseSSSPAlgorithm(const Graph& graph) {
+  return isApproximateDegreeDistributionPowerLaw(graph)
+             ? SSSPPlan::deltaStep
+             : SSSPPlan::deltaStepBarrier;
+}
+
+namespace internal {
+
+template <typename Graph, ptrdiff_t EDGE_TILE_SIZE>
+struct SSSPImpl {
+  using GNode = typename Graph::GraphNode;
+  using Dist  = typename Graph::node_data_type::value_type;
+  using Base  = BFS_SSSP<Graph, Dist, true, EDGE_TILE_SIZE>;
+
+  using UpdateRequest        = typename Base::UpdateRequest;
+  using UpdateRequestIndexer = typename Base::UpdateRequestIndexer;
+  using SrcEdgeTile          = typename Base::SrcEdgeTile;
+  using SrcEdgeTileMaker     = typename Base::SrcEdgeTileMaker;
+  using SrcEdgeTilePushWrap  = typename Base::SrcEdgeTilePushWrap;
+  using ReqPushWrap          = typename Base::ReqPushWrap;
+  using OutEdgeRangeFn       = typename Base::OutEdgeRangeFn;
+  using TileRangeFn          = typename Base::TileRangeFn;
+
+  constexpr static const bool TRACK_WORK     = false;
+  constexpr static const unsigned CHUNK_SIZE = 64U;
+
+  using PSchunk = galois::worklists::PerSocketChunkFIFO<CHUNK_SIZE>;
+  using OBIM =
+      galois::worklists::OrderedByIntegerMetric<UpdateRequestIndexer, PSchunk>;
+  using OBIM_Barrier = typename galois::worklists::OrderedByIntegerMetric<
+      UpdateRequestIndexer, PSchunk>::template with_barrier<true>::type;
+
+  Graph& graph;
+  unsigned stepShift;
+
+  template <typename T, typename OBIMTy = OBIM, typename P, typename R>
+  void deltaStepAlgo(GNode source, const P& pushWrap, const R& edgeRange) {
+
+    //! [reducible for self-defined stats]
+    galois::GAccumulator<size_t> BadWork;
+    //! [reducible for self-defined stats]
+    galois::GAccumulator<size_t> WLEmptyWork;
+
+    graph.getData(source) = 0;
+
+    galois::InsertBag<T> initBag;
+    pushWrap(initBag, source, 0, "parallel");
+
+    galois::for_each(
+        galois::iterate(initBag),
+        [&](const T& item, auto& ctx) {
+          constexpr galois::MethodFlag flag = galois::MethodFlag::UNPROTECTED;
+          const auto& sdata                 = graph.getData(item.src, flag);
+
+          if (sdata < item.dist) {
+            if (TRACK_WORK)
+              WLEmptyWork += 1;
+            return;
+          }
+
+          for (auto ii : edgeRange(item)) {
+
+            GNode dst          = graph.getEdgeDst(ii);
+            auto& ddist        = graph.getData(dst, flag);
+            Dist ew            = graph.getEdgeData(ii, flag);
+            const Dist newDist = sdata + ew;
+            Dist oldDist       = galois::atomicMin<Dist>(ddist, newDist);
+            if (newDist < oldDist) {
+              if (TRACK_WORK) {
+                //! [per-thread contribution of self-defined stats]
+                if (oldDist != Base::DIST_INFINITY) {
+                  BadWork += 1;
+                }
+                //! [per-thread contribution of self-defined stats]
+              }
+              pushWrap(ctx, dst, newDist);
+            }
+          }
+        },
+        galois::wl<OBIMTy>(UpdateRequestIndexer{stepShift}),
+        galois::disable_conflict_detection(), galois::loopname("SSSP"));
+
+    if (TRACK_WORK) {
+      //! [report self-defined stats]
+      galois::runtime::reportStat_Single("SSSP", "BadWork", BadWork.reduce());
+      //! [report self-defined stats]
+      galois::runtime::reportStat_Single("SSSP", "WLEmptyWork",
+                                         WLEmptyWork.reduce());
+    }
+  }
+
+  template <typename T, typename P, typename R>
+  void serDeltaAlgo(const GNode& source, const P& pushWrap,
+                    const R& edgeRange) {
+
+    SerialBucketWL<T, UpdateRequestIndexer> wl(UpdateRequestIndexer{stepShift});
+    graph.getData(source) = 0;
+
+    pushWrap(wl, source, 0);
+
+    size_t iter = 0UL;
+    while (!wl.empty()) {
+
+      auto& curr = wl.minBucket();
+
+      while (!curr.empty()) {
+        ++iter;
+        auto item = curr.front();
+        curr.pop_front();
+
+        if (graph.getData(item.src) < item.dist) {
+          // empty work
+          continue;
+        }
+
+        for (auto e : edgeRange(item)) {
+
+          GNode dst   = graph.getEdgeDst(e);
+          auto& ddata = graph.getData(dst);
+
+          const auto newDist = item.dist + graph.getEdgeData(e);
+
+          if (newDist < ddata) {
+            ddata = newDist;
+            pushWrap(wl, dst, newDist);
+          }
+        }
+      }
+
+      wl.goToNextBucket();
+    }
+
+    if (!wl.allEmpty()) {
+      std::abort();
+    }
+    galois::runtime::reportStat_Single("SSSP-Serial-Delta", "Iterations", iter);
+  }
+
+  template <typename T, typename P, typename R>
+  void dijkstraAlgo(const GNode& source, const P& pushWrap,
+                    const R& edgeRange) {
+
+    using WL = galois::MinHeap<T>;
+
+    graph.getData(source) = 0;
+
+    WL wl;
+    pushWrap(wl, source, 0);
+
+    size_t iter = 0;
+
+    while (!wl.empty()) {
+      ++iter;
+
+      T item = wl.pop();
+
+      if (graph.getData(item.src) < item.dist) {
+        // empty work
+        continue;
+      }
+
+      for (auto e : edgeRange(item)) {
+
+        GNode dst   = graph.getEdgeDst(e);
+        auto& ddata = graph.getData(dst);
+
+        const auto newDist = item.dist + graph.getEdgeData(e);
+
+        if (newDist < ddata) {
+          ddata = newDist;
+          pushWrap(wl, dst, newDist);
+        }
+      }
+    }
+
+    galois::runtime::reportStat_Single("SSSP-Dijkstra", "Iterations", iter);
+  }
+
+  void topoAlgo(const GNode& source) {
+
+    galois::LargeArray<Dist> oldDist;
+    oldDist.allocateInterleaved(graph.size());
+
+    constexpr Dist INFTY = Base::DIST_INFINITY;
+    galois::do_all(
+        galois::iterate(size_t{0}, graph.size()),
+        [&](size_t i) { oldDist.constructAt(i, INFTY); }, galois::no_stats(),
+        galois::loopname("initDistArray"));
+
+    graph.getData(source) = 0;
+
+    galois::GReduceLogicalOr changed;
+    size_t rounds = 0;
+
+    do {
+
+      ++rounds;
+      changed.reset();
+
+      galois::do_all(
+          galois::iterate(graph),
+          [&](const GNode& n) {
+            const auto& sdata = graph.getData(n);
+
+            if (oldDist[n] > sdata) {
+
+              oldDist[n] = sdata;
+              changed.update(true);
+
+              for (auto e : graph.edges(n)) {
+                const auto newDist = sdata + graph.getEdgeData(e);
+                auto dst           = graph.getEdgeDst(e);
+                auto& ddata        = graph.getData(dst);
+                galois::atomicMin(ddata, newDist);
+              }
+            }
+          },
+          galois::steal(), galois::loopname("Update"));
+
+    } while (changed.reduce());
+
+    galois::runtime::reportStat_Single("SSSP-topo", "rounds", rounds);
+  }
+
+  void topoTileAlgo(const GNode& source) {
+
+    galois::InsertBag<SrcEdgeTile> tiles;
+
+    graph.getData(source) = 0;
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& n) {
+          Base::pushEdgeTiles(tiles, graph, n,
+                              SrcEdgeTileMaker{n, Base::DIST_INFINITY});
+        },
+        galois::steal(), galois::loopname("MakeTiles"));
+
+    galois::GReduceLogicalOr changed;
+    size_t rounds = 0;
+
+    do {
+      ++rounds;
+      changed.reset();
+
+      galois::do_all(
+          galois::iterate(tiles),
+          [&](SrcEdgeTile& t) {
+            const auto& sdata = graph.getData(t.src);
+
+            if (t.dist > sdata) {
+
+              t.dist = sdata;
+              changed.update(true);
+
+              for (auto e = t.beg; e != t.end; ++e) {
+                const auto newDist = sdata + graph.getEdgeData(e);
+                auto dst           = graph.getEdgeDst(e);
+                auto& ddata        = graph.getData(dst);
+                galois::atomicMin(ddata, newDist);
+              }
+            }
+          },
+          galois::steal(), galois::loopname("Update"));
+
+    } while (changed.reduce());
+
+    galois::runtime::reportStat_Single("SSSP-topo", "rounds", rounds);
+  }
+
+  void run(GNode source, SSSPPlan::Algorithm algo) {
+    switch (algo) {
+    case SSSPPlan::deltaTile:
+      deltaStepAlgo<SrcEdgeTile>(source, SrcEdgeTilePushWrap{graph},
+                                 TileRangeFn());
+      break;
+    case SSSPPlan::deltaStep:
+      deltaStepAlgo<UpdateRequest>(source, ReqPushWrap(),
+                                   OutEdgeRangeFn{graph});
+      break;
+    case SSSPPlan::deltaStepBarrier:
+      deltaStepAlgo<UpdateRequest, OBIM_Barrier>(source, ReqPushWrap(),
+                                                 OutEdgeRangeFn{graph});
+      break;
+    case SSSPPlan::serDeltaTile:
+      serDeltaAlgo<SrcEdgeTile>(source, SrcEdgeTilePushWrap{graph},
+                                TileRangeFn());
+      break;
+    case SSSPPlan::serDelta:
+      serDeltaAlgo<UpdateRequest>(source, ReqPushWrap(), OutEdgeRangeFn{graph});
+      break;
+    case SSSPPlan::dijkstraTile:
+      dijkstraAlgo<SrcEdgeTile>(source, SrcEdgeTilePushWrap{graph},
+                                TileRangeFn());
+      break;
+    case SSSPPlan::dijkstra:
+      dijkstraAlgo<UpdateRequest>(source, ReqPushWrap(), OutEdgeRangeFn{graph});
+      break;
+    case SSSPPlan::topo:
+      topoAlgo(source);
+      break;
+    case SSSPPlan::topoTile:
+      topoTileAlgo(source);
+      break;
+    default:
+      GALOIS_DIE("unknown SSSP algorithm ", algo);
+    }
+  }
+};
+
+} // namespace internal
+
+//! Distance sssp() leaves on nodes unreachable from the source
+template <typename Graph>
+constexpr typename Graph::node_data_type::value_type ssspInfinity() {
+  return BFS_SSSP<Graph, typename Graph::node_data_type::value_type,
+                  true>::DIST_INFINITY;
+}
+
+//! Marks all nodes unreached; sssp() starts with this unless told otherwise
+template <typename Graph>
+void initSSSP(Graph& graph) {
+  galois::do_all(
+      galois::iterate(graph),
+      [&](typename Graph::GraphNode n) {
+        graph.getData(n) = ssspInfinity<Graph>();
+      },
+      galois::no_stats());
+}
+
+/**
+ * Single-source shortest paths from source over non-negative integer edge
+ * weights.
+ *
+ * Graph is an LC_CSR_Graph (or compatible) whose node data is a
+ * std::atomic of an unsigned integer type, which receives the distance of
+ * each node (ssspInfinity<Graph>() if unreachable), and whose edge data is
+ * the weight.
+ *
+ * @tparam EDGE_TILE_SIZE number of edges per work item of the tiled variants
+ */
+template <typename Graph, ptrdiff_t EDGE_TILE_SIZE = 512>
+void sssp(Graph& graph, typename Graph::GraphNode source,
+          const SSSPPlan& plan = SSSPPlan()) {
+  using Impl = internal::SSSPImpl<Graph, EDGE_TILE_SIZE>;
+
+  if (plan.initialize)
+    initSSSP(graph);
+
+  SSSPPlan::Algorithm algo = plan.algorithm;
+  if (algo == SSSPPlan::automatic)
+    algo = chooseSSSPAlgorithm(graph);
+
+  Impl{graph, plan.deltaShift}.run(source, algo);
+}
+
+} // namespace LONESTAR_ANALYTICS_ABI
+} // namespace analytics
+} // namespace lonestar
+
+#endif
@@ -0,0 +1,335 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_ANALYTICS_SIMILARITY_H
+#define LONESTAR_ANALYTICS_SIMILARITY_H
+
+#include "galois/Galois.h"
+#include "galois/Bag.h"
+#include "galois/ParallelSTL.h"
+#include "galois/substrate/PerThreadStorage.h"
+#include "Lonestar/Analytics/Version.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace lonestar {
+namespace analytics {
+inline namespace LONESTAR_ANALYTICS_ABI {
+
+//! Algorithm and tuning options of similarity()
+struct SimilarityPlan {
+  enum Measure {
+    //! |N(u) & N(v)| / |N(u) | N(v)|
+    jaccard,
+    //! |N(u) & N(v)| / sqrt(|N(u)| |N(v)|)
+    cosine,
+    //! |N(u) & N(v)| / min(|N(u)|, |N(v)|)
+    overlap,
+    //! sum of 1 / log |N(w)| over the common neighbors w
+    adamicAdar,
+  };
+
+  Measure measure = jaccard;
+  //! Most similar nodes kept per node; ignored by allPairs
+  unsigned topK = 10;
+  //! Pairs less similar than this are dropped. For Jaccard and cosine it
+  //! also rules out candidates whose degree is too far from the node's
+  double threshold = 0;
+  //! Report every pair (u, v), u < v, at least threshold similar instead of
+  //! the top-k of every node
+  bool allPairs = false;
+  //! Leave out pairs that are already neighbors, as for link prediction
+  bool excludeNeighbors = false;
+  //! Common neighbors with more neighbors than this are not counted, which
+  //! bounds the work per node by its degree times maxDegree; 0 counts all.
+  //! Scores are then lower bounds, except that Adamic-Adar hardly changes
+  uint64_t maxDegree = 0;
+  //! Nodes whose results are held in memory before they go to the sink
+  size_t batchSize = size_t(1) << 16;
+};
+
+inline const char* algorithmName(SimilarityPlan::Measure measure) {
+  static const char* const names[] = {"Jaccard", "Cosine", "Overlap",
+                                      "AdamicAdar"};
+  return names[measure];
+}
+
+/**
+ * A batch of results from similarity(). Node firstNode + i of the graph has
+ * the similar nodes [begin(i), end(i)), by decreasing score and then
+ * increasing node id, with their scores starting at scores(i).
+ */
+struct SimilarityBatch {
+  uint32_t firstNode = 0;
+  size_t numNodes    = 0;
+  std::vector<uint64_t> offsets;
+  std::vector<uint32_t> nodes;
+  std::vector<float> values;
+
+  size_t size() const { return numNodes; }
+  const uint32_t* begin(size_t i) const { return nodes.data() + offsets[i]; }
+  const uint32_t* end(size_t i) const {
+    return nodes.data() + offsets[i + 1];
+  }
+  const float* scores(size_t i) const { return values.data() + offsets[i]; }
+  //! Pairs in the batch
+  size_t numPairs() const { return nodes.size(); }
+};
+
+namespace internal {
+
+template <typename Graph>
+struct SimilarityImpl {
+  using GNode        = typename Graph::GraphNode;
+  using EdgeIterator = typename Graph::edge_iterator;
+
+  constexpr static const unsigned CHUNK_SIZE = 16;
+  constexpr static const galois::MethodFlag flag =
+      galois::MethodFlag::UNPROTECTED;
+
+  //! Node node is score similar to the batch's node local
+  struct Entry {
+    uint32_t local;
+    uint32_t node;
+    float score;
+
+    bool operator<(const Entry& o) const {
+      if (local != o.local)
+        return local < o.local;
+      if (score != o.score)
+        return score > o.score;
+      return node < o.node;
+    }
+  };
+
+  //! Sparse accumulator of one thread: a dense row and the entries it set
+  struct Scratch {
+    std::vector<double> weight;
+    std::vector<uint32_t> touched;
+    std::vector<Entry> found;
+  };
+
+  Graph& graph;
+  const SimilarityPlan& plan;
+  galois::substrate::PerThreadStorage<Scratch> scratch;
+
+  SimilarityImpl(Graph& g, const SimilarityPlan& p) : graph(g), plan(p) {}
+
+  uint64_t degree(GNode n) {
+    return std::distance(graph.edge_begin(n, flag), graph.edge_end(n, flag));
+  }
+
+  //! First edge of n whose destination is not less than dst
+  EdgeIterator lowerBound(GNode n, GNode dst) {
+    EdgeIterator first = graph.edge_begin(n, flag);
+    EdgeIterator last  = graph.edge_end(n, flag);
+    auto count         = std::distance(first, last);
+    while (count > 0) {
+      auto half       = count / 2;
+      EdgeIterator it = first;
+      std::advance(it, half);
+      if (graph.getEdgeDst(it) < dst) {
+        first = ++it;
+        count -= half + 1;
+      } else {
+        count = half;
+      }
+    }
+    return first;
+  }
+
+  /**
+   * Fraction of du that the degree of a candidate must be within for it to
+   * reach the threshold: the common neighbors are at most min(du, dv), so
+   * Jaccard is at most min/max and cosine at most sqrt(min/max).
+   */
+  double degreeRatio() {
+    switch (plan.measure) {
+    case SimilarityPlan::jaccard:
+      return plan.threshold;
+    case SimilarityPlan::cosine:
+      return plan.threshold * plan.threshold;
+    default:
+      return 0;
+    }
+  }
+
+  double score(double common, uint64_t du, uint64_t dv) {
+    switch (plan.measure) {
+    case SimilarityPlan::jaccard:
+      return common / double(du + dv - common);
+    case SimilarityPlan::cosine:
+      return common / std::sqrt(double(du) * double(dv));
+    case SimilarityPlan::overlap:
+      return common / double(std::min(du, dv));
+    default:
+      return common;
+    }
+  }
+
+  /**
+   * Scores the two-hop neighbors of u and appends those it keeps to the
+   * thread's found entries.
+   */
+  void visit(GNode u, uint32_t local, double ratio, Scratch& s) {
+    uint64_t du = degree(u);
+    if (!du)
+      return;
+    double lo = ratio * du;
+    double hi = ratio > 0 ? du / ratio : std::numeric_limits<double>::max();
+    bool adamicAdar = plan.measure == SimilarityPlan::adamicAdar;
+
+    for (auto e : graph.edges(u, flag)) {
+      GNode w = graph.getEdgeDst(e);
+      if (w == u)
+        continue;
+      uint64_t dw = degree(w);
+      if (plan.maxDegree && dw > plan.maxDegree)
+        continue;
+      // w has at least u and v as neighbors
+      double wt = adamicAdar ? 1.0 / std::log(std::max<uint64_t>(dw, 2)) : 1;
+      EdgeIterator ii = plan.allPairs ? lowerBound(w, u + 1)
+                                      : graph.edge_begin(w, flag);
+      for (EdgeIterator ei = graph.edge_end(w, flag); ii != ei; ++ii) {
+        GNode v = graph.getEdgeDst(ii);
+        if (v == u)
+          continue;
+        if (ratio > 0) {
+          uint64_t dv = degree(v);
+          if (dv < lo || dv > hi)
+            continue;
+        }
+        if (s.weight[v] == 0)
+          s.touched.push_back(v);
+        s.weight[v] += wt;
+      }
+    }
+
+    if (plan.excludeNeighbors)
+      for (auto e : graph.edges(u, flag))
+        s.weight[graph.getEdgeDst(e)] = 0;
+
+    size_t first = s.found.size();
+    for (uint32_t v : s.touched) {
+      double common = s.weight[v];
+      s.weight[v]   = 0;
+      if (common == 0)
+        continue;
+      float value = score(common, du, degree(v));
+      if (value > 0 && value >= plan.threshold)
+        s.found.push_back(Entry{local, v, value});
+    }
+    s.touched.clear();
+
+    if (!plan.allPairs && s.found.size() - first > plan.topK) {
+      auto kth = s.found.begin() + first + plan.topK;
+      std::nth_element(s.found.begin() + first, kth, s.found.end());
+      s.found.erase(kth, s.found.end());
+    }
+  }
+
+  template <typename Sink>
+  void run(Sink& sink) {
+    if (!plan.allPairs && !plan.topK)
+      GALOIS_DIE("topK must be positive");
+    if (plan.threshold < 0)
+      GALOIS_DIE("threshold must not be negative");
+
+    size_t numNodes  = graph.size();
+    size_t batchSize = std::max<size_t>(plan.batchSize, 1);
+    double ratio     = std::min(degreeRatio(), 1.0);
+    galois::on_each([&](unsigned, unsigned) {
+      scratch.getLocal()->weight.assign(numNodes, 0);
+    });
+
+    SimilarityBatch batch;
+    for (size_t begin = 0; begin < numNodes; begin += batchSize) {
+      size_t end = std::min(numNodes, begin + batchSize);
+      galois::on_each(
+          [&](unsigned, unsigned) { scratch.getLocal()->found.clear(); });
+
+      galois::do_all(
+          galois::iterate(begin, end),
+          [&](size_t u) { visit(u, u - begin, ratio, *scratch.getLocal()); },
+          galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
+          galois::loopname("Similarity"));
+
+      std::vector<Entry> sorted;
+      for (unsigned t = 0; t < galois::getActiveThreads(); ++t) {
+        auto& found = scratch.getRemote(t)->found;
+        sorted.insert(sorted.end(), found.begin(), found.end());
+      }
+      galois::ParallelSTL::sort(sorted.begin(), sorted.end());
+
+      batch.firstNode = begin;
+      batch.numNodes  = end - begin;
+      batch.offsets.assign(batch.numNodes + 1, 0);
+      batch.nodes.resize(sorted.size());
+      batch.values.resize(sorted.size());
+      galois::do_all(
+          galois::iterate(size_t(0), sorted.size()),
+          [&](size_t i) {
+            batch.nodes[i]  = sorted[i].node;
+            batch.values[i] = sorted[i].score;
+            if (i + 1 == sorted.size() ||
+                sorted[i + 1].local != sorted[i].local)
+              batch.offsets[sorted[i].local + 1] = i + 1;
+          },
+          galois::no_stats());
+      // nodes without entries end where the previous node does
+      for (size_t i = 1; i <= batch.numNodes; ++i)
+        batch.offsets[i] = std::max(batch.offsets[i], batch.offsets[i - 1]);
+
+      sink(static_cast<const SimilarityBatch&>(batch));
+    }
+  }
+};
+
+} // namespace internal
+
+/**
+ * Finds the most similar nodes of every node of graph by the neighbors they
+ * share and hands them to sink in batches of plan.batchSize nodes, in node
+ * order. sink is called as sink(const SimilarityBatch&) outside of parallel
+ * loops; the batch is reused afterwards.
+ *
+ * Candidates are the two-hop neighbors of a node, found through each of its
+ * neighbors. Every thread accumulates the shared neighbors of its current
+ * node in a dense row, so memory is one row of doubles per thread besides
+ * the batch, however skewed the degrees are; plan.maxDegree bounds the work
+ * that hubs cause.
+ *
+ * Graph is an LC_CSR_Graph (or compatible) holding a symmetric graph without
+ * duplicate edges; node data is not used. plan.allPairs needs the neighbors
+ * of every node sorted by destination, e.g. by sortAllEdgesByDst().
+ */
+template <typename Graph, typename Sink>
+void similarity(Graph& graph, const SimilarityPlan& plan, Sink&& sink) {
+  internal::SimilarityImpl<Graph>(graph, plan).run(sink);
+}
+
+} // namespace LONESTAR_ANALYTICS_ABI
+} // namespace analytics
+} // namespace lonestar
+
+#endif
@@ -0,0 +1,375 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_ANALYTICS_TEMPORAL_H
+#define LONESTAR_ANALYTICS_TEMPORAL_H
+
+#include "galois/Galois.h"
+#include "galois/AtomicHelpers.h"
+#include "galois/Bag.h"
+#include "galois/IndexedUnionFind.h"
+#include "galois/LargeArray.h"
+#include "galois/Reduction.h"
+#include "galois/graphs/LC_CSR_Temporal_Graph.h"
+#include "Lonestar/Analytics/PageRank.h"
+#include "Lonestar/Analytics/Version.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <vector>
+
+/**
+ * Analytics over the edges of a galois::graphs::LC_CSR_Temporal_Graph that
+ * fall in a time window, and over time-respecting paths. None of them copies
+ * the graph: each reads the edges of a node in the window as the contiguous
+ * range the graph finds by binary search, so sliding a window over a graph
+ * costs one pass over the edges in each window rather than a rebuild.
+ */
+
+namespace lonestar {
+namespace analytics {
+inline namespace LONESTAR_ANALYTICS_ABI {
+
+//! Node data with the fields every temporal analytic needs
+template <typename TimeTy>
+struct TemporalNode {
+  //! temporalReachability()
+  std::atomic<TimeTy> arrival;
+  //! windowBFS()
+  std::atomic<uint32_t> level;
+  //! windowComponents()
+  uint32_t component;
+  //! windowPageRank()
+  PRTy rank;
+  std::atomic<PRTy> residual;
+};
+
+//! Options of temporalReachability()
+struct TemporalReachabilityPlan {
+  //! Successive edges of a path must have strictly increasing times rather
+  //! than non-decreasing ones
+  bool strict = false;
+};
+
+//! Options of windowPageRank()
+struct WindowPageRankPlan {
+  PRTy alpha     = 0.85;
+  PRTy tolerance = 1.0e-3;
+};
+
+//! Value temporalReachability() leaves on unreached nodes
+template <typename Graph>
+constexpr typename Graph::time_type temporalInfinity() {
+  return std::numeric_limits<typename Graph::time_type>::max();
+}
+
+//! Value windowBFS() leaves on unreached nodes
+constexpr uint32_t windowBFSInfinity() {
+  return std::numeric_limits<uint32_t>::max();
+}
+
+namespace internal {
+
+template <typename Graph>
+struct TemporalReachabilityImpl {
+  using GNode  = typename Graph::GraphNode;
+  using TimeTy = typename Graph::time_type;
+  using Window = typename Graph::window_type;
+
+  constexpr static const unsigned CHUNK_SIZE = 64U;
+  constexpr static const galois::MethodFlag flag =
+      galois::MethodFlag::UNPROTECTED;
+  constexpr static const uint64_t UNSCANNED =
+      std::numeric_limits<uint64_t>::max();
+
+  Graph& graph;
+  const Window& window;
+  const TemporalReachabilityPlan& plan;
+  //! edges of the window from scanned[n] on have been relaxed
+  galois::LargeArray<std::atomic<uint64_t>> scanned;
+
+  TemporalReachabilityImpl(Graph& g, const Window& w,
+                           const TemporalReachabilityPlan& p)
+      : graph(g), window(w), plan(p) {}
+
+  /**
+   * A path reaching n at time a continues along the edges of n at or after
+   * a (after a if strict). An edge leads to its destination at its own time
+   * whichever path took it, so when n is reached earlier only the edges
+   * between the new and the old arrival are new: every edge is relaxed at
+   * most once.
+   */
+  void relax(GNode n, GNode source, galois::UserContext<GNode>& ctx) {
+    TimeTy a    = graph.getData(n, flag).arrival.load();
+    auto usable = graph.edges(n, window, flag);
+    typename Graph::edge_iterator begin = *usable.begin();
+    typename Graph::edge_iterator end   = *usable.end();
+    bool strict = plan.strict && n != source;
+    auto first  = std::partition_point(begin, end, [&](uint64_t e) {
+      TimeTy t = graph.getEdgeTime(typename Graph::edge_iterator(e));
+      return strict ? !(a < t) : t < a;
+    });
+    uint64_t from = *first;
+    uint64_t old  = galois::atomicMin(scanned[n], from);
+    uint64_t to   = std::min<uint64_t>(old, *end);
+    for (uint64_t e = from; e < to; ++e) {
+      typename Graph::edge_iterator ei(e);
+      GNode v  = graph.getEdgeDst(ei);
+      TimeTy t = graph.getEdgeTime(ei);
+      if (t < galois::atomicMin(graph.getData(v, flag).arrival, t))
+        ctx.push(v);
+    }
+  }
+
+  size_t run(GNode source) {
+    scanned.allocateInterleaved(graph.size());
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          graph.getData(n, flag).arrival = temporalInfinity<Graph>();
+          scanned.constructAt(n, UNSCANNED);
+        },
+        galois::no_stats());
+    graph.getData(source, flag).arrival = window.begin;
+
+    using WL = galois::worklists::PerSocketChunkFIFO<CHUNK_SIZE>;
+    galois::for_each(
+        galois::iterate({source}),
+        [&](GNode n, auto& ctx) { relax(n, source, ctx); },
+        galois::wl<WL>(), galois::disable_conflict_detection(),
+        galois::loopname("TemporalReachability"));
+
+    galois::GAccumulator<size_t> reached;
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          if (graph.getData(n, flag).arrival != temporalInfinity<Graph>())
+            reached += 1;
+        },
+        galois::no_stats());
+    return reached.reduce();
+  }
+};
+
+template <typename Graph>
+struct WindowPageRankImpl {
+  using GNode  = typename Graph::GraphNode;
+  using Window = typename Graph::window_type;
+
+  constexpr static const unsigned CHUNK_SIZE = 16;
+  constexpr static const galois::MethodFlag flag =
+      galois::MethodFlag::UNPROTECTED;
+
+  Graph& graph;
+  const Window& window;
+  const WindowPageRankPlan& plan;
+
+  //! Same as the async variant of pageRankPush(), on the window's edges
+  void run() {
+    galois::LargeArray<uint32_t> degree;
+    degree.allocateInterleaved(graph.size());
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          auto& data    = graph.getData(n, flag);
+          data.rank     = 0;
+          data.residual = 1 - plan.alpha;
+          degree[n]     = graph.degree(n, window, flag);
+        },
+        galois::steal(), galois::no_stats());
+
+    using WL = galois::worklists::PerSocketChunkFIFO<CHUNK_SIZE>;
+    galois::for_each(
+        galois::iterate(graph),
+        [&](GNode src, auto& ctx) {
+          auto& sdata = graph.getData(src, flag);
+          if (sdata.residual <= plan.tolerance)
+            return;
+          PRTy residual = sdata.residual.exchange(0);
+          sdata.rank += residual;
+          if (!degree[src])
+            return;
+          PRTy delta = residual * plan.alpha / degree[src];
+          for (auto e : graph.edges(src, window, flag)) {
+            auto& ddata = graph.getData(graph.getEdgeDst(e), flag);
+            PRTy old    = galois::atomicAdd(ddata.residual, delta);
+            if (old < plan.tolerance && old + delta >= plan.tolerance)
+              ctx.push(graph.getEdgeDst(e));
+          }
+        },
+        galois::wl<WL>(), galois::disable_conflict_detection(),
+        galois::no_stats(), galois::loopname("WindowPageRank"));
+  }
+};
+
+} // namespace internal
+
+/**
+ * Earliest arrival times over time-respecting paths from source: paths
+ * whose edges lie in window and have non-decreasing times (increasing with
+ * plan.strict), starting at window.begin. The arrival time of node n, the
+ * time of the last edge of its earliest path, is stored in
+ * graph.getData(n).arrival (window.begin for source, temporalInfinity<Graph>()
+ * if unreachable). Returns the number of nodes reached, source included.
+ *
+ * Graph is an LC_CSR_Temporal_Graph whose node data has an arrival field of
+ * type std::atomic<Graph::time_type>, e.g. TemporalNode.
+ */
+template <typename Graph>
+size_t temporalReachability(
+    Graph& graph, typename Graph::GraphNode source,
+    const typename Graph::window_type& window,
+    const TemporalReachabilityPlan& plan = TemporalReachabilityPlan()) {
+  return internal::TemporalReachabilityImpl<Graph>(graph, window, plan).run(
+      source);
+}
+
+/**
+ * Breadth-first search from source over the edges in window. The level of
+ * node n is stored in graph.getData(n).level (windowBFSInfinity() if
+ * unreachable). Returns the number of nodes reached, source included.
+ *
+ * Graph is an LC_CSR_Temporal_Graph whose node data has a level field of
+ * type std::atomic<uint32_t>, e.g. TemporalNode.
+ */
+template <typename Graph>
+size_t windowBFS(Graph& graph, typename Graph::GraphNode source,
+                 const typename Graph::window_type& window) {
+  using GNode = typename Graph::GraphNode;
+  constexpr galois::MethodFlag flag = galois::MethodFlag::UNPROTECTED;
+
+  galois::do_all(
+      galois::iterate(graph),
+      [&](GNode n) { graph.getData(n, flag).level = windowBFSInfinity(); },
+      galois::no_stats());
+  graph.getData(source, flag).level = 0;
+
+  galois::InsertBag<GNode> frontier, next;
+  frontier.push(source);
+  size_t reached = 1;
+  for (uint32_t level = 1; !frontier.empty(); ++level) {
+    galois::GAccumulator<size_t> found;
+    galois::do_all(
+        galois::iterate(frontier),
+        [&](GNode n) {
+          for (auto e : graph.edges(n, window, flag)) {
+            GNode v        = graph.getEdgeDst(e);
+            auto& vl       = graph.getData(v, flag).level;
+            uint32_t unset = windowBFSInfinity();
+            if (vl.load(std::memory_order_relaxed) == unset &&
+                vl.compare_exchange_strong(unset, level)) {
+              next.push(v);
+              found += 1;
+            }
+          }
+        },
+        galois::steal(), galois::chunk_size<64>(),
+        galois::loopname("WindowBFS"));
+    reached += found.reduce();
+    frontier.clear();
+    std::swap(frontier, next);
+  }
+  return reached;
+}
+
+/**
+ * Connected components of the graph formed by the edges in window, with
+ * edge directions ignored (weakly connected components of a directed
+ * graph). The smallest node id of the component of node n is stored in
+ * graph.getData(n).component; nodes without edges in the window are
+ * components of their own. Returns the number of components.
+ *
+ * Graph is an LC_CSR_Temporal_Graph whose node data has a uint32_t
+ * component field, e.g. TemporalNode.
+ */
+template <typename Graph>
+size_t windowComponents(Graph& graph,
+                        const typename Graph::window_type& window) {
+  using GNode = typename Graph::GraphNode;
+  constexpr galois::MethodFlag flag = galois::MethodFlag::UNPROTECTED;
+
+  galois::IndexedUnionFind<uint32_t> sets(graph.size());
+  galois::do_all(
+      galois::iterate(graph),
+      [&](GNode n) {
+        for (auto e : graph.edges(n, window, flag))
+          sets.unite(n, graph.getEdgeDst(e));
+      },
+      galois::steal(), galois::loopname("WindowComponents"));
+  galois::LargeArray<uint32_t> labels = sets.finalize();
+  galois::do_all(
+      galois::iterate(graph),
+      [&](GNode n) { graph.getData(n, flag).component = labels[n]; },
+      galois::no_stats());
+  size_t numComponents = 0;
+  for (GNode n : graph)
+    numComponents += labels[n] == n;
+  return numComponents;
+}
+
+/**
+ * PageRank of the graph formed by the edges in window, computed by pushing
+ * residuals as pageRankPush() does. The rank of node n is stored in
+ * graph.getData(n).rank; nodes without edges in the window keep the base
+ * rank 1 - alpha.
+ *
+ * Graph is an LC_CSR_Temporal_Graph whose node data has a PRTy rank and a
+ * std::atomic<PRTy> residual field, e.g. TemporalNode.
+ */
+template <typename Graph>
+void windowPageRank(Graph& graph, const typename Graph::window_type& window,
+                    const WindowPageRankPlan& plan = WindowPageRankPlan()) {
+  internal::WindowPageRankImpl<Graph>{graph, window, plan}.run();
+}
+
+/**
+ * Calls fn(window) for the windows [begin, begin + width) of the graph's
+ * time span, starting at its first edge time and advancing by step, until
+ * a window starts after the last edge time. The analytics above can be
+ * called from fn on the same graph, so a sliding-window analysis reads the
+ * graph once.
+ */
+template <typename Graph, typename Fn>
+void forEachWindow(Graph& graph, typename Graph::time_type width,
+                   typename Graph::time_type step, Fn&& fn) {
+  using TimeTy = typename Graph::time_type;
+  if (!(TimeTy() < width) || !(TimeTy() < step))
+    GALOIS_DIE("window width and step must be positive");
+  if (!graph.sizeEdges())
+    return;
+
+  auto span = graph.timeSpan();
+  for (TimeTy begin = span.first;;) {
+    TimeTy end = begin + width;
+    // saturate at the largest time, if that is representable
+    if (end < begin)
+      end = std::numeric_limits<TimeTy>::max();
+    fn(typename Graph::window_type{begin, end});
+    if (!(begin < begin + step) || span.second < begin + step)
+      break;
+    begin += step;
+  }
+}
+
+} // namespace LONESTAR_ANALYTICS_ABI
+} // namespace analytics
+} // namespace lonestar
+
+#endif
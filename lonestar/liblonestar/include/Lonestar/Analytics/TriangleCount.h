@@ -0,0 +1,250 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_ANALYTICS_TRIANGLECOUNT_H
+#define LONESTAR_ANALYTICS_TRIANGLECOUNT_H
+
+#include "galois/Galois.h"
+#include "galois/Bag.h"
+#include "galois/Reduction.h"
+#include "Lonestar/Analytics/Version.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace lonestar {
+namespace analytics {
+inline namespace LONESTAR_ANALYTICS_ABI {
+
+//! Algorithm and tuning options of triangleCount()
+struct TriangleCountPlan {
+  enum Algorithm { nodeIterator, edgeIterator, orderedCount };
+
+  Algorithm algorithm = orderedCount;
+};
+
+inline const char* algorithmName(TriangleCountPlan::Algorithm algo) {
+  static const char* const names[] = {"NodeIterator", "EdgeIterator",
+                                      "OrderedCount"};
+  return names[algo];
+}
+
+namespace internal {
+
+template <typename Graph>
+struct TriangleCountImpl {
+  using GNode        = typename Graph::GraphNode;
+  using EdgeIterator = typename Graph::edge_iterator;
+
+  constexpr static const unsigned CHUNK_SIZE = 64u;
+
+  Graph& graph;
+
+  //! First edge of n whose destination is not less than dst
+  EdgeIterator lowerBound(GNode n, GNode dst) {
+    EdgeIterator first = graph.edge_begin(n, galois::MethodFlag::UNPROTECTED);
+    EdgeIterator last  = graph.edge_end(n, galois::MethodFlag::UNPROTECTED);
+    auto count         = std::distance(first, last);
+    while (count > 0) {
+      auto half       = count / 2;
+      EdgeIterator it = first;
+      std::advance(it, half);
+      if (graph.getEdgeDst(it) < dst) {
+        first = ++it;
+        count -= half + 1;
+      } else {
+        count = half;
+      }
+    }
+    return first;
+  }
+
+  /**
+   * Node Iterator algorithm for counting triangles.
+   * <code>
+   * for (v in G)
+   *   for (all pairs of neighbors (a, b) of v)
+   *     if ((a,b) in G and a < v < b)
+   *       triangle += 1
+   * </code>
+   *
+   * Thomas Schank. Algorithmic Aspects of Triangle-Based Network Analysis.
+   * PhD Thesis. Universitat Karlsruhe. 2007.
+   */
+  uint64_t nodeIterator() {
+    galois::GAccumulator<uint64_t> numTriangles;
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          // [first, ea) [n] [bb, last)
+          EdgeIterator first =
+              graph.edge_begin(n, galois::MethodFlag::UNPROTECTED);
+          EdgeIterator last =
+              graph.edge_end(n, galois::MethodFlag::UNPROTECTED);
+          EdgeIterator ea = lowerBound(n, n);
+          EdgeIterator bb = ea;
+          while (bb != last && graph.getEdgeDst(bb) == n) {
+            ++bb;
+          }
+
+          for (; bb != last; ++bb) {
+            GNode b = graph.getEdgeDst(bb);
+            for (EdgeIterator aa = first; aa != ea; ++aa) {
+              GNode a         = graph.getEdgeDst(aa);
+              EdgeIterator it = lowerBound(a, b);
+              if (it != graph.edge_end(a, galois::MethodFlag::UNPROTECTED) &&
+                  graph.getEdgeDst(it) == b) {
+                numTriangles += 1;
+              }
+            }
+          }
+        },
+        galois::chunk_size<CHUNK_SIZE>(), galois::steal(),
+        galois::loopname("TriangleNodeIterator"));
+
+    return numTriangles.reduce();
+  }
+
+  /**
+   * Edge Iterator algorithm for counting triangles.
+   * <code>
+   * for ((a, b) in E)
+   *   if (a < b)
+   *     for (v in intersect(neighbors(a), neighbors(b)))
+   *       if (a < v < b)
+   *         triangle += 1
+   * </code>
+   */
+  uint64_t edgeIterator() {
+    galois::InsertBag<std::pair<GNode, GNode>> items;
+    galois::GAccumulator<uint64_t> numTriangles;
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          for (auto e : graph.edges(n, galois::MethodFlag::UNPROTECTED)) {
+            GNode dst = graph.getEdgeDst(e);
+            if (n < dst) {
+              items.push(std::make_pair(n, dst));
+            }
+          }
+        },
+        galois::loopname("TriangleEdgeIteratorInit"));
+
+    galois::do_all(
+        galois::iterate(items),
+        [&](const std::pair<GNode, GNode>& w) {
+          // intersect the neighbors in (src, dst) of both endpoints
+          EdgeIterator aa = lowerBound(w.first, w.first + 1);
+          EdgeIterator ea = lowerBound(w.first, w.second);
+          EdgeIterator bb = lowerBound(w.second, w.first + 1);
+          EdgeIterator eb = lowerBound(w.second, w.second);
+
+          uint64_t count = 0;
+          while (aa != ea && bb != eb) {
+            GNode a = graph.getEdgeDst(aa);
+            GNode b = graph.getEdgeDst(bb);
+            if (a < b) {
+              ++aa;
+            } else if (b < a) {
+              ++bb;
+            } else {
+              count += 1;
+              ++aa;
+              ++bb;
+            }
+          }
+          numTriangles += count;
+        },
+        galois::chunk_size<CHUNK_SIZE>(), galois::steal(),
+        galois::loopname("TriangleEdgeIterator"));
+
+    return numTriangles.reduce();
+  }
+
+  //! Simple counting loop over the lower neighbors, instead of binary
+  //! searching.
+  uint64_t orderedCount() {
+    galois::GAccumulator<uint64_t> numTriangles;
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          uint64_t count = 0;
+          for (auto e : graph.edges(n, galois::MethodFlag::UNPROTECTED)) {
+            GNode v = graph.getEdgeDst(e);
+            if (v >= n) {
+              break;
+            }
+            EdgeIterator itN =
+                graph.edge_begin(n, galois::MethodFlag::UNPROTECTED);
+            for (auto ev : graph.edges(v, galois::MethodFlag::UNPROTECTED)) {
+              GNode vv = graph.getEdgeDst(ev);
+              if (vv >= v) {
+                break;
+              }
+              while (graph.getEdgeDst(itN) < vv) {
+                ++itN;
+              }
+              if (graph.getEdgeDst(itN) == vv) {
+                count += 1;
+              }
+            }
+          }
+          numTriangles += count;
+        },
+        galois::chunk_size<CHUNK_SIZE>(), galois::steal(),
+        galois::loopname("TriangleOrderedCount"));
+
+    return numTriangles.reduce();
+  }
+
+  uint64_t run(TriangleCountPlan::Algorithm algorithm) {
+    switch (algorithm) {
+    case TriangleCountPlan::nodeIterator:
+      return nodeIterator();
+    case TriangleCountPlan::edgeIterator:
+      return edgeIterator();
+    case TriangleCountPlan::orderedCount:
+      return orderedCount();
+    default:
+      GALOIS_DIE("invalid specification of triangle counting algorithm");
+    }
+  }
+};
+
+} // namespace internal
+
+/**
+ * Counts the triangles of a symmetric graph without self loops or duplicate
+ * edges. The edges of every node must be sorted by destination (see
+ * LC_CSR_Graph::sortAllEdgesByDst()); node data is not used.
+ */
+template <typename Graph>
+uint64_t triangleCount(Graph& graph,
+                       const TriangleCountPlan& plan = TriangleCountPlan()) {
+  return internal::TriangleCountImpl<Graph>{graph}.run(plan.algorithm);
+}
+
+} // namespace LONESTAR_ANALYTICS_ABI
+} // namespace analytics
+} // namespace lonestar
+
+#endif
@@ -0,0 +1,37 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_ANALYTICS_VERSION_H
+#define LONESTAR_ANALYTICS_VERSION_H
+
+/**
+ * Version of the analytics library API.
+ *
+ * The minor version grows when algorithms or options are added; the major
+ * version changes when an existing signature or plan field does. Everything
+ * is declared in the inline namespace LONESTAR_ANALYTICS_ABI, so objects
+ * built against different major versions fail to link instead of silently
+ * mixing.
+ */
+#define LONESTAR_ANALYTICS_VERSION_MAJOR 1
+#define LONESTAR_ANALYTICS_VERSION_MINOR 8
+
+#define LONESTAR_ANALYTICS_ABI v1
+
+#endif
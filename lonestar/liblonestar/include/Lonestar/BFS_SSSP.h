@@ -19,8 +19,15 @@
 
 #ifndef LONESTAR_BFS_SSSP_H
 #define LONESTAR_BFS_SSSP_H
-#include <iostream>
+
+#include "galois/Galois.h"
+#include "galois/Reduction.h"
+
+#include <atomic>
 #include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <limits>
 
 template <typename Graph, typename _DistLabel, bool USE_EDGE_WT,
           ptrdiff_t EDGE_TILE_SIZE = 256>
@@ -18,6 +18,7 @@
  */
 
 #include "Lonestar/BoilerPlate.h"
+#include "galois/graphs/GraphMetadata.h"
 
 #include <sstream>
 
@@ -47,6 +48,22 @@ static void LonestarPrintVersion(llvm::raw_ostream& out) {
   out.flush();
 }
 
+//! checks -symmetricGraph against what the input file records about itself
+static void checkInputMetadata(const std::string& filename) {
+  using galois::graphs::GraphMetadata;
+  GraphMetadata meta;
+  if (!galois::graphs::readGraphMetadata(filename, meta))
+    return;
+  galois::runtime::reportParam("(NULL)", "InputProperties", meta.describe());
+  if (symmetricGraph) {
+    meta.require(GraphMetadata::SYMMETRIC, GraphMetadata::UNKNOWN_TYPE,
+                 filename);
+  } else if (meta.has(GraphMetadata::SYMMETRIC)) {
+    symmetricGraph = true;
+    llvm::outs() << "note: input is symmetric according to its metadata\n";
+  }
+}
+
 //! initialize lonestar benchmark
 void LonestarStart(int argc, char** argv) {
   LonestarStart(argc, argv, nullptr, nullptr, nullptr, nullptr);
@@ -89,6 +106,7 @@ void LonestarStart(int argc, char** argv, const char* app, const char* desc,
   galois::runtime::reportParam("(NULL)", "Hosts", 1);
   if (input) {
     galois::runtime::reportParam("(NULL)", "Input", input->getValue());
+    checkInputMetadata(*input);
   }
 
   char name[256];
@@ -1,5 +1,6 @@
 #include "lonestarmine.h"
 #include "pangolin/BfsMining/vertex_miner.h"
+#include "pangolin/orbit_counter.h"
 
 const char* name = "Motif Counting";
 const char* desc =
@@ -7,6 +8,18 @@ const char* desc =
 const char* url     = nullptr;
 int num_patterns[3] = {2, 6, 21};
 
+static cll::opt<bool>
+    analytic("analytic",
+             cll::desc("count motifs from per-vertex graphlet orbits computed "
+                       "by counting formulas instead of enumeration (k <= 5); "
+                       "with -v, also run the enumerator and compare"),
+             cll::init(false));
+static cll::opt<std::string>
+    orbitFile("orbitFile",
+              cll::desc("write per-vertex graphlet orbit counts (requires "
+                        "-analytic)"),
+              cll::init(""));
+
 #include "pangolin/BfsMining/vertex_miner_api.h"
 class MyAPI : public VertexMinerAPI<VertexEmbedding> {
 public:
@@ -20,18 +33,96 @@ public:
 
 class AppMiner : public VertexMiner<SimpleElement, VertexEmbedding, MyAPI,
                                     false, false, true> {
+  typedef VertexMiner<SimpleElement, VertexEmbedding, MyAPI, false, false,
+                      true>
+      BaseMiner;
+
 public:
-  AppMiner(unsigned ms, int nt)
-      : VertexMiner<SimpleElement, VertexEmbedding, MyAPI, false, false, true>(
-            ms, nt, nblocks) {
+  AppMiner(unsigned ms, int nt) : BaseMiner(ms, nt, nblocks) {
     if (ms <= 2) {
       printf("ERROR: command line argument k must be 3 or greater\n");
       exit(1);
     }
+    if (analytic && ms > 5) {
+      printf("ERROR: analytic motif counting supports k of at most 5\n");
+      exit(1);
+    }
     set_num_patterns(num_patterns[k - 3]);
   }
   ~AppMiner() {}
-  void print_output() { printout_motifs(); }
+  void initialize(std::string pattern_filename) {
+    // the analytic counter does not use the embedding list unless it is
+    // verified against the enumerator
+    if (!analytic || verify)
+      BaseMiner::initialize(pattern_filename);
+  }
+  void solver() {
+    if (!analytic) {
+      BaseMiner::solver();
+      return;
+    }
+    OrbitCounter<PangolinGraph> counter(this->graph, this->max_size);
+    counter.count();
+    motifs = counter.motif_counts(this->max_size);
+    if (orbitFile != "")
+      counter.write_orbits(orbitFile);
+    if (verify) {
+      BaseMiner::solver();
+      std::vector<uint64_t> enumerated = enumerated_counts();
+      for (size_t i = 0; i < motifs.size(); i++) {
+        if (motifs[i] != enumerated[i])
+          GALOIS_DIE("analytic count of pattern ", i, " is ", motifs[i],
+                     " but enumeration found ", enumerated[i]);
+      }
+      std::cout << "\n\tanalytic counts match enumeration\n";
+    }
+  }
+  void print_output() {
+    if (!analytic) {
+      printout_motifs();
+      return;
+    }
+    std::cout << std::endl;
+    if (motifs.size() == 2) {
+      std::cout << "\ttriangles " << motifs[0] << std::endl;
+      std::cout << "\twedges    " << motifs[1] << std::endl;
+    } else if (motifs.size() == 6) {
+      std::cout << "\t4-paths --> " << motifs[0] << std::endl;
+      std::cout << "\t3-stars --> " << motifs[1] << std::endl;
+      std::cout << "\t4-cycles --> " << motifs[2] << std::endl;
+      std::cout << "\ttailed-triangles --> " << motifs[3] << std::endl;
+      std::cout << "\tdiamonds --> " << motifs[4] << std::endl;
+      std::cout << "\t4-cliques --> " << motifs[5] << std::endl;
+    } else {
+      for (size_t i = 0; i < motifs.size(); i++)
+        std::cout << "\tG" << i + 9 << " --> " << motifs[i] << std::endl;
+    }
+  }
+
+private:
+  std::vector<uint64_t> motifs;
+
+  // the enumerator counts 5-vertex motifs per canonical pattern, whose
+  // embedding holds one edge per element after the first: the element and
+  // its history, both numbered from 1
+  std::vector<uint64_t> enumerated_counts() {
+    std::vector<uint64_t> counts(motifs.size());
+    if (this->max_size < 5) {
+      for (size_t i = 0; i < counts.size(); i++)
+        counts[i] = this->accumulators[i].reduce();
+      return counts;
+    }
+    for (auto& element : this->get_cg_map()) {
+      auto emb = element.first.get_embedding();
+      std::vector<std::pair<unsigned, unsigned>> edges;
+      for (unsigned i = 1; i < emb.size(); i++)
+        edges.emplace_back(emb.get_vertex(emb.get_history(i)) - 1,
+                           emb.get_vertex(i) - 1);
+      counts[OrbitCounter<PangolinGraph>::graphlet_index(edges)] +=
+          element.second;
+    }
+    return counts;
+  }
 };
 
 #include "pangolin/BfsMining/engine.h"
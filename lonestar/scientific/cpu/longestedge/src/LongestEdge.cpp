@@ -17,6 +17,7 @@
 #include "writers/TriangleFormatWriter.h"
 #include "utils/ConnectivityManager.h"
 #include "utils/GraphGenerator.h"
+#include "utils/Refinement.h"
 #include "utils/Utils.h"
 #include "readers/AsciiReader.h"
 
@@ -69,10 +70,6 @@ static cll::opt<bool> altOutput(
 static cll::opt<bool> display("display",
                               cll::desc("Use external visualizator."));
 
-void afterStep(int i, Graph& graph);
-
-bool basicCondition(const Graph& graph, GNode& node);
-
 int main(int argc, char** argv) {
   galois::SharedMemSys G;
 
@@ -178,38 +175,8 @@ int main(int argc, char** argv) {
     galois::StatTimer step(("step" + std::to_string(j)).c_str());
     step.start();
 
-    auto prodExecuted = true;
-
-    while (prodExecuted) {
-      prodExecuted = false;
-
-      galois::for_each(
-          galois::iterate(graph.begin(), graph.end()),
-          [&](GNode node, auto& ctx) {
-            // only need to check hyperedges
-            if (!basicCondition(graph, node)) {
-              return;
-            }
-
-            // TODO does this have to be initialized for every one?
-            // may be able to optimize
-            ProductionState pState(connManager, node, version2D,
-                                   [&map](double x, double y) -> double {
-                                     return map->get_height(x, y);
-                                   });
-
-            // loop through productions and apply the first applicable
-            // one
-            for (Production* production : productions) {
-              if (production->execute(pState, ctx)) {
-                afterStep(j, graph);
-                prodExecuted = true;
-                return;
-              }
-            }
-          },
-          galois::loopname(("step" + std::to_string(j)).c_str()));
-    }
+    refine(graph, connManager, productions, *map, version2D,
+           "step" + std::to_string(j));
 
     step.stop();
     galois::gInfo("Step ", j, " finished.");
@@ -234,12 +201,3 @@ int main(int argc, char** argv) {
   delete map;
   return 0;
 }
-
-//! Checks if node exists + is hyperedge
-bool basicCondition(const Graph& graph, GNode& node) {
-  return graph.containsNode(node, galois::MethodFlag::WRITE) &&
-         node->getData().isHyperEdge();
-}
-
-//! Writes intermediate data to file
-void afterStep(int GALOIS_UNUSED(step), Graph& GALOIS_UNUSED(graph)) {}
@@ -3,11 +3,18 @@
 #include "../utils/Utils.h"
 #include "../libmgrs/utm.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <cmath>
 #include <limits>
 #include <iostream>
 
+Map::Map(std::unique_ptr<SrtmTiles> tiles, size_t width, size_t length,
+         double cellWidth, double cellLength)
+    : width(width), length(length), cell_width(cellWidth),
+      cell_length(cellLength), data(nullptr), tiles(std::move(tiles)),
+      utm(true), zone(-1) {}
+
 double** Map::init_map_data(size_t rows, size_t cols) {
   double** map;
   map = (double**)malloc(rows * sizeof(double*));
@@ -20,7 +27,7 @@ double** Map::init_map_data(size_t rows, size_t cols) {
 void Map::print_map() {
   for (size_t i = 0; i < this->length; ++i) {
     for (size_t j = 0; j < this->width; ++j) {
-      fprintf(stdout, "%5.0lf ", this->data[i][j]);
+      fprintf(stdout, "%5.0lf ", data ? data[i][j] : tiles->get(i, j));
     }
     fprintf(stdout, "\n");
   }
@@ -105,13 +112,16 @@ double Map::get_height_wo_interpol(const double lon_grid, const double lat_grid,
     return std::numeric_limits<double>::min();
   }
 
-  x = std::max(0, x);
-  y = std::max(0, y);
+  x = std::min(std::max(0, x), (int)width - 1);
+  y = std::min(std::max(0, y), (int)length - 1);
 
-  return data[y][x];
+  return data ? data[y][x] : tiles->get(y, x);
 }
 
 Map::~Map() {
+  if (!data) {
+    return;
+  }
   for (size_t i = 0; i < this->length; ++i) {
     free((double*)this->data[i]);
   }
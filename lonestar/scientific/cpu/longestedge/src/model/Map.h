@@ -2,10 +2,14 @@
 #define TERGEN_MAP_H
 
 #include <cstdlib>
+#include <memory>
+
+#include "../readers/SrtmTiles.h"
 
 /**
  * Holds the elevation of a particular point for some specified region (borders
- * and their lengths).
+ * and their lengths). Heights come either from an in-memory grid or from
+ * SRTM tiles mapped on demand.
  */
 class Map {
 private:
@@ -19,6 +23,8 @@ private:
 
   double** data;
 
+  std::unique_ptr<SrtmTiles> tiles;
+
   double north_border;
 
   double west_border;
@@ -38,6 +44,10 @@ public:
       : width(width), length(length), cell_width(cellWidth),
         cell_length(cellLength), data(data), utm(true), zone(-1) {}
 
+  //! Map whose heights are read from tiles; data is null
+  Map(std::unique_ptr<SrtmTiles> tiles, size_t width, size_t length,
+      double cellWidth, double cellLength);
+
   static double** init_map_data(size_t rows, size_t cols);
 
   void print_map();
@@ -3,6 +3,8 @@
 
 #include "../model/ProductionState.h"
 
+#include <algorithm>
+
 class Production {
 
 public:
@@ -66,6 +68,8 @@ protected:
     breakElementUsingNode(edgeToBreak, hangingNode, pState, ctx);
 
     hangingNode->getData().setHanging(false);
+    // triangles waiting for this node to stop hanging may proceed now
+    pushHyperEdgesAround(hangingNode, ctx);
   }
 
   //! Break an edge that doesn't have a hanging node already on it
@@ -119,13 +123,16 @@ private:
         pState.getVerticesData()[edgeVertices.second].getCoords(),
         pState.getZGetter());
 
-    // create the new node, push to graph and worklist
+    // the triangle on the other side of the edge now has a broken edge
+    pushHyperEdgesOnEdge(pState.getVertices()[edgeVertices.first],
+                         pState.getVertices()[edgeVertices.second], ctx);
+
+    // create the new node and push to graph
     // note: border nodes are never hanging; hanging means it needs to be
     // broken on the other end
     NodeData newNodeData = NodeData{false, newPointCoords, !breakingOnBorder};
     GNode newNode        = graph.createNode(newNodeData);
     graph.addNode(newNode);
-    ctx.push(newNode);
 
     // connect vertices in original triangle to new node
     for (int i = 0; i < 3; ++i) {
@@ -193,6 +200,35 @@ private:
         .get();
   }
 
+  /**
+   * A triangle's productions depend only on its own edges and on the hanging
+   * state of its vertices, so after a change only the hyperedges around the
+   * changed nodes need to be looked at again. The nodes passed in are
+   * already locked by the current production and hyperedge flags never
+   * change, so no new locks are taken.
+   */
+  void pushHyperEdgesAround(const GNode& node,
+                            galois::UserContext<GNode>& ctx) const {
+    for (GNode neighbour : connManager.getNeighbours(node)) {
+      if (neighbour->getData().isHyperEdge()) {
+        ctx.push(neighbour);
+      }
+    }
+  }
+
+  //! Push the hyperedges of triangles that contain both node1 and node2
+  void pushHyperEdgesOnEdge(const GNode& node1, const GNode& node2,
+                            galois::UserContext<GNode>& ctx) const {
+    std::vector<GNode> neighbours2 = connManager.getNeighbours(node2);
+    for (GNode neighbour : connManager.getNeighbours(node1)) {
+      if (neighbour->getData().isHyperEdge() &&
+          std::find(neighbours2.begin(), neighbours2.end(), neighbour) !=
+              neighbours2.end()) {
+        ctx.push(neighbour);
+      }
+    }
+  }
+
   //! Adds an edge to the graph given all neccessary parameters
   void addEdge(Graph& graph, GNode const& node1, GNode const& node2,
                bool border, double length,
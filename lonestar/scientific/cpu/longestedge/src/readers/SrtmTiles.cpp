@@ -0,0 +1,122 @@
+#include "SrtmTiles.h"
+
+#include <galois/gIO.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+const size_t CELLS_IN_FILE_ROW = SrtmTiles::CELLS_IN_DEGREE + 1;
+const size_t FILE_SIZE = CELLS_IN_FILE_ROW * CELLS_IN_FILE_ROW * 2;
+
+//! floor(a / b) for b > 0
+int floorDiv(int a, int b) { return a >= 0 ? a / b : -((-a + b - 1) / b); }
+
+//! latitude of the tile holding cells with latitude in (lat, lat + 1]
+int tileLat(int cellLat) {
+  return floorDiv(cellLat - 1, SrtmTiles::CELLS_IN_DEGREE);
+}
+
+int tileLon(int cellLon) {
+  return floorDiv(cellLon, SrtmTiles::CELLS_IN_DEGREE);
+}
+
+} // namespace
+
+SrtmTiles::SrtmTiles(const std::string& mapDir, int northBorderInt,
+                     int westBorderInt, size_t rows, size_t cols)
+    : mapDir(mapDir), northBorderInt(northBorderInt),
+      westBorderInt(westBorderInt) {
+  firstLat    = tileLat(northBorderInt - int(rows) + 1);
+  firstLon    = tileLon(westBorderInt);
+  numLons     = tileLon(westBorderInt + int(cols) - 1) - firstLon + 1;
+  int numLats = tileLat(northBorderInt) - firstLat + 1;
+  numTiles    = size_t(numLats) * numLons;
+  tiles.reset(new Tile[numTiles]);
+}
+
+SrtmTiles::~SrtmTiles() {
+  for (size_t i = 0; i < numTiles; ++i) {
+    const unsigned char* data = tiles[i].data.load(std::memory_order_relaxed);
+    if (data) {
+      munmap(const_cast<unsigned char*>(data), FILE_SIZE);
+    }
+  }
+}
+
+double SrtmTiles::get(size_t row, size_t col) {
+  size_t r = row;
+  while (true) {
+    uint16_t height = raw(r, col);
+    if (!isOutlier(height)) {
+      return height;
+    }
+    if (!outlierFound.load(std::memory_order_relaxed) &&
+        !outlierFound.exchange(true)) {
+      galois::gInfo("Outliers in input data detected.");
+    }
+    if (r == 0) {
+      return raw(1, col);
+    }
+    --r;
+  }
+}
+
+uint16_t SrtmTiles::raw(size_t row, size_t col) {
+  const int cellLat = northBorderInt - int(row);
+  const int cellLon = westBorderInt + int(col);
+  const int lat     = tileLat(cellLat);
+  const int lon     = tileLon(cellLon);
+
+  const unsigned char* data = load(lat, lon);
+  // file rows run from north to south
+  size_t fileRow = size_t((lat + 1) * CELLS_IN_DEGREE - cellLat);
+  size_t fileCol = size_t(cellLon - lon * CELLS_IN_DEGREE);
+  const unsigned char* cell = data + 2 * (fileRow * CELLS_IN_FILE_ROW + fileCol);
+  // heights are big-endian
+  return uint16_t((cell[0] << 8) | cell[1]);
+}
+
+const unsigned char* SrtmTiles::load(int lat, int lon) {
+  Tile& tile = tiles[size_t(lat - firstLat) * numLons + (lon - firstLon)];
+  const unsigned char* data = tile.data.load(std::memory_order_acquire);
+  if (data) {
+    return data;
+  }
+
+  std::lock_guard<std::mutex> guard(tile.lock);
+  data = tile.data.load(std::memory_order_relaxed);
+  if (data) {
+    return data;
+  }
+
+  char filename[4096];
+  snprintf(filename, sizeof(filename), "%s/%s%d%s%.3d.hgt", mapDir.c_str(),
+           lat < 0 ? "S" : "N", std::abs(lat), lon < 0 ? "W" : "E",
+           std::abs(lon));
+  int fd = open(filename, O_RDONLY);
+  if (fd == -1) {
+    GALOIS_DIE("cannot open ", filename, ": ", strerror(errno));
+  }
+  struct stat info;
+  if (fstat(fd, &info) == -1 || size_t(info.st_size) != FILE_SIZE) {
+    GALOIS_DIE(filename, " is not an SRTM3 tile of ", FILE_SIZE, " bytes");
+  }
+  void* mapped = mmap(nullptr, FILE_SIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (mapped == MAP_FAILED) {
+    GALOIS_DIE("cannot map ", filename, ": ", strerror(errno));
+  }
+  close(fd);
+
+  data = static_cast<const unsigned char*>(mapped);
+  tile.data.store(data, std::memory_order_release);
+  return data;
+}
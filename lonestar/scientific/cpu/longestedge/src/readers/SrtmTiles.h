@@ -0,0 +1,75 @@
+#ifndef TERGEN_SRTMTILES_H
+#define TERGEN_SRTMTILES_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/**
+ * Heights of a rectangular SRTM3 region served straight from the .hgt files
+ * of a data directory.
+ *
+ * Nothing is read up front. A tile is memory-mapped the first time one of
+ * its cells is requested, so only the tiles the mesh touches are opened and
+ * only the pages it samples are brought into memory. Lookups are safe to run
+ * from many threads at once.
+ */
+class SrtmTiles {
+public:
+  //! cells per degree; an .hgt file has one more row and column that
+  //! duplicate the first ones of its neighbors
+  static const int CELLS_IN_DEGREE = 1200;
+
+  /**
+   * @param mapDir directory with the .hgt files
+   * @param northBorderInt latitude of map row 0, in cells
+   * @param westBorderInt longitude of map column 0, in cells
+   * @param rows number of rows of the map
+   * @param cols number of columns of the map
+   */
+  SrtmTiles(const std::string& mapDir, int northBorderInt, int westBorderInt,
+            size_t rows, size_t cols);
+
+  ~SrtmTiles();
+
+  SrtmTiles(const SrtmTiles&) = delete;
+  SrtmTiles& operator=(const SrtmTiles&) = delete;
+
+  /**
+   * Height of a map cell. A reading outside [10, 3000] is an outlier and is
+   * replaced by the height of the cell above it (by the raw reading of row 1
+   * in row 0). The first outlier met is reported once.
+   */
+  double get(size_t row, size_t col);
+
+private:
+  struct Tile {
+    std::atomic<const unsigned char*> data{nullptr};
+    std::mutex lock;
+  };
+
+  std::string mapDir;
+  int northBorderInt;
+  int westBorderInt;
+  int firstLat;
+  int firstLon;
+  int numLons;
+  std::unique_ptr<Tile[]> tiles;
+  size_t numTiles;
+  std::atomic<bool> outlierFound{false};
+
+  //! reading of a map cell as stored in the file
+  uint16_t raw(size_t row, size_t col);
+
+  //! maps the tile with south-west corner (lat, lon) if not mapped yet
+  const unsigned char* load(int lat, int lon);
+
+  static bool isOutlier(uint16_t height) {
+    return height > 3000 || height < 10;
+  }
+};
+
+#endif // TERGEN_SRTMTILES_H
@@ -0,0 +1,62 @@
+#ifndef GALOIS_REFINEMENT_H
+#define GALOIS_REFINEMENT_H
+
+#include "ConnectivityManager.h"
+#include "../model/Map.h"
+#include "../model/ProductionState.h"
+#include "../productions/Production.h"
+
+#include <galois/Bag.h>
+
+#include <string>
+#include <vector>
+
+//! Checks if node exists + is hyperedge
+inline bool basicCondition(const Graph& graph, GNode& node) {
+  return graph.containsNode(node, galois::MethodFlag::WRITE) &&
+         node->getData().isHyperEdge();
+}
+
+/**
+ * Applies the first applicable production to the hyperedges until none
+ * applies. Every hyperedge is visited once; productions push the hyperedges
+ * they create or may have enabled, so the loop ends at the fixed point.
+ */
+inline void refine(Graph& graph, ConnectivityManager& connManager,
+                   const std::vector<Production*>& productions, Map& map,
+                   bool version2D, const std::string& loopName) {
+  galois::InsertBag<GNode> hyperEdges;
+  galois::do_all(
+      galois::iterate(graph.begin(), graph.end()),
+      [&](GNode node) {
+        if (graph.containsNode(node, galois::MethodFlag::UNPROTECTED) &&
+            node->getData().isHyperEdge()) {
+          hyperEdges.push(node);
+        }
+      },
+      galois::no_stats());
+
+  galois::for_each(
+      galois::iterate(hyperEdges),
+      [&](GNode node, auto& ctx) {
+        // only need to check hyperedges
+        if (!basicCondition(graph, node)) {
+          return;
+        }
+
+        ProductionState pState(connManager, node, version2D,
+                               [&map](double x, double y) -> double {
+                                 return map.get_height(x, y);
+                               });
+
+        // loop through productions and apply the first applicable one
+        for (Production* production : productions) {
+          if (production->execute(pState, ctx)) {
+            return;
+          }
+        }
+      },
+      galois::loopname(loopName.c_str()));
+}
+
+#endif // GALOIS_REFINEMENT_H
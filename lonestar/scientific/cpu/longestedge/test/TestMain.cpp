@@ -2,11 +2,14 @@
 #define GALOIS_TESTMAIN_H
 
 #define CATCH_CONFIG_MAIN
+// glibc 2.34 made MINSIGSTKSZ non-constant, which this catch.hpp needs
+#define CATCH_CONFIG_NO_POSIX_SIGNALS
 #include "catch.hpp"
 #include "productions/Production1Test.cpp"
 #include "utils/ConnectivityManagerTest.cpp"
 #include "model/ProductionStateTest.cpp"
 #include "utils/UtilsTest.cpp"
 #include "model/MapTest.cpp"
+#include "utils/RefinementTest.cpp"
 
 #endif // GALOIS_TESTMAIN_H
@@ -0,0 +1,190 @@
+#include "../catch.hpp"
+#include "../../src/conditions/TerrainConditionChecker.h"
+#include "../../src/model/Graph.h"
+#include "../../src/model/Map.h"
+#include "../../src/productions/Production1.h"
+#include "../../src/productions/Production2.h"
+#include "../../src/productions/Production3.h"
+#include "../../src/productions/Production4.h"
+#include "../../src/productions/Production5.h"
+#include "../../src/productions/Production6.h"
+#include "../../src/readers/SrtmReader.h"
+#include "../../src/readers/SrtmTiles.h"
+#include "../../src/utils/ConnectivityManager.h"
+#include "../../src/utils/GraphGenerator.h"
+#include "../../src/utils/Refinement.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <unistd.h>
+
+namespace {
+
+const int TILE_ROW = SrtmTiles::CELLS_IN_DEGREE + 1;
+
+//! cell of N0E000.hgt holding a reading of 5000 m
+const int OUTLIER_ROW = 1070;
+const int OUTLIER_COL = 130;
+
+//! ridges of 20 to 380 m, a few cells apart
+uint16_t syntheticHeight(int row, int col) {
+  return uint16_t(200 + 100 * std::sin(col / 2.) + 80 * std::cos(row / 3.));
+}
+
+//! writes the tile with south-west corner (0, 0) into a new directory
+std::string writeSyntheticTile() {
+  char dir[] = "/tmp/longestedge-XXXXXX";
+  REQUIRE(mkdtemp(dir) != nullptr);
+  std::vector<unsigned char> data(2 * TILE_ROW * TILE_ROW);
+  for (int row = 0; row < TILE_ROW; ++row) {
+    for (int col = 0; col < TILE_ROW; ++col) {
+      uint16_t height = row == OUTLIER_ROW && col == OUTLIER_COL
+                            ? 5000
+                            : syntheticHeight(row, col);
+      data[2 * (row * TILE_ROW + col)]     = height >> 8;
+      data[2 * (row * TILE_ROW + col) + 1] = height & 0xff;
+    }
+  }
+  std::string path = std::string(dir) + "/N0E000.hgt";
+  FILE* file       = fopen(path.c_str(), "wb");
+  REQUIRE(file != nullptr);
+  REQUIRE(fwrite(data.data(), 1, data.size(), file) == data.size());
+  fclose(file);
+  return dir;
+}
+
+void removeSyntheticTile(const std::string& dir) {
+  unlink((dir + "/N0E000.hgt").c_str());
+  rmdir(dir.c_str());
+}
+
+//! the refinement before the worklist: sweep all nodes until none changes
+void refineBySweeps(Graph& graph, ConnectivityManager& connManager,
+                    const std::vector<Production*>& productions, Map& map) {
+  std::atomic<bool> prodExecuted{true};
+  while (prodExecuted) {
+    prodExecuted = false;
+    galois::for_each(
+        galois::iterate(graph.begin(), graph.end()),
+        [&](GNode node, auto& ctx) {
+          if (!basicCondition(graph, node)) {
+            return;
+          }
+          ProductionState pState(connManager, node, false,
+                                 [&map](double x, double y) -> double {
+                                   return map.get_height(x, y);
+                                 });
+          for (Production* production : productions) {
+            if (production->execute(pState, ctx)) {
+              prodExecuted = true;
+              return;
+            }
+          }
+        });
+  }
+}
+
+using Triangle = std::array<std::tuple<long long, long long, long long>, 3>;
+
+//! triangles of the mesh with their corners rounded to millimeters
+std::vector<Triangle> meshTriangles(Graph& graph) {
+  ConnectivityManager connManager{graph};
+  std::vector<Triangle> triangles;
+  for (GNode node : graph) {
+    if (!graph.containsNode(node) || !node->getData().isHyperEdge()) {
+      continue;
+    }
+    Triangle triangle;
+    auto corners = connManager.getVerticesCoords(node);
+    REQUIRE(corners.size() == 3);
+    for (int i = 0; i < 3; ++i) {
+      triangle[i] = std::make_tuple(std::llround(corners[i].getX() * 1000),
+                                    std::llround(corners[i].getY() * 1000),
+                                    std::llround(corners[i].getZ() * 1000));
+    }
+    std::sort(triangle.begin(), triangle.end());
+    triangles.push_back(triangle);
+  }
+  std::sort(triangles.begin(), triangles.end());
+  return triangles;
+}
+
+//! refines a small region of the synthetic tile for a few steps
+std::vector<Triangle> generateMesh(const std::string& dir, bool bySweeps) {
+  const double W = 0.1, N = 0.115, E = 0.115, S = 0.1;
+  SrtmReader reader;
+  Map* map = reader.read(W, N, E, S, dir.c_str());
+  Graph graph{};
+  GraphGenerator::generateSampleGraphWithDataWithConversionToUtm(
+      graph, *map, W, N, E, S, false, false);
+
+  ConnectivityManager connManager{graph};
+  TerrainConditionChecker checker(5, connManager, *map);
+  Production1 production1{connManager};
+  Production2 production2{connManager};
+  Production3 production3{connManager};
+  Production4 production4{connManager};
+  Production5 production5{connManager};
+  Production6 production6{connManager};
+  std::vector<Production*> productions = {&production1, &production2,
+                                          &production3, &production4,
+                                          &production5, &production6};
+  for (int step = 0; step < 8; ++step) {
+    galois::for_each(galois::iterate(graph.begin(), graph.end()),
+                     [&](GNode node, auto&) {
+                       if (basicCondition(graph, node)) {
+                         checker.execute(node);
+                       }
+                     });
+    if (bySweeps) {
+      refineBySweeps(graph, connManager, productions, *map);
+    } else {
+      refine(graph, connManager, productions, *map, false, "refine");
+    }
+  }
+  delete map;
+  return meshTriangles(graph);
+}
+
+} // namespace
+
+TEST_CASE("SrtmTiles reads heights and replaces outliers") {
+  galois::SharedMemSys G;
+  std::string dir = writeSyntheticTile();
+  {
+    // map row 0 is latitude 1000 cells north of the equator, i.e. file
+    // row 200
+    SrtmTiles tiles(dir, 1000, 100, 900, 100);
+    for (size_t row : {0, 1, 450, 899}) {
+      for (size_t col : {0, 17, 99}) {
+        REQUIRE(tiles.get(row, col) ==
+                syntheticHeight(200 + int(row), 100 + int(col)));
+      }
+    }
+    // the outlier takes the height of the cell north of it
+    REQUIRE(tiles.get(OUTLIER_ROW - 200, OUTLIER_COL - 100) ==
+            syntheticHeight(OUTLIER_ROW - 1, OUTLIER_COL));
+  }
+  removeSyntheticTile(dir);
+}
+
+TEST_CASE("Worklist refinement generates the mesh of repeated sweeps") {
+  galois::SharedMemSys G;
+  galois::setActiveThreads(2);
+  std::string dir = writeSyntheticTile();
+  std::vector<Triangle> bySweeps   = generateMesh(dir, true);
+  std::vector<Triangle> byWorklist = generateMesh(dir, false);
+  removeSyntheticTile(dir);
+
+  // the initial mesh has 2 triangles
+  REQUIRE(bySweeps.size() > 200);
+  REQUIRE(byWorklist == bySweeps);
+}
@@ -0,0 +1,223 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef PYGALOIS_ANALYTICS_H
+#define PYGALOIS_ANALYTICS_H
+
+/**
+ * Non-template entry points into the Lonestar analytics library for
+ * _analytics.pyx. Every call builds the graph type its algorithm needs from
+ * the shared topology, runs without touching Python objects (so Cython can
+ * release the GIL around it) and copies the per-node or per-edge result into
+ * a caller-owned contiguous array.
+ */
+
+#include "galois/Galois.h"
+#include "galois/graphs/FileGraph.h"
+#include "galois/graphs/LCGraph.h"
+#include "Lonestar/Analytics.h"
+
+#include <algorithm>
+#include <string>
+
+namespace pygalois {
+
+namespace analytics = lonestar::analytics;
+
+template <typename Node, typename Edge = void>
+using CSRGraph = typename galois::graphs::LC_CSR_Graph<
+    Node, Edge>::template with_no_lockable<true>::type;
+
+//! Topology of a .gr file, loaded once and shared by the calls below
+class AnalyticsGraph {
+  galois::graphs::FileGraph fileGraph;
+
+public:
+  explicit AnalyticsGraph(const std::string& filename) {
+    fileGraph.fromFile(filename);
+  }
+
+  uint64_t numNodes() const { return fileGraph.size(); }
+  uint64_t numEdges() const { return fileGraph.sizeEdges(); }
+  //! true if the file carries 32-bit edge weights
+  bool weighted() const { return fileGraph.edgeSize() == sizeof(uint32_t); }
+
+  //! CSR row offsets: the edges of node n are [out[n], out[n + 1])
+  void edgeIndex(uint64_t* out) {
+    out[0] = 0;
+    galois::do_all(
+        galois::iterate(uint64_t{0}, numNodes()),
+        [&](uint64_t n) { out[n + 1] = *fileGraph.edge_end(n); },
+        galois::no_stats());
+  }
+
+  //! Edge destinations in file order
+  void edgeDestinations(uint32_t* out) {
+    galois::do_all(
+        galois::iterate(uint64_t{0}, numNodes()),
+        [&](uint64_t n) {
+          for (auto e = fileGraph.edge_begin(n); e != fileGraph.edge_end(n);
+               ++e) {
+            out[*e] = fileGraph.getEdgeDst(e);
+          }
+        },
+        galois::no_stats());
+  }
+
+  /**
+   * Builds graph from the topology; edge data is read only if the graph
+   * keeps 32-bit weights and the file has them.
+   */
+  template <typename Graph>
+  void load(Graph& graph, bool sortEdges = false) {
+    galois::graphs::readGraph(graph, fileGraph, !weighted());
+    if (sortEdges) {
+      graph.sortAllEdgesByDst();
+    }
+  }
+
+  galois::graphs::FileGraph& topology() { return fileGraph; }
+};
+
+//! Copies one field of every node into out[n]
+template <typename Graph, typename T, typename Get>
+void copyNodeData(Graph& graph, T* out, Get get) {
+  galois::do_all(
+      galois::iterate(graph),
+      [&](typename Graph::GraphNode n) { out[n] = get(graph.getData(n)); },
+      galois::no_stats());
+}
+
+inline uint64_t kCore(AnalyticsGraph& topology, unsigned int k, int algorithm,
+                      uint8_t* inCore) {
+  CSRGraph<analytics::KCoreNode> graph;
+  topology.load(graph);
+  analytics::KCorePlan plan;
+  plan.algorithm = analytics::KCorePlan::Algorithm(algorithm);
+  analytics::kCore(graph, k, plan);
+  copyNodeData(graph, inCore, [&](const analytics::KCoreNode& data) {
+    return uint8_t(data.currentDegree >= k);
+  });
+  return analytics::kCoreSize(graph, k);
+}
+
+inline uint64_t triangleCount(AnalyticsGraph& topology, int algorithm) {
+  CSRGraph<void> graph;
+  topology.load(graph, true);
+  analytics::TriangleCountPlan plan;
+  plan.algorithm = analytics::TriangleCountPlan::Algorithm(algorithm);
+  return analytics::triangleCount(graph, plan);
+}
+
+inline void betweennessCentrality(AnalyticsGraph& topology,
+                                  uint32_t startSource, uint32_t numSources,
+                                  float* centrality) {
+  CSRGraph<analytics::BetweennessNode> graph;
+  topology.load(graph);
+  analytics::BetweennessPlan plan;
+  plan.startSource = startSource;
+  plan.numSources  = numSources;
+  analytics::betweennessCentrality(graph, plan);
+  copyNodeData(graph, centrality, [](const analytics::BetweennessNode& data) {
+    return data.centrality;
+  });
+}
+
+inline double louvain(AnalyticsGraph& topology, uint32_t maxIterations,
+                      uint32_t maxLevels, double threshold, double resolution,
+                      uint64_t* community) {
+  analytics::LouvainPlan plan;
+  plan.maxIterations = maxIterations;
+  plan.maxLevels     = maxLevels;
+  plan.threshold     = threshold;
+  plan.resolution    = resolution;
+  auto get = [](const analytics::LouvainNode& data) { return data.community; };
+
+  if (topology.weighted()) {
+    CSRGraph<analytics::LouvainNode, uint32_t> graph;
+    topology.load(graph);
+    double modularity = analytics::louvain(graph, plan);
+    copyNodeData(graph, community, get);
+    return modularity;
+  }
+  CSRGraph<analytics::LouvainNode> graph;
+  topology.load(graph);
+  double modularity = analytics::louvain(graph, plan);
+  copyNodeData(graph, community, get);
+  return modularity;
+}
+
+/**
+ * Marks in inTruss[e] whether edge e, in file order, is in the k-truss. The
+ * algorithm needs sorted edges, so each file edge is found again in the
+ * sorted graph.
+ */
+inline uint64_t kTruss(AnalyticsGraph& topology, unsigned int k,
+                       uint8_t* inTruss) {
+  using Graph = CSRGraph<void, uint32_t>;
+  Graph graph;
+  topology.load(graph, true);
+  uint64_t numTrussEdges = analytics::kTruss(graph, k);
+
+  galois::graphs::FileGraph& file = topology.topology();
+  galois::do_all(
+      galois::iterate(graph),
+      [&](Graph::GraphNode n) {
+        auto first = graph.edge_begin(n);
+        auto last  = graph.edge_end(n);
+        for (auto e = file.edge_begin(n); e != file.edge_end(n); ++e) {
+          uint32_t dst = file.getEdgeDst(e);
+          auto it = std::partition_point(first, last, [&](uint64_t s) {
+            return graph.getEdgeDst(Graph::edge_iterator(s)) < dst;
+          });
+          inTruss[*e] = graph.getEdgeData(it) == analytics::KTRUSS_ALIVE;
+        }
+      },
+      galois::steal(), galois::no_stats());
+  return numTrussEdges;
+}
+
+inline uint64_t maximalIndependentSet(AnalyticsGraph& topology, uint64_t seed,
+                                      uint8_t* inSet) {
+  CSRGraph<analytics::IndependentSetNode> graph;
+  topology.load(graph);
+  analytics::IndependentSetPlan plan;
+  plan.seed     = seed;
+  uint64_t size = analytics::maximalIndependentSet(graph, plan);
+  copyNodeData(graph, inSet, [](const analytics::IndependentSetNode& data) {
+    return uint8_t(data.flag == analytics::IndependentSetNode::IN_SET);
+  });
+  return size;
+}
+
+inline uint64_t maximalMatching(AnalyticsGraph& topology, uint64_t seed,
+                                uint32_t* mate) {
+  CSRGraph<analytics::MatchingNode> graph;
+  topology.load(graph);
+  analytics::MatchingPlan plan;
+  plan.seed     = seed;
+  uint64_t size = analytics::maximalMatching(graph, plan);
+  copyNodeData(graph, mate,
+               [](const analytics::MatchingNode& data) { return data.mate; });
+  return size;
+}
+
+} // namespace pygalois
+
+#endif
@@ -0,0 +1,253 @@
+# cython: language_level = 3
+
+# Only declarations are cimported: importing the galois.shmem module would
+# load a second copy of the runtime into the process.
+from libgalois.Galois cimport SharedMemSys, setActiveThreads
+from libc.stdint cimport *
+from libcpp cimport bool
+from libcpp.string cimport string
+
+import concurrent.futures
+
+import numpy as np
+
+__all__ = ["Graph", "k_core", "triangle_count", "betweenness_centrality",
+           "louvain", "k_truss", "maximal_independent_set", "maximal_matching"]
+
+cdef extern from "_analytics.h" namespace "pygalois" nogil:
+    cdef cppclass AnalyticsGraph:
+        AnalyticsGraph(const string& filename) except +
+        uint64_t numNodes()
+        uint64_t numEdges()
+        bool weighted()
+        void edgeIndex(uint64_t* out) except +
+        void edgeDestinations(uint32_t* out) except +
+
+    uint64_t kCore(AnalyticsGraph& graph, unsigned int k, int algorithm,
+                   uint8_t* inCore) except +
+    uint64_t triangleCount(AnalyticsGraph& graph, int algorithm) except +
+    void betweennessCentrality(AnalyticsGraph& graph, uint32_t startSource,
+                               uint32_t numSources, float* centrality) except +
+    uint64_t kTruss(AnalyticsGraph& graph, unsigned int k,
+                    uint8_t* inTruss) except +
+    uint64_t maximalIndependentSet(AnalyticsGraph& graph, uint64_t seed,
+                                   uint8_t* inSet) except +
+    uint64_t maximalMatching(AnalyticsGraph& graph, uint64_t seed,
+                             uint32_t* mate) except +
+
+# Declared outside the namespace block so that louvain() below can keep the
+# plain name.
+cdef extern from "_analytics.h" nogil:
+    double louvainCommunities "pygalois::louvain"(
+        AnalyticsGraph& graph, uint32_t maxIterations, uint32_t maxLevels,
+        double threshold, double resolution, uint64_t* community) except +
+
+cdef extern from "Lonestar/Analytics.h" namespace "lonestar::analytics" nogil:
+    const uint32_t MATCHING_UNMATCHED
+
+_KCORE_ALGORITHMS = {"async": 0, "sync": 1}
+_TRIANGLE_ALGORITHMS = {"node_iterator": 0, "edge_iterator": 1,
+                        "ordered_count": 2}
+
+##############################################################################
+## Runtime and result buffers
+###########################################################################
+#
+# The Galois runtime belongs to the thread that created it, so one dedicated
+# thread creates it and makes every call. Callers wait on it without holding
+# the GIL, and it releases the GIL while the C++ side runs, so other Python
+# threads keep going.
+#
+cdef SharedMemSys *_runtime = NULL
+_galois_thread = concurrent.futures.ThreadPoolExecutor(
+    max_workers=1, thread_name_prefix="galois")
+
+def _invoke(threads, function, args):
+    global _runtime
+    if _runtime == NULL:
+        _runtime = new SharedMemSys()
+    if threads is not None:
+        if setActiveThreads(threads) != threads:
+            print("Warning, using fewer threads than requested")
+    return function(*args)
+
+def _run(threads, function, *args):
+    return _galois_thread.submit(_invoke, threads, function, args).result()
+
+def _choose(name, choices):
+    try:
+        return choices[name]
+    except KeyError:
+        raise ValueError("unknown algorithm {0!r}; expected one of {1}".format(
+            name, ", ".join(sorted(choices)))) from None
+
+#
+# Results are written straight into numpy arrays by the C++ side. Empty
+# arrays still need a valid address, so one spare element is allocated.
+#
+def _empty(size, dtype):
+    return np.empty(max(size, 1), dtype=dtype)
+
+##############################################################################
+## Graph
+###########################################################################
+cdef class Graph:
+    """
+    Topology of a graph in .gr format, read once and shared by every
+    analytics call on it. Node ids are [0, num_nodes); edges are numbered in
+    file order, which edge_index() and edge_destinations() describe.
+    """
+    cdef AnalyticsGraph *c_graph
+
+    def __cinit__(self, filename):
+        # the C++ reader aborts the process on a bad path; fail in Python
+        open(filename, "rb").close()
+        if isinstance(filename, str):
+            filename = filename.encode()
+        _run(None, self._load, filename)
+
+    def _load(self, string path):
+        with nogil:
+            self.c_graph = new AnalyticsGraph(path)
+
+    def __dealloc__(self):
+        del self.c_graph
+
+    @property
+    def num_nodes(self):
+        return self.c_graph.numNodes()
+
+    @property
+    def num_edges(self):
+        return self.c_graph.numEdges()
+
+    @property
+    def weighted(self):
+        return self.c_graph.weighted()
+
+    def edge_index(self):
+        """CSR row offsets: the edges of node n are [index[n], index[n + 1])."""
+        out = _empty(self.num_nodes + 1, np.uint64)
+        _run(None, self._edge_index, out)
+        return out
+
+    def _edge_index(self, uint64_t[::1] out):
+        with nogil:
+            self.c_graph.edgeIndex(&out[0])
+
+    def edge_destinations(self):
+        """Destination of every edge, in file order."""
+        out = _empty(self.num_edges, np.uint32)
+        _run(None, self._edge_destinations, out)
+        return out[:self.num_edges]
+
+    def _edge_destinations(self, uint32_t[::1] out):
+        with nogil:
+            self.c_graph.edgeDestinations(&out[0])
+
+##############################################################################
+## Algorithms
+###########################################################################
+#
+# The graph must be symmetric for everything except betweenness centrality.
+# threads, when given, sets the number of Galois threads for this and later
+# calls.
+#
+def _k_core(Graph graph, unsigned int k, int algorithm, uint8_t[::1] out):
+    with nogil:
+        kCore(graph.c_graph[0], k, algorithm, &out[0])
+
+def k_core(Graph graph, unsigned int k, algorithm="sync", threads=None):
+    """Boolean array marking the nodes of the k-core."""
+    algo = _choose(algorithm, _KCORE_ALGORITHMS)
+    out = _empty(graph.num_nodes, np.uint8)
+    _run(threads, _k_core, graph, k, algo, out)
+    return out[:graph.num_nodes].view(np.bool_)
+
+def _triangle_count(Graph graph, int algorithm):
+    cdef uint64_t count
+    with nogil:
+        count = triangleCount(graph.c_graph[0], algorithm)
+    return count
+
+def triangle_count(Graph graph, algorithm="ordered_count", threads=None):
+    """Number of triangles; the graph must not have duplicate edges."""
+    algo = _choose(algorithm, _TRIANGLE_ALGORITHMS)
+    return _run(threads, _triangle_count, graph, algo)
+
+def _betweenness_centrality(Graph graph, uint32_t start_source,
+                            uint32_t num_sources, float[::1] out):
+    with nogil:
+        betweennessCentrality(graph.c_graph[0], start_source, num_sources,
+                              &out[0])
+
+def betweenness_centrality(Graph graph, uint32_t start_source=0,
+                           uint32_t num_sources=0, threads=None):
+    """
+    Unnormalized betweenness centrality of every node (float32), using the
+    sources [start_source, start_source + num_sources) or every node when
+    num_sources is 0.
+    """
+    out = _empty(graph.num_nodes, np.float32)
+    _run(threads, _betweenness_centrality, graph, start_source, num_sources,
+         out)
+    return out[:graph.num_nodes]
+
+def _louvain(Graph graph, uint32_t max_iterations, uint32_t max_levels,
+             double threshold, double resolution, uint64_t[::1] out):
+    cdef double modularity
+    with nogil:
+        modularity = louvainCommunities(graph.c_graph[0], max_iterations,
+                                        max_levels, threshold, resolution,
+                                        &out[0])
+    return modularity
+
+def louvain(Graph graph, uint32_t max_iterations=10, uint32_t max_levels=10,
+            double threshold=1e-6, double resolution=1.0, threads=None):
+    """
+    Louvain communities as (community of every node, modularity). Community
+    ids are [0, number of communities); 32-bit edge weights are used when the
+    file has them.
+    """
+    out = _empty(graph.num_nodes, np.uint64)
+    modularity = _run(threads, _louvain, graph, max_iterations, max_levels,
+                      threshold, resolution, out)
+    return out[:graph.num_nodes], modularity
+
+def _k_truss(Graph graph, unsigned int k, uint8_t[::1] out):
+    with nogil:
+        kTruss(graph.c_graph[0], k, &out[0])
+
+def k_truss(Graph graph, unsigned int k, threads=None):
+    """
+    Boolean array over the edges (in file order) marking those in the
+    k-truss: every such edge lies in at least k - 2 triangles of the truss.
+    """
+    out = _empty(graph.num_edges, np.uint8)
+    _run(threads, _k_truss, graph, k, out)
+    return out[:graph.num_edges].view(np.bool_)
+
+def _maximal_independent_set(Graph graph, uint64_t seed, uint8_t[::1] out):
+    with nogil:
+        maximalIndependentSet(graph.c_graph[0], seed, &out[0])
+
+def maximal_independent_set(Graph graph, uint64_t seed=0, threads=None):
+    """Boolean array marking a maximal independent set; fixed for a seed."""
+    out = _empty(graph.num_nodes, np.uint8)
+    _run(threads, _maximal_independent_set, graph, seed, out)
+    return out[:graph.num_nodes].view(np.bool_)
+
+def _maximal_matching(Graph graph, uint64_t seed, uint32_t[::1] out):
+    with nogil:
+        maximalMatching(graph.c_graph[0], seed, &out[0])
+
+def maximal_matching(Graph graph, uint64_t seed=0, threads=None):
+    """
+    Mate of every node in a maximal matching (int64, -1 when unmatched);
+    fixed for a seed.
+    """
+    out = _empty(graph.num_nodes, np.uint32)
+    _run(threads, _maximal_matching, graph, seed, out)
+    mate = out[:graph.num_nodes].astype(np.int64)
+    mate[mate == MATCHING_UNMATCHED] = -1
+    return mate
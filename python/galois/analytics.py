@@ -0,0 +1 @@
+from ._analytics import *
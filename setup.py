@@ -47,6 +47,7 @@ def package_setup():
         packages=setuptools.find_packages("python"),
         package_data={"galois": pxd_files},
         package_dir={"": "python"},
+        install_requires=["numpy"],
         tests_require=["pytest"],
         setup_requires=setup_requires,
         cmake_args=cmake_args,
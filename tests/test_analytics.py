@@ -0,0 +1,130 @@
+import itertools
+
+import numpy as np
+import pytest
+
+import galois.analytics as analytics
+
+
+def write_graph(path, num_nodes, edges):
+    """Writes the symmetric graph of edges as an unweighted .gr (version 1)."""
+    neighbors = [set() for _ in range(num_nodes)]
+    for a, b in edges:
+        neighbors[a].add(b)
+        neighbors[b].add(a)
+    index = np.cumsum([len(n) for n in neighbors], dtype=np.uint64)
+    dests = np.array([d for n in neighbors for d in sorted(n)], dtype=np.uint32)
+    if len(dests) % 2:
+        dests = np.append(dests, np.uint32(0))
+    header = np.array([1, 0, num_nodes, index[-1]], dtype=np.uint64)
+    with open(path, "wb") as f:
+        for array in (header, index, dests):
+            f.write(array.tobytes())
+    return analytics.Graph(str(path))
+
+
+def clique(nodes):
+    return list(itertools.combinations(nodes, 2))
+
+
+@pytest.fixture
+def k4_pendant(tmp_path):
+    """K4 on 0-3, the pendant edge 3-4 and the isolated node 5."""
+    return write_graph(tmp_path / "k4.gr", 6, clique(range(4)) + [(3, 4)])
+
+
+@pytest.fixture
+def random_graph(tmp_path):
+    rng = np.random.default_rng(3)
+    edges = [(a, b) for a, b in rng.integers(0, 60, size=(240, 2)) if a != b]
+    return write_graph(tmp_path / "random.gr", 60, edges)
+
+
+def edge_list(graph):
+    index = graph.edge_index()
+    return [(n, d) for n in range(graph.num_nodes)
+            for d in graph.edge_destinations()[index[n]:index[n + 1]]]
+
+
+def test_graph(k4_pendant):
+    assert k4_pendant.num_nodes == 6
+    assert k4_pendant.num_edges == 14
+    assert not k4_pendant.weighted
+    assert list(k4_pendant.edge_index()) == [0, 3, 6, 9, 13, 14, 14]
+    assert (3, 4) in edge_list(k4_pendant) and (4, 3) in edge_list(k4_pendant)
+
+
+def test_missing_graph(tmp_path):
+    with pytest.raises(FileNotFoundError):
+        analytics.Graph(str(tmp_path / "missing.gr"))
+
+
+@pytest.mark.parametrize("algorithm", ["sync", "async"])
+def test_k_core(k4_pendant, algorithm):
+    core = analytics.k_core(k4_pendant, 3, algorithm=algorithm)
+    assert list(core) == [True] * 4 + [False] * 2
+
+
+@pytest.mark.parametrize("algorithm",
+                         ["node_iterator", "edge_iterator", "ordered_count"])
+def test_triangle_count(k4_pendant, algorithm):
+    assert analytics.triangle_count(k4_pendant, algorithm=algorithm) == 4
+
+
+def test_unknown_algorithm(k4_pendant):
+    with pytest.raises(ValueError):
+        analytics.triangle_count(k4_pendant, algorithm="matrix")
+
+
+def test_betweenness_centrality(tmp_path):
+    path = write_graph(tmp_path / "path.gr", 5, [(i, i + 1) for i in range(4)])
+    bc = analytics.betweenness_centrality(path)
+    assert bc.dtype == np.float32
+    assert list(bc) == [2 * i * (4 - i) for i in range(5)]
+    # node i lies on the paths from node 0 to the 4 - i nodes right of it
+    bc = analytics.betweenness_centrality(path, start_source=0, num_sources=1)
+    assert list(bc) == [0, 3, 2, 1, 0]
+
+
+def test_louvain(tmp_path):
+    edges = clique(range(5)) + clique(range(5, 10)) + [(4, 5)]
+    graph = write_graph(tmp_path / "cliques.gr", 10, edges)
+    communities, modularity = analytics.louvain(graph)
+    assert communities.dtype == np.uint64
+    assert sorted(set(communities)) == [0, 1]
+    assert len(set(communities[:5])) == 1 and len(set(communities[5:])) == 1
+    # 20 of 21 edges are inside; each community holds half the degree
+    assert modularity == pytest.approx(20 / 21 - 0.5)
+
+
+def test_k_truss(k4_pendant):
+    truss = analytics.k_truss(k4_pendant, 4)
+    assert len(truss) == k4_pendant.num_edges
+    for (a, b), alive in zip(edge_list(k4_pendant), truss):
+        assert alive == (a < 4 and b < 4)
+    assert not analytics.k_truss(k4_pendant, 5).any()
+
+
+def test_maximal_independent_set(random_graph):
+    in_set = analytics.maximal_independent_set(random_graph, threads=1)
+    for a, b in edge_list(random_graph):
+        assert not (in_set[a] and in_set[b])
+    covered = in_set.copy()
+    for a, b in edge_list(random_graph):
+        covered[a] |= in_set[b]
+    assert covered.all()
+    same = analytics.maximal_independent_set(random_graph, threads=4)
+    assert (same == in_set).all()
+
+
+def test_maximal_matching(random_graph):
+    mate = analytics.maximal_matching(random_graph, threads=1)
+    assert mate.dtype == np.int64
+    edges = set(edge_list(random_graph))
+    for n, m in enumerate(mate):
+        if m != -1:
+            assert mate[m] == n and (n, m) in edges
+    for a, b in edges:
+        assert mate[a] != -1 or mate[b] != -1
+    same = analytics.maximal_matching(random_graph, threads=4)
+    assert (same == mate).all()
@@ -3,3 +3,4 @@ def test_imports():
     import galois.pagerank
     import galois.bfs
     import galois.connectedComponents
+    import galois.analytics
@@ -0,0 +1,21 @@
+# Usage: cmake -P expect-failure.cmake <command> [<arg>...]
+#
+# Runs the command, echoes its output and fails if the command succeeds, so
+# that tests can check that a command dies (GALOIS_DIE aborts, which ctest
+# would report as a crash) and match what it printed.
+
+set(command)
+math(EXPR last "${CMAKE_ARGC} - 1")
+foreach(i RANGE 3 ${last})
+  list(APPEND command "${CMAKE_ARGV${i}}")
+endforeach()
+
+execute_process(COMMAND ${command}
+  RESULT_VARIABLE result
+  OUTPUT_VARIABLE output
+  ERROR_VARIABLE output
+)
+message("${output}")
+if (result EQUAL 0)
+  message(FATAL_ERROR "expected the command to fail")
+endif()
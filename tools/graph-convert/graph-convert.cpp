@@ -20,6 +20,7 @@
 #include "galois/Galois.h"
 #include "galois/LargeArray.h"
 #include "galois/graphs/FileGraph.h"
+#include "galois/graphs/HypergraphIO.h"
 
 #include <llvm/Support/CommandLine.h>
 
@@ -29,6 +30,7 @@
 #include <fstream>
 #include <iostream>
 #include <limits>
+#include <optional>
 #include <cstdint>
 #include <vector>
 #include <random>
@@ -82,7 +84,11 @@ enum ConvertMode {
   nodelist2gr,
   pbbs2gr,
   svmlight2gr,
-  edgelist2binary
+  edgelist2binary,
+  hmetis2binaryhgr,
+  patoh2binaryhgr,
+  gr2metagr,
+  verifygr
 };
 
 enum EdgeType { float32_, float64_, int32_, int64_, uint32_, uint64_, void_ };
@@ -91,8 +97,9 @@ namespace cll = llvm::cl;
 
 static cll::opt<std::string>
     inputFilename(cll::Positional, cll::desc("<input file>"), cll::Required);
-static cll::opt<std::string>
-    outputFilename(cll::Positional, cll::desc("<output file>"), cll::Required);
+static cll::opt<std::string> outputFilename(cll::Positional,
+                                            cll::desc("<output file>"),
+                                            cll::Optional);
 static cll::opt<std::string>
     transposeFilename("graphTranspose", cll::desc("transpose graph file"),
                       cll::init(""));
@@ -182,8 +189,22 @@ static cll::opt<ConvertMode> convertMode(
         clEnumVal(svmlight2gr, "Convert svmlight file to binary gr"),
         clEnumVal(edgelist2binary,
                   "Convert edge list to binary edgelist "
-                  "format (assumes vertices of type uin32_t)")),
+                  "format (assumes vertices of type uin32_t)"),
+        clEnumVal(hmetis2binaryhgr,
+                  "Convert hMetis hypergraph to binary hypergraph"),
+        clEnumVal(patoh2binaryhgr,
+                  "Convert PaToH hypergraph to binary hypergraph"),
+        clEnumVal(gr2metagr, "Attach metadata to binary gr: properties, "
+                             "edge type and checksums (output may be the "
+                             "input)"),
+        clEnumVal(verifygr, "Check binary gr against its metadata (no "
+                            "output file)")),
     cll::Required);
+static cll::opt<unsigned>
+    numThreads("t",
+               cll::desc("Number of threads for conversions that run in "
+                         "parallel (default 1)"),
+               cll::init(1));
 static cll::opt<uint32_t>
     sourceNode("sourceNode", cll::desc("Source node ID for BFS traversal"),
                cll::init(0));
@@ -200,6 +221,11 @@ static cll::opt<int>
              cll::init(1));
 static cll::opt<int> maxDegree("maxDegree", cll::desc("maximum degree to keep"),
                                cll::init(2 * 1024));
+static cll::opt<bool>
+    writeMetadata("metadata",
+                  cll::desc("Attach metadata (properties, edge type and "
+                            "checksums) to the output gr"),
+                  cll::init(false));
 
 struct Conversion {};
 struct HasOnlyVoidSpecialization {};
@@ -758,6 +784,22 @@ struct Gr2Mtx : public HasNoVoidSpecialization {
   }
 };
 
+/**
+ * Parses a text hypergraph in parallel and writes it in the binary format
+ * that BiPart can load without parsing.
+ */
+template <galois::graphs::HypergraphFormat Format>
+struct Hypergraph2BinaryHgr : public HasOnlyVoidSpecialization {
+  template <typename EdgeTy>
+  void convert(const std::string& infilename, const std::string& outfilename) {
+    static_assert(std::is_same<EdgeTy, void>::value,
+                  "conversion undefined for non-void graphs");
+    auto hg = galois::graphs::readHypergraph(infilename, Format);
+    galois::graphs::writeHypergraphBinary(hg, outfilename);
+    printStatus(hg.numNets, hg.numPins());
+  }
+};
+
 /**
  * List of node adjacencies:
  *
@@ -2886,10 +2928,152 @@ struct Svmlight2Gr : public HasNoVoidSpecialization {
   }
 };
 
+static galois::graphs::GraphMetadata::EdgeType metadataType(EdgeType e) {
+  using M = galois::graphs::GraphMetadata;
+  switch (e) {
+  case EdgeType::float32_:
+    return M::FLOAT32_TYPE;
+  case EdgeType::float64_:
+    return M::FLOAT64_TYPE;
+  case EdgeType::int32_:
+    return M::INT32_TYPE;
+  case EdgeType::int64_:
+    return M::INT64_TYPE;
+  case EdgeType::uint32_:
+    return M::UINT32_TYPE;
+  case EdgeType::uint64_:
+    return M::UINT64_TYPE;
+  case EdgeType::void_:
+    return M::VOID_TYPE;
+  default:
+    abort();
+  }
+}
+
+/**
+ * Computes the metadata of a gr file and attaches it. Whether it is a
+ * transpose cannot be recomputed: it is kept from the old metadata, or for
+ * transposed outputs derived from the input's.
+ */
+static void attachMetadata(const std::string& filename, bool transposed) {
+  using M = galois::graphs::GraphMetadata;
+  galois::graphs::FileGraph graph;
+  graph.fromFile(filename);
+  M::EdgeType type = metadataType(edgeType);
+  if (M::sizeOf(type) != graph.edgeSize()) {
+    std::cerr << "note: edge data is " << graph.edgeSize()
+              << " bytes, recording its type as unknown\n";
+    type = M::UNKNOWN_TYPE;
+  }
+  M meta = graph.computeMetadata(type);
+  M input;
+  if (transposed)
+    meta.set(M::TRANSPOSE,
+             !(galois::graphs::readGraphMetadata(inputFilename, input) &&
+               input.has(M::TRANSPOSE)));
+  else if (graph.getMetadata().isKnown(M::TRANSPOSE))
+    meta.set(M::TRANSPOSE, graph.getMetadata().has(M::TRANSPOSE));
+  galois::graphs::writeGraphMetadata(filename, meta);
+  std::cout << "Metadata: " << meta.describe() << "\n";
+}
+
+struct AddMetadata : public Conversion {
+  template <typename EdgeTy>
+  void convert(const std::string& infilename, const std::string& outfilename) {
+    if (infilename != outfilename) {
+      std::ifstream in(infilename, std::ios::binary);
+      std::ofstream out(outfilename, std::ios::binary);
+      out << in.rdbuf();
+      if (!in || !out)
+        GALOIS_DIE("failed copying ", infilename, " to ", outfilename);
+    }
+    attachMetadata(outfilename, false);
+  }
+};
+
+struct VerifyMetadata : public Conversion {
+  template <typename EdgeTy>
+  void convert(const std::string& infilename, const std::string&) {
+    using M = galois::graphs::GraphMetadata;
+    galois::graphs::FileGraph graph;
+    graph.fromFile(infilename);
+    if (!graph.hasMetadata())
+      GALOIS_DIE(infilename, " has no metadata; attach it with -gr2metagr");
+    const M& stored = graph.getMetadata();
+    M actual        = graph.computeMetadata(stored.edgeType);
+    std::cout << "Stored: " << stored.describe() << "\n";
+    std::cout << "Actual: " << actual.describe() << "\n";
+
+    unsigned problems = 0;
+    if (stored.hasChecksums &&
+        stored.topologyChecksum != actual.topologyChecksum) {
+      std::cout << "topology checksum does not match\n";
+      ++problems;
+    }
+    if (stored.hasChecksums &&
+        stored.edgeDataChecksum != actual.edgeDataChecksum) {
+      std::cout << "edge data checksum does not match\n";
+      ++problems;
+    }
+    for (uint64_t p = 1; p < M::TRANSPOSE; p <<= 1) {
+      M::Property prop = M::Property(p);
+      if (stored.isKnown(prop) && stored.has(prop) != actual.has(prop)) {
+        std::cout << "property " << M::name(prop) << " is recorded as "
+                  << (stored.has(prop) ? "holding" : "not holding")
+                  << " but does " << (actual.has(prop) ? "" : "not ")
+                  << "hold\n";
+        ++problems;
+      }
+    }
+    if (problems)
+      GALOIS_DIE(infilename, ": metadata check failed (", problems, ")");
+    std::cout << infilename << ": metadata OK\n";
+  }
+};
+
+//! conversions whose output is a single gr
+static bool writesGr(ConvertMode mode) {
+  switch (mode) {
+  case bipartitegr2sorteddegreegr:
+  case dimacs2gr:
+  case edgelist2gr:
+  case csv2gr:
+  case gr2biggr:
+  case gr2cgr:
+  case gr2linegr:
+  case gr2lowdegreegr:
+  case gr2randgr:
+  case gr2randomweightgr:
+  case gr2ringgr:
+  case gr2sgr:
+  case gr2sorteddegreegr:
+  case gr2sorteddstgr:
+  case gr2sortedparentdegreegr:
+  case gr2sortedweightgr:
+  case gr2sortedbfsgr:
+  case gr2streegr:
+  case gr2tgr:
+  case gr2treegr:
+  case gr2trigr:
+  case mtx2gr:
+  case nodelist2gr:
+  case pbbs2gr:
+  case svmlight2gr:
+    return true;
+  default:
+    return false;
+  }
+}
+
 int main(int argc, char** argv) {
   galois::SharedMemSys G;
   llvm::cl::ParseCommandLineOptions(argc, argv);
   std::ios_base::sync_with_stdio(false);
+  galois::setActiveThreads(numThreads);
+  if (outputFilename.empty() && convertMode != verifygr)
+    GALOIS_DIE("missing <output file>");
+  if (writeMetadata && !writesGr(convertMode))
+    GALOIS_DIE("-metadata needs a conversion that writes a single gr");
   switch (convertMode) {
   case bipartitegr2bigpetsc:
     convert<Bipartitegr2Petsc<double, false>>();
@@ -3023,8 +3207,22 @@ int main(int argc, char** argv) {
   case edgelist2binary:
     convert<Edgelist2Binary>();
     break;
+  case hmetis2binaryhgr:
+    convert<Hypergraph2BinaryHgr<galois::graphs::HypergraphFormat::hMetis>>();
+    break;
+  case patoh2binaryhgr:
+    convert<Hypergraph2BinaryHgr<galois::graphs::HypergraphFormat::PaToH>>();
+    break;
+  case gr2metagr:
+    convert<AddMetadata>();
+    break;
+  case verifygr:
+    convert<VerifyMetadata>();
+    break;
   default:
     abort();
   }
+  if (writeMetadata)
+    attachMetadata(outputFilename, convertMode == gr2tgr);
   return 0;
 }
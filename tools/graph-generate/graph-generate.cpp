@@ -0,0 +1,649 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+/**
+ * Generates synthetic graphs in parallel and writes them as Galois .gr files.
+ *
+ * Every random choice is drawn from a counter-based generator keyed by the
+ * seed and the index of the item being generated (edge, node, community), so
+ * the output depends only on the options and not on the number of threads.
+ * Self loops and duplicate edges are removed; all models except a
+ * non-symmetric R-MAT produce symmetric graphs. The output carries metadata
+ * recording its properties, edge type and checksums.
+ */
+
+#include "galois/Galois.h"
+#include "galois/LargeArray.h"
+#include "galois/ParallelSTL.h"
+#include "galois/SplitMix64.h"
+#include "galois/Timer.h"
+#include "galois/graphs/FileGraph.h"
+#include "galois/graphs/WriteGraph.h"
+#include "galois/substrate/PerThreadStorage.h"
+
+#include "llvm/Support/CommandLine.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace cll = llvm::cl;
+
+enum Model { rmat, er, grid2d, grid3d, road, ba, lfr };
+enum WeightType { none, uint32, float32 };
+
+static cll::opt<std::string>
+    outputFilename(cll::Positional, cll::desc("<output .gr>"), cll::Required);
+static cll::opt<Model> model(
+    "model", cll::desc("Graph model:"),
+    cll::values(
+        clEnumVal(rmat, "R-MAT, i.e. stochastic Kronecker with a 2x2 "
+                        "initiator (-a, -b, -c); node ids are scrambled"),
+        clEnumVal(er, "Erdos-Renyi G(n, p) with p = degree / (n - 1)"),
+        clEnumVal(grid2d, "2D grid of -width x -height"),
+        clEnumVal(grid3d, "3D grid of -width x -height x -depth"),
+        clEnumVal(road, "Road-like: 2D grid with jittered coordinates, "
+                        "dropped streets and diagonal shortcuts"),
+        clEnumVal(ba, "Barabasi-Albert preferential attachment with "
+                      "degree / 2 edges per new node"),
+        clEnumVal(lfr, "LFR-style power-law graph with planted "
+                       "communities (-mu, -communities)")),
+    cll::Required);
+static cll::opt<uint32_t> numNodes("n", cll::desc("Number of nodes"),
+                                   cll::init(0));
+static cll::opt<double> degree("degree",
+                               cll::desc("Average degree (default 16); R-MAT "
+                                         "draws n * degree edges"),
+                               cll::init(16));
+static cll::opt<uint64_t> seed("seed", cll::desc("Random seed (default 0)"),
+                               cll::init(0));
+static cll::opt<bool> symmetric("symmetric",
+                                cll::desc("Also add the reverse of every "
+                                          "R-MAT edge"),
+                                cll::init(false));
+static cll::opt<double> rmatA("a", cll::desc("R-MAT a (default 0.57)"),
+                              cll::init(0.57));
+static cll::opt<double> rmatB("b", cll::desc("R-MAT b (default 0.19)"),
+                              cll::init(0.19));
+static cll::opt<double> rmatC("c", cll::desc("R-MAT c (default 0.19)"),
+                              cll::init(0.19));
+static cll::opt<uint32_t> width("width", cll::desc("Grid width"),
+                                cll::init(0));
+static cll::opt<uint32_t> height("height", cll::desc("Grid height"),
+                                 cll::init(0));
+static cll::opt<uint32_t> depth("depth", cll::desc("Grid depth (3D only)"),
+                                cll::init(1));
+static cll::opt<double> dropProb("dropProb",
+                                 cll::desc("Road: probability that a street "
+                                           "is missing (default 0.1)"),
+                                 cll::init(0.1));
+static cll::opt<double> diagonalProb("diagonalProb",
+                                     cll::desc("Road: probability of a "
+                                               "diagonal street (default "
+                                               "0.05)"),
+                                     cll::init(0.05));
+static cll::opt<double> mu("mu",
+                           cll::desc("LFR: fraction of each node's edges "
+                                     "leaving its community (default 0.2)"),
+                           cll::init(0.2));
+static cll::opt<uint32_t> maxDegree("maxDegree",
+                                    cll::desc("LFR: maximum degree (default "
+                                              "4 * degree)"),
+                                    cll::init(0));
+static cll::opt<double> degreeExp("degreeExp",
+                                  cll::desc("LFR: degree power-law exponent "
+                                            "(default 2.5)"),
+                                  cll::init(2.5));
+static cll::opt<double> communityExp("communityExp",
+                                     cll::desc("LFR: community size power-law "
+                                               "exponent (default 1.5)"),
+                                     cll::init(1.5));
+static cll::opt<uint32_t> minCommunity("minCommunity",
+                                       cll::desc("LFR: smallest community "
+                                                 "(default 2 * degree)"),
+                                       cll::init(0));
+static cll::opt<uint32_t> maxCommunity("maxCommunity",
+                                       cll::desc("LFR: largest community "
+                                                 "(default 20 * degree)"),
+                                       cll::init(0));
+static cll::opt<std::string>
+    communitiesFilename("communities",
+                        cll::desc("LFR: write the community of node i on "
+                                  "line i of this file"),
+                        cll::init(""));
+static cll::opt<WeightType> weightType(
+    "edgeType", cll::desc("Type of the edge weights:"),
+    cll::values(clEnumVal(none, "No edge data (default)"),
+                clEnumVal(uint32, "uint32 weights"),
+                clEnumVal(float32, "float32 weights")),
+    cll::init(none));
+static cll::opt<double> minWeight("minWeight",
+                                  cll::desc("Smallest uniform weight "
+                                            "(default 1)"),
+                                  cll::init(1));
+static cll::opt<double> maxWeight("maxWeight",
+                                  cll::desc("Largest uniform weight "
+                                            "(default 100)"),
+                                  cll::init(100));
+static cll::opt<double> scale("scale",
+                              cll::desc("Road: weights are distances times "
+                                        "this, in grid units (default 100)"),
+                              cll::init(100));
+static cll::opt<int> numThreads("t", cll::desc("Number of threads (default 1)"),
+                                cll::init(1));
+
+struct Edge {
+  uint32_t src;
+  uint32_t dst;
+
+  bool operator<(const Edge& o) const {
+    return src < o.src || (src == o.src && dst < o.dst);
+  }
+  bool operator==(const Edge& o) const { return src == o.src && dst == o.dst; }
+};
+
+using EdgeBuffer = galois::substrate::PerThreadStorage<std::vector<Edge>>;
+
+//! independent streams of random numbers, one per use
+enum Stream : uint64_t {
+  RMAT_EDGE = 1,
+  SCRAMBLE,
+  ER_NODE,
+  ROAD_COORD,
+  ROAD_STREET,
+  BA_EDGE,
+  LFR_DEGREE,
+  LFR_SIZE,
+  LFR_PLACE,
+  LFR_INTERNAL,
+  LFR_EXTERNAL,
+  WEIGHT
+};
+
+//! splitmix64 seeded by (seed, stream, index)
+class Random : public galois::SplitMix64 {
+public:
+  Random(Stream stream, uint64_t index)
+      : SplitMix64(galois::splitMix64(
+            galois::splitMix64(seed ^ galois::splitMix64(stream)) + index)) {}
+};
+
+//! concatenates the per-thread edges, adding reverses when asked, and sorts
+//! them into a simple graph
+static galois::LargeArray<Edge> collect(EdgeBuffer& edges, bool addReverse) {
+  unsigned numT = galois::getActiveThreads();
+  std::vector<size_t> offsets(numT + 1);
+  for (unsigned t = 0; t < numT; ++t)
+    offsets[t + 1] =
+        offsets[t] + edges.getRemote(t)->size() * (addReverse ? 2 : 1);
+  galois::LargeArray<Edge> all;
+  all.allocateBlocked(offsets.back());
+  galois::on_each([&](unsigned tid, unsigned) {
+    auto& local = *edges.getLocal();
+    Edge* out   = &all[0] + offsets[tid];
+    for (auto& e : local) {
+      *out++ = e;
+      if (addReverse)
+        *out++ = Edge{e.dst, e.src};
+    }
+    std::vector<Edge>().swap(local);
+  });
+
+  galois::ParallelSTL::sort(all.begin(), all.end());
+  auto last = galois::ParallelSTL::unique(all.begin(), all.end());
+  // self loops end up anywhere in the sorted order
+  galois::LargeArray<Edge> simple;
+  simple.allocateBlocked(last - all.begin());
+  auto end = galois::ParallelSTL::copy_if(
+      all.begin(), last, simple.begin(),
+      [](const Edge& e) { return e.src != e.dst; });
+  galois::LargeArray<Edge> result;
+  result.allocateBlocked(end - simple.begin());
+  galois::do_all(
+      galois::iterate(size_t(0), result.size()),
+      [&](size_t i) { result[i] = simple[i]; }, galois::no_stats());
+  return result;
+}
+
+//! a random permutation of [0, n)
+static galois::LargeArray<uint32_t> randomPermutation(uint32_t n) {
+  galois::LargeArray<std::pair<uint64_t, uint32_t>> keys;
+  keys.allocateBlocked(n);
+  galois::do_all(
+      galois::iterate(uint32_t(0), n),
+      [&](uint32_t i) { keys[i] = {Random(SCRAMBLE, i).next(), i}; },
+      galois::no_stats());
+  galois::ParallelSTL::sort(keys.begin(), keys.end());
+  galois::LargeArray<uint32_t> perm;
+  perm.allocateBlocked(n);
+  galois::do_all(
+      galois::iterate(uint32_t(0), n),
+      [&](uint32_t i) { perm[keys[i].second] = i; }, galois::no_stats());
+  return perm;
+}
+
+static galois::LargeArray<Edge> generateRMAT(uint32_t n) {
+  unsigned levels = 0;
+  while ((uint64_t(1) << levels) < n)
+    ++levels;
+  double ab  = rmatA + rmatB;
+  double abc = ab + rmatC;
+  auto perm  = randomPermutation(n);
+
+  EdgeBuffer edges;
+  galois::do_all(
+      galois::iterate(uint64_t(0), uint64_t(n * degree)),
+      [&](uint64_t e) {
+        Random r(RMAT_EDGE, e);
+        uint64_t src, dst;
+        // ids past n (n not a power of two) are drawn again
+        do {
+          src = dst = 0;
+          for (unsigned l = 0; l < levels; ++l) {
+            double p = r.real();
+            src      = src << 1 | (p >= ab);
+            dst      = dst << 1 | ((p >= rmatA && p < ab) || p >= abc);
+          }
+        } while (src >= n || dst >= n);
+        edges.getLocal()->push_back(Edge{perm[src], perm[dst]});
+      },
+      galois::loopname("RMAT"));
+  return collect(edges, symmetric);
+}
+
+static galois::LargeArray<Edge> generateER(uint32_t n) {
+  double p = n > 1 ? degree / (n - 1) : 0;
+  EdgeBuffer edges;
+  if (p <= 0)
+    return collect(edges, true);
+  // geometric skipping over the candidates v > u
+  double logq = std::log1p(-std::min(p, 1.0));
+  galois::do_all(
+      galois::iterate(uint32_t(0), n),
+      [&](uint32_t u) {
+        Random r(ER_NODE, u);
+        auto& local = *edges.getLocal();
+        for (uint64_t v = u;;) {
+          if (p >= 1)
+            ++v;
+          else
+            v += 1 + uint64_t(std::floor(std::log1p(-r.real()) / logq));
+          if (v >= n)
+            break;
+          local.push_back(Edge{u, uint32_t(v)});
+        }
+      },
+      galois::steal(), galois::loopname("ErdosRenyi"));
+  return collect(edges, true);
+}
+
+static galois::LargeArray<Edge> generateGrid(bool is3D) {
+  uint64_t total = uint64_t(width) * height * depth;
+  EdgeBuffer edges;
+  galois::do_all(
+      galois::iterate(uint64_t(0), total),
+      [&](uint64_t id) {
+        uint32_t x  = id % width;
+        uint32_t y  = id / width % height;
+        uint32_t z  = id / width / height;
+        auto& local = *edges.getLocal();
+        if (x + 1 < width)
+          local.push_back(Edge{uint32_t(id), uint32_t(id + 1)});
+        if (y + 1 < height)
+          local.push_back(Edge{uint32_t(id), uint32_t(id + width)});
+        if (is3D && z + 1 < depth)
+          local.push_back(
+              Edge{uint32_t(id), uint32_t(id + uint64_t(width) * height)});
+      },
+      galois::loopname("Grid"));
+  return collect(edges, true);
+}
+
+//! jittered position of a road node in grid units
+static std::pair<double, double> roadCoord(uint32_t id) {
+  Random r(ROAD_COORD, id);
+  double dx = r.real() - 0.5;
+  double dy = r.real() - 0.5;
+  return {id % width + 0.4 * dx, id / width + 0.4 * dy};
+}
+
+static galois::LargeArray<Edge> generateRoad() {
+  uint64_t total = uint64_t(width) * height;
+  EdgeBuffer edges;
+  galois::do_all(
+      galois::iterate(uint64_t(0), total),
+      [&](uint64_t id) {
+        uint32_t x  = id % width;
+        uint32_t y  = id / width;
+        uint32_t u  = id;
+        auto& local = *edges.getLocal();
+        Random r(ROAD_STREET, id);
+        bool east  = x + 1 < width && r.real() >= dropProb;
+        bool north = y + 1 < height && r.real() >= dropProb;
+        bool diag  = x + 1 < width && y + 1 < height &&
+                    r.real() < diagonalProb;
+        if (east)
+          local.push_back(Edge{u, u + 1});
+        if (north)
+          local.push_back(Edge{u, u + width});
+        if (diag)
+          local.push_back(Edge{u, u + width + 1});
+      },
+      galois::loopname("Road"));
+  return collect(edges, true);
+}
+
+/**
+ * Preferential attachment as a parallel copy model: edge e = u * m + j of
+ * node u picks a uniform position among the 2e endpoints of earlier edges.
+ * An even position is the source of that edge, which is known; an odd one is
+ * its target, which is resolved the same way. Picking an endpoint uniformly
+ * is picking a node proportionally to its degree.
+ */
+static galois::LargeArray<Edge> generateBA(uint32_t n) {
+  uint64_t m = std::max<uint64_t>(1, std::llround(degree / 2));
+  EdgeBuffer edges;
+  galois::do_all(
+      galois::iterate(uint64_t(0), uint64_t(n) * m),
+      [&](uint64_t e) {
+        uint64_t pos = 2 * e + 1;
+        while (pos & 1) {
+          uint64_t edge = pos / 2;
+          // the very first edge has nothing to attach to; use node 0
+          pos = edge ? Random(BA_EDGE, edge).below(2 * edge) : 0;
+        }
+        edges.getLocal()->push_back(
+            Edge{uint32_t(e / m), uint32_t(pos / 2 / m)});
+      },
+      galois::loopname("PreferentialAttachment"));
+  return collect(edges, true);
+}
+
+//! inverse CDF of a continuous power law with exponent exp on [lo, hi]
+static double powerLaw(double u, double lo, double hi, double exp) {
+  if (std::abs(exp - 1) < 1e-9)
+    return lo * std::pow(hi / lo, u);
+  double a = std::pow(lo, 1 - exp);
+  double b = std::pow(hi, 1 - exp);
+  return std::pow(a + u * (b - a), 1 / (1 - exp));
+}
+
+//! mean of the power law on [lo, hi]
+static double powerLawMean(double lo, double hi, double exp) {
+  const unsigned samples = 4096;
+  double sum             = 0;
+  for (unsigned i = 0; i < samples; ++i)
+    sum += powerLaw((i + 0.5) / samples, lo, hi, exp);
+  return sum / samples;
+}
+
+/**
+ * LFR-style benchmark: power-law degrees and community sizes, each node with
+ * about (1 - mu) of its edges inside its community. Internal edges pair up
+ * the stubs of each community at random, external edges pair up all
+ * remaining stubs at random and drop pairs within one community. Unlike the
+ * original LFR the degrees are not rewired afterwards, so removed duplicates
+ * make them slightly smaller than drawn.
+ */
+static galois::LargeArray<Edge> generateLFR(uint32_t n) {
+  double kmax = maxDegree ? double(maxDegree) : 4 * degree;
+  if (kmax > n - 1)
+    kmax = n - 1;
+  if (degree >= kmax)
+    GALOIS_DIE("-degree must be below the maximum degree ", kmax);
+  // smallest degree that gives the requested mean
+  double lo = 1, hi = degree;
+  for (unsigned i = 0; i < 50; ++i) {
+    double mid = (lo + hi) / 2;
+    (powerLawMean(mid, kmax, degreeExp) < degree ? lo : hi) = mid;
+  }
+  double kmin = lo;
+
+  galois::LargeArray<uint32_t> deg;
+  deg.allocateBlocked(n);
+  galois::do_all(
+      galois::iterate(uint32_t(0), n),
+      [&](uint32_t u) {
+        double k =
+            powerLaw(Random(LFR_DEGREE, u).real(), kmin, kmax, degreeExp);
+        deg[u] = std::max<uint32_t>(1, std::llround(k));
+      },
+      galois::no_stats());
+
+  // community sizes, drawn serially since there are few of them
+  uint32_t cmin = minCommunity ? uint32_t(minCommunity)
+                               : uint32_t(std::ceil(2 * degree));
+  uint32_t cmax = maxCommunity ? uint32_t(maxCommunity)
+                               : uint32_t(std::ceil(20 * degree));
+  cmax = std::min(cmax, n);
+  cmin = std::min(cmin, cmax);
+  std::vector<uint32_t> sizes;
+  for (uint64_t total = 0; total < n;) {
+    double s = powerLaw(Random(LFR_SIZE, sizes.size()).real(), cmin, cmax,
+                        communityExp);
+    sizes.push_back(std::llround(s));
+    total += sizes.back();
+    if (total > n)
+      sizes.back() -= total - n;
+  }
+  // a too small remainder joins the previous community
+  if (sizes.size() > 1 && sizes.back() < cmin) {
+    sizes[sizes.size() - 2] += sizes.back();
+    sizes.pop_back();
+  }
+  std::vector<uint64_t> firstMember(sizes.size() + 1, 0);
+  for (size_t c = 0; c < sizes.size(); ++c)
+    firstMember[c + 1] = firstMember[c] + sizes[c];
+
+  // members of community c are members[firstMember[c] ...]
+  galois::LargeArray<uint32_t> members = randomPermutation(n);
+  galois::LargeArray<uint32_t> community;
+  community.allocateBlocked(n);
+  galois::do_all(
+      galois::iterate(size_t(0), sizes.size()),
+      [&](size_t c) {
+        for (uint64_t i = firstMember[c]; i < firstMember[c + 1]; ++i)
+          community[members[i]] = c;
+      },
+      galois::no_stats());
+
+  galois::LargeArray<uint32_t> internal;
+  internal.allocateBlocked(n);
+  galois::do_all(
+      galois::iterate(uint32_t(0), n),
+      [&](uint32_t u) {
+        uint32_t k = std::llround((1 - mu) * deg[u]);
+        internal[u] = std::min(k, sizes[community[u]] - 1);
+      },
+      galois::no_stats());
+
+  EdgeBuffer edges;
+  galois::do_all(
+      galois::iterate(size_t(0), sizes.size()),
+      [&](size_t c) {
+        std::vector<uint32_t> stubs;
+        for (uint64_t i = firstMember[c]; i < firstMember[c + 1]; ++i)
+          stubs.insert(stubs.end(), internal[members[i]], members[i]);
+        std::mt19937_64 gen(Random(LFR_INTERNAL, c).next());
+        std::shuffle(stubs.begin(), stubs.end(), gen);
+        auto& local = *edges.getLocal();
+        for (size_t i = 0; i + 1 < stubs.size(); i += 2)
+          local.push_back(Edge{stubs[i], stubs[i + 1]});
+      },
+      galois::steal(), galois::loopname("LFRInternal"));
+
+  // external stubs of node u are stubs[offsets[u] ...]
+  galois::LargeArray<uint64_t> offsets;
+  offsets.allocateBlocked(n + 1);
+  galois::do_all(
+      galois::iterate(uint32_t(0), n),
+      [&](uint32_t u) {
+        offsets[u + 1] = deg[u] - std::min(deg[u], internal[u]);
+      },
+      galois::no_stats());
+  offsets[0] = 0;
+  galois::ParallelSTL::partial_sum(offsets.begin(), offsets.end(),
+                                   offsets.begin());
+  galois::LargeArray<std::pair<uint64_t, uint32_t>> stubs;
+  stubs.allocateBlocked(offsets[n]);
+  galois::do_all(
+      galois::iterate(uint32_t(0), n),
+      [&](uint32_t u) {
+        for (uint64_t i = offsets[u]; i < offsets[u + 1]; ++i)
+          stubs[i] = {Random(LFR_EXTERNAL, i).next(), u};
+      },
+      galois::no_stats());
+  galois::ParallelSTL::sort(stubs.begin(), stubs.end());
+  galois::do_all(
+      galois::iterate(size_t(0), stubs.size() / 2),
+      [&](size_t i) {
+        uint32_t u = stubs[2 * i].second;
+        uint32_t v = stubs[2 * i + 1].second;
+        if (community[u] != community[v])
+          edges.getLocal()->push_back(Edge{u, v});
+      },
+      galois::loopname("LFRExternal"));
+
+  std::cout << "Planted " << sizes.size() << " communities of "
+            << *std::min_element(sizes.begin(), sizes.end()) << " to "
+            << *std::max_element(sizes.begin(), sizes.end()) << " nodes\n";
+  if (!communitiesFilename.empty()) {
+    std::ofstream out(communitiesFilename);
+    if (!out)
+      GALOIS_DIE("failed to open ", communitiesFilename);
+    for (uint32_t u = 0; u < n; ++u)
+      out << community[u] << "\n";
+    if (!out)
+      GALOIS_DIE("failed to write ", communitiesFilename);
+  }
+  return collect(edges, true);
+}
+
+//! weight of the edge {u, v}; both directions get the same value
+template <typename EdgeTy>
+static EdgeTy weightOf(uint32_t u, uint32_t v) {
+  if (model == road) {
+    auto a = roadCoord(u);
+    auto b = roadCoord(v);
+    double d =
+        std::hypot(a.first - b.first, a.second - b.second) * (double)scale;
+    if constexpr (std::is_integral<EdgeTy>::value)
+      return EdgeTy(std::max<long long>(1, std::llround(d)));
+    else
+      return EdgeTy(d);
+  }
+  Random r(WEIGHT, uint64_t(std::min(u, v)) << 32 | std::max(u, v));
+  if constexpr (std::is_integral<EdgeTy>::value)
+    return EdgeTy(minWeight + r.below(uint64_t(maxWeight - minWeight) + 1));
+  else
+    return EdgeTy(minWeight + r.real() * (maxWeight - minWeight));
+}
+
+template <typename EdgeTy>
+static void writeGraph(size_t numNodes, const galois::LargeArray<Edge>& edges,
+                       const std::string& filename) {
+  galois::graphs::FileGraphWriter g;
+  galois::graphs::writeSortedEdges<EdgeTy>(
+      g, numNodes, edges.begin(), edges.end(),
+      [](const Edge& e) { return e.src; },
+      [](galois::graphs::FileGraphWriter& w, size_t n, const Edge& e) {
+        if constexpr (std::is_void<EdgeTy>::value)
+          w.addNeighbor(n, e.dst);
+        else
+          w.addNeighbor<EdgeTy>(n, e.dst, weightOf<EdgeTy>(e.src, e.dst));
+      });
+  auto meta = g.computeMetadata(
+      galois::graphs::GraphMetadata::typeOf<EdgeTy>());
+  g.toFile(filename);
+  galois::graphs::writeGraphMetadata(filename, meta);
+}
+
+int main(int argc, char** argv) {
+  galois::SharedMemSys G;
+  llvm::cl::ParseCommandLineOptions(argc, argv);
+  galois::setActiveThreads(numThreads);
+
+  uint64_t n = numNodes;
+  if (model == grid2d || model == grid3d || model == road) {
+    if (!width || !height || !depth)
+      GALOIS_DIE("grids need -width and -height (and -depth for 3D)");
+    n = uint64_t(width) * height * (model == grid3d ? uint64_t(depth) : 1);
+    if (model != grid3d)
+      depth = 1;
+  } else if (!n) {
+    GALOIS_DIE("-n must be positive");
+  }
+  if (n >= (uint64_t(1) << 32))
+    GALOIS_DIE("at most 2^32 - 1 nodes are supported");
+  if (!(degree > 0))
+    GALOIS_DIE("-degree must be positive");
+  if (model == rmat &&
+      !(rmatA >= 0 && rmatB >= 0 && rmatC >= 0 && rmatA + rmatB + rmatC <= 1))
+    GALOIS_DIE("-a, -b and -c must be probabilities summing to at most 1");
+  if (model == lfr && !(mu >= 0 && mu <= 1))
+    GALOIS_DIE("-mu must be in [0, 1]");
+  if (weightType != none && model != road && !(minWeight <= maxWeight))
+    GALOIS_DIE("-minWeight must not exceed -maxWeight");
+  if (symmetric && model != rmat)
+    std::cerr << "note: only R-MAT graphs can be non-symmetric\n";
+
+  galois::StatTimer genTimer("GenerateTime");
+  genTimer.start();
+  galois::LargeArray<Edge> edges;
+  switch (model) {
+  case rmat:
+    edges = generateRMAT(n);
+    break;
+  case er:
+    edges = generateER(n);
+    break;
+  case grid2d:
+  case grid3d:
+    edges = generateGrid(model == grid3d);
+    break;
+  case road:
+    edges = generateRoad();
+    break;
+  case ba:
+    edges = generateBA(n);
+    break;
+  case lfr:
+    edges = generateLFR(n);
+    break;
+  }
+  genTimer.stop();
+
+  galois::StatTimer writeTimer("WriteTime");
+  writeTimer.start();
+  if (weightType == uint32)
+    writeGraph<uint32_t>(n, edges, outputFilename);
+  else if (weightType == float32)
+    writeGraph<float>(n, edges, outputFilename);
+  else
+    writeGraph<void>(n, edges, outputFilename);
+  writeTimer.stop();
+  std::cout << "Wrote " << n << " nodes and " << edges.size() << " edges to "
+            << outputFilename << "\n";
+
+  return 0;
+}
@@ -0,0 +1,278 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+/**
+ * Builds the k-nearest-neighbor graph or the epsilon-radius graph of a point
+ * set and writes it as a Galois .gr file whose edge weights are the
+ * Euclidean distances.
+ */
+
+#include "galois/Galois.h"
+#include "galois/LargeArray.h"
+#include "galois/ParallelSTL.h"
+#include "galois/Timer.h"
+#include "galois/graphs/FileGraph.h"
+#include "galois/graphs/WriteGraph.h"
+#include "galois/graphs/KdTree.h"
+#include "galois/substrate/PerThreadStorage.h"
+
+#include "llvm/Support/CommandLine.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace cll = llvm::cl;
+
+enum PointFormat { text, fvecs };
+enum WeightType { float32, uint32 };
+
+static cll::opt<std::string>
+    inputFilename(cll::Positional, cll::desc("<points file>"), cll::Required);
+static cll::opt<std::string>
+    outputFilename(cll::Positional, cll::desc("<output .gr>"), cll::Required);
+static cll::opt<PointFormat> inputFormat(
+    "inputFormat", cll::desc("Format of the points file:"),
+    cll::values(clEnumVal(text, "One point per line, coordinates separated by "
+                                "spaces, tabs or commas (default)"),
+                clEnumVal(fvecs, "Each point is an int32 dimension followed "
+                                 "by that many float32 coordinates")),
+    cll::init(text));
+static cll::opt<unsigned> k("k", cll::desc("Connect each point to its k "
+                                           "nearest neighbors"),
+                            cll::init(0));
+static cll::opt<double>
+    radius("radius",
+           cll::desc("Connect all pairs of points within this distance"),
+           cll::init(0));
+static cll::opt<bool> symmetric(
+    "symmetric",
+    cll::desc("Also add the reverse of every kNN edge (radius graphs are "
+              "always symmetric)"),
+    cll::init(false));
+static cll::opt<WeightType> weightType(
+    "edgeType", cll::desc("Type of the edge weights:"),
+    cll::values(clEnumVal(float32, "Distances as float32 (default)"),
+                clEnumVal(uint32, "Distances times -scale, rounded to uint32")),
+    cll::init(float32));
+static cll::opt<double> scale("scale",
+                              cll::desc("Multiplier applied to distances for "
+                                        "-edgeType=uint32 (default 1)"),
+                              cll::init(1));
+static cll::opt<unsigned> leafSize("leafSize",
+                                   cll::desc("Points per k-d tree leaf "
+                                             "(default 16)"),
+                                   cll::init(16));
+static cll::opt<int> numThreads("t", cll::desc("Number of threads (default 1)"),
+                                cll::init(1));
+
+struct Edge {
+  uint32_t src;
+  uint32_t dst;
+  float dist;
+
+  bool operator<(const Edge& o) const {
+    return src < o.src || (src == o.src && dst < o.dst);
+  }
+  bool operator==(const Edge& o) const { return src == o.src && dst == o.dst; }
+};
+
+static bool isSeparator(char c) {
+  return c == ' ' || c == '\t' || c == ',' || c == '\r';
+}
+
+//! reads a text point file; the first point fixes the dimension
+static std::vector<float> readText(const std::string& filename,
+                                   unsigned& dims) {
+  std::ifstream in(filename);
+  if (!in)
+    GALOIS_DIE("failed to open ", filename);
+  std::vector<float> coords;
+  std::string line;
+  size_t lineNo = 0;
+  dims          = 0;
+  while (std::getline(in, line)) {
+    ++lineNo;
+    if (line.empty() || line[0] == '#' || line[0] == '%')
+      continue;
+    unsigned count = 0;
+    const char* p  = line.c_str();
+    while (true) {
+      while (isSeparator(*p))
+        ++p;
+      if (!*p)
+        break;
+      char* next;
+      float x = std::strtof(p, &next);
+      if (next == p)
+        GALOIS_DIE(filename, ":", lineNo, ": not a number");
+      coords.push_back(x);
+      ++count;
+      p = next;
+    }
+    if (count == 0)
+      continue;
+    if (!dims)
+      dims = count;
+    if (count != dims)
+      GALOIS_DIE(filename, ":", lineNo, ": expected ", dims,
+                 " coordinates, found ", count);
+  }
+  return coords;
+}
+
+static std::vector<float> readFvecs(const std::string& filename,
+                                    unsigned& dims) {
+  std::ifstream in(filename, std::ios::binary);
+  if (!in)
+    GALOIS_DIE("failed to open ", filename);
+  std::vector<float> coords;
+  dims = 0;
+  int32_t d;
+  while (in.read(reinterpret_cast<char*>(&d), sizeof(d))) {
+    if (d <= 0 || (dims && unsigned(d) != dims))
+      GALOIS_DIE(filename, ": bad dimension ", d, " at point ",
+                 dims ? coords.size() / dims : 0);
+    dims = d;
+    coords.resize(coords.size() + dims);
+    if (!in.read(reinterpret_cast<char*>(&coords[coords.size() - dims]),
+                 dims * sizeof(float)))
+      GALOIS_DIE(filename, ": truncated point");
+  }
+  return coords;
+}
+
+//! queries every point and gathers the edges, sorted by (src, dst)
+static galois::LargeArray<Edge>
+buildEdges(const galois::graphs::KdTree<float>& tree,
+           const std::vector<float>& coords) {
+  using Neighbor = galois::graphs::KdTree<float>::Neighbor;
+  galois::substrate::PerThreadStorage<std::vector<Edge>> edges;
+  galois::substrate::PerThreadStorage<std::vector<Neighbor>> scratch;
+  unsigned dims = tree.dims();
+  bool addReverse = k && symmetric;
+
+  galois::do_all(
+      galois::iterate(size_t(0), tree.size()),
+      [&](size_t i) {
+        auto& result   = *scratch.getLocal();
+        auto& local    = *edges.getLocal();
+        const float* q = &coords[i * dims];
+        if (k)
+          tree.knn(q, k, result, i);
+        else
+          tree.radius(q, radius, result, i);
+        for (auto& n : result) {
+          float d = std::sqrt(n.dist2);
+          local.push_back(Edge{uint32_t(i), n.id, d});
+          if (addReverse)
+            local.push_back(Edge{n.id, uint32_t(i), d});
+        }
+      },
+      galois::steal(), galois::loopname("Query"));
+
+  // concatenate the per-thread edges
+  std::vector<size_t> offsets(galois::getActiveThreads() + 1);
+  for (unsigned t = 0; t < galois::getActiveThreads(); ++t)
+    offsets[t + 1] = offsets[t] + edges.getRemote(t)->size();
+  galois::LargeArray<Edge> all;
+  all.allocateBlocked(offsets.back());
+  galois::on_each([&](unsigned tid, unsigned) {
+    auto& local = *edges.getLocal();
+    std::copy(local.begin(), local.end(), &all[0] + offsets[tid]);
+    std::vector<Edge>().swap(local);
+  });
+
+  galois::ParallelSTL::sort(all.begin(), all.end());
+  if (addReverse) {
+    // a mutual pair was added once from each side with the same distance
+    auto last = galois::ParallelSTL::unique(all.begin(), all.end());
+    galois::LargeArray<Edge> unique;
+    unique.allocateBlocked(last - all.begin());
+    galois::do_all(
+        galois::iterate(size_t(0), unique.size()),
+        [&](size_t i) { unique[i] = all[i]; }, galois::no_stats());
+    return unique;
+  }
+  return all;
+}
+
+template <typename EdgeTy>
+static void writeGraph(size_t numNodes, const galois::LargeArray<Edge>& edges,
+                       const std::string& filename) {
+  galois::graphs::FileGraphWriter g;
+  galois::graphs::writeSortedEdges<EdgeTy>(
+      g, numNodes, edges.begin(), edges.end(),
+      [](const Edge& e) { return e.src; },
+      [](galois::graphs::FileGraphWriter& w, size_t n, const Edge& e) {
+        if constexpr (std::is_same<EdgeTy, float>::value)
+          w.addNeighbor<EdgeTy>(n, e.dst, e.dist);
+        else
+          w.addNeighbor<EdgeTy>(n, e.dst, EdgeTy(std::llround(e.dist * scale)));
+      });
+  g.toFile(filename);
+}
+
+int main(int argc, char** argv) {
+  galois::SharedMemSys G;
+  llvm::cl::ParseCommandLineOptions(argc, argv);
+  galois::setActiveThreads(numThreads);
+
+  if (bool(k) == (radius > 0))
+    GALOIS_DIE("specify exactly one of -k and -radius");
+  if (symmetric && !k)
+    std::cerr << "note: -symmetric has no effect on radius graphs\n";
+  if (weightType == uint32 && !(scale > 0))
+    GALOIS_DIE("-scale must be positive");
+
+  unsigned dims;
+  std::vector<float> coords = inputFormat == fvecs
+                                  ? readFvecs(inputFilename, dims)
+                                  : readText(inputFilename, dims);
+  size_t numPoints = dims ? coords.size() / dims : 0;
+  if (numPoints == 0)
+    GALOIS_DIE("no points in ", inputFilename);
+  std::cout << "Read " << numPoints << " points with " << dims
+            << " dimensions\n";
+
+  galois::StatTimer buildTimer("BuildTime");
+  buildTimer.start();
+  galois::graphs::KdTree<float> tree;
+  tree.build(coords.data(), numPoints, dims, leafSize);
+  buildTimer.stop();
+
+  galois::StatTimer queryTimer("QueryTime");
+  queryTimer.start();
+  galois::LargeArray<Edge> edges = buildEdges(tree, coords);
+  queryTimer.stop();
+
+  if (weightType == float32)
+    writeGraph<float>(numPoints, edges, outputFilename);
+  else
+    writeGraph<uint32_t>(numPoints, edges, outputFilename);
+  std::cout << "Wrote " << numPoints << " nodes and " << edges.size()
+            << " edges to " << outputFilename << "\n";
+
+  return 0;
+}
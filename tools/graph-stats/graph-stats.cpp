@@ -18,13 +18,23 @@
  */
 
 #include "galois/Galois.h"
+#include "galois/AtomicHelpers.h"
+#include "galois/Bag.h"
+#include "galois/IndexedUnionFind.h"
+#include "galois/LargeArray.h"
+#include "galois/ParallelSTL.h"
+#include "galois/Reduction.h"
+#include "galois/graphs/FileGraph.h"
 #include "galois/graphs/LCGraph.h"
 #include "galois/graphs/OfflineGraph.h"
 
 #include "llvm/Support/CommandLine.h"
 
+#include <atomic>
+#include <cmath>
 #include <cstdlib>
 #include <iostream>
+#include <limits>
 #include <vector>
 
 namespace cll = llvm::cl;
@@ -37,7 +47,13 @@ enum StatMode {
   indegreehist,
   sortedlogoffsethist,
   sparsityPattern,
-  summary
+  summary,
+  clusteringCoefficient,
+  componentHist,
+  sccHist,
+  diameter,
+  degeneracy,
+  powerLaw
 };
 
 static cll::opt<std::string>
@@ -53,11 +69,39 @@ static cll::list<StatMode> statModeList(
                           "Histogram of neighbor offsets with sorted edges"),
                 clEnumVal(sparsityPattern, "Pattern of non-zeros when graph is "
                                            "interpreted as a sparse matrix"),
-                clEnumVal(summary, "Graph summary")));
+                clEnumVal(summary, "Graph summary"),
+                clEnumVal(clusteringCoefficient,
+                          "Global and average local clustering coefficient"),
+                clEnumVal(componentHist,
+                          "Size distribution of (weakly) connected components"),
+                clEnumVal(sccHist,
+                          "Size distribution of strongly connected components"),
+                clEnumVal(diameter, "Approximate diameter and eccentricity "
+                                    "estimate by repeated BFS sweeps"),
+                clEnumVal(degeneracy, "Degeneracy (max core number)"),
+                clEnumVal(powerLaw,
+                          "Power-law exponent fit of the out-degree "
+                          "distribution")));
 static cll::opt<int> numBins("numBins", cll::desc("Number of bins"),
                              cll::init(-1));
 static cll::opt<int> columns("columns", cll::desc("Columns for sparsity"),
                              cll::init(80));
+static cll::opt<int> numThreads("t", cll::desc("Number of threads (default 1)"),
+                                cll::init(1));
+static cll::opt<bool> symmetricInput(
+    "symmetricGraph",
+    cll::desc("Input graph is symmetric: skip symmetrization for the "
+              "undirected structural stats"),
+    cll::init(false));
+static cll::opt<unsigned> diameterSweeps(
+    "diameterSweeps",
+    cll::desc("Number of BFS sweeps for the diameter estimate (default 4)"),
+    cll::init(4));
+static cll::opt<unsigned> powerLawMinTail(
+    "powerLawMinTail",
+    cll::desc("Minimum number of nodes in the tail of the degree "
+              "distribution when fitting the power-law exponent (default 50)"),
+    cll::init(50));
 
 typedef galois::graphs::OfflineGraph Graph;
 typedef Graph::GraphNode GNode;
@@ -139,25 +183,58 @@ void doSparsityPattern(Graph& graph,
   }
 }
 
-void doDegreeHistogram(Graph& graph) {
+/**
+ * Histogram of key(x) over [first, last) as the sparse map printHistogram
+ * takes. Keys must be below numBins.
+ */
+template <typename It, typename KeyFn>
+std::map<uint64_t, uint64_t> countKeys(It first, It last, uint64_t numBins,
+                                       KeyFn key) {
+  std::vector<uint64_t> counts(numBins);
+  galois::ParallelSTL::histogram(first, last, numBins, counts.begin(), key);
   std::map<uint64_t, uint64_t> hist;
-  for (auto ii : graph) {
-    ++hist[std::distance(graph.edge_begin(ii), graph.edge_end(ii))];
+  for (uint64_t b = 0; b < numBins; ++b) {
+    if (counts[b]) {
+      hist.emplace_hint(hist.end(), b, counts[b]);
+    }
   }
+  return hist;
+}
+
+uint64_t maxValue(const std::vector<uint64_t>& v) {
+  galois::GReduceMax<uint64_t> max;
+  galois::do_all(galois::iterate(v), [&](uint64_t x) { max.update(x); },
+                 galois::no_stats());
+  return max.reduce();
+}
+
+void doDegreeHistogram(galois::graphs::FileGraph& graph) {
+  std::vector<uint64_t> degrees(graph.size());
+  galois::do_all(
+      galois::iterate(graph),
+      [&](uint64_t n) {
+        degrees[n] = std::distance(graph.edge_begin(n), graph.edge_end(n));
+      },
+      galois::no_stats());
+  auto hist = countKeys(degrees.begin(), degrees.end(), maxValue(degrees) + 1,
+                        [](uint64_t d) { return d; });
   printHistogram("Degree", hist);
 }
 
-void doInDegreeHistogram(Graph& graph) {
+//! in-degree of every node, counted in parallel over the edge array
+std::vector<uint64_t> inDegrees(galois::graphs::FileGraph& graph) {
+  using EdgeIt = galois::graphs::FileGraph::edge_iterator;
   std::vector<uint64_t> inv(graph.size());
-  std::map<uint64_t, uint64_t> hist;
-  for (auto ii : graph) {
-    for (auto jj : graph.edges(ii)) {
-      ++inv[graph.getEdgeDst(jj)];
-    }
-  }
-  for (uint64_t n : inv) {
-    ++hist[n];
-  }
+  galois::ParallelSTL::histogram(
+      EdgeIt(0), EdgeIt(graph.sizeEdges()), graph.size(), inv.begin(),
+      [&](uint64_t e) { return graph.getEdgeDst(EdgeIt(e)); });
+  return inv;
+}
+
+void doInDegreeHistogram(galois::graphs::FileGraph& graph) {
+  std::vector<uint64_t> inv = inDegrees(graph);
+  auto hist = countKeys(inv.begin(), inv.end(), maxValue(inv) + 1,
+                        [](uint64_t d) { return d; });
   printHistogram("InDegree", hist);
 }
 
@@ -229,24 +306,714 @@ void doSortedLogOffsetHistogram(Graph& GALOIS_UNUSED(graph)) {
   // printHistogram("LogOffset", hists);
 }
 
-void doDestinationHistogram(Graph& graph) {
+void doDestinationHistogram(galois::graphs::FileGraph& graph) {
+  std::vector<uint64_t> inv = inDegrees(graph);
   std::map<uint64_t, uint64_t> hist;
-  for (auto ii : graph) {
-    for (auto jj : graph.edges(ii)) {
-      ++hist[graph.getEdgeDst(jj)];
+  for (uint64_t n = 0; n < inv.size(); ++n) {
+    if (inv[n]) {
+      hist.emplace_hint(hist.end(), n, inv[n]);
     }
   }
   printHistogram("DestinationBin", hist);
 }
 
+/*******************************************************************************
+ * Structural stats
+ *
+ * These operate in parallel on the memory-mapped FileGraph. Stats that treat
+ * the graph as undirected first build a compact symmetric CSR (sorted, no self
+ * loops or duplicate edges) over 32-bit node ids.
+ ******************************************************************************/
+
+typedef galois::graphs::FileGraph FGraph;
+
+static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+//! Compact in-memory CSR with sorted, deduplicated adjacency lists
+struct CompactCSR {
+  galois::LargeArray<uint64_t> offsets;
+  galois::LargeArray<uint32_t> dsts;
+
+  size_t size() const { return offsets.size() - 1; }
+  size_t sizeEdges() const { return dsts.size(); }
+  uint64_t degree(uint32_t n) const { return offsets[n + 1] - offsets[n]; }
+  const uint32_t* begin(uint32_t n) const { return &dsts[offsets[n]]; }
+  const uint32_t* end(uint32_t n) const { return &dsts[offsets[n + 1]]; }
+};
+
+enum class EdgeDir { Out, In, Both };
+
+/**
+ * Builds a compact CSR of the out-edges, in-edges (transpose) or both
+ * (symmetrization) of a file graph. Self loops and duplicate edges are
+ * dropped.
+ */
+void buildCompactCSR(FGraph& graph, EdgeDir dir, CompactCSR& out) {
+  size_t numNodes = graph.size();
+  if (numNodes >= NONE) {
+    GALOIS_DIE("structural stats require fewer than 2^32 nodes");
+  }
+
+  std::vector<std::atomic<uint64_t>> counts(numNodes);
+  galois::do_all(
+      galois::iterate(graph),
+      [&](FGraph::GraphNode src) {
+        for (auto e : graph.edges(src)) {
+          auto dst = graph.getEdgeDst(e);
+          if (src == dst) {
+            continue;
+          }
+          if (dir != EdgeDir::In) {
+            counts[src].fetch_add(1, std::memory_order_relaxed);
+          }
+          if (dir != EdgeDir::Out) {
+            counts[dst].fetch_add(1, std::memory_order_relaxed);
+          }
+        }
+      },
+      galois::steal(), galois::no_stats());
+
+  galois::LargeArray<uint64_t> rawOffsets;
+  rawOffsets.allocateInterleaved(numNodes + 1);
+  rawOffsets[0] = 0;
+  galois::do_all(
+      galois::iterate(size_t{0}, numNodes),
+      [&](size_t n) { rawOffsets[n + 1] = counts[n].load(); },
+      galois::no_stats());
+  galois::ParallelSTL::partial_sum(rawOffsets.begin(), rawOffsets.end(),
+                                   rawOffsets.begin());
+
+  // reuse counts as insertion cursors
+  galois::do_all(
+      galois::iterate(size_t{0}, numNodes),
+      [&](size_t n) { counts[n] = rawOffsets[n]; }, galois::no_stats());
+
+  galois::LargeArray<uint32_t> rawDsts;
+  rawDsts.allocateInterleaved(rawOffsets[numNodes]);
+  galois::do_all(
+      galois::iterate(graph),
+      [&](FGraph::GraphNode src) {
+        for (auto e : graph.edges(src)) {
+          auto dst = graph.getEdgeDst(e);
+          if (src == dst) {
+            continue;
+          }
+          if (dir != EdgeDir::In) {
+            rawDsts[counts[src].fetch_add(1, std::memory_order_relaxed)] = dst;
+          }
+          if (dir != EdgeDir::Out) {
+            rawDsts[counts[dst].fetch_add(1, std::memory_order_relaxed)] = src;
+          }
+        }
+      },
+      galois::steal(), galois::no_stats());
+
+  // sort and deduplicate each list; record the new degree
+  out.offsets.allocateInterleaved(numNodes + 1);
+  out.offsets[0] = 0;
+  galois::do_all(
+      galois::iterate(size_t{0}, numNodes),
+      [&](size_t n) {
+        uint32_t* b = &rawDsts[rawOffsets[n]];
+        uint32_t* e = &rawDsts[rawOffsets[n + 1]];
+        std::sort(b, e);
+        out.offsets[n + 1] = std::distance(b, std::unique(b, e));
+      },
+      galois::steal(), galois::no_stats());
+  galois::ParallelSTL::partial_sum(out.offsets.begin(), out.offsets.end(),
+                                   out.offsets.begin());
+
+  out.dsts.allocateInterleaved(out.offsets[numNodes]);
+  galois::do_all(
+      galois::iterate(size_t{0}, numNodes),
+      [&](size_t n) {
+        std::copy(&rawDsts[rawOffsets[n]],
+                  &rawDsts[rawOffsets[n] + (out.offsets[n + 1] - out.offsets[n])],
+                  &out.dsts[out.offsets[n]]);
+      },
+      galois::steal(), galois::no_stats());
+}
+
+//! Undirected view of the input; no transpose is needed for symmetric inputs
+void buildUndirected(FGraph& graph, CompactCSR& out) {
+  buildCompactCSR(graph, symmetricInput ? EdgeDir::Out : EdgeDir::Both, out);
+}
+
+/**
+ * Level-synchronous parallel BFS from src over nodes accepted by filter.
+ * Writes levels into dist (which must be NONE for unvisited nodes).
+ *
+ * @returns pair of eccentricity of src and the smallest node id in the last
+ * level
+ */
+template <typename Filter>
+std::pair<uint32_t, uint32_t>
+bfsLevels(const CompactCSR& graph, uint32_t src,
+          std::vector<std::atomic<uint32_t>>& dist, Filter filter) {
+  galois::InsertBag<uint32_t> bags[2];
+  galois::InsertBag<uint32_t>* cur  = &bags[0];
+  galois::InsertBag<uint32_t>* next = &bags[1];
+
+  dist[src]          = 0;
+  uint32_t level     = 0;
+  uint32_t farthest  = src;
+  cur->push(src);
+
+  while (true) {
+    galois::do_all(
+        galois::iterate(*cur),
+        [&](uint32_t n) {
+          for (auto ii = graph.begin(n), ei = graph.end(n); ii != ei; ++ii) {
+            uint32_t dst = *ii;
+            uint32_t old = NONE;
+            if (dist[dst].load(std::memory_order_relaxed) == NONE &&
+                filter(dst) &&
+                dist[dst].compare_exchange_strong(old, level + 1)) {
+              next->push(dst);
+            }
+          }
+        },
+        galois::steal(), galois::no_stats());
+
+    if (next->empty()) {
+      break;
+    }
+    galois::GReduceMin<uint32_t> minNode;
+    galois::do_all(
+        galois::iterate(*next), [&](uint32_t n) { minNode.update(n); },
+        galois::no_stats());
+    farthest = minNode.reduce();
+    ++level;
+    cur->clear();
+    std::swap(cur, next);
+  }
+
+  return std::make_pair(level, farthest);
+}
+
+void doClusteringCoefficient(FGraph& fgraph) {
+  CompactCSR graph;
+  buildUndirected(fgraph, graph);
+  size_t numNodes = graph.size();
+
+  // orient edges from lower to higher (degree, id) rank so each triangle is
+  // found exactly once
+  auto lowerRank = [&](uint32_t a, uint32_t b) {
+    uint64_t da = graph.degree(a);
+    uint64_t db = graph.degree(b);
+    return da < db || (da == db && a < b);
+  };
+
+  std::vector<std::atomic<uint64_t>> triangles(numNodes);
+  galois::GAccumulator<uint64_t> totalTriangles;
+
+  galois::do_all(
+      galois::iterate(size_t{0}, numNodes),
+      [&](size_t n) {
+        uint32_t u = n;
+        for (auto vi = graph.begin(u), ve = graph.end(u); vi != ve; ++vi) {
+          uint32_t v = *vi;
+          if (!lowerRank(u, v)) {
+            continue;
+          }
+          // sorted-list intersection of N(u) and N(v), keeping w above v
+          auto ui = graph.begin(u), ue = graph.end(u);
+          auto wi = graph.begin(v), we = graph.end(v);
+          while (ui != ue && wi != we) {
+            if (*ui < *wi) {
+              ++ui;
+            } else if (*wi < *ui) {
+              ++wi;
+            } else {
+              uint32_t w = *ui;
+              if (lowerRank(v, w)) {
+                totalTriangles += 1;
+                triangles[u].fetch_add(1, std::memory_order_relaxed);
+                triangles[v].fetch_add(1, std::memory_order_relaxed);
+                triangles[w].fetch_add(1, std::memory_order_relaxed);
+              }
+              ++ui;
+              ++wi;
+            }
+          }
+        }
+      },
+      galois::steal(), galois::chunk_size<64>(),
+      galois::loopname("ClusteringTriangles"));
+
+  galois::GAccumulator<uint64_t> wedges;
+  galois::GAccumulator<double> localSum;
+  galois::GAccumulator<uint64_t> eligible;
+  galois::do_all(
+      galois::iterate(size_t{0}, numNodes),
+      [&](size_t n) {
+        uint64_t d = graph.degree(n);
+        if (d < 2) {
+          return;
+        }
+        uint64_t w = d * (d - 1) / 2;
+        wedges += w;
+        eligible += 1;
+        localSum += static_cast<double>(triangles[n].load()) / w;
+      },
+      galois::no_stats());
+
+  uint64_t t = totalTriangles.reduce();
+  uint64_t w = wedges.reduce();
+  double l   = localSum.reduce();
+  uint64_t k = eligible.reduce();
+  std::cout << "NumTriangles: " << t << "\n";
+  std::cout << "NumWedges: " << w << "\n";
+  std::cout << "GlobalClusteringCoefficient: "
+            << (w ? 3.0 * t / static_cast<double>(w) : 0.0) << "\n";
+  std::cout << "AverageClusteringCoefficient: "
+            << (numNodes ? l / numNodes : 0.0) << "\n";
+  std::cout << "AverageClusteringCoefficientDegreeAtLeast2: "
+            << (k ? l / k : 0.0) << "\n";
+}
+
+//! Prints count, largest and the sparse size distribution of a set of sizes
+void printSizeDistribution(const std::string& name,
+                           std::vector<uint64_t>& sizes, uint64_t numNodes) {
+  galois::ParallelSTL::sort(sizes.begin(), sizes.end());
+  uint64_t largest = sizes.empty() ? 0 : sizes.back();
+  std::cout << "Num" << name << "s: " << sizes.size() << "\n";
+  std::cout << "Largest" << name << ": " << largest << "\n";
+  std::cout << "Largest" << name << "Fraction: "
+            << (numNodes ? static_cast<double>(largest) / numNodes : 0.0)
+            << "\n";
+  std::cout << name << "Size,Count\n";
+  for (auto ii = sizes.begin(), ei = sizes.end(); ii != ei;) {
+    auto next = std::upper_bound(ii, ei, *ii);
+    std::cout << *ii << ',' << std::distance(ii, next) << '\n';
+    ii = next;
+  }
+}
+
+//! Collects the sizes of all groups given a per-node representative label
+template <typename LabelArray>
+void collectGroupSizes(const LabelArray& label, std::vector<uint64_t>& sizes) {
+  size_t numNodes = label.size();
+  std::vector<std::atomic<uint64_t>> counts(numNodes);
+  galois::do_all(
+      galois::iterate(size_t{0}, numNodes),
+      [&](size_t n) {
+        counts[uint32_t(label[n])].fetch_add(1, std::memory_order_relaxed);
+      },
+      galois::no_stats());
+
+  galois::InsertBag<uint64_t> bag;
+  galois::do_all(
+      galois::iterate(size_t{0}, numNodes),
+      [&](size_t n) {
+        if (counts[n].load()) {
+          bag.push(counts[n].load());
+        }
+      },
+      galois::no_stats());
+  sizes.assign(bag.begin(), bag.end());
+}
+
+void doComponentHistogram(FGraph& graph) {
+  size_t numNodes = graph.size();
+  if (numNodes >= NONE) {
+    GALOIS_DIE("structural stats require fewer than 2^32 nodes");
+  }
+
+  // weak connectivity ignores direction, so union directly over out-edges
+  galois::IndexedUnionFind<uint32_t> uf(numNodes);
+  galois::do_all(
+      galois::iterate(graph),
+      [&](FGraph::GraphNode src) {
+        for (auto e : graph.edges(src)) {
+          uf.unite(src, graph.getEdgeDst(e));
+        }
+      },
+      galois::steal(), galois::loopname("ComponentUnion"));
+  auto labels = uf.finalize(galois::uf::Labels::Root);
+
+  std::vector<uint64_t> sizes;
+  collectGroupSizes(labels, sizes);
+  printSizeDistribution("Component", sizes, numNodes);
+}
+
+/**
+ * Strongly connected components by trimming, one forward-backward
+ * reachability step from a high-degree pivot to peel the giant component, and
+ * repeated max-color propagation with backward confirmation for the rest.
+ */
+void doSCCHistogram(FGraph& fgraph) {
+  CompactCSR out, in;
+  buildCompactCSR(fgraph, EdgeDir::Out, out);
+  buildCompactCSR(fgraph, EdgeDir::In, in);
+  size_t numNodes = out.size();
+
+  std::vector<std::atomic<uint32_t>> scc(numNodes);
+  galois::do_all(
+      galois::iterate(size_t{0}, numNodes), [&](size_t n) { scc[n] = NONE; },
+      galois::no_stats());
+  auto alive = [&](uint32_t n) { return scc[n].load() == NONE; };
+
+  // trim nodes without live in- or out-neighbors: they are singleton SCCs
+  auto hasLive = [&](const CompactCSR& g, uint32_t n) {
+    for (auto ii = g.begin(n), ei = g.end(n); ii != ei; ++ii) {
+      if (alive(*ii)) {
+        return true;
+      }
+    }
+    return false;
+  };
+  auto trim = [&]() {
+    bool changed = true;
+    while (changed) {
+      galois::GReduceLogicalOr trimmed;
+      galois::do_all(
+          galois::iterate(size_t{0}, numNodes),
+          [&](size_t n) {
+            if (alive(n) && (!hasLive(out, n) || !hasLive(in, n))) {
+              scc[n] = n;
+              trimmed.update(true);
+            }
+          },
+          galois::steal(), galois::loopname("SCCTrim"));
+      changed = trimmed.reduce();
+    }
+  };
+  trim();
+
+  // forward-backward from the live node with the largest in*out degree
+  galois::GReduceMax<std::pair<uint64_t, uint32_t>> pivotReduce;
+  galois::do_all(
+      galois::iterate(size_t{0}, numNodes),
+      [&](size_t n) {
+        if (alive(n)) {
+          pivotReduce.update(
+              std::make_pair(out.degree(n) * in.degree(n), uint32_t(n)));
+        }
+      },
+      galois::no_stats());
+  auto pivot = pivotReduce.reduce();
+  if (pivot.first) {
+    std::vector<std::atomic<uint32_t>> fw(numNodes), bw(numNodes);
+    galois::do_all(
+        galois::iterate(size_t{0}, numNodes),
+        [&](size_t n) {
+          fw[n] = NONE;
+          bw[n] = NONE;
+        },
+        galois::no_stats());
+    bfsLevels(out, pivot.second, fw, alive);
+    bfsLevels(in, pivot.second, bw, alive);
+    galois::do_all(
+        galois::iterate(size_t{0}, numNodes),
+        [&](size_t n) {
+          if (fw[n] != NONE && bw[n] != NONE) {
+            scc[n] = pivot.second;
+          }
+        },
+        galois::no_stats());
+    trim();
+  }
+
+  // coloring for the remainder
+  std::vector<std::atomic<uint32_t>> color(numNodes);
+  while (true) {
+    galois::InsertBag<uint32_t> live;
+    galois::do_all(
+        galois::iterate(size_t{0}, numNodes),
+        [&](size_t n) {
+          if (alive(n)) {
+            color[n] = n;
+            live.push(n);
+          }
+        },
+        galois::no_stats());
+    if (live.empty()) {
+      break;
+    }
+
+    galois::for_each(
+        galois::iterate(live),
+        [&](uint32_t n, auto& ctx) {
+          uint32_t c = color[n].load();
+          for (auto ii = out.begin(n), ei = out.end(n); ii != ei; ++ii) {
+            uint32_t dst = *ii;
+            if (alive(dst) && color[dst].load() < c &&
+                galois::atomicMax(color[dst], c) < c) {
+              ctx.push(dst);
+            }
+          }
+        },
+        galois::disable_conflict_detection(), galois::chunk_size<64>(),
+        galois::loopname("SCCColor"));
+
+    galois::InsertBag<uint32_t> roots;
+    galois::do_all(
+        galois::iterate(live),
+        [&](uint32_t n) {
+          if (color[n].load() == n) {
+            roots.push(n);
+          }
+        },
+        galois::no_stats());
+    galois::do_all(
+        galois::iterate(roots), [&](uint32_t n) { scc[n] = n; },
+        galois::no_stats());
+
+    galois::for_each(
+        galois::iterate(roots),
+        [&](uint32_t n, auto& ctx) {
+          uint32_t c = color[n].load();
+          for (auto ii = in.begin(n), ei = in.end(n); ii != ei; ++ii) {
+            uint32_t src      = *ii;
+            uint32_t expected = NONE;
+            if (color[src].load() == c &&
+                scc[src].compare_exchange_strong(expected, c)) {
+              ctx.push(src);
+            }
+          }
+        },
+        galois::disable_conflict_detection(), galois::chunk_size<64>(),
+        galois::loopname("SCCBackward"));
+  }
+
+  std::vector<uint64_t> sizes;
+  collectGroupSizes(scc, sizes);
+  printSizeDistribution("SCC", sizes, numNodes);
+}
+
+/**
+ * Estimates the diameter of the component containing the max-degree node by
+ * repeated BFS sweeps, each starting from the farthest node of the previous
+ * one. Every sweep's eccentricity e gives e <= diameter <= 2e.
+ */
+void doDiameter(FGraph& fgraph) {
+  CompactCSR graph;
+  buildUndirected(fgraph, graph);
+  size_t numNodes = graph.size();
+  if (!numNodes) {
+    return;
+  }
+
+  galois::GReduceMax<std::pair<uint64_t, uint32_t>> maxDegree;
+  galois::do_all(
+      galois::iterate(size_t{0}, numNodes),
+      [&](size_t n) {
+        // prefer the smaller id on ties
+        maxDegree.update(std::make_pair(graph.degree(n), NONE - uint32_t(n)));
+      },
+      galois::no_stats());
+  uint32_t source = NONE - maxDegree.reduce().second;
+
+  std::vector<std::atomic<uint32_t>> dist(numNodes);
+  uint32_t lower = 0;
+  uint32_t upper = NONE;
+  uint64_t reached = 0;
+  std::cout << "Sweep,Source,Eccentricity\n";
+  for (unsigned sweep = 0; sweep < diameterSweeps; ++sweep) {
+    galois::do_all(
+        galois::iterate(size_t{0}, numNodes), [&](size_t n) { dist[n] = NONE; },
+        galois::no_stats());
+    auto r = bfsLevels(graph, source, dist, [](uint32_t) { return true; });
+    std::cout << sweep << ',' << source << ',' << r.first << '\n';
+
+    if (sweep == 0) {
+      reached = galois::ParallelSTL::count_if(
+          dist.begin(), dist.end(),
+          [](const std::atomic<uint32_t>& d) { return d.load() != NONE; });
+    }
+    upper = std::min<uint64_t>(upper, 2 * uint64_t(r.first));
+    if (r.first <= lower && sweep != 0) {
+      break;
+    }
+    lower  = std::max(lower, r.first);
+    source = r.second;
+  }
+  std::cout << "DiameterComponentSize: " << reached << "\n";
+  std::cout << "DiameterLowerBound: " << lower << "\n";
+  std::cout << "DiameterUpperBound: " << upper << "\n";
+}
+
+//! Degeneracy by parallel peeling: each round removes every node whose
+//! remaining degree is at most the current core level k.
+void doDegeneracy(FGraph& fgraph) {
+  CompactCSR graph;
+  buildUndirected(fgraph, graph);
+  size_t numNodes = graph.size();
+
+  std::vector<std::atomic<uint32_t>> degree(numNodes);
+  std::vector<std::atomic<uint32_t>> core(numNodes);
+  galois::do_all(
+      galois::iterate(size_t{0}, numNodes),
+      [&](size_t n) {
+        degree[n] = graph.degree(n);
+        core[n]   = NONE;
+      },
+      galois::no_stats());
+
+  uint32_t k         = 0;
+  uint64_t remaining = numNodes;
+  galois::InsertBag<uint32_t> bags[2];
+  while (remaining) {
+    galois::GReduceMin<uint32_t> minDegree;
+    galois::do_all(
+        galois::iterate(size_t{0}, numNodes),
+        [&](size_t n) {
+          if (core[n].load() == NONE) {
+            minDegree.update(degree[n].load());
+          }
+        },
+        galois::no_stats());
+    k = std::max(k, minDegree.reduce());
+
+    galois::InsertBag<uint32_t>* cur  = &bags[0];
+    galois::InsertBag<uint32_t>* next = &bags[1];
+    cur->clear();
+    galois::do_all(
+        galois::iterate(size_t{0}, numNodes),
+        [&](size_t n) {
+          if (core[n].load() == NONE && degree[n].load() <= k) {
+            core[n] = k;
+            cur->push(n);
+          }
+        },
+        galois::no_stats());
+
+    while (!cur->empty()) {
+      galois::GAccumulator<uint64_t> removed;
+      next->clear();
+      galois::do_all(
+          galois::iterate(*cur),
+          [&](uint32_t n) {
+            removed += 1;
+            for (auto ii = graph.begin(n), ei = graph.end(n); ii != ei; ++ii) {
+              uint32_t dst = *ii;
+              if (core[dst].load() != NONE) {
+                continue;
+              }
+              // exactly one decrement crosses the threshold
+              if (degree[dst].fetch_sub(1) == k + 1) {
+                uint32_t expected = NONE;
+                if (core[dst].compare_exchange_strong(expected, k)) {
+                  next->push(dst);
+                }
+              }
+            }
+          },
+          galois::steal(), galois::loopname("DegeneracyPeel"));
+      remaining -= removed.reduce();
+      std::swap(cur, next);
+    }
+  }
+
+  uint64_t maxCoreSize = galois::ParallelSTL::count_if(
+      core.begin(), core.end(),
+      [&](const std::atomic<uint32_t>& c) { return c.load() == k; });
+  std::cout << "Degeneracy: " << (numNodes ? k : 0) << "\n";
+  std::cout << "MaxCoreSize: " << (numNodes ? maxCoreSize : 0) << "\n";
+}
+
+/**
+ * Fits a discrete power law to the out-degree distribution: the exponent is
+ * the approximate MLE for each candidate minimum degree, and the candidate
+ * with the smallest Kolmogorov-Smirnov distance wins.
+ */
+void doPowerLaw(FGraph& graph) {
+  galois::GReduceMax<uint64_t> maxDegreeReduce;
+  galois::do_all(
+      galois::iterate(graph),
+      [&](FGraph::GraphNode n) {
+        maxDegreeReduce.update(
+            std::distance(graph.edge_begin(n), graph.edge_end(n)));
+      },
+      galois::no_stats());
+  uint64_t maxDegree = maxDegreeReduce.reduce();
+
+  std::vector<std::atomic<uint64_t>> hist(maxDegree + 1);
+  galois::do_all(
+      galois::iterate(graph),
+      [&](FGraph::GraphNode n) {
+        hist[std::distance(graph.edge_begin(n), graph.edge_end(n))].fetch_add(
+            1, std::memory_order_relaxed);
+      },
+      galois::no_stats());
+
+  std::vector<std::pair<uint64_t, uint64_t>> counts;
+  for (uint64_t d = 1; d <= maxDegree; ++d) {
+    if (hist[d].load()) {
+      counts.emplace_back(d, hist[d].load());
+    }
+  }
+  // tail[i] is the number of nodes with degree >= counts[i].first
+  std::vector<uint64_t> tail(counts.size() + 1, 0);
+  for (size_t i = counts.size(); i > 0; --i) {
+    tail[i - 1] = tail[i] + counts[i - 1].second;
+  }
+
+  std::vector<double> alphas(counts.size(), 0.0);
+  std::vector<double> distances(counts.size(),
+                                std::numeric_limits<double>::infinity());
+  galois::do_all(
+      galois::iterate(size_t{0}, counts.size()),
+      [&](size_t i) {
+        uint64_t n = tail[i];
+        if (n < powerLawMinTail) {
+          return;
+        }
+        double xmin = counts[i].first - 0.5;
+        double sum  = 0;
+        for (size_t j = i; j < counts.size(); ++j) {
+          sum += counts[j].second * std::log(counts[j].first / xmin);
+        }
+        if (sum <= 0) {
+          return;
+        }
+        double alpha = 1 + n / sum;
+        double ks    = 0;
+        uint64_t cum = 0;
+        for (size_t j = i; j < counts.size(); ++j) {
+          cum += counts[j].second;
+          double empirical = static_cast<double>(cum) / n;
+          double model =
+              1 - std::pow((counts[j].first + 0.5) / xmin, 1 - alpha);
+          ks = std::max(ks, std::fabs(empirical - model));
+        }
+        alphas[i]    = alpha;
+        distances[i] = ks;
+      },
+      galois::steal(), galois::no_stats());
+
+  auto best = std::min_element(distances.begin(), distances.end());
+  if (best == distances.end() || std::isinf(*best)) {
+    std::cout << "PowerLaw: not enough nodes in the tail (powerLawMinTail="
+              << powerLawMinTail << ")\n";
+    return;
+  }
+  size_t i = std::distance(distances.begin(), best);
+  std::cout << "PowerLawAlpha: " << alphas[i] << "\n";
+  std::cout << "PowerLawMinDegree: " << counts[i].first << "\n";
+  std::cout << "PowerLawTailSize: " << tail[i] << "\n";
+  std::cout << "PowerLawKSDistance: " << *best << "\n";
+}
+
 int main(int argc, char** argv) {
+  galois::SharedMemSys G;
   llvm::cl::ParseCommandLineOptions(argc, argv);
+  galois::setActiveThreads(numThreads);
   try {
     Graph graph(inputfilename);
+    // the structural stats share one memory-mapped view of the input
+    FGraph fgraph;
+    auto mapped = [&]() -> FGraph& {
+      if (!fgraph.size() && graph.size()) {
+        fgraph.fromFile(inputfilename);
+      }
+      return fgraph;
+    };
     for (unsigned i = 0; i != statModeList.size(); ++i) {
       switch (statModeList[i]) {
       case degreehist:
-        doDegreeHistogram(graph);
+        doDegreeHistogram(mapped());
         break;
       case degrees:
         doDegrees(graph);
@@ -255,10 +1022,10 @@ int main(int argc, char** argv) {
         findMaxDegreeNode(graph);
         break;
       case dsthist:
-        doDestinationHistogram(graph);
+        doDestinationHistogram(mapped());
         break;
       case indegreehist:
-        doInDegreeHistogram(graph);
+        doInDegreeHistogram(mapped());
         break;
       case sortedlogoffsethist:
         doSortedLogOffsetHistogram(graph);
@@ -278,6 +1045,24 @@ int main(int argc, char** argv) {
       case summary:
         doSummary(graph);
         break;
+      case clusteringCoefficient:
+        doClusteringCoefficient(mapped());
+        break;
+      case componentHist:
+        doComponentHistogram(mapped());
+        break;
+      case sccHist:
+        doSCCHistogram(mapped());
+        break;
+      case diameter:
+        doDiameter(mapped());
+        break;
+      case degeneracy:
+        doDegeneracy(mapped());
+        break;
+      case powerLaw:
+        doPowerLaw(mapped());
+        break;
       default:
         std::cerr << "Unknown stat requested\n";
         break;